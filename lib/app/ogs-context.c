@@ -175,9 +175,11 @@ static void app_context_prepare(void)
 
 #define MAX_NUM_OF_UE               1024    /* Num of UE per AMF/MME */
 #define MAX_NUM_OF_GNB              32      /* Num of gNB per AMF/MME */
+#define MAX_NUM_OF_CONCURRENT_STREAMS   100 /* HTTP/2 streams per SBI peer */
 
     self.max.gnb = MAX_NUM_OF_GNB;
     self.max.ue = MAX_NUM_OF_UE;
+    self.max.concurrent_streams = MAX_NUM_OF_CONCURRENT_STREAMS;
 
     ogs_pkbuf_default_init(&self.pool.defconfig);
 
@@ -235,6 +237,9 @@ int ogs_app_context_parse_config(void)
         ogs_assert(root_key);
         if (!strcmp(root_key, "db_uri")) {
             self.db_uri = ogs_yaml_iter_value(&root_iter);
+        } else if (!strcmp(root_key, "db_cache")) {
+            const char *v = ogs_yaml_iter_value(&root_iter);
+            if (v) self.db_cache = atoi(v);
         } else if (!strcmp(root_key, "logger")) {
             ogs_yaml_iter_t logger_iter;
             ogs_yaml_iter_recurse(&root_iter, &logger_iter);
@@ -249,6 +254,8 @@ int ogs_app_context_parse_config(void)
                 } else if (!strcmp(logger_key, "domain")) {
                     self.logger.domain =
                         ogs_yaml_iter_value(&logger_iter);
+                } else if (!strcmp(logger_key, "async")) {
+                    self.logger.async = ogs_yaml_iter_bool(&logger_iter);
                 }
             }
         } else if (!strcmp(root_key, "parameter")) {
@@ -314,6 +321,9 @@ int ogs_app_context_parse_config(void)
                 } else if (!strcmp(parameter_key, "no_slaac")) {
                     self.parameter.no_slaac =
                         ogs_yaml_iter_bool(&parameter_iter);
+                } else if (!strcmp(parameter_key, "http2")) {
+                    self.parameter.http2 =
+                        ogs_yaml_iter_bool(&parameter_iter);
                 } else
                     ogs_warn("unknown key `%s`", parameter_key);
             }
@@ -369,6 +379,9 @@ int ogs_app_context_parse_config(void)
                             !strcmp(max_key, "enb")) {
                     const char *v = ogs_yaml_iter_value(&max_iter);
                     if (v) self.max.gnb = atoi(v);
+                } else if (!strcmp(max_key, "concurrent_streams")) {
+                    const char *v = ogs_yaml_iter_value(&max_iter);
+                    if (v) self.max.concurrent_streams = atoi(v);
                 } else
                     ogs_warn("unknown key `%s`", max_key);
             }
@@ -453,6 +466,16 @@ int ogs_app_context_parse_config(void)
                         } else
                             ogs_warn("unknown key `%s`", sbi_key);
                     }
+                } else if (!strcmp(time_key, "timer")) {
+                    const char *v = ogs_yaml_iter_value(&time_iter);
+                    if (v) {
+                        if (!strcmp(v, "wheel"))
+                            self.time.timer = OGS_TIMER_MGR_WHEEL;
+                        else if (!strcmp(v, "rbtree"))
+                            self.time.timer = OGS_TIMER_MGR_RBTREE;
+                        else
+                            ogs_warn("unknown timer `%s`", v);
+                    }
                 } else if (!strcmp(time_key, "message")) {
                     ogs_yaml_iter_t msg_iter;
                     ogs_yaml_iter_recurse(&time_iter, &msg_iter);
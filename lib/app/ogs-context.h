@@ -35,10 +35,12 @@ typedef struct ogs_app_context_s {
     void *document;
 
     const char *db_uri;
+    int db_cache;       /* Num of cached subscriber profiles, 0: disabled */
     struct {
         const char *file;
         const char *level;
         const char *domain;
+        bool async;
     } logger;
 
     ogs_queue_t *queue;
@@ -69,6 +71,9 @@ typedef struct ogs_app_context_s {
         int prefer_ipv4;
         int multicast;
         int no_slaac;
+
+        /* SBI */
+        int http2;
     } parameter;
 
     ogs_sockopt_t sockopt;
@@ -79,6 +84,7 @@ typedef struct ogs_app_context_s {
     struct {
         uint64_t ue;
         uint64_t gnb;
+        uint64_t concurrent_streams;
     } max;
 
     struct {
@@ -106,6 +112,8 @@ typedef struct ogs_app_context_s {
     } pool;
 
     struct {
+        ogs_timer_mgr_type_e timer;
+
         struct {
             int heartbeat_interval;
             int no_heartbeat_margin;
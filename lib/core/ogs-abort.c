@@ -44,12 +44,19 @@ OGS_GNUC_NORETURN void ogs_abort(void)
         free(strings);
     }
 
+    /* The FATAL lines may still be queued for the async log writer */
+    ogs_log_async_flush();
+
     abort();
 #elif defined(_WIN32)
+    ogs_log_async_flush();
+
     DebugBreak();
     abort();
     ExitProcess(127);
 #else
+    ogs_log_async_flush();
+
     abort();
 #endif
 }
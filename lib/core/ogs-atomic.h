@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_CORE_INSIDE) && !defined(OGS_CORE_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_ATOMIC_H
+#define OGS_ATOMIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Atomic operations for the variables
+ * shared between the data-plane threads and the control thread
+ */
+#define ogs_atomic_load(__pTR) \
+    __atomic_load_n((__pTR), __ATOMIC_ACQUIRE)
+#define ogs_atomic_store(__pTR, __vAL) \
+    __atomic_store_n((__pTR), (__vAL), __ATOMIC_RELEASE)
+#define ogs_atomic_exchange(__pTR, __vAL) \
+    __atomic_exchange_n((__pTR), (__vAL), __ATOMIC_ACQ_REL)
+#define ogs_atomic_compare_exchange(__pTR, __eXPECTED, __dESIRED) \
+    __atomic_compare_exchange_n((__pTR), (__eXPECTED), (__dESIRED), \
+            0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+/* Orders a store before a later load of another variable */
+#define ogs_atomic_fence() \
+    __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/* Counters do not order other memory accesses */
+#define ogs_atomic_add(__pTR, __vAL) \
+    __atomic_add_fetch((__pTR), (__vAL), __ATOMIC_RELAXED)
+
+/* Reference counts; the last release sees all writes of the others */
+#define ogs_atomic_inc(__pTR) \
+    __atomic_add_fetch((__pTR), 1, __ATOMIC_RELAXED)
+#define ogs_atomic_dec(__pTR) \
+    __atomic_sub_fetch((__pTR), 1, __ATOMIC_ACQ_REL)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_ATOMIC_H */
@@ -29,6 +29,7 @@ static ogs_core_context_t self = {
     .log.pool = 8,
     .log.domain_pool = 64,
     .log.level = OGS_LOG_DEFAULT,
+    .log.ring_size = 256*1024,
 
     .pkbuf.pool = 8,
     .pkbuf.config_pool = 8,
@@ -38,6 +39,7 @@ static ogs_core_context_t self = {
 
 void ogs_core_initialize(void)
 {
+    ogs_mem_init();
     ogs_log_init();
     ogs_pkbuf_init();
     ogs_socket_init();
@@ -53,9 +55,15 @@ void ogs_core_initialize(void)
 
 void ogs_core_terminate(void)
 {
+    ogs_thread_run_at_exit();
+
+    /* The rings live in ogs_malloc() memory; later warnings go out directly */
+    ogs_log_async_stop();
+
     ogs_tlv_final();
     ogs_socket_final();
     ogs_pkbuf_final();
+    ogs_mem_final();
     ogs_log_final();
 }
 
@@ -26,6 +26,7 @@
 
 #include "core/ogs-compat.h"
 #include "core/ogs-macros.h"
+#include "core/ogs-atomic.h"
 #include "core/ogs-list.h"
 #include "core/ogs-pool.h"
 #include "core/ogs-abort.h"
@@ -79,6 +80,7 @@ typedef struct {
         int pool;
         int domain_pool;
         ogs_log_level_e level;
+        int ring_size;  /* per-thread buffer of the asynchronous writer */
     } log;
 
     struct {
@@ -50,13 +50,38 @@ struct epoll_map_s {
     ogs_poll_t *write;
 };
 
+/*
+ * File descriptors are small dense integers, so the read/write polls
+ * sharing one epoll registration are found by indexing map[] with the fd.
+ * The table grows on demand; epoll_event.data carries the fd rather than
+ * a pointer into it.
+ */
 struct epoll_context_s {
     int epfd;
 
-    ogs_hash_t *map_hash;
+    struct epoll_map_s *map;
+    int map_size;
 	struct epoll_event *event_list;
 };
 
+static struct epoll_map_s *epoll_map(
+        struct epoll_context_s *context, ogs_socket_t fd)
+{
+    ogs_assert(fd >= 0);
+
+    if (fd >= context->map_size) {
+        int size = ogs_max(context->map_size * 2, fd + 1);
+
+        context->map = ogs_realloc(context->map, size * sizeof(*context->map));
+        ogs_assert(context->map);
+        memset(context->map + context->map_size, 0,
+                (size - context->map_size) * sizeof(*context->map));
+        context->map_size = size;
+    }
+
+    return &context->map[fd];
+}
+
 static void epoll_init(ogs_pollset_t *pollset)
 {
     struct epoll_context_s *context = NULL;
@@ -70,8 +95,9 @@ static void epoll_init(ogs_pollset_t *pollset)
             pollset->capacity, sizeof(struct epoll_event));
 	ogs_assert(context->event_list);
 
-    context->map_hash = ogs_hash_make();
-    ogs_assert(context->map_hash);
+    context->map_size = pollset->capacity;
+    context->map = ogs_calloc(context->map_size, sizeof(*context->map));
+    ogs_assert(context->map);
 
     context->epfd = epoll_create(pollset->capacity);
     ogs_assert(context->epfd >= 0);
@@ -90,7 +116,7 @@ static void epoll_cleanup(ogs_pollset_t *pollset)
     ogs_notify_final(pollset);
     close(context->epfd);
 	ogs_free(context->event_list);
-    ogs_hash_destroy(context->map_hash);
+    ogs_free(context->map);
 
     ogs_free(context);
 }
@@ -109,16 +135,11 @@ static int epoll_add(ogs_poll_t *poll)
     context = pollset->context;
     ogs_assert(context);
 
-    map = ogs_hash_get(context->map_hash, &poll->fd, sizeof(poll->fd));
-    if (!map) {
-        map = ogs_calloc(1, sizeof(*map));
-        ogs_assert(map);
-
+    map = epoll_map(context, poll->fd);
+    if (!map->read && !map->write)
         op = EPOLL_CTL_ADD;
-        ogs_hash_set(context->map_hash, &poll->fd, sizeof(poll->fd), map);
-    } else {
+    else
         op = EPOLL_CTL_MOD;
-    }
 
     if (poll->when & OGS_POLLIN)
         map->read = poll;
@@ -130,7 +151,8 @@ static int epoll_add(ogs_poll_t *poll)
         ee.events |= (EPOLLIN|EPOLLRDHUP);
     if (map->write)
         ee.events |= EPOLLOUT;
-    ee.data.ptr = map;
+    ee.data.u64 = 0;
+    ee.data.fd = poll->fd;
 
     rv = epoll_ctl(context->epfd, op, poll->fd, &ee);
     if (rv < 0) {
@@ -156,8 +178,8 @@ static int epoll_remove(ogs_poll_t *poll)
     context = pollset->context;
     ogs_assert(context);
 
-    map = ogs_hash_get(context->map_hash, &poll->fd, sizeof(poll->fd));
-    ogs_assert(map);
+    ogs_assert(poll->fd >= 0 && poll->fd < context->map_size);
+    map = &context->map[poll->fd];
 
     if (poll->when & OGS_POLLIN)
         map->read = NULL;
@@ -170,16 +192,13 @@ static int epoll_remove(ogs_poll_t *poll)
     if (map->write)
         ee.events |= EPOLLOUT;
 
-    if (map->read || map->write) {
+    ee.data.u64 = 0;
+    ee.data.fd = poll->fd;
+
+    if (map->read || map->write)
         op = EPOLL_CTL_MOD;
-        ee.data.ptr = map;
-    } else {
+    else
         op = EPOLL_CTL_DEL;
-        ee.data.ptr = NULL;
-
-        ogs_free(map);
-        ogs_hash_set(context->map_hash, &poll->fd, sizeof(poll->fd), NULL);
-    }
 
     rv = epoll_ctl(context->epfd, op, poll->fd, &ee);
     if (rv < 0) {
@@ -213,7 +232,8 @@ static int epoll_process(ogs_pollset_t *pollset, ogs_time_t timeout)
     }
 
 	for (i = 0; i < num_of_poll; i++) {
-        struct epoll_map_s *map = NULL;
+        ogs_poll_t *read = NULL, *write = NULL;
+        ogs_socket_t fd;
 		uint32_t received;
         short when = 0;
 
@@ -232,16 +252,25 @@ static int epoll_process(ogs_pollset_t *pollset, ogs_time_t timeout)
         if (!when)
             continue;
 
-        map = context->event_list[i].data.ptr;
-        ogs_assert(map);
+        /*
+         * A handler earlier in this batch may have removed the poll
+         * or grown the table, so look the fd up again every time.
+         */
+        fd = context->event_list[i].data.fd;
+        if (fd >= context->map_size)
+            continue;
+
+        read = context->map[fd].read;
+        write = context->map[fd].write;
 
-        if (map->read && map->write && map->read == map->write) {
-            map->read->handler(when, map->read->fd, map->read->data);
+        if (read && write && read == write) {
+            read->handler(when, read->fd, read->data);
         } else {
-            if (map->read && (when & OGS_POLLIN))
-                map->read->handler(when, map->read->fd, map->read->data);
-            if (map->write && (when & OGS_POLLOUT))
-                map->write->handler(when, map->write->fd, map->write->data);
+            if (read && (when & OGS_POLLIN))
+                read->handler(when, read->fd, read->data);
+            if (context->map[fd].write == write &&
+                    write && (when & OGS_POLLOUT))
+                write->handler(when, write->fd, write->data);
         }
     }
     
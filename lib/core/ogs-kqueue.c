@@ -205,7 +205,9 @@ static int kqueue_process(ogs_pollset_t *pollset, ogs_time_t timeout)
         } else if (context->event_list[i].filter == EVFILT_WRITE) {
             when |= OGS_POLLOUT;
         } else if (context->event_list[i].filter == EVFILT_USER) {
-            /* Nothing */
+            /* Notification consumed; see ogs_drain_pollset() */
+            ogs_atomic_store(&pollset->notify.armed, 1);
+            ogs_atomic_fence();
         } else {
             ogs_warn("kevent() unknown filter = 0x%x\n",
                 context->event_list[i].filter);
@@ -246,6 +248,8 @@ static void kqueue_notify_init(ogs_pollset_t *pollset)
 
     rc = kevent(context->kqueue, &kev, 1, NULL, 0, &timeout);
     ogs_assert(rc != -1);
+
+    pollset->notify.armed = 1;
 }
 
 static int kqueue_notify_pollset(ogs_pollset_t *pollset)
@@ -260,6 +264,10 @@ static int kqueue_notify_pollset(ogs_pollset_t *pollset)
     context = pollset->context;
     ogs_assert(context);
 
+    ogs_atomic_fence();
+    if (!ogs_atomic_exchange(&pollset->notify.armed, 0))
+        return OGS_OK;
+
     memset(&kev, 0, sizeof kev);
     kev.ident = NOTIFY_IDENT;
 	kev.filter = EVFILT_USER;
@@ -268,6 +276,7 @@ static int kqueue_notify_pollset(ogs_pollset_t *pollset)
     rc = kevent(context->kqueue, &kev, 1, NULL, 0, &timeout);
     if (rc == -1) {
         ogs_warn("kevent() failed");
+        ogs_atomic_store(&pollset->notify.armed, 1);
         return OGS_ERROR;
     }
 
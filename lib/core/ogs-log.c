@@ -27,6 +27,21 @@
 #include <stdarg.h>
 #endif
 
+#if HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#if !HAVE_SYS_UIO_H
+struct iovec {
+    void *iov_base;
+    size_t iov_len;
+};
+#endif
+
 #include "ogs-core.h"
 
 #define TA_NOR              "\033[0m"       /* all off */
@@ -95,6 +110,56 @@ static OGS_LIST(log_list);
 static OGS_POOL(domain_pool, ogs_log_domain_t);
 static OGS_LIST(domain_list);
 
+uint8_t ogs_log_level_cache[OGS_LOG_MAX_NUM_OF_DOMAIN+1];
+
+/*
+ * Single-producer/single-consumer byte ring owned by one logging thread.
+ * head and tail are free-running; records are padded to
+ * OGS_LOG_RECORD_ALIGN so that a record header never wraps.
+ */
+typedef struct ogs_log_ring_s {
+    ogs_lnode_t node;
+
+    uint32_t head;          /* advanced by the owning thread */
+    uint32_t tail;          /* advanced by the writer */
+    uint32_t size;
+    uint8_t *buf;
+} ogs_log_ring_t;
+
+typedef struct ogs_log_record_s {
+    ogs_log_t *log;         /* NULL : padding up to the end of the ring */
+    uint32_t len;
+} ogs_log_record_t;
+
+#define OGS_LOG_RECORD_ALIGN 16
+#define OGS_LOG_RECORD_SIZE(__lEN) \
+    (((sizeof(ogs_log_record_t) + (__lEN)) + OGS_LOG_RECORD_ALIGN - 1) & \
+     ~(OGS_LOG_RECORD_ALIGN - 1))
+
+#define OGS_LOG_MAX_IOV 64
+#define OGS_LOG_BACKPRESSURE_TRY 100
+
+static struct {
+    bool enabled;
+    bool running;
+    uint32_t generation;
+    uint64_t dropped;
+    uint32_t users;             /* threads inside async_push() or flush */
+
+    ogs_thread_t *thread;
+    ogs_thread_mutex_t mutex;   /* ring list, consumer side and files */
+    ogs_thread_cond_t cond;
+
+    ogs_list_t ring_list;
+} async;
+
+static ogs_thread_local ogs_log_ring_t *thread_ring;
+static ogs_thread_local uint32_t thread_ring_generation;
+static ogs_thread_local bool thread_is_writer;
+
+static bool async_push(ogs_log_t *log, ogs_log_level_e level,
+        const char *string);
+
 static ogs_log_t *add_log(ogs_log_type_e type);
 static int file_cycle(ogs_log_t *log);
 
@@ -111,8 +176,16 @@ static char *log_linefeed(char *buf, char *last);
 static void file_writer(
         ogs_log_t *log, ogs_log_level_e level, const char *string);
 
+static void set_domain_level(ogs_log_domain_t *domain, ogs_log_level_e level)
+{
+    domain->level = level;
+    ogs_log_level_cache[domain->id] = level;
+}
+
 void ogs_log_init(void)
 {
+    ogs_assert(ogs_core()->log.domain_pool <= OGS_LOG_MAX_NUM_OF_DOMAIN);
+
     ogs_pool_init(&log_pool, ogs_core()->log.pool);
     ogs_pool_init(&domain_pool, ogs_core()->log.domain_pool);
 
@@ -125,6 +198,8 @@ void ogs_log_final(void)
     ogs_log_t *log, *saved_log;
     ogs_log_domain_t *domain, *saved_domain;
 
+    ogs_log_async_stop();
+
     ogs_list_for_each_safe(&log_list, saved_log, log)
         ogs_log_remove(log);
     ogs_pool_final(&log_pool);
@@ -141,7 +216,13 @@ void ogs_log_cycle(void)
     ogs_list_for_each(&log_list, log) {
         switch(log->type) {
         case OGS_LOG_FILE_TYPE:
-            file_cycle(log);
+            if (ogs_atomic_load(&async.enabled)) {
+                ogs_thread_mutex_lock(&async.mutex);
+                file_cycle(log);
+                ogs_thread_mutex_unlock(&async.mutex);
+            } else {
+                file_cycle(log);
+            }
         default:
             break;
         }
@@ -189,6 +270,8 @@ void ogs_log_remove(ogs_log_t *log)
 {
     ogs_assert(log);
 
+    ogs_log_async_flush();
+
     ogs_list_remove(&log_list, log);
 
     if (log->type == OGS_LOG_FILE_TYPE) {
@@ -211,7 +294,7 @@ ogs_log_domain_t *ogs_log_add_domain(const char *name, ogs_log_level_e level)
 
     domain->name = name;
     domain->id = ogs_pool_index(&domain_pool, domain);
-    domain->level = level;
+    set_domain_level(domain, level);
 
     ogs_list_add(&domain_list, domain);
 
@@ -235,6 +318,8 @@ void ogs_log_remove_domain(ogs_log_domain_t *domain)
 {
     ogs_assert(domain);
 
+    ogs_log_level_cache[domain->id] = OGS_LOG_NONE;
+
     ogs_list_remove(&domain_list, domain);
     ogs_pool_free(&domain_pool, domain);
 }
@@ -248,7 +333,7 @@ void ogs_log_set_domain_level(int id, ogs_log_level_e level)
     domain = ogs_pool_find(&domain_pool, id);
     ogs_assert(domain);
 
-    domain->level = level;
+    set_domain_level(domain, level);
 }
 
 ogs_log_level_e ogs_log_get_domain_level(int id)
@@ -330,13 +415,13 @@ void ogs_log_set_mask_level(const char *_mask, ogs_log_level_e level)
 
             domain = ogs_log_find_domain(name);
             if (domain)
-                domain->level = level;
+                set_domain_level(domain, level);
         }
 
         ogs_free(mask);
     } else {
         ogs_list_for_each(&domain_list, domain)
-            domain->level = level;
+            set_domain_level(domain, level);
     }
 }
 
@@ -388,7 +473,7 @@ void ogs_log_vprintf(ogs_log_level_e level, int id,
 
     int wrote_stderr = 0;
 
-    ogs_list_for_each(&log_list, log) {
+    if (ogs_list_first(&log_list)) {
         domain = ogs_pool_find(&domain_pool, id);
         if (!domain) {
             fprintf(stderr, "No LogDomain[id:%d] in %s:%d", id, file, line);
@@ -396,7 +481,9 @@ void ogs_log_vprintf(ogs_log_level_e level, int id,
         }
         if (domain->level < level)
             return;
+    }
 
+    ogs_list_for_each(&log_list, log) {
         p = logstr;
         last = logstr + OGS_HUGE_LEN;
 
@@ -426,7 +513,9 @@ void ogs_log_vprintf(ogs_log_level_e level, int id,
                 p = log_linefeed(p, last);
         }
 
-        log->writer(log, level, logstr);
+        if (!ogs_atomic_load(&async.enabled) ||
+            !async_push(log, level, logstr))
+            log->writer(log, level, logstr);
         
         if (log->type == OGS_LOG_STDERR_TYPE)
             wrote_stderr = 1;
@@ -623,3 +712,288 @@ static void file_writer(
     fflush(log->file.out);
 }
 
+
+static void async_write(ogs_log_t *log, struct iovec *iov, int iovcnt)
+{
+#if HAVE_SYS_UIO_H
+    int fd = fileno(log->file.out);
+    ssize_t n;
+
+    while (iovcnt) {
+        n = writev(fd, iov, iovcnt);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+        while (iovcnt && (size_t)n >= iov->iov_len) {
+            n -= iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt) {
+            iov->iov_base = (char *)iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+    }
+#else
+    int i;
+
+    for (i = 0; i < iovcnt; i++)
+        fwrite(iov[i].iov_base, 1, iov[i].iov_len, log->file.out);
+    fflush(log->file.out);
+#endif
+}
+
+/* Must be called with async.mutex held */
+static void async_drain(void)
+{
+    ogs_log_ring_t *ring = NULL;
+    struct iovec iov[OGS_LOG_MAX_IOV];
+
+    ogs_list_for_each(&async.ring_list, ring) {
+        uint32_t head = ogs_atomic_load(&ring->head);
+        uint32_t tail = ring->tail;
+        ogs_log_t *log = NULL;
+        int iovcnt = 0;
+
+        while (tail != head) {
+            ogs_log_record_t *record = (ogs_log_record_t *)
+                (ring->buf + (tail & (ring->size - 1)));
+
+            if (iovcnt &&
+                (record->log != log || iovcnt == OGS_LOG_MAX_IOV)) {
+                async_write(log, iov, iovcnt);
+                iovcnt = 0;
+                ogs_atomic_store(&ring->tail, tail);
+            }
+
+            if (record->log) {
+                log = record->log;
+                iov[iovcnt].iov_base = record + 1;
+                iov[iovcnt].iov_len = record->len;
+                iovcnt++;
+            }
+
+            tail += OGS_LOG_RECORD_SIZE(record->len);
+        }
+
+        if (iovcnt)
+            async_write(log, iov, iovcnt);
+        ogs_atomic_store(&ring->tail, tail);
+    }
+}
+
+static void async_main(void *data)
+{
+    thread_is_writer = true;
+
+    ogs_thread_mutex_lock(&async.mutex);
+    while (ogs_atomic_load(&async.running)) {
+        async_drain();
+        ogs_thread_cond_timedwait(
+                &async.cond, &async.mutex, ogs_time_from_msec(10));
+    }
+    async_drain();
+    ogs_thread_mutex_unlock(&async.mutex);
+}
+
+static ogs_log_ring_t *async_ring(void)
+{
+    ogs_log_ring_t *ring = NULL;
+    uint32_t generation = ogs_atomic_load(&async.generation);
+
+    if (thread_ring && thread_ring_generation == generation)
+        return thread_ring;
+
+    ring = ogs_calloc(1, sizeof *ring);
+    ogs_assert(ring);
+    ring->size = ogs_core()->log.ring_size;
+    ring->buf = ogs_malloc(ring->size);
+    ogs_assert(ring->buf);
+
+    ogs_thread_mutex_lock(&async.mutex);
+    ogs_list_add(&async.ring_list, ring);
+    ogs_thread_mutex_unlock(&async.mutex);
+
+    thread_ring = ring;
+    thread_ring_generation = generation;
+
+    return ring;
+}
+
+/*
+ * ogs_log_async_stop() frees the rings once no thread is inside here.
+ * A thread that comes in after async.enabled is cleared backs out and
+ * writes synchronously instead.
+ */
+static bool async_enter(void)
+{
+    ogs_atomic_inc(&async.users);
+    ogs_atomic_fence();
+
+    if (!ogs_atomic_load(&async.enabled)) {
+        ogs_atomic_dec(&async.users);
+        return false;
+    }
+
+    return true;
+}
+
+static void async_leave(void)
+{
+    ogs_atomic_dec(&async.users);
+}
+
+static void async_push_ring(ogs_log_t *log, ogs_log_level_e level,
+        const char *string)
+{
+    ogs_log_ring_t *ring = async_ring();
+    ogs_log_record_t *record = NULL;
+    uint32_t len = strlen(string);
+    uint32_t need = OGS_LOG_RECORD_SIZE(len);
+    uint32_t head = ring->head, offset, contig, used;
+    int tries = 0;
+
+    offset = head & (ring->size - 1);
+    contig = ring->size - offset;
+    if (contig < need)
+        need += contig;
+
+    for ( ;; ) {
+        used = head - ogs_atomic_load(&ring->tail);
+        if (ring->size - used >= need)
+            break;
+
+        if (level > OGS_LOG_ERROR || tries++ == OGS_LOG_BACKPRESSURE_TRY) {
+            /* A crash reason is never dropped, even out of order */
+            if (level == OGS_LOG_FATAL) {
+                log->writer(log, level, string);
+                return;
+            }
+            ogs_atomic_add(&async.dropped, 1);
+            return;
+        }
+        ogs_thread_cond_signal(&async.cond);
+        ogs_usleep(100);
+    }
+
+    if (contig < OGS_LOG_RECORD_SIZE(len)) {
+        record = (ogs_log_record_t *)(ring->buf + offset);
+        record->log = NULL;
+        record->len = contig - sizeof(ogs_log_record_t);
+        head += contig;
+        offset = 0;
+    }
+
+    record = (ogs_log_record_t *)(ring->buf + offset);
+    record->log = log;
+    record->len = len;
+    memcpy(record + 1, string, len);
+    head += OGS_LOG_RECORD_SIZE(len);
+
+    ogs_atomic_store(&ring->head, head);
+
+    if (level <= OGS_LOG_ERROR || used + need > ring->size / 2)
+        ogs_thread_cond_signal(&async.cond);
+}
+
+static bool async_push(ogs_log_t *log, ogs_log_level_e level,
+        const char *string)
+{
+    if (!async_enter())
+        return false;
+
+    async_push_ring(log, level, string);
+    async_leave();
+
+    return true;
+}
+
+int ogs_log_async_start(void)
+{
+    int size = ogs_core()->log.ring_size;
+
+    if (ogs_atomic_load(&async.enabled))
+        return OGS_OK;
+
+    if (size < 4 * OGS_HUGE_LEN || (size & (size - 1))) {
+        ogs_error("Invalid log ring size [%d]", size);
+        return OGS_ERROR;
+    }
+
+    ogs_thread_mutex_init(&async.mutex);
+    ogs_thread_cond_init(&async.cond);
+    ogs_list_init(&async.ring_list);
+
+    async.generation++;
+    ogs_atomic_store(&async.running, true);
+
+    async.thread = ogs_thread_create(async_main, NULL);
+    ogs_assert(async.thread);
+
+    ogs_atomic_store(&async.enabled, true);
+
+    return OGS_OK;
+}
+
+void ogs_log_async_stop(void)
+{
+    ogs_log_ring_t *ring = NULL, *next_ring = NULL;
+
+    if (!ogs_atomic_load(&async.enabled))
+        return;
+
+    ogs_atomic_store(&async.enabled, false);
+
+    /* The writer keeps draining so a thread under backpressure gets out */
+    ogs_atomic_fence();
+    while (ogs_atomic_load(&async.users))
+        ogs_usleep(100);
+
+    ogs_thread_mutex_lock(&async.mutex);
+    ogs_atomic_store(&async.running, false);
+    ogs_thread_cond_signal(&async.cond);
+    ogs_thread_mutex_unlock(&async.mutex);
+
+    ogs_thread_destroy(async.thread);
+    async.thread = NULL;
+
+    ogs_list_for_each_safe(&async.ring_list, next_ring, ring) {
+        ogs_list_remove(&async.ring_list, ring);
+        ogs_free(ring->buf);
+        ogs_free(ring);
+    }
+
+    ogs_thread_cond_destroy(&async.cond);
+    ogs_thread_mutex_destroy(&async.mutex);
+
+    if (async.dropped)
+        ogs_warn("%llu log messages dropped",
+                (unsigned long long)async.dropped);
+    async.dropped = 0;
+}
+
+void ogs_log_async_flush(void)
+{
+    if (!ogs_atomic_load(&async.enabled))
+        return;
+
+    /* The writer thread already holds the mutex while draining */
+    if (thread_is_writer)
+        return;
+
+    if (!async_enter())
+        return;
+
+    ogs_thread_mutex_lock(&async.mutex);
+    async_drain();
+    ogs_thread_mutex_unlock(&async.mutex);
+
+    async_leave();
+}
+
+uint64_t ogs_log_async_dropped(void)
+{
+    return ogs_atomic_load(&async.dropped);
+}
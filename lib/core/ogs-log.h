@@ -32,6 +32,30 @@ extern "C" {
 #define OGS_LOG_DOMAIN      1
 #endif
 
+/*
+ * Messages more verbose than OGS_LOG_MAX_LEVEL are compiled out, arguments
+ * included. Build with -DOGS_LOG_MAX_LEVEL=OGS_LOG_INFO (or define it before
+ * including ogs-core.h) to strip debug/trace from hot paths.
+ */
+#ifndef OGS_LOG_MAX_LEVEL
+#define OGS_LOG_MAX_LEVEL   OGS_LOG_TRACE
+#endif
+
+/*
+ * Cached per-domain level so that debug/trace arguments are evaluated
+ * only when the message is going to be written. Levels up to INFO are
+ * always passed to ogs_log_printf() so that they are never lost
+ * before the domain is installed.
+ */
+#define OGS_LOG_MAX_NUM_OF_DOMAIN 256
+extern uint8_t ogs_log_level_cache[OGS_LOG_MAX_NUM_OF_DOMAIN+1];
+
+#define ogs_log_enabled(level, id) \
+    ((level) <= OGS_LOG_MAX_LEVEL && \
+     ((level) <= OGS_LOG_INFO || \
+      ((unsigned int)(id) <= OGS_LOG_MAX_NUM_OF_DOMAIN && \
+       (level) <= ogs_log_level_cache[(unsigned int)(id)])))
+
 #define ogs_fatal(...) ogs_log_message(OGS_LOG_FATAL, 0, __VA_ARGS__)
 #define ogs_error(...) ogs_log_message(OGS_LOG_ERROR, 0, __VA_ARGS__)
 #define ogs_warn(...) ogs_log_message(OGS_LOG_WARN, 0, __VA_ARGS__)
@@ -40,17 +64,26 @@ extern "C" {
 #define ogs_trace(...) ogs_log_message(OGS_LOG_TRACE, 0, __VA_ARGS__)
 
 #define ogs_log_message(level, err, ...) \
-    ogs_log_printf(level, OGS_LOG_DOMAIN, \
-    err, __FILE__, __LINE__, OGS_FUNC,  \
-    0, __VA_ARGS__) 
+    do { \
+        if (ogs_log_enabled(level, OGS_LOG_DOMAIN)) \
+            ogs_log_printf(level, OGS_LOG_DOMAIN, \
+                    err, __FILE__, __LINE__, OGS_FUNC,  \
+                    0, __VA_ARGS__); \
+    } while (0)
 
 #define ogs_log_print(level, ...) \
-    ogs_log_printf(level, OGS_LOG_DOMAIN, \
-    0, NULL, 0, NULL,  \
-    1, __VA_ARGS__) 
+    do { \
+        if (ogs_log_enabled(level, OGS_LOG_DOMAIN)) \
+            ogs_log_printf(level, OGS_LOG_DOMAIN, \
+                    0, NULL, 0, NULL,  \
+                    1, __VA_ARGS__); \
+    } while (0)
 
 #define ogs_log_hexdump(level, _d, _l) \
-    ogs_log_hexdump_func(level, OGS_LOG_DOMAIN, _d, _l)
+    do { \
+        if (ogs_log_enabled(level, OGS_LOG_DOMAIN)) \
+            ogs_log_hexdump_func(level, OGS_LOG_DOMAIN, _d, _l); \
+    } while (0)
 
 typedef enum {
     OGS_LOG_NONE,
@@ -91,6 +124,19 @@ int ogs_log_config_domain(const char *domain, const char *level);
 
 void ogs_log_set_mask_level(const char *mask, ogs_log_level_e level);
 
+/*
+ * Asynchronous mode: formatted lines are queued in a per-thread ring and
+ * written by a dedicated thread. When a ring is full, ERROR and FATAL
+ * wait for the writer for a short while (FATAL is then written directly);
+ * other levels are dropped and counted. ogs_log_async_stop() drains the rings and must be called when
+ * no other thread is logging (ogs_log_final() does it).
+ * ogs_abort() calls ogs_log_async_flush() so the crash reason is written.
+ */
+int ogs_log_async_start(void);
+void ogs_log_async_stop(void);
+void ogs_log_async_flush(void);
+uint64_t ogs_log_async_dropped(void);
+
 void ogs_log_vprintf(ogs_log_level_e level, int id,
     ogs_err_t err, const char *file, int line, const char *func,
     int content_only, const char *format, va_list ap);
@@ -22,36 +22,355 @@
 #undef OGS_LOG_DOMAIN
 #define OGS_LOG_DOMAIN __ogs_mem_domain
 
+/*
+ * Slab allocator for ogs_malloc()
+ *
+ * Four size classes per power of two up to OGS_MEM_MAX_SLAB_SIZE.
+ * Each class carves objects out of OGS_MEM_SLAB_SIZE chunks and keeps
+ * the free ones in a list. Larger requests go to malloc() directly.
+ *
+ * Every thread keeps a short free list per class which is refilled and
+ * drained in bulk from the shared one, as the pkbuf pool does.
+ */
+#define OGS_MEM_SLAB_SIZE       (64*1024)
+#define OGS_MEM_MAX_SLAB_SIZE   16384
+#define OGS_MEM_MIN_SLAB_OBJECT 4
+#define OGS_MEM_CACHE_SIZE      (32*1024)
+#define OGS_MEM_MAX_CACHE       64
+
+#define OGS_MEM_MAGIC           0x6f67736d
+
+static const size_t mem_class_size[OGS_MEM_NUM_OF_CLASS] = {
+    16, 32, 48, 64, 80, 96, 112, 128,
+    160, 192, 224, 256, 320, 384, 448, 512,
+    640, 768, 896, 1024, 1280, 1536, 1792, 2048,
+    2560, 3072, 3584, 4096, 5120, 6144, 7168, 8192,
+    10240, 12288, 14336, 16384,
+};
+OGS_STATIC_ASSERT(OGS_MEM_MAX_SLAB_SIZE == 16384);
+
+/* Keeps the user data aligned to 16 bytes */
+typedef struct ogs_mem_header_s {
+    size_t size;
+    uint32_t class;
+    uint32_t magic;
+} ogs_mem_header_t;
+OGS_STATIC_ASSERT(sizeof(ogs_mem_header_t) == 16);
+
+typedef struct ogs_mem_object_s {
+    ogs_mem_header_t header;
+    struct ogs_mem_object_s *next;
+} ogs_mem_object_t;
+
+typedef struct ogs_mem_slab_s {
+    struct ogs_mem_slab_s *next;
+    size_t padding;
+} ogs_mem_slab_t;
+
+typedef struct ogs_mem_class_s {
+    ogs_thread_mutex_t mutex;
+
+    size_t size;
+    int num_of_object;          /* per slab */
+    int cache_max;              /* per thread */
+
+    ogs_mem_slab_t *slab;
+    ogs_mem_object_t *free;
+
+    unsigned long num_of_slab;
+    unsigned long in_use;
+    unsigned long total;
+} ogs_mem_class_t;
+
+static ogs_mem_class_t mem_class[OGS_MEM_NUM_OF_CLASS];
+static struct {
+    unsigned long in_use;
+    unsigned long total;
+} mem_large;
+static unsigned int mem_generation = 0;
+
+/* Reset when ogs_mem_final() releases the slabs */
+static ogs_thread_local struct {
+    ogs_mem_object_t *free;
+    int num;
+    unsigned int generation;
+} thread_cache[OGS_MEM_NUM_OF_CLASS];
+static ogs_thread_local bool thread_cache_armed;
+
+static int mem_class_find(size_t size)
+{
+    int low = 0, high = OGS_MEM_NUM_OF_CLASS - 1, mid;
+
+    while (low < high) {
+        mid = (low + high) / 2;
+        if (mem_class_size[mid] < size)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return low;
+}
+
+/* Called with class->mutex held */
+static void mem_slab_alloc(ogs_mem_class_t *class)
+{
+    ogs_mem_slab_t *slab = NULL;
+    ogs_mem_object_t *object = NULL;
+    size_t stride;
+    int i;
+
+    stride = sizeof(ogs_mem_header_t) + class->size;
+
+    slab = malloc(sizeof(*slab) + stride * class->num_of_object);
+    ogs_assert(slab);
+
+    slab->next = class->slab;
+    class->slab = slab;
+    class->num_of_slab++;
+
+    for (i = 0; i < class->num_of_object; i++) {
+        object = (ogs_mem_object_t *)
+            ((unsigned char *)(slab + 1) + stride * i);
+        object->next = class->free;
+        class->free = object;
+    }
+}
+
+void ogs_mem_init(void)
+{
+    ogs_mem_class_t *class = NULL;
+    int i;
+
+    for (i = 0; i < OGS_MEM_NUM_OF_CLASS; i++) {
+        class = &mem_class[i];
+        memset(class, 0, sizeof(*class));
+
+        ogs_thread_mutex_init(&class->mutex);
+
+        class->size = mem_class_size[i];
+        class->num_of_object = ogs_max(OGS_MEM_MIN_SLAB_OBJECT,
+                OGS_MEM_SLAB_SIZE / (sizeof(ogs_mem_header_t) + class->size));
+        class->cache_max = ogs_max(1, ogs_min(OGS_MEM_MAX_CACHE,
+                    (int)(OGS_MEM_CACHE_SIZE / class->size)));
+    }
+    memset(&mem_large, 0, sizeof(mem_large));
+
+    ogs_atomic_inc(&mem_generation);
+}
+
+void ogs_mem_final(void)
+{
+    ogs_mem_class_t *class = NULL;
+    ogs_mem_slab_t *slab = NULL;
+    int i;
+
+    for (i = 0; i < OGS_MEM_NUM_OF_CLASS; i++) {
+        class = &mem_class[i];
+
+        if (class->in_use)
+            ogs_error("%lu in 'ogs_malloc[%d]' were not released.",
+                    class->in_use, (int)class->size);
+
+        while (class->slab) {
+            slab = class->slab;
+            class->slab = slab->next;
+            free(slab);
+        }
+        class->free = NULL;
+
+        ogs_thread_mutex_destroy(&class->mutex);
+    }
+
+    if (mem_large.in_use)
+        ogs_error("%lu in 'ogs_malloc[large]' were not released.",
+                mem_large.in_use);
+
+    /* Drop the objects left in the caches of all threads */
+    ogs_atomic_inc(&mem_generation);
+}
+
+void ogs_mem_stat(ogs_mem_stat_t stat[OGS_MEM_NUM_OF_CLASS+1])
+{
+    ogs_mem_class_t *class = NULL;
+    int i;
+
+    ogs_assert(stat);
+
+    for (i = 0; i < OGS_MEM_NUM_OF_CLASS; i++) {
+        class = &mem_class[i];
+
+        stat[i].size = class->size;
+        ogs_thread_mutex_lock(&class->mutex);
+        stat[i].num_of_slab = class->num_of_slab;
+        ogs_thread_mutex_unlock(&class->mutex);
+        stat[i].in_use = ogs_atomic_load(&class->in_use);
+        stat[i].total = ogs_atomic_load(&class->total);
+    }
+
+    stat[i].size = 0;
+    stat[i].num_of_slab = 0;
+    stat[i].in_use = ogs_atomic_load(&mem_large.in_use);
+    stat[i].total = ogs_atomic_load(&mem_large.total);
+}
+
+/* Gives the objects cached by an exiting thread back to the classes */
+static void thread_cache_drain(void)
+{
+    ogs_mem_class_t *class = NULL;
+    ogs_mem_object_t *object = NULL;
+    unsigned int generation;
+    int i;
+
+    generation = ogs_atomic_load(&mem_generation);
+    for (i = 0; i < OGS_MEM_NUM_OF_CLASS; i++) {
+        if (thread_cache[i].generation == generation &&
+            thread_cache[i].free) {
+            class = &mem_class[i];
+
+            ogs_thread_mutex_lock(&class->mutex);
+            while ((object = thread_cache[i].free) != NULL) {
+                thread_cache[i].free = object->next;
+
+                object->next = class->free;
+                class->free = object;
+            }
+            ogs_thread_mutex_unlock(&class->mutex);
+        }
+
+        thread_cache[i].free = NULL;
+        thread_cache[i].num = 0;
+        thread_cache[i].generation = 0;
+    }
+
+    thread_cache_armed = false;
+}
+
+static void thread_cache_check(int i)
+{
+    unsigned int generation;
+
+    generation = ogs_atomic_load(&mem_generation);
+    if (thread_cache[i].generation != generation) {
+        thread_cache[i].free = NULL;
+        thread_cache[i].num = 0;
+        thread_cache[i].generation = generation;
+
+        if (!thread_cache_armed) {
+            ogs_thread_at_exit(thread_cache_drain);
+            thread_cache_armed = true;
+        }
+    }
+}
+
+static ogs_mem_object_t *mem_object_alloc(int i)
+{
+    ogs_mem_class_t *class = &mem_class[i];
+    ogs_mem_object_t *object = NULL;
+    int batch;
+
+    thread_cache_check(i);
+
+    if (!thread_cache[i].free) {
+        batch = ogs_max(class->cache_max / 2, 1);
+
+        ogs_thread_mutex_lock(&class->mutex);
+        while (batch--) {
+            if (!class->free)
+                mem_slab_alloc(class);
+            object = class->free;
+            class->free = object->next;
+
+            object->next = thread_cache[i].free;
+            thread_cache[i].free = object;
+            thread_cache[i].num++;
+        }
+        ogs_thread_mutex_unlock(&class->mutex);
+    }
+
+    object = thread_cache[i].free;
+    thread_cache[i].free = object->next;
+    thread_cache[i].num--;
+
+    return object;
+}
+
+static void mem_object_free(int i, ogs_mem_object_t *object)
+{
+    ogs_mem_class_t *class = &mem_class[i];
+    ogs_mem_object_t *next = NULL;
+    int batch;
+
+    thread_cache_check(i);
+
+    if (thread_cache[i].num == class->cache_max) {
+        batch = ogs_max(class->cache_max / 2, 1);
+
+        ogs_thread_mutex_lock(&class->mutex);
+        while (batch--) {
+            next = thread_cache[i].free;
+            thread_cache[i].free = next->next;
+            thread_cache[i].num--;
+
+            next->next = class->free;
+            class->free = next;
+        }
+        ogs_thread_mutex_unlock(&class->mutex);
+    }
+
+    object->next = thread_cache[i].free;
+    thread_cache[i].free = object;
+    thread_cache[i].num++;
+}
+
 void *ogs_malloc(size_t size)
 {
-    size_t headroom = 0;
-    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_mem_header_t *header = NULL;
+    int i;
 
     ogs_assert(size);
 
-    headroom = sizeof(ogs_pkbuf_t *);
-    pkbuf = ogs_pkbuf_alloc(NULL, headroom + size);
-    ogs_assert(pkbuf);
-    ogs_pkbuf_reserve(pkbuf, headroom);
-    memcpy(pkbuf->head, &pkbuf, headroom);
-    ogs_pkbuf_put(pkbuf, size);
+    if (size > OGS_MEM_MAX_SLAB_SIZE) {
+        header = malloc(sizeof(*header) + size);
+        ogs_assert(header);
 
-    return pkbuf->data;
+        header->class = OGS_MEM_NUM_OF_CLASS;
+        ogs_atomic_inc(&mem_large.in_use);
+        ogs_atomic_inc(&mem_large.total);
+    } else {
+        i = mem_class_find(size);
+        header = &mem_object_alloc(i)->header;
+
+        header->class = i;
+        ogs_atomic_inc(&mem_class[i].in_use);
+        ogs_atomic_inc(&mem_class[i].total);
+    }
+
+    header->size = size;
+    header->magic = OGS_MEM_MAGIC;
+
+    return header + 1;
 }
 
 void ogs_free(void *ptr)
 {
-    size_t headroom;
-    ogs_pkbuf_t *pkbuf = NULL;
+    ogs_mem_header_t *header = NULL;
 
     if (!ptr)
         return;
 
-    headroom = sizeof(ogs_pkbuf_t *);
-    memcpy(&pkbuf, (unsigned char*)ptr - headroom, headroom);
-    ogs_assert(pkbuf);
+    header = (ogs_mem_header_t *)ptr - 1;
+    ogs_assert(header->magic == OGS_MEM_MAGIC);
+    header->magic = 0;
 
-    ogs_pkbuf_free(pkbuf);
+    if (header->class == OGS_MEM_NUM_OF_CLASS) {
+        ogs_atomic_dec(&mem_large.in_use);
+        free(header);
+    } else {
+        ogs_assert(header->class < OGS_MEM_NUM_OF_CLASS);
+        ogs_atomic_dec(&mem_class[header->class].in_use);
+        mem_object_free(header->class, (ogs_mem_object_t *)header);
+    }
 }
 
 void *ogs_calloc(size_t nmemb, size_t size)
@@ -67,37 +386,43 @@ void *ogs_calloc(size_t nmemb, size_t size)
 
 void *ogs_realloc(void *ptr, size_t size)
 {
-    size_t headroom = 0;
-    ogs_pkbuf_t *pkbuf = NULL;
-    ogs_cluster_t *cluster = NULL;
+    ogs_mem_header_t *header = NULL;
+    size_t capacity;
 
     if (!ptr)
         return ogs_malloc(size);
 
-    headroom = sizeof(ogs_pkbuf_t *);
-
-    memcpy(&pkbuf, (unsigned char*)ptr - headroom, headroom);
-    ogs_assert(pkbuf);
-    cluster = pkbuf->cluster;
-    ogs_assert(cluster);
+    header = (ogs_mem_header_t *)ptr - 1;
+    ogs_assert(header->magic == OGS_MEM_MAGIC);
 
     if (!size) {
-        ogs_pkbuf_free(pkbuf);
+        ogs_free(ptr);
         return NULL;
     }
 
-    if (size > (cluster->size - headroom)) {
+    if (header->class == OGS_MEM_NUM_OF_CLASS)
+        capacity = header->size;
+    else
+        capacity = mem_class_size[header->class];
+
+    if (size > capacity) {
         void *new = NULL;
 
         new = ogs_malloc(size);
         ogs_assert(new);
-        memcpy(new, ptr, pkbuf->len);
+        memcpy(new, ptr, header->size);
 
-        ogs_pkbuf_free(pkbuf);
+        ogs_free(ptr);
         return new;
     } else {
-        pkbuf->tail = pkbuf->data + size;
-        pkbuf->len = size;
+        header->size = size;
         return ptr;
     }
 }
+
+static void *(*const volatile memzero_memset)(void *, int, size_t) = memset;
+
+void ogs_memzero(void *ptr, size_t size)
+{
+    memzero_memset(ptr, 0, size);
+}
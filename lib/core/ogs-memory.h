@@ -44,11 +44,28 @@ extern "C" {
         memcpy((__dST), (__sRC), sizeof(*(__sRC))*sizeof(uint8_t)); \
     } while(0)
 
+/* Slab classes of ogs_malloc(). One more stat covers larger requests */
+#define OGS_MEM_NUM_OF_CLASS 36
+
+typedef struct ogs_mem_stat_s {
+    size_t size;                /* 0 for the requests above all classes */
+    unsigned long num_of_slab;
+    unsigned long in_use;
+    unsigned long total;
+} ogs_mem_stat_t;
+
+void ogs_mem_init(void);
+void ogs_mem_final(void);
+void ogs_mem_stat(ogs_mem_stat_t stat[OGS_MEM_NUM_OF_CLASS+1]);
+
 void *ogs_malloc(size_t size);
 void ogs_free(void *ptr);
 void *ogs_calloc(size_t nmemb, size_t size);
 void *ogs_realloc(void *ptr, size_t size);
 
+/* memset() to zero that is never dropped as a dead store */
+void ogs_memzero(void *ptr, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,8 +48,10 @@ void ogs_notify_init(ogs_pollset_t *pollset)
 #endif
 
     pollset->notify.poll = ogs_pollset_add(pollset, OGS_POLLIN,
-            pollset->notify.fd[0], ogs_drain_pollset, NULL);
+            pollset->notify.fd[0], ogs_drain_pollset, pollset);
     ogs_assert(pollset->notify.poll);
+
+    pollset->notify.armed = 1;
 }
 
 void ogs_notify_final(ogs_pollset_t *pollset)
@@ -76,6 +78,11 @@ int ogs_notify_pollset(ogs_pollset_t *pollset)
 
     ogs_assert(pollset);
 
+    /* A wakeup is already pending and has not been consumed yet */
+    ogs_atomic_fence();
+    if (!ogs_atomic_exchange(&pollset->notify.armed, 0))
+        return OGS_OK;
+
 #if defined(HAVE_EVENTFD)
     r = write(pollset->notify.fd[0], (void*)&msg, sizeof(msg));
 #else
@@ -84,6 +91,7 @@ int ogs_notify_pollset(ogs_pollset_t *pollset)
 
     if (r < 0) {
         ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "notify failed");
+        ogs_atomic_store(&pollset->notify.armed, 1);
         return OGS_ERROR;
     }
 
@@ -92,6 +100,7 @@ int ogs_notify_pollset(ogs_pollset_t *pollset)
 
 static void ogs_drain_pollset(short when, ogs_socket_t fd, void *data)
 {
+    ogs_pollset_t *pollset = data;
     ssize_t r;
 #if defined(HAVE_EVENTFD)
     uint64_t msg;
@@ -109,4 +118,13 @@ static void ogs_drain_pollset(short when, ogs_socket_t fd, void *data)
     if (r < 0) {
         ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "drain failed");
     }
+
+    /*
+     * Re-arm before the caller drains its event queue, so that an event
+     * pushed after this point is either seen by that drain or signals
+     * the eventfd again.
+     */
+    ogs_assert(pollset);
+    ogs_atomic_store(&pollset->notify.armed, 1);
+    ogs_atomic_fence();
 }
@@ -46,6 +46,46 @@ OGS_STATIC_ASSERT(sizeof(ogs_cluster_2048_t) % sizeof(void *) == 0);
 OGS_STATIC_ASSERT(sizeof(ogs_cluster_8192_t) % sizeof(void *) == 0);
 OGS_STATIC_ASSERT(sizeof(ogs_cluster_big_t) % sizeof(void *) == 0);
 
+/*
+ * Index of the objects kept in the pool.
+ * The buffer of each cluster size stays attached to its ogs_cluster_t
+ * while it sits in a per-thread cache.
+ */
+#define OGS_CLUSTER_128_CLASS   0
+#define OGS_CLUSTER_256_CLASS   1
+#define OGS_CLUSTER_512_CLASS   2
+#define OGS_CLUSTER_1024_CLASS  3
+#define OGS_CLUSTER_2048_CLASS  4
+#define OGS_CLUSTER_8192_CLASS  5
+#define OGS_CLUSTER_BIG_CLASS   6
+#define OGS_PKBUF_CLASS         7
+#define OGS_PKBUF_NUM_OF_CLASS  8
+
+/*
+ * Per-thread magazine cache
+ *
+ * Every thread keeps up to OGS_PKBUF_CACHE_SIZE objects of each class.
+ * An empty magazine is refilled with half of its capacity in one go
+ * under pool->mutex, and a full magazine is drained the same way.
+ * The capacity is bounded by 1/OGS_PKBUF_CACHE_RATIO of the pool
+ * so that a few threads cannot starve the others of a small class.
+ */
+#define OGS_PKBUF_CACHE_SIZE    64
+#define OGS_PKBUF_CACHE_RATIO   16
+#define OGS_PKBUF_MAX_THREAD_CACHE 4
+
+typedef struct ogs_pkbuf_magazine_s {
+    int num;
+    void *obj[OGS_PKBUF_CACHE_SIZE];
+} ogs_pkbuf_magazine_t;
+
+typedef struct ogs_pkbuf_cache_s {
+    ogs_lnode_t lnode;
+    struct ogs_pkbuf_pool_s *pool;  /* NULL once the pool is destroyed */
+
+    ogs_pkbuf_magazine_t magazine[OGS_PKBUF_NUM_OF_CLASS];
+} ogs_pkbuf_cache_t;
+
 typedef struct ogs_pkbuf_pool_s {
     OGS_POOL(pkbuf, ogs_pkbuf_t);
     OGS_POOL(cluster, ogs_cluster_t);
@@ -59,14 +99,36 @@ typedef struct ogs_pkbuf_pool_s {
     OGS_POOL(cluster_big, ogs_cluster_big_t);
 
     ogs_thread_mutex_t mutex;
+
+    int cache_max[OGS_PKBUF_NUM_OF_CLASS];
+    ogs_list_t cache_list;
 } ogs_pkbuf_pool_t;
 
 static OGS_POOL(pkbuf_pool, ogs_pkbuf_pool_t);
 static ogs_pkbuf_pool_t *default_pool = NULL;
 
-static ogs_cluster_t *cluster_alloc(
-        ogs_pkbuf_pool_t *pool, unsigned int size);
-static void cluster_free(ogs_pkbuf_pool_t *pool, ogs_cluster_t *cluster);
+/*
+ * A cache belongs to its thread. When the pool is destroyed first,
+ * the pool drains the cache and the thread frees it later, so that
+ * another pool created at the same address never sees the old cache.
+ */
+static ogs_thread_local struct {
+    ogs_pkbuf_pool_t *pool;
+    ogs_pkbuf_cache_t *cache;
+} thread_cache[OGS_PKBUF_MAX_THREAD_CACHE];
+static ogs_thread_local bool thread_cache_armed;
+
+static int cluster_class(unsigned int size);
+static int object_avail(ogs_pkbuf_pool_t *pool, int class);
+static void *object_alloc(ogs_pkbuf_pool_t *pool, int class);
+static void object_free(ogs_pkbuf_pool_t *pool, int class, void *obj);
+
+static ogs_pkbuf_cache_t *cache_find(ogs_pkbuf_pool_t *pool);
+static void cache_drain(ogs_pkbuf_pool_t *pool, ogs_pkbuf_cache_t *cache);
+static void *cache_get(ogs_pkbuf_pool_t *pool,
+        ogs_pkbuf_cache_t *cache, int class);
+static void cache_put(ogs_pkbuf_pool_t *pool,
+        ogs_pkbuf_cache_t *cache, int class, void *obj);
 
 void *ogs_pkbuf_put_data(
         ogs_pkbuf_t *pkbuf, const void *data, unsigned int len)
@@ -111,6 +173,11 @@ void ogs_pkbuf_default_destroy(void)
     ogs_pkbuf_pool_destroy(default_pool);
 }
 
+static int cache_max(int size)
+{
+    return ogs_min(OGS_PKBUF_CACHE_SIZE, size / OGS_PKBUF_CACHE_RATIO);
+}
+
 ogs_pkbuf_pool_t *ogs_pkbuf_pool_create(ogs_pkbuf_config_t *config)
 {
     ogs_pkbuf_pool_t *pool = NULL;
@@ -140,13 +207,43 @@ ogs_pkbuf_pool_t *ogs_pkbuf_pool_create(ogs_pkbuf_config_t *config)
     ogs_pool_init(&pool->cluster_8192, config->cluster_8192_pool);
     ogs_pool_init(&pool->cluster_big, config->cluster_big_pool);
 
+    pool->cache_max[OGS_CLUSTER_128_CLASS] =
+        cache_max(config->cluster_128_pool);
+    pool->cache_max[OGS_CLUSTER_256_CLASS] =
+        cache_max(config->cluster_256_pool);
+    pool->cache_max[OGS_CLUSTER_512_CLASS] =
+        cache_max(config->cluster_512_pool);
+    pool->cache_max[OGS_CLUSTER_1024_CLASS] =
+        cache_max(config->cluster_1024_pool);
+    pool->cache_max[OGS_CLUSTER_2048_CLASS] =
+        cache_max(config->cluster_2048_pool);
+    pool->cache_max[OGS_CLUSTER_8192_CLASS] =
+        cache_max(config->cluster_8192_pool);
+    /* Big clusters are rare. They always go through the shared pool */
+    pool->cache_max[OGS_CLUSTER_BIG_CLASS] = 0;
+    pool->cache_max[OGS_PKBUF_CLASS] = cache_max(tmp);
+
+    ogs_list_init(&pool->cache_list);
+
     return pool;
 }
 
 void ogs_pkbuf_pool_destroy(ogs_pkbuf_pool_t *pool)
 {
+    ogs_pkbuf_cache_t *cache = NULL, *next_cache = NULL;
+
     ogs_assert(pool);
 
+    /*
+     * No thread may use the pool at this point.
+     * Return the objects left in the caches of all threads.
+     */
+    ogs_list_for_each_safe(&pool->cache_list, next_cache, cache) {
+        ogs_list_remove(&pool->cache_list, cache);
+        cache_drain(pool, cache);
+        ogs_atomic_store(&cache->pool, NULL);
+    }
+
     ogs_pool_final(&pool->pkbuf);
     ogs_pool_final(&pool->cluster);
 
@@ -167,28 +264,32 @@ ogs_pkbuf_t *ogs_pkbuf_alloc(ogs_pkbuf_pool_t *pool, unsigned int size)
 {
     ogs_pkbuf_t *pkbuf = NULL;
     ogs_cluster_t *cluster = NULL;
+    ogs_pkbuf_cache_t *cache = NULL;
+    int class;
 
     if (pool == NULL)
         pool = default_pool;
     ogs_assert(pool);
 
-    ogs_thread_mutex_lock(&pool->mutex);
+    class = cluster_class(size);
+    cache = cache_find(pool);
 
-    cluster = cluster_alloc(pool, size);
+    cluster = cache_get(pool, cache, class);
     if (!cluster) {
         ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
-        ogs_thread_mutex_unlock(&pool->mutex);
         return NULL;
     }
-    ogs_assert(cluster);
 
-    ogs_pool_alloc(&pool->pkbuf, &pkbuf);
-    ogs_assert(pkbuf);
+    pkbuf = cache_get(pool, cache, OGS_PKBUF_CLASS);
+    if (!pkbuf) {
+        ogs_error("ogs_pkbuf_alloc() failed [size=%d]", size);
+        cache_put(pool, cache, class, cluster);
+        return NULL;
+    }
     memset(pkbuf, 0, sizeof(*pkbuf));
 
-    cluster->ref++;
-
-    ogs_thread_mutex_unlock(&pool->mutex);
+    /* No other thread can see the cluster yet */
+    cluster->ref = 1;
 
     pkbuf->cluster = cluster;
 
@@ -208,6 +309,7 @@ void ogs_pkbuf_free(ogs_pkbuf_t *pkbuf)
 {
     ogs_pkbuf_pool_t *pool = NULL;
     ogs_cluster_t *cluster = NULL;
+    ogs_pkbuf_cache_t *cache = NULL;
     ogs_assert(pkbuf);
 
     pool = pkbuf->pool;
@@ -216,15 +318,13 @@ void ogs_pkbuf_free(ogs_pkbuf_t *pkbuf)
     cluster = pkbuf->cluster;
     ogs_assert(cluster);
 
-    ogs_thread_mutex_lock(&pool->mutex);
+    cache = cache_find(pool);
 
-    cluster->ref--;
-    if (cluster->ref == 0)
-        cluster_free(pool, pkbuf->cluster);
+    /* A copy of the cluster may be freed by another thread */
+    if (ogs_atomic_dec(&cluster->ref) == 0)
+        cache_put(pool, cache, cluster_class(cluster->size), cluster);
 
-    ogs_pool_free(&pool->pkbuf, pkbuf);
-
-    ogs_thread_mutex_unlock(&pool->mutex);
+    cache_put(pool, cache, OGS_PKBUF_CLASS, pkbuf);
 }
 
 ogs_pkbuf_t *ogs_pkbuf_copy(ogs_pkbuf_t *pkbuf)
@@ -236,85 +336,127 @@ ogs_pkbuf_t *ogs_pkbuf_copy(ogs_pkbuf_t *pkbuf)
     pool = pkbuf->pool;
     ogs_assert(pool);
 
-    ogs_thread_mutex_lock(&pool->mutex);
-
-    ogs_pool_alloc(&pool->pkbuf, &newbuf);
+    newbuf = cache_get(pool, cache_find(pool), OGS_PKBUF_CLASS);
     if (!newbuf) {
         ogs_error("ogs_pkbuf_copy() failed");
-        ogs_thread_mutex_unlock(&pool->mutex);
         return NULL;
     }
-    ogs_assert(newbuf);
     memcpy(newbuf, pkbuf, sizeof *pkbuf);
 
-    newbuf->cluster->ref++;
-
-    ogs_thread_mutex_unlock(&pool->mutex);
+    ogs_atomic_inc(&newbuf->cluster->ref);
 
     return newbuf;
 }
 
-static ogs_cluster_t *cluster_alloc(
-        ogs_pkbuf_pool_t *pool, unsigned int size)
+static int cluster_class(unsigned int size)
+{
+    if (size <= OGS_CLUSTER_128_SIZE)
+        return OGS_CLUSTER_128_CLASS;
+    else if (size <= OGS_CLUSTER_256_SIZE)
+        return OGS_CLUSTER_256_CLASS;
+    else if (size <= OGS_CLUSTER_512_SIZE)
+        return OGS_CLUSTER_512_CLASS;
+    else if (size <= OGS_CLUSTER_1024_SIZE)
+        return OGS_CLUSTER_1024_CLASS;
+    else if (size <= OGS_CLUSTER_2048_SIZE)
+        return OGS_CLUSTER_2048_CLASS;
+    else if (size <= OGS_CLUSTER_8192_SIZE)
+        return OGS_CLUSTER_8192_CLASS;
+    else if (size <= OGS_CLUSTER_BIG_SIZE)
+        return OGS_CLUSTER_BIG_CLASS;
+
+    ogs_fatal("invalid size = %d", size);
+    ogs_assert_if_reached();
+    return -1;
+}
+
+static ogs_cluster_t *cluster_alloc(ogs_pkbuf_pool_t *pool, int class)
 {
     ogs_cluster_t *cluster = NULL;
     void *buffer = NULL;
     ogs_assert(pool);
 
-    ogs_pool_alloc(&pool->cluster, &cluster);
-    ogs_assert(cluster);
-    memset(cluster, 0, sizeof(*cluster));
-
-    if (size <= OGS_CLUSTER_128_SIZE) {
+    switch (class) {
+    case OGS_CLUSTER_128_CLASS:
         ogs_pool_alloc(&pool->cluster_128, (ogs_cluster_128_t**)&buffer);
         if (!buffer) {
             ogs_fatal("No OGS_CLUSTER_128_SIZE");
             return NULL;
         }
-        cluster->size = OGS_CLUSTER_128_SIZE;
-    } else if (size <= OGS_CLUSTER_256_SIZE) {
+        break;
+    case OGS_CLUSTER_256_CLASS:
         ogs_pool_alloc(&pool->cluster_256, (ogs_cluster_256_t**)&buffer);
         if (!buffer) {
             ogs_fatal("No OGS_CLUSTER_256_SIZE");
             return NULL;
         }
-        cluster->size = OGS_CLUSTER_256_SIZE;
-    } else if (size <= OGS_CLUSTER_512_SIZE) {
+        break;
+    case OGS_CLUSTER_512_CLASS:
         ogs_pool_alloc(&pool->cluster_512, (ogs_cluster_512_t**)&buffer);
         if (!buffer) {
             ogs_fatal("No OGS_CLUSTER_512_SIZE");
             return NULL;
         }
-        cluster->size = OGS_CLUSTER_512_SIZE;
-    } else if (size <= OGS_CLUSTER_1024_SIZE) {
+        break;
+    case OGS_CLUSTER_1024_CLASS:
         ogs_pool_alloc(&pool->cluster_1024, (ogs_cluster_1024_t**)&buffer);
         if (!buffer) {
             ogs_fatal("No OGS_CLUSTER_1024_SIZE");
             return NULL;
         }
-        cluster->size = OGS_CLUSTER_1024_SIZE;
-    } else if (size <= OGS_CLUSTER_2048_SIZE) {
+        break;
+    case OGS_CLUSTER_2048_CLASS:
         ogs_pool_alloc(&pool->cluster_2048, (ogs_cluster_2048_t**)&buffer);
         if (!buffer) {
             ogs_fatal("No OGS_CLUSTER_2048_SIZE");
             return NULL;
         }
-        cluster->size = OGS_CLUSTER_2048_SIZE;
-    } else if (size <= OGS_CLUSTER_8192_SIZE) {
+        break;
+    case OGS_CLUSTER_8192_CLASS:
         ogs_pool_alloc(&pool->cluster_8192, (ogs_cluster_8192_t**)&buffer);
         if (!buffer) {
             ogs_fatal("No OGS_CLUSTER_8192_SIZE");
             return NULL;
         }
-        cluster->size = OGS_CLUSTER_8192_SIZE;
-    } else if (size <= OGS_CLUSTER_BIG_SIZE) {
+        break;
+    case OGS_CLUSTER_BIG_CLASS:
         ogs_pool_alloc(&pool->cluster_big, (ogs_cluster_big_t**)&buffer);
         if (!buffer) {
             ogs_fatal("No OGS_CLUSTER_BIG_SIZE");
+            return NULL;
         }
+        break;
+    default:
+        ogs_assert_if_reached();
+    }
+
+    ogs_pool_alloc(&pool->cluster, &cluster);
+    ogs_assert(cluster);
+    memset(cluster, 0, sizeof(*cluster));
+
+    switch (class) {
+    case OGS_CLUSTER_128_CLASS:
+        cluster->size = OGS_CLUSTER_128_SIZE;
+        break;
+    case OGS_CLUSTER_256_CLASS:
+        cluster->size = OGS_CLUSTER_256_SIZE;
+        break;
+    case OGS_CLUSTER_512_CLASS:
+        cluster->size = OGS_CLUSTER_512_SIZE;
+        break;
+    case OGS_CLUSTER_1024_CLASS:
+        cluster->size = OGS_CLUSTER_1024_SIZE;
+        break;
+    case OGS_CLUSTER_2048_CLASS:
+        cluster->size = OGS_CLUSTER_2048_SIZE;
+        break;
+    case OGS_CLUSTER_8192_CLASS:
+        cluster->size = OGS_CLUSTER_8192_SIZE;
+        break;
+    case OGS_CLUSTER_BIG_CLASS:
         cluster->size = OGS_CLUSTER_BIG_SIZE;
-    } else {
-        ogs_fatal("invalid size = %d", size);
+        break;
+    default:
         ogs_assert_if_reached();
     }
     cluster->buffer = buffer;
@@ -357,3 +499,214 @@ static void cluster_free(ogs_pkbuf_pool_t *pool, ogs_cluster_t *cluster)
     ogs_pool_free(&pool->cluster, cluster);
 }
 
+/* Called with pool->mutex held */
+static int object_avail(ogs_pkbuf_pool_t *pool, int class)
+{
+    switch (class) {
+    case OGS_CLUSTER_128_CLASS:
+        return ogs_pool_avail(&pool->cluster_128);
+    case OGS_CLUSTER_256_CLASS:
+        return ogs_pool_avail(&pool->cluster_256);
+    case OGS_CLUSTER_512_CLASS:
+        return ogs_pool_avail(&pool->cluster_512);
+    case OGS_CLUSTER_1024_CLASS:
+        return ogs_pool_avail(&pool->cluster_1024);
+    case OGS_CLUSTER_2048_CLASS:
+        return ogs_pool_avail(&pool->cluster_2048);
+    case OGS_CLUSTER_8192_CLASS:
+        return ogs_pool_avail(&pool->cluster_8192);
+    case OGS_CLUSTER_BIG_CLASS:
+        return ogs_pool_avail(&pool->cluster_big);
+    case OGS_PKBUF_CLASS:
+        return ogs_pool_avail(&pool->pkbuf);
+    default:
+        ogs_assert_if_reached();
+    }
+
+    return 0;
+}
+
+/* Called with pool->mutex held */
+static void *object_alloc(ogs_pkbuf_pool_t *pool, int class)
+{
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    if (class == OGS_PKBUF_CLASS) {
+        ogs_pool_alloc(&pool->pkbuf, &pkbuf);
+        return pkbuf;
+    }
+
+    return cluster_alloc(pool, class);
+}
+
+/* Called with pool->mutex held */
+static void object_free(ogs_pkbuf_pool_t *pool, int class, void *obj)
+{
+    if (class == OGS_PKBUF_CLASS)
+        ogs_pool_free(&pool->pkbuf, (ogs_pkbuf_t *)obj);
+    else
+        cluster_free(pool, obj);
+}
+
+/* Gives the objects cached by an exiting thread back to the pools */
+static void cache_release(void)
+{
+    ogs_pkbuf_pool_t *pool = NULL;
+    ogs_pkbuf_cache_t *cache = NULL;
+    int i;
+
+    for (i = 0; i < OGS_PKBUF_MAX_THREAD_CACHE; i++) {
+        cache = thread_cache[i].cache;
+        if (!cache)
+            continue;
+
+        pool = ogs_atomic_load(&cache->pool);
+        if (pool) {
+            ogs_thread_mutex_lock(&pool->mutex);
+            ogs_list_remove(&pool->cache_list, cache);
+            ogs_thread_mutex_unlock(&pool->mutex);
+
+            cache_drain(pool, cache);
+        }
+        free(cache);
+
+        thread_cache[i].pool = NULL;
+        thread_cache[i].cache = NULL;
+    }
+
+    thread_cache_armed = false;
+}
+
+static ogs_pkbuf_cache_t *cache_find(ogs_pkbuf_pool_t *pool)
+{
+    ogs_pkbuf_cache_t *cache = NULL;
+    int i, slot = -1;
+
+    ogs_assert(pool);
+
+    for (i = 0; i < OGS_PKBUF_MAX_THREAD_CACHE; i++) {
+        cache = thread_cache[i].cache;
+        if (cache && !ogs_atomic_load(&cache->pool)) {
+            /* The pool was destroyed and has drained the cache */
+            free(cache);
+            thread_cache[i].pool = NULL;
+            thread_cache[i].cache = NULL;
+        }
+        if (thread_cache[i].pool == pool)
+            return thread_cache[i].cache;
+        if (thread_cache[i].pool == NULL && slot < 0)
+            slot = i;
+    }
+
+    /* Too many pools in this thread. Use the shared pool directly */
+    if (slot < 0)
+        return NULL;
+
+    /* ogs_malloc() is built on the pkbuf pool */
+    cache = calloc(1, sizeof(*cache));
+    if (!cache)
+        return NULL;
+    cache->pool = pool;
+
+    ogs_thread_mutex_lock(&pool->mutex);
+    ogs_list_add(&pool->cache_list, cache);
+    ogs_thread_mutex_unlock(&pool->mutex);
+
+    thread_cache[slot].pool = pool;
+    thread_cache[slot].cache = cache;
+
+    if (!thread_cache_armed) {
+        ogs_thread_at_exit(cache_release);
+        thread_cache_armed = true;
+    }
+
+    return cache;
+}
+
+static void cache_drain(ogs_pkbuf_pool_t *pool, ogs_pkbuf_cache_t *cache)
+{
+    ogs_pkbuf_magazine_t *magazine = NULL;
+    int class;
+
+    ogs_assert(pool);
+    ogs_assert(cache);
+
+    ogs_thread_mutex_lock(&pool->mutex);
+    for (class = 0; class < OGS_PKBUF_NUM_OF_CLASS; class++) {
+        magazine = &cache->magazine[class];
+        while (magazine->num)
+            object_free(pool, class, magazine->obj[--magazine->num]);
+    }
+    ogs_thread_mutex_unlock(&pool->mutex);
+}
+
+static void *cache_get(ogs_pkbuf_pool_t *pool,
+        ogs_pkbuf_cache_t *cache, int class)
+{
+    ogs_pkbuf_magazine_t *magazine = NULL;
+    void *obj = NULL;
+    int batch;
+
+    ogs_assert(pool);
+
+    if (!cache || !pool->cache_max[class]) {
+        ogs_thread_mutex_lock(&pool->mutex);
+        obj = object_alloc(pool, class);
+        ogs_thread_mutex_unlock(&pool->mutex);
+
+        return obj;
+    }
+
+    magazine = &cache->magazine[class];
+    if (magazine->num == 0) {
+        batch = ogs_max(pool->cache_max[class] / 2, 1);
+
+        ogs_thread_mutex_lock(&pool->mutex);
+        batch = ogs_min(batch, object_avail(pool, class));
+        if (batch == 0) {
+            /* Let object_alloc() report the exhausted pool */
+            obj = object_alloc(pool, class);
+            ogs_thread_mutex_unlock(&pool->mutex);
+
+            return obj;
+        }
+        while (magazine->num < batch) {
+            obj = object_alloc(pool, class);
+            ogs_assert(obj);
+            magazine->obj[magazine->num++] = obj;
+        }
+        ogs_thread_mutex_unlock(&pool->mutex);
+    }
+
+    return magazine->obj[--magazine->num];
+}
+
+static void cache_put(ogs_pkbuf_pool_t *pool,
+        ogs_pkbuf_cache_t *cache, int class, void *obj)
+{
+    ogs_pkbuf_magazine_t *magazine = NULL;
+    int batch;
+
+    ogs_assert(pool);
+    ogs_assert(obj);
+
+    if (!cache || !pool->cache_max[class]) {
+        ogs_thread_mutex_lock(&pool->mutex);
+        object_free(pool, class, obj);
+        ogs_thread_mutex_unlock(&pool->mutex);
+
+        return;
+    }
+
+    magazine = &cache->magazine[class];
+    if (magazine->num == pool->cache_max[class]) {
+        batch = ogs_max(pool->cache_max[class] / 2, 1);
+
+        ogs_thread_mutex_lock(&pool->mutex);
+        while (batch--)
+            object_free(pool, class, magazine->obj[--magazine->num]);
+        ogs_thread_mutex_unlock(&pool->mutex);
+    }
+
+    magazine->obj[magazine->num++] = obj;
+}
@@ -47,6 +47,12 @@ typedef struct ogs_pollset_s {
     struct {
         ogs_socket_t fd[2];
         ogs_poll_t *poll;
+        /*
+         * Set while no wakeup is pending. Only the producer that clears
+         * it writes the eventfd; the poll thread sets it again when it
+         * consumes the wakeup, before the event queue is drained.
+         */
+        int armed;
     } notify;
 
     unsigned int capacity;
@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-core.h"
+
+/*
+ * Each object is preceded by a header holding its index, so that the
+ * index can be recovered from the pointer. A zero index marks a free slot.
+ */
+typedef struct ogs_cpool_header_s {
+    ogs_index_t index;
+} ogs_cpool_header_t;
+
+#define OGS_CPOOL_ALIGN 16
+#define cpool_align(__sIZE) \
+    (((__sIZE) + OGS_CPOOL_ALIGN - 1) & ~((size_t)OGS_CPOOL_ALIGN - 1))
+#define OGS_CPOOL_HEADER_SIZE cpool_align(sizeof(ogs_cpool_header_t))
+
+typedef struct ogs_cpool_chunk_s {
+    ogs_lnode_t node;       /* in partial_list while it has free slots */
+
+    uint8_t *mem;           /* NULL while not backed */
+    uint32_t *free;         /* FIFO of free slots, chunk_size entries */
+    unsigned int head, tail;
+    unsigned int avail;
+} ogs_cpool_chunk_t;
+
+#define header_of(pool, chunk, slot) \
+    ((ogs_cpool_header_t *)((chunk)->mem + (size_t)(slot) * (pool)->stride))
+
+void ogs_cpool_init_func(ogs_cpool_t *pool, const char *name,
+        size_t elem_size, int size, int chunk)
+{
+    ogs_assert(pool);
+    ogs_assert(size > 0);
+    ogs_assert(chunk > 0 && (chunk & (chunk - 1)) == 0);
+
+    memset(pool, 0, sizeof *pool);
+
+    pool->name = name;
+    pool->stride = OGS_CPOOL_HEADER_SIZE + cpool_align(elem_size);
+    pool->chunk_size = chunk;
+    while ((1U << pool->chunk_shift) < pool->chunk_size)
+        pool->chunk_shift++;
+
+    pool->num_of_chunk = (size + chunk - 1) >> pool->chunk_shift;
+    pool->chunk = calloc(pool->num_of_chunk, sizeof(ogs_cpool_chunk_t));
+    ogs_assert(pool->chunk);
+    pool->sorted = calloc(pool->num_of_chunk, sizeof(ogs_cpool_chunk_t *));
+    ogs_assert(pool->sorted);
+
+    ogs_list_init(&pool->partial_list);
+
+    pool->size = size;
+}
+
+void ogs_cpool_final_func(ogs_cpool_t *pool)
+{
+    unsigned int i;
+
+    ogs_assert(pool);
+
+    if (pool->used)
+        ogs_error("%d in '%s[%d]' were not released.",
+                pool->used, pool->name, pool->size);
+    ogs_debug("'%s[%d]' high-water mark %d", pool->name, pool->size, pool->hwm);
+
+    for (i = 0; i < pool->num_of_chunk; i++)
+        free(pool->chunk[i].mem);
+    free(pool->chunk);
+    free(pool->sorted);
+}
+
+/* Number of backed chunks whose memory starts at or below 'ptr' */
+static unsigned int sorted_bound(ogs_cpool_t *pool, const uint8_t *ptr)
+{
+    unsigned int lo = 0, hi = pool->num_of_sorted, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (pool->sorted[mid]->mem <= ptr)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+static void sorted_insert(ogs_cpool_t *pool, ogs_cpool_chunk_t *chunk)
+{
+    unsigned int i = sorted_bound(pool, chunk->mem);
+
+    memmove(&pool->sorted[i + 1], &pool->sorted[i],
+            (pool->num_of_sorted - i) * sizeof(ogs_cpool_chunk_t *));
+    pool->sorted[i] = chunk;
+    pool->num_of_sorted++;
+}
+
+static void sorted_remove(ogs_cpool_t *pool, ogs_cpool_chunk_t *chunk)
+{
+    unsigned int i = sorted_bound(pool, chunk->mem);
+
+    ogs_assert(i > 0 && pool->sorted[i - 1] == chunk);
+    i--;
+
+    pool->num_of_sorted--;
+    memmove(&pool->sorted[i], &pool->sorted[i + 1],
+            (pool->num_of_sorted - i) * sizeof(ogs_cpool_chunk_t *));
+}
+
+static ogs_cpool_chunk_t *chunk_back(ogs_cpool_t *pool)
+{
+    ogs_cpool_chunk_t *chunk = NULL;
+    unsigned int i, n;
+
+    while (pool->unbacked < pool->num_of_chunk &&
+            pool->chunk[pool->unbacked].mem)
+        pool->unbacked++;
+    if (pool->unbacked == pool->num_of_chunk)
+        return NULL;
+
+    chunk = &pool->chunk[pool->unbacked];
+
+    /* The last chunk only covers what is left up to the pool size */
+    n = ogs_min(pool->chunk_size,
+            pool->size - (pool->unbacked << pool->chunk_shift));
+
+    chunk->mem = malloc(pool->stride * n + sizeof(uint32_t) * pool->chunk_size);
+    ogs_assert(chunk->mem);
+    chunk->free = (uint32_t *)(chunk->mem + pool->stride * n);
+    sorted_insert(pool, chunk);
+
+    for (i = 0; i < n; i++) {
+        header_of(pool, chunk, i)->index = 0;
+        chunk->free[i] = i;
+    }
+    chunk->head = 0;
+    chunk->tail = n & (pool->chunk_size - 1);
+    chunk->avail = n;
+
+    pool->backed += n;
+
+    ogs_list_add(&pool->partial_list, chunk);
+
+    return chunk;
+}
+
+static void chunk_release(ogs_cpool_t *pool, ogs_cpool_chunk_t *chunk)
+{
+    unsigned int c = chunk - pool->chunk;
+
+    ogs_list_remove(&pool->partial_list, chunk);
+    sorted_remove(pool, chunk);
+
+    free(chunk->mem);
+    chunk->mem = NULL;
+    chunk->free = NULL;
+
+    pool->backed -= chunk->avail;
+    chunk->avail = 0;
+
+    if (c < pool->unbacked)
+        pool->unbacked = c;
+}
+
+void *ogs_cpool_alloc_func(ogs_cpool_t *pool)
+{
+    ogs_cpool_chunk_t *chunk = NULL;
+    ogs_cpool_header_t *header = NULL;
+    unsigned int slot;
+
+    ogs_assert(pool);
+
+    if (pool->used == pool->size)
+        return NULL;
+
+    chunk = ogs_list_first(&pool->partial_list);
+    if (!chunk) {
+        chunk = chunk_back(pool);
+        ogs_assert(chunk);
+    }
+
+    slot = chunk->free[chunk->head];
+    chunk->head = (chunk->head + 1) & (pool->chunk_size - 1);
+    if (--chunk->avail == 0)
+        ogs_list_remove(&pool->partial_list, chunk);
+
+    header = header_of(pool, chunk, slot);
+    header->index = ((chunk - pool->chunk) << pool->chunk_shift) + slot + 1;
+
+    pool->used++;
+    if (pool->used > pool->hwm)
+        pool->hwm = pool->used;
+
+    return (uint8_t *)header + OGS_CPOOL_HEADER_SIZE;
+}
+
+void ogs_cpool_free_func(ogs_cpool_t *pool, void *node)
+{
+    ogs_cpool_chunk_t *chunk = NULL;
+    ogs_cpool_header_t *header = NULL;
+    unsigned int slot;
+    int n;
+
+    ogs_assert(pool);
+    ogs_assert(node);
+
+    header = (ogs_cpool_header_t *)((uint8_t *)node - OGS_CPOOL_HEADER_SIZE);
+    ogs_assert(header->index > 0 && header->index <= pool->size);
+
+    chunk = &pool->chunk[(header->index - 1) >> pool->chunk_shift];
+    slot = (header->index - 1) & (pool->chunk_size - 1);
+    header->index = 0;
+
+    chunk->free[chunk->tail] = slot;
+    chunk->tail = (chunk->tail + 1) & (pool->chunk_size - 1);
+    if (chunk->avail++ == 0)
+        ogs_list_add(&pool->partial_list, chunk);
+
+    pool->used--;
+
+    n = ogs_min(pool->chunk_size,
+            pool->size - ((chunk - pool->chunk) << pool->chunk_shift));
+    if (pool->release && chunk->avail == n &&
+            pool->backed - pool->used - n >= (int)pool->chunk_size)
+        chunk_release(pool, chunk);
+}
+
+ogs_index_t ogs_cpool_index_func(ogs_cpool_t *pool, void *node)
+{
+    ogs_assert(pool);
+    ogs_assert(node);
+
+    return ((ogs_cpool_header_t *)
+            ((uint8_t *)node - OGS_CPOOL_HEADER_SIZE))->index;
+}
+
+void *ogs_cpool_find_func(ogs_cpool_t *pool, ogs_index_t index)
+{
+    ogs_cpool_chunk_t *chunk = NULL;
+    ogs_cpool_header_t *header = NULL;
+
+    ogs_assert(pool);
+
+    if (index == 0 || index > pool->size)
+        return NULL;
+
+    chunk = &pool->chunk[(index - 1) >> pool->chunk_shift];
+    if (!chunk->mem)
+        return NULL;
+
+    header = header_of(pool, chunk, (index - 1) & (pool->chunk_size - 1));
+    if (header->index != index)
+        return NULL;
+
+    return (uint8_t *)header + OGS_CPOOL_HEADER_SIZE;
+}
+
+void *ogs_cpool_cycle_func(ogs_cpool_t *pool, void *node)
+{
+    ogs_cpool_chunk_t *chunk = NULL;
+    ogs_cpool_header_t *header = NULL;
+    unsigned int c, i;
+    size_t offset;
+    int n;
+
+    ogs_assert(pool);
+
+    if (!node)
+        return NULL;
+
+    header = (ogs_cpool_header_t *)((uint8_t *)node - OGS_CPOOL_HEADER_SIZE);
+
+    /* Never dereference the header unless it lies in a backed chunk */
+    i = sorted_bound(pool, (uint8_t *)header);
+    if (i == 0)
+        return NULL;
+
+    chunk = pool->sorted[i - 1];
+    c = chunk - pool->chunk;
+
+    n = ogs_min(pool->chunk_size, pool->size - (c << pool->chunk_shift));
+    offset = (uint8_t *)header - chunk->mem;
+    if (offset >= pool->stride * n)
+        return NULL;
+
+    if (offset % pool->stride != 0)
+        return NULL;
+    if (header->index != (c << pool->chunk_shift) + offset / pool->stride + 1)
+        return NULL;
+
+    return node;
+}
@@ -119,6 +119,76 @@ typedef unsigned int ogs_index_t;
     ogs_free((pool)->index); \
 } while (0)
 
+/*
+ * Chunked pool
+ *
+ * Same model as OGS_POOL, but memory is allocated in chunks of
+ * 'chunk' objects (a power of two) on demand, up to '_size' objects.
+ * An object keeps its index for its whole life, so
+ * ogs_cpool_index()/ogs_cpool_find() work as with OGS_POOL. With
+ * ogs_cpool_set_release(), a chunk that becomes empty is returned to
+ * the system as long as another chunk's worth of free objects remains.
+ * ogs_cpool_cycle() looks a possibly stale pointer up among the backed
+ * chunks (a binary search by address) before reading its header, so it
+ * is safe after a release.
+ */
+typedef struct ogs_cpool_chunk_s ogs_cpool_chunk_t;
+
+typedef struct ogs_cpool_s {
+    const char *name;
+    size_t stride;
+    unsigned int chunk_size, chunk_shift;
+    unsigned int num_of_chunk, unbacked;
+    ogs_cpool_chunk_t *chunk;
+    ogs_cpool_chunk_t **sorted; /* backed chunks by address */
+    unsigned int num_of_sorted;
+    ogs_list_t partial_list;
+    bool release;
+
+    int size;       /* maximum number of objects */
+    int backed;     /* objects with memory behind them */
+    int used;       /* objects allocated */
+    int hwm;        /* high-water mark of 'used' */
+} ogs_cpool_t;
+
+void ogs_cpool_init_func(ogs_cpool_t *pool, const char *name,
+        size_t elem_size, int size, int chunk);
+void ogs_cpool_final_func(ogs_cpool_t *pool);
+void *ogs_cpool_alloc_func(ogs_cpool_t *pool);
+void ogs_cpool_free_func(ogs_cpool_t *pool, void *node);
+ogs_index_t ogs_cpool_index_func(ogs_cpool_t *pool, void *node);
+void *ogs_cpool_find_func(ogs_cpool_t *pool, ogs_index_t index);
+void *ogs_cpool_cycle_func(ogs_cpool_t *pool, void *node);
+
+#define OGS_CPOOL_DEFAULT_CHUNK 1024
+
+#define OGS_CPOOL(pool, type) \
+    struct { \
+        ogs_cpool_t core; \
+        type *typed; \
+    } pool
+
+#define ogs_cpool_init(pool, _size, _chunk) \
+    ogs_cpool_init_func(&(pool)->core, #pool, \
+            sizeof(*(pool)->typed), _size, _chunk)
+#define ogs_cpool_final(pool) ogs_cpool_final_func(&(pool)->core)
+#define ogs_cpool_set_release(pool, _release) \
+    ((pool)->core.release = (_release))
+
+#define ogs_cpool_alloc(pool, node) do { \
+    *(node) = ogs_cpool_alloc_func(&(pool)->core); \
+} while (0)
+#define ogs_cpool_free(pool, node) ogs_cpool_free_func(&(pool)->core, node)
+
+#define ogs_cpool_index(pool, node) ogs_cpool_index_func(&(pool)->core, node)
+#define ogs_cpool_find(pool, _index) ogs_cpool_find_func(&(pool)->core, _index)
+#define ogs_cpool_cycle(pool, node) ogs_cpool_cycle_func(&(pool)->core, node)
+
+#define ogs_cpool_size(pool) ((pool)->core.size)
+#define ogs_cpool_avail(pool) ((pool)->core.size - (pool)->core.used)
+#define ogs_cpool_hwm(pool) ((pool)->core.hwm)
+#define ogs_cpool_backed(pool) ((pool)->core.backed)
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,12 +22,31 @@
 #undef OGS_LOG_DOMAIN
 #define OGS_LOG_DOMAIN __ogs_event_domain
 
+/*
+ * Bounded lock-free queue (D. Vyukov). Each cell carries a sequence
+ * number telling whether it is free for the producer at position 'pos'
+ * (seq == pos) or filled for the consumer at 'pos' (seq == pos + 1).
+ * Positions are 64-bit and never wrap, so any capacity can be used.
+ *
+ * one_big_mutex and the condition variables are only taken by threads
+ * that have to block, and by the other side when it sees a waiter.
+ */
+typedef struct ogs_queue_cell_s {
+    uint64_t            seq;
+    void                *data;
+} ogs_queue_cell_t;
+
 typedef struct ogs_queue_s {
-    void              **data;
-    unsigned int        nelts; /**< # elements */
-    unsigned int        in;    /**< next empty location */
-    unsigned int        out;   /**< next filled location */
+    ogs_queue_cell_t    *cell;
     unsigned int        bounds;/**< max size of queue */
+
+    /* Keep producer and consumer positions on separate cache lines */
+    uint8_t             pad0[64];
+    uint64_t            in;    /**< next empty position */
+    uint8_t             pad1[64];
+    uint64_t            out;   /**< next filled position */
+    uint8_t             pad2[64];
+
     unsigned int        full_waiters;
     unsigned int        empty_waiters;
     ogs_thread_mutex_t  one_big_mutex;
@@ -36,34 +55,26 @@ typedef struct ogs_queue_s {
     int                 terminated;
 } ogs_queue_t;
 
-/**
- * Detects when the ogs_queue_t is full. This utility function is expected
- * to be called from within critical sections, and is not threadsafe.
- */
-#define ogs_queue_full(queue) ((queue)->nelts == (queue)->bounds)
-
-/**
- * Detects when the ogs_queue_t is empty. This utility function is expected
- * to be called from within critical sections, and is not threadsafe.
- */
-#define ogs_queue_empty(queue) ((queue)->nelts == 0)
-
-/**
- * Callback routine that is called to destroy this
- * ogs_queue_t when its pool is destroyed.
- */
 ogs_queue_t *ogs_queue_create(unsigned int capacity)
 {
-    ogs_queue_t *queue = ogs_calloc(1, sizeof *queue);
+    unsigned int i;
+    ogs_queue_t *queue = NULL;
+
+    ogs_assert(capacity);
+
+    queue = ogs_calloc(1, sizeof *queue);
     ogs_assert(queue);
 
     ogs_thread_mutex_init(&queue->one_big_mutex);
     ogs_thread_cond_init(&queue->not_empty);
     ogs_thread_cond_init(&queue->not_full);
 
-    queue->data = ogs_calloc(1, capacity * sizeof(void*));
+    queue->cell = ogs_calloc(capacity, sizeof(ogs_queue_cell_t));
+    ogs_assert(queue->cell);
+    for (i = 0; i < capacity; i++)
+        queue->cell[i].seq = i;
+
     queue->bounds = capacity;
-    queue->nelts = 0;
     queue->in = 0;
     queue->out = 0;
     queue->terminated = 0;
@@ -77,7 +88,7 @@ void ogs_queue_destroy(ogs_queue_t *queue)
 {
     ogs_assert(queue);
 
-    ogs_free(queue->data);
+    ogs_free(queue->cell);
 
     ogs_thread_cond_destroy(&queue->not_empty);
     ogs_thread_cond_destroy(&queue->not_full);
@@ -86,23 +97,102 @@ void ogs_queue_destroy(ogs_queue_t *queue)
     ogs_free(queue);
 }
 
+static bool cell_push(ogs_queue_t *queue, void *data)
+{
+    ogs_queue_cell_t *cell = NULL;
+    uint64_t pos = __atomic_load_n(&queue->in, __ATOMIC_RELAXED);
+    int64_t diff;
+
+    for ( ;; ) {
+        cell = &queue->cell[pos % queue->bounds];
+        diff = (int64_t)(ogs_atomic_load(&cell->seq) - pos);
+        if (diff == 0) {
+            if (ogs_atomic_compare_exchange(&queue->in, &pos, pos + 1))
+                break;
+        } else if (diff < 0) {
+            return false; /* full */
+        } else {
+            pos = __atomic_load_n(&queue->in, __ATOMIC_RELAXED);
+        }
+    }
+
+    cell->data = data;
+    ogs_atomic_store(&cell->seq, pos + 1);
+
+    return true;
+}
+
+static unsigned int cell_pop(
+        ogs_queue_t *queue, void **data, unsigned int max)
+{
+    ogs_queue_cell_t *cell = NULL;
+    uint64_t pos = __atomic_load_n(&queue->out, __ATOMIC_RELAXED);
+    unsigned int i, num;
+
+    for ( ;; ) {
+        /* Claim the run of filled cells starting at 'pos' */
+        for (num = 0; num < max; num++) {
+            cell = &queue->cell[(pos + num) % queue->bounds];
+            if (ogs_atomic_load(&cell->seq) != pos + num + 1)
+                break;
+        }
+        if (!num) {
+            cell = &queue->cell[pos % queue->bounds];
+            if ((int64_t)(ogs_atomic_load(&cell->seq) - (pos + 1)) < 0)
+                return 0; /* empty */
+            pos = __atomic_load_n(&queue->out, __ATOMIC_RELAXED);
+            continue;
+        }
+        if (ogs_atomic_compare_exchange(&queue->out, &pos, pos + num))
+            break;
+    }
+
+    for (i = 0; i < num; i++) {
+        cell = &queue->cell[(pos + i) % queue->bounds];
+        data[i] = cell->data;
+        ogs_atomic_store(&cell->seq, pos + i + queue->bounds);
+    }
+
+    return num;
+}
+
+/* Wake up a thread blocked on the other side, if any */
+static void queue_signal(ogs_queue_t *queue,
+        unsigned int *waiters, ogs_thread_cond_t *cond)
+{
+    ogs_atomic_fence();
+    if (ogs_atomic_load(waiters)) {
+        ogs_thread_mutex_lock(&queue->one_big_mutex);
+        ogs_thread_cond_signal(cond);
+        ogs_thread_mutex_unlock(&queue->one_big_mutex);
+    }
+}
+
 static int queue_push(ogs_queue_t *queue, void *data, ogs_time_t timeout)
 {
     int rv;
 
-    if (queue->terminated) {
+    if (ogs_atomic_load(&queue->terminated)) {
         return OGS_DONE; /* no more elements ever again */
     }
 
-    ogs_thread_mutex_lock(&queue->one_big_mutex);
-
-    if (ogs_queue_full(queue)) {
+    if (!cell_push(queue, data)) {
         if (!timeout) {
-            ogs_thread_mutex_unlock(&queue->one_big_mutex);
             return OGS_RETRY;
         }
+
+        ogs_thread_mutex_lock(&queue->one_big_mutex);
+
+        ogs_atomic_inc(&queue->full_waiters);
+        ogs_atomic_fence();
+
+        if (cell_push(queue, data)) {
+            ogs_atomic_dec(&queue->full_waiters);
+            ogs_thread_mutex_unlock(&queue->one_big_mutex);
+            goto pushed;
+        }
+
         if (!queue->terminated) {
-            queue->full_waiters++;
             if (timeout > 0) {
                 rv = ogs_thread_cond_timedwait(&queue->not_full,
                                                &queue->one_big_mutex,
@@ -112,14 +202,17 @@ static int queue_push(ogs_queue_t *queue, void *data, ogs_time_t timeout)
                 rv = ogs_thread_cond_wait(&queue->not_full,
                                           &queue->one_big_mutex);
             }
-            queue->full_waiters--;
+            ogs_atomic_dec(&queue->full_waiters);
             if (rv != OGS_OK) {
                 ogs_thread_mutex_unlock(&queue->one_big_mutex);
                 return rv;
             }
+        } else {
+            ogs_atomic_dec(&queue->full_waiters);
         }
-        /* If we wake up and it's still empty, then we were interrupted */
-        if (ogs_queue_full(queue)) {
+
+        /* If we wake up and it's still full, then we were interrupted */
+        if (!cell_push(queue, data)) {
             ogs_warn("queue full (intr)");
             ogs_thread_mutex_unlock(&queue->one_big_mutex);
             if (queue->terminated) {
@@ -129,20 +222,13 @@ static int queue_push(ogs_queue_t *queue, void *data, ogs_time_t timeout)
                 return OGS_ERROR;
             }
         }
-    }
-
-    queue->data[queue->in] = data;
-    queue->in++;
-    if (queue->in >= queue->bounds)
-        queue->in -= queue->bounds;
-    queue->nelts++;
 
-    if (queue->empty_waiters) {
-        ogs_trace("signal !empty");
-        ogs_thread_cond_signal(&queue->not_empty);
+        ogs_thread_mutex_unlock(&queue->one_big_mutex);
     }
 
-    ogs_thread_mutex_unlock(&queue->one_big_mutex);
+pushed:
+    queue_signal(queue, &queue->empty_waiters, &queue->not_empty);
+
     return OGS_OK;
 }
 
@@ -167,10 +253,13 @@ int ogs_queue_timedpush(ogs_queue_t *queue, void *data, ogs_time_t timeout)
 }
 
 /**
- * not thread safe
+ * not exact while other threads push or pop
  */
 unsigned int ogs_queue_size(ogs_queue_t *queue) {
-    return queue->nelts;
+    uint64_t out = ogs_atomic_load(&queue->out);
+    uint64_t in = ogs_atomic_load(&queue->in);
+
+    return in > out ? (unsigned int)(in - out) : 0;
 }
 
 /**
@@ -180,24 +269,35 @@ unsigned int ogs_queue_size(ogs_queue_t *queue) {
  * otherwise until the given timeout expires). Once retrieved, the
  * item is placed into the address specified by 'data'.
  */
-static int queue_pop(ogs_queue_t *queue, void **data, ogs_time_t timeout)
+static int queue_pop(ogs_queue_t *queue,
+        void **data, unsigned int *num, ogs_time_t timeout)
 {
     int rv;
+    unsigned int max = *num;
 
-    if (queue->terminated) {
+    if (ogs_atomic_load(&queue->terminated)) {
         return OGS_DONE; /* no more elements ever again */
     }
 
-    ogs_thread_mutex_lock(&queue->one_big_mutex);
-
-    /* Keep waiting until we wake up and find that the queue is not empty. */
-    if (ogs_queue_empty(queue)) {
+    *num = cell_pop(queue, data, max);
+    if (!*num) {
         if (!timeout) {
-            ogs_thread_mutex_unlock(&queue->one_big_mutex);
             return OGS_RETRY;
         }
+
+        ogs_thread_mutex_lock(&queue->one_big_mutex);
+
+        ogs_atomic_inc(&queue->empty_waiters);
+        ogs_atomic_fence();
+
+        *num = cell_pop(queue, data, max);
+        if (*num) {
+            ogs_atomic_dec(&queue->empty_waiters);
+            ogs_thread_mutex_unlock(&queue->one_big_mutex);
+            goto popped;
+        }
+
         if (!queue->terminated) {
-            queue->empty_waiters++;
             if (timeout > 0) {
                 rv = ogs_thread_cond_timedwait(&queue->not_empty,
                                                &queue->one_big_mutex,
@@ -207,14 +307,18 @@ static int queue_pop(ogs_queue_t *queue, void **data, ogs_time_t timeout)
                 rv = ogs_thread_cond_wait(&queue->not_empty,
                                           &queue->one_big_mutex);
             }
-            queue->empty_waiters--;
+            ogs_atomic_dec(&queue->empty_waiters);
             if (rv != OGS_OK) {
                 ogs_thread_mutex_unlock(&queue->one_big_mutex);
                 return rv;
             }
+        } else {
+            ogs_atomic_dec(&queue->empty_waiters);
         }
+
         /* If we wake up and it's still empty, then we were interrupted */
-        if (ogs_queue_empty(queue)) {
+        *num = cell_pop(queue, data, max);
+        if (!*num) {
             ogs_warn("queue empty (intr)");
             ogs_thread_mutex_unlock(&queue->one_big_mutex);
             if (queue->terminated) {
@@ -223,36 +327,40 @@ static int queue_pop(ogs_queue_t *queue, void **data, ogs_time_t timeout)
                 return OGS_ERROR;
             }
         }
-    } 
 
-    *data = queue->data[queue->out];
-    queue->nelts--;
-
-    queue->out++;
-    if (queue->out >= queue->bounds)
-        queue->out -= queue->bounds;
-    if (queue->full_waiters) {
-        ogs_trace("signal !full");
-        ogs_thread_cond_signal(&queue->not_full);
+        ogs_thread_mutex_unlock(&queue->one_big_mutex);
     }
 
-    ogs_thread_mutex_unlock(&queue->one_big_mutex);
+popped:
+    queue_signal(queue, &queue->full_waiters, &queue->not_full);
+
     return OGS_OK;
 }
 
 int ogs_queue_pop(ogs_queue_t *queue, void **data)
 {
-    return queue_pop(queue, data, OGS_INFINITE_TIME);
+    unsigned int num = 1;
+    return queue_pop(queue, data, &num, OGS_INFINITE_TIME);
 }
 
 int ogs_queue_trypop(ogs_queue_t *queue, void **data)
 {
-    return queue_pop(queue, data, 0);
+    unsigned int num = 1;
+    return queue_pop(queue, data, &num, 0);
+}
+
+int ogs_queue_trypop_batch(ogs_queue_t *queue, void **data, unsigned int *num)
+{
+    ogs_assert(num);
+    ogs_assert(*num);
+
+    return queue_pop(queue, data, num, 0);
 }
 
 int ogs_queue_timedpop(ogs_queue_t *queue, void **data, ogs_time_t timeout)
 {
-    return queue_pop(queue, data, timeout);
+    unsigned int num = 1;
+    return queue_pop(queue, data, &num, timeout);
 }
 
 int ogs_queue_interrupt_all(ogs_queue_t *queue)
@@ -276,9 +384,8 @@ int ogs_queue_term(ogs_queue_t *queue)
      * we could end up setting it and waking everybody up just after a 
      * would-be popper checks it but right before they block
      */
-    queue->terminated = 1;
+    ogs_atomic_store(&queue->terminated, 1);
     ogs_thread_mutex_unlock(&queue->one_big_mutex);
 
     return ogs_queue_interrupt_all(queue);
 }
-
@@ -39,6 +39,13 @@ int ogs_queue_pop(ogs_queue_t *queue, void **data);
 int ogs_queue_trypush(ogs_queue_t *queue, void *data);
 int ogs_queue_trypop(ogs_queue_t *queue, void **data);
 
+/*
+ * Pops up to *num elements without blocking. On OGS_OK, *num is set to
+ * the number of elements stored in data[].
+ */
+#define OGS_QUEUE_BATCH_SIZE 32
+int ogs_queue_trypop_batch(ogs_queue_t *queue, void **data, unsigned int *num);
+
 int ogs_queue_timedpush(ogs_queue_t *queue, void *data, ogs_time_t timeout);
 int ogs_queue_timedpop(ogs_queue_t *queue, void **data, ogs_time_t timeout);
 
@@ -210,7 +210,7 @@ ssize_t ogs_read(ogs_socket_t fd, void *buf, size_t len)
     ogs_assert(fd != INVALID_SOCKET);
 
     size = read(fd, buf, len);
-    if (size < 0) {
+    if (size < 0 && ogs_socket_errno != OGS_EAGAIN) {
         ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
                 "ogs_read(len:%d) failed", (int)size);
     }
@@ -364,3 +364,24 @@ int ogs_listen_reusable(ogs_socket_t fd)
 
     return OGS_OK;
 }
+
+int ogs_listen_reuseport(ogs_socket_t fd)
+{
+#if defined(SO_REUSEPORT) && !defined(_WIN32)
+    int rc;
+    int on = 1;
+
+    ogs_assert(fd != INVALID_SOCKET);
+    rc = setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, (void *)&on, sizeof(int));
+    if (rc != OGS_OK) {
+        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                "setsockopt(SOL_SOCKET, SO_REUSEPORT) failed");
+        return OGS_ERROR;
+    }
+
+    return OGS_OK;
+#else
+    ogs_error("SO_REUSEPORT is not supported");
+    return OGS_ERROR;
+#endif
+}
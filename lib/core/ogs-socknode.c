@@ -257,6 +257,12 @@ void ogs_socknode_nodelay(ogs_socknode_t *node, int on)
     node->option.nodelay = on;
 }
 
+void ogs_socknode_reuseport(ogs_socknode_t *node, int on)
+{
+    ogs_assert(node);
+    node->option.reuseport = on;
+}
+
 void ogs_socknode_linger(ogs_socknode_t *node, int onoff, int linger)
 {
     ogs_assert(node);
@@ -41,6 +41,7 @@ typedef struct ogs_sockopt_s {
     } sctp;
 
     int nodelay;
+    int reuseport;
     int l_onoff;
     int l_linger;;
 } ogs_sockopt_t;
@@ -74,6 +75,7 @@ int ogs_socknode_fill_scope_id_in_local(ogs_sockaddr_t *sa_list);
 
 void ogs_socknode_sctp_option(ogs_socknode_t *node, ogs_sockopt_t *option);
 void ogs_socknode_nodelay(ogs_socknode_t *node, int on);
+void ogs_socknode_reuseport(ogs_socknode_t *node, int on);
 void ogs_socknode_linger(ogs_socknode_t *node, int onoff, int linger); 
 
 void ogs_socknode_set_cleanup(
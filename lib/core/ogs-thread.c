@@ -137,3 +137,63 @@ void ogs_thread_destroy(ogs_thread_t *thread)
     ogs_free(thread);
     ogs_debug("[%p] thread done", thread);
 }
+
+static ogs_thread_local struct {
+    void (*func[OGS_THREAD_MAX_AT_EXIT])(void);
+    int num;
+} at_exit;
+
+void ogs_thread_run_at_exit(void)
+{
+    while (at_exit.num > 0)
+        at_exit.func[--at_exit.num]();
+}
+
+#if !defined(_WIN32)
+static pthread_once_t at_exit_once = PTHREAD_ONCE_INIT;
+static pthread_key_t at_exit_key;
+
+static void at_exit_destructor(void *data)
+{
+    ogs_thread_run_at_exit();
+}
+
+static void at_exit_key_create(void)
+{
+    ogs_assert(pthread_key_create(&at_exit_key, at_exit_destructor) == 0);
+}
+#else
+static INIT_ONCE at_exit_once = INIT_ONCE_STATIC_INIT;
+static DWORD at_exit_key = FLS_OUT_OF_INDEXES;
+
+static VOID WINAPI at_exit_destructor(PVOID data)
+{
+    ogs_thread_run_at_exit();
+}
+
+static BOOL CALLBACK at_exit_key_create(
+        PINIT_ONCE once, PVOID param, PVOID *context)
+{
+    at_exit_key = FlsAlloc(at_exit_destructor);
+    ogs_assert(at_exit_key != FLS_OUT_OF_INDEXES);
+
+    return TRUE;
+}
+#endif
+
+void ogs_thread_at_exit(void (*func)(void))
+{
+    ogs_assert(func);
+    ogs_assert(at_exit.num < OGS_THREAD_MAX_AT_EXIT);
+
+    /* The destructor only runs for a thread with a non-NULL value */
+#if !defined(_WIN32)
+    pthread_once(&at_exit_once, at_exit_key_create);
+    ogs_assert(pthread_setspecific(at_exit_key, &at_exit) == 0);
+#else
+    InitOnceExecuteOnce(&at_exit_once, at_exit_key_create, NULL, NULL);
+    ogs_assert(FlsSetValue(at_exit_key, &at_exit));
+#endif
+
+    at_exit.func[at_exit.num++] = func;
+}
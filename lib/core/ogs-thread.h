@@ -110,6 +110,16 @@ typedef struct ogs_thread_s ogs_thread_t;
 ogs_thread_t *ogs_thread_create(void (*func)(void *), void *data);
 void ogs_thread_destroy(ogs_thread_t *thread);
 
+/*
+ * Have the calling thread run func when it exits, whether or not it was
+ * started by ogs_thread_create(). Register each func once per thread.
+ * ogs_thread_run_at_exit() runs them early, e.g. for the main thread
+ * from ogs_core_terminate().
+ */
+#define OGS_THREAD_MAX_AT_EXIT 8
+void ogs_thread_at_exit(void (*func)(void));
+void ogs_thread_run_at_exit(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -204,6 +204,17 @@ ogs_time_t ogs_get_monotonic_time(void)
 #endif
 }
 
+ogs_time_t ogs_get_monotonic_coarse_time(void)
+{
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC_COARSE)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    return ((ts.tv_sec * 1000000UL) + (ts.tv_nsec / 1000UL));
+#else
+    return ogs_get_monotonic_time();
+#endif
+}
+
 void ogs_localtime(time_t s, struct tm *tm)
 {
     ogs_assert(tm);
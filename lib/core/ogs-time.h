@@ -62,6 +62,9 @@ int ogs_time_from_gmt(ogs_time_t *t, struct tm *tm, int tm_usec);
 
 /** @return number of microseconds since an arbitrary point */
 ogs_time_t ogs_get_monotonic_time(void);
+/** @return same as above with a few milliseconds of resolution,
+ *  but cheaper to read in the data path */
+ogs_time_t ogs_get_monotonic_coarse_time(void);
 /** @return the GMT offset in seconds */
 int ogs_timezone(void);
 
@@ -22,9 +22,36 @@
 #undef OGS_LOG_DOMAIN
 #define OGS_LOG_DOMAIN __ogs_event_domain
 
+/*
+ * Hierarchical timing wheel
+ *
+ * Level 0 has one slot per millisecond tick and every upper level is
+ * OGS_TIMER_WHEEL_SIZE times coarser. A timer goes into the lowest
+ * level that covers its expiry and falls down one level each time the
+ * wheel below wraps around. Five levels cover about 12 days; longer
+ * timers wait in the top level and are placed again when it wraps.
+ */
+#define OGS_TIMER_WHEEL_BITS    6
+#define OGS_TIMER_WHEEL_SIZE    (1 << OGS_TIMER_WHEEL_BITS)
+#define OGS_TIMER_WHEEL_MASK    (OGS_TIMER_WHEEL_SIZE - 1)
+#define OGS_TIMER_WHEEL_LEVEL   5
+#define OGS_TIMER_WHEEL_TICK    1000 /* usec */
+
+#define WHEEL_SHIFT(__lEVEL)    ((__lEVEL) * OGS_TIMER_WHEEL_BITS)
+#define WHEEL_INDEX(__tICK, __lEVEL) \
+    (((__tICK) >> WHEEL_SHIFT(__lEVEL)) & OGS_TIMER_WHEEL_MASK)
+
 typedef struct ogs_timer_mgr_s {
-    OGS_POOL(pool, ogs_timer_t);
+    OGS_CPOOL(pool, ogs_timer_t);
+    ogs_timer_mgr_type_e type;
+
     ogs_rbtree_t tree;
+
+    struct {
+        uint64_t tick;      /* Next tick to be processed */
+        uint64_t bitmap[OGS_TIMER_WHEEL_LEVEL];
+        ogs_list_t slot[OGS_TIMER_WHEEL_LEVEL][OGS_TIMER_WHEEL_SIZE];
+    } wheel;
 } ogs_timer_mgr_t;
 
 static void add_timer_node(
@@ -52,12 +79,94 @@ static void add_timer_node(
     ogs_rbtree_insert_color(tree, timer);
 }
 
-ogs_timer_mgr_t *ogs_timer_mgr_create(unsigned int capacity)
+static void add_wheel_node(ogs_timer_mgr_t *manager, ogs_timer_t *timer)
+{
+    uint64_t expires, delta;
+    int level, index;
+
+    ogs_assert(manager);
+    ogs_assert(timer);
+
+    expires = (timer->timeout + OGS_TIMER_WHEEL_TICK - 1) /
+        OGS_TIMER_WHEEL_TICK;
+    if (expires < manager->wheel.tick)
+        expires = manager->wheel.tick;
+
+    delta = expires - manager->wheel.tick;
+    for (level = 0; level < OGS_TIMER_WHEEL_LEVEL - 1; level++)
+        if (delta < (1ULL << WHEEL_SHIFT(level + 1)))
+            break;
+
+    if (delta >= (1ULL << WHEEL_SHIFT(OGS_TIMER_WHEEL_LEVEL)))
+        expires = manager->wheel.tick +
+            (1ULL << WHEEL_SHIFT(OGS_TIMER_WHEEL_LEVEL)) - 1;
+
+    index = WHEEL_INDEX(expires, level);
+
+    timer->slot = &manager->wheel.slot[level][index];
+    ogs_list_add(timer->slot, &timer->lnode);
+    manager->wheel.bitmap[level] |= (1ULL << index);
+}
+
+static void delete_wheel_node(ogs_timer_mgr_t *manager, ogs_timer_t *timer)
+{
+    int level, index;
+
+    ogs_assert(manager);
+    ogs_assert(timer);
+    ogs_assert(timer->slot);
+
+    ogs_list_remove(timer->slot, &timer->lnode);
+
+    /* The expiring timers sit in a local list outside the wheel */
+    index = timer->slot - &manager->wheel.slot[0][0];
+    if (index >= 0 && index < OGS_TIMER_WHEEL_LEVEL * OGS_TIMER_WHEEL_SIZE &&
+        ogs_list_empty(timer->slot)) {
+        level = index / OGS_TIMER_WHEEL_SIZE;
+        index = index % OGS_TIMER_WHEEL_SIZE;
+
+        manager->wheel.bitmap[level] &= ~(1ULL << index);
+    }
+    timer->slot = NULL;
+}
+
+/* Move the timers of the upper levels down when level 0 wraps around */
+static void cascade_wheel(ogs_timer_mgr_t *manager)
+{
+    OGS_LIST(list);
+    ogs_lnode_t *lnode = NULL;
+    ogs_timer_t *this = NULL;
+    int level, index;
+
+    for (level = 1; level < OGS_TIMER_WHEEL_LEVEL; level++) {
+        index = WHEEL_INDEX(manager->wheel.tick, level);
+
+        list = manager->wheel.slot[level][index];
+        ogs_list_init(&manager->wheel.slot[level][index]);
+        manager->wheel.bitmap[level] &= ~(1ULL << index);
+
+        while ((lnode = ogs_list_first(&list)) != NULL) {
+            this = ogs_rb_entry(lnode, ogs_timer_t, lnode);
+            ogs_list_remove(&list, lnode);
+            add_wheel_node(manager, this);
+        }
+
+        if (index)
+            break;
+    }
+}
+
+ogs_timer_mgr_t *ogs_timer_mgr_create(
+        unsigned int capacity, ogs_timer_mgr_type_e type)
 {
     ogs_timer_mgr_t *manager = ogs_calloc(1, sizeof *manager);
     ogs_assert(manager);
 
-    ogs_pool_init(&manager->pool, capacity);
+    ogs_cpool_init(&manager->pool, capacity, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&manager->pool, true);
+
+    manager->type = type;
+    manager->wheel.tick = ogs_get_monotonic_time() / OGS_TIMER_WHEEL_TICK;
 
     return manager;
 }
@@ -66,7 +175,7 @@ void ogs_timer_mgr_destroy(ogs_timer_mgr_t *manager)
 {
     ogs_assert(manager);
 
-    ogs_pool_final(&manager->pool);
+    ogs_cpool_final(&manager->pool);
     ogs_free(manager);
 }
 
@@ -76,7 +185,7 @@ ogs_timer_t *ogs_timer_add(
     ogs_timer_t *timer = NULL;
     ogs_assert(manager);
 
-    ogs_pool_alloc(&manager->pool, &timer);
+    ogs_cpool_alloc(&manager->pool, &timer);
     ogs_assert(timer);
 
     memset(timer, 0, sizeof *timer);
@@ -97,7 +206,7 @@ void ogs_timer_delete(ogs_timer_t *timer)
 
     ogs_timer_stop(timer);
 
-    ogs_pool_free(&manager->pool, timer);
+    ogs_cpool_free(&manager->pool, timer);
 }
 
 void ogs_timer_start(ogs_timer_t *timer, ogs_time_t duration)
@@ -109,6 +218,16 @@ void ogs_timer_start(ogs_timer_t *timer, ogs_time_t duration)
     manager = timer->manager;
     ogs_assert(manager);
 
+    if (manager->type == OGS_TIMER_MGR_WHEEL) {
+        if (timer->running == true)
+            delete_wheel_node(manager, timer);
+
+        timer->running = true;
+        timer->timeout = ogs_get_monotonic_time() + duration;
+        add_wheel_node(manager, timer);
+        return;
+    }
+
     if (timer->running == true)
         ogs_rbtree_delete(&manager->tree, timer);
 
@@ -127,7 +246,112 @@ void ogs_timer_stop(ogs_timer_t *timer)
         return;
 
     timer->running = false;
-    ogs_rbtree_delete(&manager->tree, timer);
+    if (manager->type == OGS_TIMER_MGR_WHEEL)
+        delete_wheel_node(manager, timer);
+    else
+        ogs_rbtree_delete(&manager->tree, timer);
+}
+
+/*
+ * Level 0 gives the exact tick. An upper level only tells when its
+ * first timer moves down, so the poll may wake up before the expiry.
+ */
+static ogs_time_t wheel_next(ogs_timer_mgr_t *manager)
+{
+    uint64_t tick, next = UINT64_MAX, bitmap, base;
+    int level, index, offset;
+    ogs_time_t current, timeout;
+
+    tick = manager->wheel.tick;
+
+    for (level = 0; level < OGS_TIMER_WHEEL_LEVEL; level++) {
+        bitmap = manager->wheel.bitmap[level];
+        if (!bitmap)
+            continue;
+
+        index = WHEEL_INDEX(tick, level);
+        base = tick >> WHEEL_SHIFT(level);
+
+        if (level && (bitmap & (1ULL << index)) &&
+            (tick & ((1ULL << WHEEL_SHIFT(level)) - 1))) {
+            /* The current slot has already moved down. It holds
+             * the timers of the next round */
+            bitmap &= ~(1ULL << index);
+            if (!bitmap)
+                base += OGS_TIMER_WHEEL_SIZE;
+        }
+
+        if (bitmap) {
+            bitmap = (bitmap >> index) |
+                (index ? bitmap << (OGS_TIMER_WHEEL_SIZE - index) : 0);
+            offset = __builtin_ctzll(bitmap);
+        } else {
+            offset = 0;
+        }
+
+        if (level == 0)
+            next = ogs_min(next, tick + offset);
+        else
+            next = ogs_min(next,
+                    ogs_max(tick, (base + offset) << WHEEL_SHIFT(level)));
+    }
+
+    if (next == UINT64_MAX)
+        return OGS_INFINITE_TIME;
+
+    current = ogs_get_monotonic_time();
+    timeout = next * OGS_TIMER_WHEEL_TICK;
+    if (timeout > current)
+        return (timeout - current);
+
+    return OGS_NO_WAIT_TIME;
+}
+
+static void wheel_expire(ogs_timer_mgr_t *manager)
+{
+    OGS_LIST(list);
+    uint64_t current, bitmap;
+    ogs_lnode_t *lnode = NULL;
+    ogs_timer_t *this = NULL;
+    int index;
+
+    current = ogs_get_monotonic_time() / OGS_TIMER_WHEEL_TICK;
+
+    while (manager->wheel.tick <= current) {
+        index = WHEEL_INDEX(manager->wheel.tick, 0);
+        if (index == 0)
+            cascade_wheel(manager);
+
+        /* Skip the empty slots up to the next wrap-around */
+        bitmap = manager->wheel.bitmap[0] >> index;
+        if (!bitmap) {
+            manager->wheel.tick = ogs_min(current + 1,
+                    (manager->wheel.tick | OGS_TIMER_WHEEL_MASK) + 1);
+            continue;
+        }
+        if (!(bitmap & 1)) {
+            manager->wheel.tick = ogs_min(current + 1,
+                    manager->wheel.tick + __builtin_ctzll(bitmap));
+            continue;
+        }
+
+        list = manager->wheel.slot[0][index];
+        ogs_list_init(&manager->wheel.slot[0][index]);
+        manager->wheel.bitmap[0] &= ~(1ULL << index);
+        manager->wheel.tick++;
+
+        ogs_list_for_each(&list, lnode) {
+            this = ogs_rb_entry(lnode, ogs_timer_t, lnode);
+            this->slot = &list;
+        }
+
+        while ((lnode = ogs_list_first(&list)) != NULL) {
+            this = ogs_rb_entry(lnode, ogs_timer_t, lnode);
+            ogs_timer_stop(this);
+            if (this->cb)
+                this->cb(this->data);
+        }
+    }
 }
 
 ogs_time_t ogs_timer_mgr_next(ogs_timer_mgr_t *manager)
@@ -136,6 +360,9 @@ ogs_time_t ogs_timer_mgr_next(ogs_timer_mgr_t *manager)
     ogs_rbnode_t *rbnode = NULL;
     ogs_assert(manager);
 
+    if (manager->type == OGS_TIMER_MGR_WHEEL)
+        return wheel_next(manager);
+
     current = ogs_get_monotonic_time();
     rbnode = ogs_rbtree_first(&manager->tree);
     if (rbnode) {
@@ -160,6 +387,11 @@ void ogs_timer_mgr_expire(ogs_timer_mgr_t *manager)
     ogs_timer_t *this;
     ogs_assert(manager);
 
+    if (manager->type == OGS_TIMER_MGR_WHEEL) {
+        wheel_expire(manager);
+        return;
+    }
+
     current = ogs_get_monotonic_time();
 
     ogs_rbtree_for_each(&manager->tree, rbnode) {
@@ -20,50 +20,135 @@
 #include "ogs-core.h"
 
 ogs_tlv_desc_t ogs_tlv_desc_more1 = { 
-    OGS_TLV_MORE, "More", 0, 1, 0, 0, { NULL } };
+    OGS_TLV_MORE, "More", 0, 1, 0, 0, { NULL }, NULL };
 ogs_tlv_desc_t ogs_tlv_desc_more2 = { 
-    OGS_TLV_MORE, "More", 0, 2, 0, 0, { NULL } };
+    OGS_TLV_MORE, "More", 0, 2, 0, 0, { NULL }, NULL };
 ogs_tlv_desc_t ogs_tlv_desc_more3 = { 
-    OGS_TLV_MORE, "More", 0, 3, 0, 0, { NULL } };
+    OGS_TLV_MORE, "More", 0, 3, 0, 0, { NULL }, NULL };
 ogs_tlv_desc_t ogs_tlv_desc_more4 = { 
-    OGS_TLV_MORE, "More", 0, 4, 0, 0, { NULL } };
+    OGS_TLV_MORE, "More", 0, 4, 0, 0, { NULL }, NULL };
 ogs_tlv_desc_t ogs_tlv_desc_more5 = { 
-    OGS_TLV_MORE, "More", 0, 5, 0, 0, { NULL } };
+    OGS_TLV_MORE, "More", 0, 5, 0, 0, { NULL }, NULL };
 ogs_tlv_desc_t ogs_tlv_desc_more6 = { 
-    OGS_TLV_MORE, "More", 0, 6, 0, 0, { NULL } };
+    OGS_TLV_MORE, "More", 0, 6, 0, 0, { NULL }, NULL };
 ogs_tlv_desc_t ogs_tlv_desc_more7 = { 
-    OGS_TLV_MORE, "More", 0, 7, 0, 0, { NULL } };
+    OGS_TLV_MORE, "More", 0, 7, 0, 0, { NULL }, NULL };
 ogs_tlv_desc_t ogs_tlv_desc_more8 = { 
-    OGS_TLV_MORE, "More", 0, 8, 0, 0, { NULL } };
+    OGS_TLV_MORE, "More", 0, 8, 0, 0, { NULL }, NULL };
 
-static ogs_tlv_t *tlv_add_leaf(
-        ogs_tlv_t *parent_tlv, ogs_tlv_t *tlv, ogs_tlv_desc_t *desc, void *msg)
+/*
+ * The message is encoded and decoded in a single walk over the
+ * descriptors. No ogs_tlv_t tree is built: the encoder writes straight
+ * into the pkbuf and the decoder reads straight from it. The decoder
+ * dispatches each IE through the generated switch in desc->find.
+ */
+static uint32_t tlv_header_length(int mode)
+{
+    switch (mode) {
+    case OGS_TLV_MODE_T1_L1:
+        return 2;
+    case OGS_TLV_MODE_T1_L2:
+        return 3;
+    case OGS_TLV_MODE_T1_L2_I1:
+    case OGS_TLV_MODE_T2_L2:
+        return 4;
+    default:
+        ogs_assert_if_reached();
+        break;
+    }
+
+    return 0;
+}
+
+static uint8_t *tlv_put_header(uint8_t *pos, ogs_tlv_desc_t *desc,
+        uint32_t length, int mode)
+{
+    switch (mode) {
+    case OGS_TLV_MODE_T1_L1:
+        *(pos++) = desc->type & 0xff;
+        *(pos++) = length & 0xff;
+        break;
+    case OGS_TLV_MODE_T1_L2:
+        *(pos++) = desc->type & 0xff;
+        *(pos++) = (length >> 8) & 0xff;
+        *(pos++) = length & 0xff;
+        break;
+    case OGS_TLV_MODE_T1_L2_I1:
+        *(pos++) = desc->type & 0xff;
+        *(pos++) = (length >> 8) & 0xff;
+        *(pos++) = length & 0xff;
+        *(pos++) = desc->instance & 0xff;
+        break;
+    case OGS_TLV_MODE_T2_L2:
+        *(pos++) = (desc->type >> 8) & 0xff;
+        *(pos++) = desc->type & 0xff;
+        *(pos++) = (length >> 8) & 0xff;
+        *(pos++) = length & 0xff;
+        break;
+    default:
+        ogs_assert_if_reached();
+        break;
+    }
+
+    return pos;
+}
+
+static uint32_t tlv_leaf_length(ogs_tlv_desc_t *desc, void *msg)
+{
+    switch (desc->ctype) {
+    case OGS_TLV_UINT8:
+    case OGS_TLV_INT8:
+        return 1;
+    case OGS_TLV_UINT16:
+    case OGS_TLV_INT16:
+        return 2;
+    case OGS_TLV_UINT24:
+    case OGS_TLV_INT24:
+        return 3;
+    case OGS_TLV_UINT32:
+    case OGS_TLV_INT32:
+        return 4;
+    case OGS_TLV_FIXED_STR:
+        return desc->length;
+    case OGS_TLV_VAR_STR:
+    {
+        ogs_tlv_octet_t *v = (ogs_tlv_octet_t *)msg;
+
+        if (v->len == 0) {
+            ogs_fatal("No TLV length - [%s] T:%d I:%d (vsz=%d)",
+                    desc->name, desc->type, desc->instance, desc->vsize);
+            ogs_assert_if_reached();
+        }
+        return v->len;
+    }
+    case OGS_TLV_NULL:
+        return 0;
+    default:
+        ogs_assert_if_reached();
+        break;
+    }
+
+    return 0;
+}
+
+static uint8_t *tlv_put_leaf(uint8_t *pos, ogs_tlv_desc_t *desc, void *msg)
 {
     switch (desc->ctype) {
     case OGS_TLV_UINT8:
     case OGS_TLV_INT8:
     {
         ogs_tlv_uint8_t *v = (ogs_tlv_uint8_t *)msg;
-        if (parent_tlv)
-            tlv = ogs_tlv_embed(parent_tlv, 
-                    desc->type, 1, desc->instance, &v->u8);
-        else
-            tlv = ogs_tlv_add(tlv, desc->type, 1, desc->instance, &v->u8);
-        ogs_assert(tlv);
+
+        *(pos++) = v->u8;
         break;
     }
     case OGS_TLV_UINT16:
+    case OGS_TLV_INT16:
     {
         ogs_tlv_uint16_t *v = (ogs_tlv_uint16_t *)msg;
 
-        v->u16 = htobe16(v->u16);
-
-        if (parent_tlv)
-            tlv = ogs_tlv_embed(parent_tlv, 
-                    desc->type, 2, desc->instance, &v->u16);
-        else
-            tlv = ogs_tlv_add(tlv, desc->type, 2, desc->instance, &v->u16);
-        ogs_assert(tlv);
+        *(pos++) = (v->u16 >> 8) & 0xff;
+        *(pos++) = v->u16 & 0xff;
         break;
     }
     case OGS_TLV_UINT24:
@@ -71,15 +156,9 @@ static ogs_tlv_t *tlv_add_leaf(
     {
         ogs_tlv_uint24_t *v = (ogs_tlv_uint24_t *)msg;
 
-        v->u24 = v->u24 << 8;
-        v->u24 = htobe32(v->u24);
-
-        if (parent_tlv)
-            tlv = ogs_tlv_embed(parent_tlv, 
-                    desc->type, 3, desc->instance, &v->u24);
-        else
-            tlv = ogs_tlv_add(tlv, desc->type, 3, desc->instance, &v->u24);
-        ogs_assert(tlv);
+        *(pos++) = (v->u24 >> 16) & 0xff;
+        *(pos++) = (v->u24 >> 8) & 0xff;
+        *(pos++) = v->u24 & 0xff;
         break;
     }
     case OGS_TLV_UINT32:
@@ -87,224 +166,155 @@ static ogs_tlv_t *tlv_add_leaf(
     {
         ogs_tlv_uint32_t *v = (ogs_tlv_uint32_t *)msg;
 
-        v->u32 = htobe32(v->u32);
-
-        if (parent_tlv)
-            tlv = ogs_tlv_embed(parent_tlv,
-                    desc->type, 4, desc->instance, &v->u32);
-        else
-            tlv = ogs_tlv_add(tlv,
-                    desc->type, 4, desc->instance, &v->u32);
-        ogs_assert(tlv);
+        *(pos++) = (v->u32 >> 24) & 0xff;
+        *(pos++) = (v->u32 >> 16) & 0xff;
+        *(pos++) = (v->u32 >> 8) & 0xff;
+        *(pos++) = v->u32 & 0xff;
         break;
     }
     case OGS_TLV_FIXED_STR:
     {
         ogs_tlv_octet_t *v = (ogs_tlv_octet_t *)msg;
 
-        if (parent_tlv)
-            tlv = ogs_tlv_embed(parent_tlv, 
-                    desc->type, desc->length, desc->instance, v->data);
-        else
-            tlv = ogs_tlv_add(tlv, 
-                    desc->type, desc->length, desc->instance, v->data);
-        ogs_assert(tlv);
+        memcpy(pos, v->data, desc->length);
+        pos += desc->length;
         break;
     }
     case OGS_TLV_VAR_STR:
     {
         ogs_tlv_octet_t *v = (ogs_tlv_octet_t *)msg;
 
-        if (v->len == 0) {
-            ogs_fatal("No TLV length - [%s] T:%d I:%d (vsz=%d)",
-                    desc->name, desc->type, desc->instance, desc->vsize);
-            ogs_assert_if_reached();
-        }
-
-        if (parent_tlv)
-            tlv = ogs_tlv_embed(parent_tlv, 
-                    desc->type, v->len, desc->instance, v->data);
-        else
-            tlv = ogs_tlv_add(tlv, 
-                    desc->type, v->len, desc->instance, v->data);
-        ogs_assert(tlv);
+        memcpy(pos, v->data, v->len);
+        pos += v->len;
         break;
     }
     case OGS_TLV_NULL:
-    {
-        if (parent_tlv)
-            tlv = ogs_tlv_embed(parent_tlv, 
-                    desc->type, 0, desc->instance, NULL);
-        else
-            tlv = ogs_tlv_add(tlv, 
-                    desc->type, 0, desc->instance, NULL);
-        ogs_assert(tlv);
         break;
-    }
     default:
         ogs_assert_if_reached();
         break;
     }
 
-    return tlv;
+    return pos;
 }
 
-static uint32_t tlv_add_compound(ogs_tlv_t **root, ogs_tlv_t *parent_tlv,
-        ogs_tlv_desc_t *parent_desc, void *msg, int depth)
+/*
+ * Walk the present IEs of a compound. With pos == NULL it only returns
+ * the encoded length. Otherwise it writes the IEs and fills in the
+ * length of every nested compound once its content is written.
+ */
+static uint32_t tlv_build_compound(uint8_t *pos, ogs_tlv_desc_t *parent_desc,
+        void *msg, int depth, int mode)
 {
     ogs_tlv_presence_t *presence_p;
     ogs_tlv_desc_t *desc = NULL, *next_desc = NULL;
-    ogs_tlv_t *tlv = NULL, *emb_tlv = NULL;
     uint8_t *p = msg;
-    uint32_t offset = 0, count = 0;
-    int i, j, r;
+    uint8_t *v = NULL;
+    uint32_t offset = 0, length = 0, hlen, vlen;
+    int i, j, count;
     char indent[17] = "                "; /* 16 spaces */
 
-    ogs_assert(root);
     ogs_assert(parent_desc);
     ogs_assert(msg);
 
     ogs_assert(depth <= 8);
     indent[depth*2] = 0;
 
-    *root = NULL;
+    hlen = tlv_header_length(mode);
 
     for (i = 0, desc = parent_desc->child_descs[i]; desc != NULL;
             i++, desc = parent_desc->child_descs[i]) {
         next_desc = parent_desc->child_descs[i+1];
         if (next_desc != NULL && next_desc->ctype == OGS_TLV_MORE) {
-            int offset2 = offset;
-            for (j = 0; j < next_desc->length; j++) {
-                presence_p = (ogs_tlv_presence_t *)(p + offset2);
-
-                if (*presence_p == 0)
-                    break;
-
-                if (desc->ctype == OGS_TLV_COMPOUND) {
-                    ogs_trace("BUILD %sC#%d [%s] T:%d I:%d (vsz=%d) off:%p ",
-                            indent, i, desc->name, desc->type, desc->instance, 
-                            desc->vsize, p + offset2);
-
-                    if (parent_tlv)
-                        tlv = ogs_tlv_embed(parent_tlv, 
-                                desc->type, 0, desc->instance, NULL);
-                    else
-                        tlv = ogs_tlv_add(tlv,
-                                desc->type, 0, desc->instance, NULL);
-
-                    r = tlv_add_compound(&emb_tlv, tlv, desc,
-                            p + offset2 + sizeof(ogs_tlv_presence_t),
-                            depth + 1);
-                    ogs_assert(r > 0 && emb_tlv);
-                    count += 1 + r;
-                } else {
-                    ogs_trace("BUILD %sL#%d [%s] T:%d L:%d I:%d "
-                            "(cls:%d vsz:%d) off:%p ",
-                            indent, i, desc->name, desc->type, desc->length, 
-                            desc->instance, desc->ctype, desc->vsize, 
-                            p + offset2);
-
-                    tlv = tlv_add_leaf(parent_tlv, tlv, desc, p + offset2);
-                    ogs_assert(tlv);
-                    count++;
-                }
+            count = next_desc->length;
+            i++;
+        } else {
+            count = 1;
+        }
 
-                if (*root == NULL)
-                    *root = tlv;
+        for (j = 0; j < count; j++) {
+            v = p + offset + desc->vsize * j;
+            presence_p = (ogs_tlv_presence_t *)v;
 
-                offset2 += desc->vsize;
+            if (*presence_p == 0) {
+                if (count > 1)
+                    break;
+                continue;
             }
-            offset += desc->vsize * next_desc->length;
-            i++;
-        } else {
-            presence_p = (ogs_tlv_presence_t *)(p + offset);
-
-            if (*presence_p) {
-                if (desc->ctype == OGS_TLV_COMPOUND) {
-                    ogs_trace("BUILD %sC#%d [%s] T:%d I:%d (vsz=%d) off:%p ",
-                            indent, i, desc->name, desc->type, desc->instance, 
-                            desc->vsize, p + offset);
-
-                    if (parent_tlv)
-                        tlv = ogs_tlv_embed(parent_tlv, 
-                                desc->type, 0, desc->instance, NULL);
-                    else
-                        tlv = ogs_tlv_add(tlv,
-                                desc->type, 0, desc->instance, NULL);
-
-                    r = tlv_add_compound(&emb_tlv, tlv, desc,
-                            p + offset + sizeof(ogs_tlv_presence_t),
-                            depth + 1);
-                    ogs_assert(r > 0 && emb_tlv);
-                    count += 1 + r;
-                } else {
-                    ogs_trace("BUILD %sL#%d [%s] T:%d L:%d I:%d "
-                            "(cls:%d vsz:%d) off:%p ",
-                            indent, i, desc->name, desc->type, desc->length, 
-                            desc->instance, desc->ctype, desc->vsize, 
-                            p + offset);
-
-                    tlv = tlv_add_leaf(parent_tlv, tlv, desc, p + offset);
-                    ogs_assert(tlv);
-                    count++;
-                }
 
-                if (*root == NULL)
-                    *root = tlv;
+            if (desc->ctype == OGS_TLV_COMPOUND) {
+                ogs_trace("BUILD %sC#%d [%s] T:%d I:%d (vsz=%d) off:%p ",
+                        indent, i, desc->name, desc->type, desc->instance,
+                        desc->vsize, v);
+
+                vlen = tlv_build_compound(pos ? pos + length + hlen : NULL,
+                        desc, v + sizeof(ogs_tlv_presence_t), depth + 1, mode);
+                ogs_assert(vlen > 0);
+
+                if (pos)
+                    tlv_put_header(pos + length, desc, vlen, mode);
+            } else {
+                ogs_trace("BUILD %sL#%d [%s] T:%d L:%d I:%d "
+                        "(cls:%d vsz:%d) off:%p ",
+                        indent, i, desc->name, desc->type, desc->length,
+                        desc->instance, desc->ctype, desc->vsize, v);
+
+                vlen = tlv_leaf_length(desc, v);
+                if (pos)
+                    tlv_put_leaf(tlv_put_header(pos + length, desc, vlen, mode),
+                            desc, v);
             }
-            offset += desc->vsize;
+
+            length += hlen + vlen;
         }
+
+        offset += desc->vsize * count;
     }
 
-    return count;
+    return length;
 }
 
 ogs_pkbuf_t *ogs_tlv_build_msg(ogs_tlv_desc_t *desc, void *msg, int mode)
 {
-    ogs_tlv_t *root = NULL;
-    uint32_t r, length, rendlen;
+    uint32_t length, rendlen;
     ogs_pkbuf_t *pkbuf = NULL;
 
     ogs_assert(desc);
     ogs_assert(msg);
 
     ogs_assert(desc->ctype == OGS_TLV_MESSAGE);
-    
-    if (desc->child_descs[0]) {
-        r = tlv_add_compound(&root, NULL, desc, msg, 0);
-        ogs_assert(r > 0 && root);
 
-        length = ogs_tlv_calc_length(root, mode);
-    } else {
+    if (desc->child_descs[0])
+        length = tlv_build_compound(NULL, desc, msg, 0, mode);
+    else
         length = 0;
-    }
+
     pkbuf = ogs_pkbuf_alloc(NULL, OGS_TLV_MAX_HEADROOM+length);
     ogs_assert(pkbuf);
     ogs_pkbuf_reserve(pkbuf, OGS_TLV_MAX_HEADROOM);
     ogs_pkbuf_put(pkbuf, length);
 
-    if (desc->child_descs[0]) {
-        rendlen = ogs_tlv_render(root, pkbuf->data, length, mode);
+    if (length) {
+        rendlen = tlv_build_compound(pkbuf->data, desc, msg, 0, mode);
         ogs_assert(rendlen == length);
-
-        ogs_tlv_free_all(root);
     }
 
     return pkbuf;
 }
 
 static ogs_tlv_desc_t* tlv_find_desc(uint8_t *desc_index,
-        uint32_t *tlv_offset, ogs_tlv_desc_t *parent_desc, ogs_tlv_t *tlv)
+        uint32_t *tlv_offset, ogs_tlv_desc_t *parent_desc,
+        uint32_t type, uint8_t instance)
 {
     ogs_tlv_desc_t *prev_desc = NULL, *desc = NULL;
     int i, offset = 0;
 
     ogs_assert(parent_desc);
-    ogs_assert(tlv);
 
     for (i = 0, desc = parent_desc->child_descs[i]; desc != NULL;
             i++, desc = parent_desc->child_descs[i]) {
-        if (desc->type == tlv->type && desc->instance == tlv->instance) {
+        if (desc->ctype != OGS_TLV_MORE &&
+                desc->type == type && desc->instance == instance) {
             *desc_index = i;
             *tlv_offset = offset;
             break;
@@ -323,11 +333,11 @@ static ogs_tlv_desc_t* tlv_find_desc(uint8_t *desc_index,
     return desc;
 }
 
-static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
+static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc,
+        uint8_t *value, uint32_t length)
 {
     ogs_assert(msg);
     ogs_assert(desc);
-    ogs_assert(tlv);
 
     switch (desc->ctype) {
     case OGS_TLV_UINT8:
@@ -335,12 +345,12 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_uint8_t *v = (ogs_tlv_uint8_t *)msg;
 
-        if (tlv->length != 1)
+        if (length != 1)
         {
-            ogs_error("Invalid TLV length %d. It should be 1", tlv->length);
+            ogs_error("Invalid TLV length %d. It should be 1", length);
             return OGS_ERROR;
         }
-        v->u8 = *(uint8_t*)(tlv->value);
+        v->u8 = value[0];
         break;
     }
     case OGS_TLV_UINT16:
@@ -348,13 +358,13 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_uint16_t *v = (ogs_tlv_uint16_t *)msg;
 
-        if (tlv->length != 2)
+        if (length != 2)
         {
-            ogs_error("Invalid TLV length %d. It should be 2", tlv->length);
+            ogs_error("Invalid TLV length %d. It should be 2", length);
             return OGS_ERROR;
         }
-        v->u16 = ((((uint8_t*)tlv->value)[0]<< 8)&0xff00) |
-               ((((uint8_t*)tlv->value)[1]    )&0x00ff);
+        v->u16 = ((value[0] << 8) & 0xff00) |
+               ((value[1]    ) & 0x00ff);
         break;
     }
     case OGS_TLV_UINT24:
@@ -362,14 +372,14 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_uint24_t *v = (ogs_tlv_uint24_t *)msg;
 
-        if (tlv->length != 3)
+        if (length != 3)
         {
-            ogs_error("Invalid TLV length %d. It should be 3", tlv->length);
+            ogs_error("Invalid TLV length %d. It should be 3", length);
             return OGS_ERROR;
         }
-        v->u24 = ((((uint8_t*)tlv->value)[0]<<16)&0x00ff0000) |
-               ((((uint8_t*)tlv->value)[1]<< 8)&0x0000ff00) |
-               ((((uint8_t*)tlv->value)[2]    )&0x000000ff);
+        v->u24 = ((value[0] << 16) & 0x00ff0000) |
+               ((value[1] <<  8) & 0x0000ff00) |
+               ((value[2]      ) & 0x000000ff);
         break;
     }
     case OGS_TLV_UINT32:
@@ -377,44 +387,44 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     {
         ogs_tlv_uint32_t *v = (ogs_tlv_uint32_t *)msg;
 
-        if (tlv->length != 4)
+        if (length != 4)
         {
-            ogs_error("Invalid TLV length %d. It should be 4", tlv->length);
+            ogs_error("Invalid TLV length %d. It should be 4", length);
             return OGS_ERROR;
         }
-        v->u32 = ((((uint8_t*)tlv->value)[0]<<24)&0xff000000) |
-               ((((uint8_t*)tlv->value)[1]<<16)&0x00ff0000) |
-               ((((uint8_t*)tlv->value)[2]<< 8)&0x0000ff00) |
-               ((((uint8_t*)tlv->value)[3]    )&0x000000ff);
+        v->u32 = ((value[0] << 24) & 0xff000000) |
+               ((value[1] << 16) & 0x00ff0000) |
+               ((value[2] <<  8) & 0x0000ff00) |
+               ((value[3]      ) & 0x000000ff);
         break;
     }
     case OGS_TLV_FIXED_STR:
     {
         ogs_tlv_octet_t *v = (ogs_tlv_octet_t *)msg;
 
-        if (tlv->length != desc->length)
+        if (length != desc->length)
         {
             ogs_error("Invalid TLV length %d. It should be %d",
-                    tlv->length, desc->length);
+                    length, desc->length);
             return OGS_ERROR;
         }
 
-        v->data = tlv->value;
-        v->len = tlv->length;
+        v->data = value;
+        v->len = length;
         break;
     }
     case OGS_TLV_VAR_STR:
     {
         ogs_tlv_octet_t *v = (ogs_tlv_octet_t *)msg;
 
-        v->data = tlv->value;
-        v->len = tlv->length;
+        v->data = value;
+        v->len = length;
         break;
     }
     case OGS_TLV_NULL:
     {
-        if (tlv->length != 0) {
-            ogs_error("Invalid TLV length %d. It should be 0", tlv->length);
+        if (length != 0) {
+            ogs_error("Invalid TLV length %d. It should be 0", length);
             return OGS_ERROR;
         }
         break;
@@ -427,31 +437,72 @@ static int tlv_parse_leaf(void *msg, ogs_tlv_desc_t *desc, ogs_tlv_t *tlv)
     return OGS_OK;
 }
 
-static int tlv_parse_compound(void *msg, ogs_tlv_desc_t *parent_desc, 
-        ogs_tlv_t *parent_tlv, int depth, int mode)
+static int tlv_parse_compound(void *msg, ogs_tlv_desc_t *parent_desc,
+        uint8_t *blk, uint32_t blk_len, int depth, int mode)
 {
     int rv;
     ogs_tlv_presence_t *presence_p = (ogs_tlv_presence_t *)msg;
     ogs_tlv_desc_t *desc = NULL, *next_desc = NULL;
-    ogs_tlv_t *tlv = NULL, *emb_tlv = NULL;
     uint8_t *p = msg;
-    uint32_t offset = 0;
-    uint8_t index = 0;
+    uint8_t *pos = blk, *end = blk + blk_len;
+    uint32_t offset = 0, type, length, hlen;
+    uint8_t index = 0, instance;
     int i = 0, j;
     char indent[17] = "                "; /* 16 spaces */
 
     ogs_assert(msg);
     ogs_assert(parent_desc);
-    ogs_assert(parent_tlv);
+    ogs_assert(blk);
 
     ogs_assert(depth <= 8);
     indent[depth*2] = 0;
 
-    tlv = parent_tlv;
-    while (tlv) {
-        desc = tlv_find_desc(&index, &offset, parent_desc, tlv);
+    hlen = tlv_header_length(mode);
+
+    while (pos < end) {
+        if (end - pos < hlen) {
+            ogs_error("Truncated TLV header [%d < %d]", (int)(end - pos), hlen);
+            return OGS_ERROR;
+        }
+
+        instance = 0;
+        switch (mode) {
+        case OGS_TLV_MODE_T1_L1:
+            type = pos[0];
+            length = pos[1];
+            break;
+        case OGS_TLV_MODE_T1_L2:
+            type = pos[0];
+            length = (pos[1] << 8) | pos[2];
+            break;
+        case OGS_TLV_MODE_T1_L2_I1:
+            type = pos[0];
+            length = (pos[1] << 8) | pos[2];
+            instance = pos[3];
+            break;
+        case OGS_TLV_MODE_T2_L2:
+            type = (pos[0] << 8) | pos[1];
+            length = (pos[2] << 8) | pos[3];
+            break;
+        default:
+            ogs_assert_if_reached();
+            return OGS_ERROR;
+        }
+        pos += hlen;
+
+        if (end - pos < length) {
+            ogs_error("Truncated TLV type:%d [%d < %d]",
+                    type, (int)(end - pos), length);
+            return OGS_ERROR;
+        }
+
+        if (parent_desc->find)
+            desc = parent_desc->find(type, instance, &index, &offset);
+        else
+            desc = tlv_find_desc(
+                    &index, &offset, parent_desc, type, instance);
         if (desc == NULL) {
-            ogs_error("Unexpected TLV type:%d", tlv->type);
+            ogs_error("Unexpected TLV type:%d", type);
             return OGS_ERROR;
         }
 
@@ -461,7 +512,7 @@ static int tlv_parse_compound(void *msg, ogs_tlv_desc_t *parent_desc,
         next_desc = parent_desc->child_descs[index+1];
         if (next_desc != NULL && next_desc->ctype == OGS_TLV_MORE) {
             for (j = 0; j < next_desc->length; j++) {
-                presence_p = 
+                presence_p =
                     (ogs_tlv_presence_t *)(p + offset + desc->vsize * j);
                 if (*presence_p == 0) {
                     offset += desc->vsize * j;
@@ -471,26 +522,25 @@ static int tlv_parse_compound(void *msg, ogs_tlv_desc_t *parent_desc,
             if (j == next_desc->length) {
                 ogs_fatal("Multiple of the same type TLV need more room");
                 ogs_assert_if_reached();
-                tlv = tlv->next;
+                pos += length;
                 continue;
             }
         }
 
         if (desc->ctype == OGS_TLV_COMPOUND) {
-            emb_tlv = ogs_tlv_parse_embedded_block(tlv, mode);
-            if (emb_tlv == NULL) {
-                ogs_error("Error while parse TLV");
-                return OGS_ERROR;
-            }
-
             ogs_trace("PARSE %sC#%d [%s] T:%d I:%d (vsz=%d) off:%p ",
-                    indent, i++, desc->name, desc->type, desc->instance, 
+                    indent, i++, desc->name, desc->type, desc->instance,
                     desc->vsize, p + offset);
 
+            if (length == 0) {
+                ogs_error("Empty compound TLV type:%d", type);
+                return OGS_ERROR;
+            }
+
             offset += sizeof(ogs_tlv_presence_t);
 
             rv = tlv_parse_compound(
-                    p + offset, desc, emb_tlv, depth + 1, mode);
+                    p + offset, desc, pos, length, depth + 1, mode);
             if (rv != OGS_OK) {
                 ogs_error("Can't parse compound TLV");
                 return OGS_ERROR;
@@ -500,10 +550,10 @@ static int tlv_parse_compound(void *msg, ogs_tlv_desc_t *parent_desc,
         } else {
             ogs_trace("PARSE %sL#%d [%s] T:%d L:%d I:%d "
                     "(cls:%d vsz:%d) off:%p ",
-                    indent, i++, desc->name, desc->type, desc->length, 
+                    indent, i++, desc->name, desc->type, desc->length,
                     desc->instance, desc->ctype, desc->vsize, p + offset);
 
-            rv = tlv_parse_leaf(p + offset, desc, tlv);
+            rv = tlv_parse_leaf(p + offset, desc, pos, length);
             if (rv != OGS_OK) {
                 ogs_error("Can't parse leaf TLV");
                 return OGS_ERROR;
@@ -512,7 +562,7 @@ static int tlv_parse_compound(void *msg, ogs_tlv_desc_t *parent_desc,
             *presence_p = 1;
         }
 
-        tlv = tlv->next;
+        pos += length;
     }
 
     return OGS_OK;
@@ -521,9 +571,6 @@ static int tlv_parse_compound(void *msg, ogs_tlv_desc_t *parent_desc,
 int ogs_tlv_parse_msg(void *msg, ogs_tlv_desc_t *desc, ogs_pkbuf_t *pkbuf,
         int mode)
 {
-    int rv;
-    ogs_tlv_t *root;
-
     ogs_assert(msg);
     ogs_assert(desc);
     ogs_assert(pkbuf);
@@ -531,15 +578,10 @@ int ogs_tlv_parse_msg(void *msg, ogs_tlv_desc_t *desc, ogs_pkbuf_t *pkbuf,
     ogs_assert(desc->ctype == OGS_TLV_MESSAGE);
     ogs_assert(desc->child_descs[0]);
 
-    root = ogs_tlv_parse_block(pkbuf->len, pkbuf->data, mode);
-    if (root == NULL) {
+    if (pkbuf->len == 0) {
         ogs_error("Can't parse TLV message");
         return OGS_ERROR;
     }
 
-    rv = tlv_parse_compound(msg, desc, root, 0, mode);
-
-    ogs_tlv_free_all(root);
-
-    return rv;
+    return tlv_parse_compound(msg, desc, pkbuf->data, pkbuf->len, 0, mode);
 }
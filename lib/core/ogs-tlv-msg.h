@@ -60,6 +60,14 @@ typedef struct ogs_tlv_desc_s {
     uint8_t  instance;
     uint16_t vsize;
     void *child_descs[OGS_TLV_MAX_CHILD_DESC];
+
+    /*
+     * Generated switch over the children of a message or grouped IE.
+     * Returns the child descriptor with its slot in child_descs and its
+     * offset in the decoded structure. NULL to scan child_descs instead.
+     */
+    struct ogs_tlv_desc_s *(*find)(uint32_t type, uint8_t instance,
+            uint8_t *index, uint32_t *offset);
 } ogs_tlv_desc_t;
 
 extern ogs_tlv_desc_t ogs_tlv_desc_more1;
@@ -38,7 +38,8 @@
 #define IFNAMSIZ 32
 #endif
 
-ogs_socket_t ogs_tun_open(char *ifname, int len, int is_tap)
+static ogs_socket_t tun_open(
+        char *ifname, int len, int is_tap, bool multi_queue)
 {
     ogs_socket_t fd = INVALID_SOCKET;
 #if defined(__linux__)
@@ -49,6 +50,15 @@ ogs_socket_t ogs_tun_open(char *ifname, int len, int is_tap)
 
     ogs_assert(ifname);
 
+    if (multi_queue) {
+#if defined(IFF_MULTI_QUEUE)
+        flags |= IFF_MULTI_QUEUE;
+#else
+        ogs_error("IFF_MULTI_QUEUE is not supported");
+        return INVALID_SOCKET;
+#endif
+    }
+
     fd = open(dev, O_RDWR);
     if (fd < 0)
     {
@@ -62,6 +72,11 @@ ogs_socket_t ogs_tun_open(char *ifname, int len, int is_tap)
 
     ogs_assert(ifname);
 
+    if (multi_queue) {
+        ogs_error("Multi-queue TUN is not supported");
+        return INVALID_SOCKET;
+    }
+
 #define TUNTAP_ID_MAX 255
     for (tun = 0; tun < TUNTAP_ID_MAX; tun++)
     {
@@ -104,6 +119,20 @@ cleanup:
 #endif
 }
 
+ogs_socket_t ogs_tun_open(char *ifname, int len, int is_tap)
+{
+    return tun_open(ifname, len, is_tap, false);
+}
+
+/*
+ * Every call attaches one more queue to the same interface.
+ * The first queue of the interface must also be opened with this function.
+ */
+ogs_socket_t ogs_tun_open_multi_queue(char *ifname, int len, int is_tap)
+{
+    return tun_open(ifname, len, is_tap, true);
+}
+
 #define TUN_ALIGN(size, boundary) \
         (((size) + ((boundary) - 1)) & ~((boundary) - 1))
 
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include "core-config-private.h"
+
 #include "ogs-core.h"
 
 #undef OGS_LOG_DOMAIN
@@ -50,6 +52,11 @@ ogs_sock_t *ogs_udp_server(ogs_socknode_t *node)
             rv = ogs_listen_reusable(new->fd);
             ogs_assert(rv == OGS_OK);
 
+            if (node->option.reuseport) {
+                rv = ogs_listen_reuseport(new->fd);
+                ogs_assert(rv == OGS_OK);
+            }
+
             if (ogs_sock_bind(new, addr) == OGS_OK) {
                 ogs_debug("udp_server() [%s]:%d",
                         OGS_ADDR(addr, buf), OGS_PORT(addr));
@@ -139,3 +146,122 @@ int ogs_udp_connect(ogs_sock_t *sock, ogs_sockaddr_t *sa_list)
 
     return OGS_OK;
 }
+
+int ogs_recvmmsg(ogs_socket_t fd,
+        ogs_pkbuf_t **pkbuf, ogs_sockaddr_t *from, int num)
+{
+#if HAVE_RECVMMSG
+    struct mmsghdr msg[OGS_MAX_NUM_OF_UDP_BURST];
+    struct iovec iov[OGS_MAX_NUM_OF_UDP_BURST];
+    int i, n;
+
+    ogs_assert(fd != INVALID_SOCKET);
+    ogs_assert(pkbuf);
+    ogs_assert(from);
+    ogs_assert(num > 0 && num <= OGS_MAX_NUM_OF_UDP_BURST);
+
+    memset(msg, 0, sizeof(msg[0]) * num);
+    for (i = 0; i < num; i++) {
+        ogs_assert(pkbuf[i]);
+
+        iov[i].iov_base = pkbuf[i]->data;
+        iov[i].iov_len = pkbuf[i]->len;
+
+        memset(&from[i], 0, sizeof from[i]);
+        msg[i].msg_hdr.msg_name = &from[i].sa;
+        msg[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+        msg[i].msg_hdr.msg_iov = &iov[i];
+        msg[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    /* Do not block once the first datagram has arrived */
+    n = recvmmsg(fd, msg, num, MSG_WAITFORONE, NULL);
+    if (n < 0) {
+        if (ogs_socket_errno != OGS_EAGAIN)
+            ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                    "recvmmsg(num:%d) failed", num);
+        return -1;
+    }
+
+    for (i = 0; i < n; i++)
+        ogs_pkbuf_trim(pkbuf[i], msg[i].msg_len);
+
+    return n;
+#else
+    ssize_t size;
+
+    ogs_assert(pkbuf);
+    ogs_assert(pkbuf[0]);
+    ogs_assert(from);
+    ogs_assert(num > 0);
+
+    size = ogs_recvfrom(fd, pkbuf[0]->data, pkbuf[0]->len, 0, &from[0]);
+    if (size < 0)
+        return -1;
+
+    ogs_pkbuf_trim(pkbuf[0], size);
+
+    return 1;
+#endif
+}
+
+int ogs_sendmmsg(ogs_socket_t fd,
+        ogs_pkbuf_t **pkbuf, ogs_sockaddr_t *to, int num)
+{
+#if HAVE_SENDMMSG
+    struct mmsghdr msg[OGS_MAX_NUM_OF_UDP_BURST];
+    struct iovec iov[OGS_MAX_NUM_OF_UDP_BURST];
+    int i, n, sent;
+
+    ogs_assert(fd != INVALID_SOCKET);
+    ogs_assert(pkbuf);
+    ogs_assert(to);
+    ogs_assert(num > 0 && num <= OGS_MAX_NUM_OF_UDP_BURST);
+
+    memset(msg, 0, sizeof(msg[0]) * num);
+    for (i = 0; i < num; i++) {
+        ogs_assert(pkbuf[i]);
+
+        iov[i].iov_base = pkbuf[i]->data;
+        iov[i].iov_len = pkbuf[i]->len;
+
+        msg[i].msg_hdr.msg_name = &to[i].sa;
+        msg[i].msg_hdr.msg_namelen = ogs_sockaddr_len(&to[i]);
+        msg[i].msg_hdr.msg_iov = &iov[i];
+        msg[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    sent = 0;
+    while (sent < num) {
+        n = sendmmsg(fd, msg + sent, num - sent, 0);
+        if (n <= 0) {
+            if (ogs_socket_errno != OGS_EAGAIN)
+                ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                        "sendmmsg(num:%d) failed", num - sent);
+            break;
+        }
+        sent += n;
+    }
+
+    return sent ? sent : -1;
+#else
+    ssize_t size;
+    int i;
+
+    ogs_assert(pkbuf);
+    ogs_assert(to);
+
+    for (i = 0; i < num; i++) {
+        ogs_assert(pkbuf[i]);
+        size = ogs_sendto(fd, pkbuf[i]->data, pkbuf[i]->len, 0, &to[i]);
+        if (size < 0 || size != pkbuf[i]->len) {
+            if (ogs_socket_errno != OGS_EAGAIN)
+                ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
+                        "ogs_sendto() failed");
+            break;
+        }
+    }
+
+    return i ? i : -1;
+#endif
+}
@@ -33,6 +33,25 @@ ogs_sock_t *ogs_udp_server(ogs_socknode_t *node);
 ogs_sock_t *ogs_udp_client(ogs_socknode_t *node);
 int ogs_udp_connect(ogs_sock_t *sock, ogs_sockaddr_t *sa_list);
 
+#define OGS_MAX_NUM_OF_UDP_BURST 32
+
+/*
+ * Batched datagram I/O (recvmmsg/sendmmsg)
+ *
+ * ogs_recvmmsg() fills up to 'num' pkbufs with one system call.
+ * Every pkbuf must be put to its full capacity before the call.
+ * On return, the received pkbufs are trimmed to the datagram size.
+ *
+ * ogs_sendmmsg() transmits 'num' pkbufs, each to its own address.
+ * The pkbufs are not freed.
+ *
+ * Both return the number of datagrams processed, or -1 on error.
+ */
+int ogs_recvmmsg(ogs_socket_t fd,
+        ogs_pkbuf_t **pkbuf, ogs_sockaddr_t *from, int num);
+int ogs_sendmmsg(ogs_socket_t fd,
+        ogs_pkbuf_t **pkbuf, ogs_sockaddr_t *to, int num);
+
 #ifdef __cplusplus
 }
 #endif
@@ -28,12 +28,7 @@ int aes_128_encrypt_block(const uint8_t *key,
 int aes_128_encrypt_block(const uint8_t *key, 
     const uint8_t *in, uint8_t *out)
 {
-    const int key_bits = 128;
-    unsigned int rk[OGS_AES_RKLENGTH(128)];
-    int nrounds;
-
-    nrounds = ogs_aes_setup_enc(rk, key, key_bits);
-    ogs_aes_encrypt(rk, nrounds, in, out);
+    ogs_aes_encrypt_block(ogs_aes_key_lookup(key, 128), in, out);
 
     return 0;
 }
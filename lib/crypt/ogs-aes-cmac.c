@@ -61,12 +61,10 @@ static int _generate_subkey(uint8_t *k1, uint8_t *k2,
     };
     uint8_t L[16];
 
-    uint32_t rk[OGS_AES_RKLENGTH(OGS_AES_MAX_KEY_BITS)];
-    int i, nrounds;
+    int i;
 
     /* Step 1.  L := AES-128(K, const_Zero) */
-    nrounds = ogs_aes_setup_enc(rk, key, 128);
-    ogs_aes_encrypt(rk, nrounds, zero, L);
+    ogs_aes_encrypt_block(ogs_aes_key_lookup(key, 128), zero, L);
 
     /* Step 2.  if MSB(L) is equal to 0 */
     if ((L[0] & 0x80) == 0)
@@ -162,8 +160,7 @@ int ogs_aes_cmac_calculate(uint8_t *cmac, const uint8_t *key,
     uint8_t y[16], m_last[16];
     uint8_t k1[16], k2[16];
     int i, j, n, bs, flag;
-    uint32_t rk[OGS_AES_RKLENGTH(OGS_AES_MAX_KEY_BITS)];
-    int nrounds;
+    const ogs_aes_key_t *aes = NULL;
 
     ogs_assert(cmac);
     ogs_assert(key);
@@ -230,20 +227,20 @@ int ogs_aes_cmac_calculate(uint8_t *cmac, const uint8_t *key,
                 T := AES-128(K,Y);
      */
 
-    nrounds = ogs_aes_setup_enc(rk, key, 128);
+    aes = ogs_aes_key_lookup(key, 128);
 
     for (i = 0; i <= n - 2; i++)
     {
         bs = i * OGS_AES_BLOCK_SIZE;
         for (j = 0; j < 16; j++)
             y[j] = x[j] ^ msg[bs + j];
-        ogs_aes_encrypt(rk, nrounds, y, x);
+        ogs_aes_encrypt_block(aes, y, x);
     }
 
     bs = (n - 1) * OGS_AES_BLOCK_SIZE;
     for (j = 0; j < 16; j++)
         y[j] = m_last[j] ^ x[j];
-    ogs_aes_encrypt(rk, nrounds, y, cmac);
+    ogs_aes_encrypt_block(aes, y, cmac);
 
     return OGS_OK;
 }
@@ -19,6 +19,12 @@
 
 #include "ogs-crypt.h"
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define OGS_AES_HAVE_AESNI 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 #define FULL_UNROLL
 
 static const uint32_t Te0[256] =
@@ -1221,6 +1227,187 @@ void ogs_aes_decrypt(const uint32_t *rk, int nrounds, const uint8_t ciphertext[1
   PUTU32(plaintext + 12, s3);
 }
 
+#if OGS_AES_HAVE_AESNI
+static int aesni_supported(void)
+{
+    static volatile int supported = -1;
+
+    if (supported < 0) {
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        supported = __get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+            (ecx & bit_AES) ? 1 : 0;
+    }
+
+    return supported;
+}
+
+__attribute__((target("aes")))
+static void aesni_encrypt(const ogs_aes_key_t *aes,
+        const uint8_t in[16], uint8_t out[16])
+{
+    const __m128i *rk = (const __m128i *)aes->ni;
+    __m128i m;
+    int i;
+
+    m = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in),
+            _mm_loadu_si128(&rk[0]));
+    for (i = 1; i < aes->nrounds; i++)
+        m = _mm_aesenc_si128(m, _mm_loadu_si128(&rk[i]));
+    m = _mm_aesenclast_si128(m, _mm_loadu_si128(&rk[aes->nrounds]));
+
+    _mm_storeu_si128((__m128i *)out, m);
+}
+
+/* Four independent blocks in flight hide the AESENC latency */
+__attribute__((target("aes")))
+static void aesni_encrypt4(const ogs_aes_key_t *const aes[4],
+        const uint8_t in[][16], uint8_t out[][16])
+{
+    __m128i m[4];
+    int i, j;
+
+    for (j = 0; j < 4; j++)
+        m[j] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in[j]),
+                _mm_loadu_si128((const __m128i *)aes[j]->ni[0]));
+    for (i = 1; i < aes[0]->nrounds; i++)
+        for (j = 0; j < 4; j++)
+            m[j] = _mm_aesenc_si128(m[j],
+                    _mm_loadu_si128((const __m128i *)aes[j]->ni[i]));
+    for (j = 0; j < 4; j++) {
+        m[j] = _mm_aesenclast_si128(m[j],
+                _mm_loadu_si128((const __m128i *)aes[j]->ni[i]));
+        _mm_storeu_si128((__m128i *)out[j], m[j]);
+    }
+}
+#endif
+
+/**
+ * Expand the cipher key into an encryption key object. The schedule is
+ * also kept in the byte order the AES-NI instructions expect when the
+ * CPU supports them, and ogs_aes_encrypt_block() dispatches on it.
+ *
+ * @return the number of rounds for the given cipher key size.
+ */
+int ogs_aes_setup_key(ogs_aes_key_t *aes, const uint8_t *key, int keybits)
+{
+    int i;
+
+    ogs_assert(aes);
+    ogs_assert(key);
+
+    memset(aes, 0, sizeof(*aes));
+    aes->nrounds = ogs_aes_setup_enc(aes->rk, key, keybits);
+    aes->keybits = keybits;
+    memcpy(aes->key, key, OGS_AES_KEYLENGTH(keybits));
+
+#if OGS_AES_HAVE_AESNI
+    if (aesni_supported()) {
+        for (i = 0; i < 4 * (aes->nrounds + 1); i++)
+            PUTU32(aes->ni[i / 4] + 4 * (i % 4), aes->rk[i]);
+        aes->aesni = 1;
+    }
+#else
+    (void)i;
+#endif
+
+    return aes->nrounds;
+}
+
+void ogs_aes_encrypt_block(const ogs_aes_key_t *aes,
+        const uint8_t in[16], uint8_t out[16])
+{
+    ogs_assert(aes);
+
+#if OGS_AES_HAVE_AESNI
+    if (aes->aesni) {
+        aesni_encrypt(aes, in, out);
+        return;
+    }
+#endif
+
+    ogs_aes_encrypt(aes->rk, aes->nrounds, in, out);
+}
+
+/**
+ * Encrypt num independent blocks, in[i] under aes[i]. With AES-NI the
+ * blocks are interleaved four at a time when their keys have the same
+ * length, which is the common case of a batch of Milenage computations.
+ */
+void ogs_aes_encrypt_multi(const ogs_aes_key_t *const aes[],
+        const uint8_t in[][16], uint8_t out[][16], int num)
+{
+    int i = 0;
+
+    ogs_assert(aes);
+    ogs_assert(in);
+    ogs_assert(out);
+
+#if OGS_AES_HAVE_AESNI
+    for (; i + 4 <= num; i += 4) {
+        if (!aes[i]->aesni ||
+            aes[i+1]->nrounds != aes[i]->nrounds || !aes[i+1]->aesni ||
+            aes[i+2]->nrounds != aes[i]->nrounds || !aes[i+2]->aesni ||
+            aes[i+3]->nrounds != aes[i]->nrounds || !aes[i+3]->aesni)
+            break;
+        aesni_encrypt4(&aes[i], &in[i], &out[i]);
+    }
+#endif
+
+    for (; i < num; i++)
+        ogs_aes_encrypt_block(aes[i], in[i], out[i]);
+}
+
+/*
+ * Milenage runs up to seven blocks with the same K per vector, and NAS
+ * integrity/ciphering reuses K_NASint/K_NASenc for every message of a
+ * UE, so each thread keeps the last few expanded keys around. The slots
+ * hold K itself, so they are wiped on eviction and when the thread exits.
+ */
+#define OGS_AES_KEY_CACHE_SIZE 4
+
+static ogs_thread_local ogs_aes_key_t key_cache[OGS_AES_KEY_CACHE_SIZE];
+static ogs_thread_local unsigned int key_cache_next;
+static ogs_thread_local bool key_cache_armed;
+
+void ogs_aes_key_cache_clear(void)
+{
+    ogs_memzero(key_cache, sizeof(key_cache));
+    key_cache_next = 0;
+}
+
+/* The hook is gone once it has run : the next lookup arms it again */
+static void key_cache_release(void)
+{
+    ogs_aes_key_cache_clear();
+    key_cache_armed = false;
+}
+
+const ogs_aes_key_t *ogs_aes_key_lookup(const uint8_t *key, int keybits)
+{
+    ogs_aes_key_t *aes = NULL;
+    int i;
+
+    ogs_assert(key);
+
+    for (i = 0; i < OGS_AES_KEY_CACHE_SIZE; i++) {
+        aes = &key_cache[i];
+        if (aes->keybits == keybits &&
+            memcmp(aes->key, key, OGS_AES_KEYLENGTH(keybits)) == 0)
+            return aes;
+    }
+
+    if (!key_cache_armed) {
+        ogs_thread_at_exit(key_cache_release);
+        key_cache_armed = true;
+    }
+
+    aes = &key_cache[key_cache_next++ % OGS_AES_KEY_CACHE_SIZE];
+    ogs_memzero(aes, sizeof(*aes));
+    ogs_aes_setup_key(aes, key, keybits);
+
+    return aes;
+}
+
 int ogs_aes_cbc_encrypt(const uint8_t *key, const uint32_t keybits,
         uint8_t *ivec, const uint8_t *in, const uint32_t inlen,
         uint8_t *out, uint32_t *outlen)
@@ -1229,8 +1416,7 @@ int ogs_aes_cbc_encrypt(const uint8_t *key, const uint32_t keybits,
     uint32_t len = inlen;
     const uint8_t *iv = ivec;
 
-    uint32_t rk[OGS_AES_RKLENGTH(OGS_AES_MAX_KEY_BITS)];
-    int nrounds;
+    const ogs_aes_key_t *aes = NULL;
 
     ogs_assert(key);
     ogs_assert(keybits >= 128);
@@ -1247,13 +1433,13 @@ int ogs_aes_cbc_encrypt(const uint8_t *key, const uint32_t keybits,
 
     *outlen = ((inlen - 1) / OGS_AES_BLOCK_SIZE + 1) * OGS_AES_BLOCK_SIZE;
 
-    nrounds = ogs_aes_setup_enc(rk, key, keybits);
+    aes = ogs_aes_key_lookup(key, keybits);
 
     while (len >= OGS_AES_BLOCK_SIZE)
     {
         for(n=0; n < OGS_AES_BLOCK_SIZE; ++n)
             out[n] = in[n] ^ iv[n];
-        ogs_aes_encrypt(rk, nrounds, out, out);
+        ogs_aes_encrypt_block(aes, out, out);
         iv = out;
         len -= OGS_AES_BLOCK_SIZE;
         in += OGS_AES_BLOCK_SIZE;
@@ -1266,7 +1452,7 @@ int ogs_aes_cbc_encrypt(const uint8_t *key, const uint32_t keybits,
             out[n] = in[n] ^ iv[n];
         for(n=len; n < OGS_AES_BLOCK_SIZE; ++n)
             out[n] = iv[n];
-        ogs_aes_encrypt(rk, nrounds, out, out);
+        ogs_aes_encrypt_block(aes, out, out);
         iv = out;
     }
 
@@ -1403,8 +1589,7 @@ int ogs_aes_ctr128_encrypt(const uint8_t *key,
     uint8_t ecount_buf[16];
     uint32_t len = inlen;
 
-    uint32_t rk[OGS_AES_RKLENGTH(OGS_AES_MAX_KEY_BITS)];
-    int nrounds;
+    const ogs_aes_key_t *aes = NULL;
 
     uint32_t n = 0;
     size_t l = 0;
@@ -1416,7 +1601,7 @@ int ogs_aes_ctr128_encrypt(const uint8_t *key,
     ogs_assert(out);
 
     memset(ecount_buf, 0, 16);
-    nrounds = ogs_aes_setup_enc(rk, key, 128);
+    aes = ogs_aes_key_lookup(key, 128);
 
     while (n && len) 
     {
@@ -1427,7 +1612,7 @@ int ogs_aes_ctr128_encrypt(const uint8_t *key,
 
     while (len >= 16) 
     {
-        ogs_aes_encrypt(rk, nrounds, ivec, ecount_buf);
+        ogs_aes_encrypt_block(aes, ivec, ecount_buf);
         ctr128_inc_aligned(ivec);
         for (n = 0; n < 16; n += sizeof(size_t))
             *(size_t *)(out + n) =
@@ -1439,7 +1624,7 @@ int ogs_aes_ctr128_encrypt(const uint8_t *key,
     }
     if (len) 
     {
-        ogs_aes_encrypt(rk, nrounds, ivec, ecount_buf);
+        ogs_aes_encrypt_block(aes, ivec, ecount_buf);
         ctr128_inc_aligned(ivec);
         while (len--) 
         {
@@ -1454,7 +1639,7 @@ int ogs_aes_ctr128_encrypt(const uint8_t *key,
     {
         if (n == 0) 
         {
-            ogs_aes_encrypt(rk, nrounds, ivec, ecount_buf);
+            ogs_aes_encrypt_block(aes, ivec, ecount_buf);
             ctr128_inc(ivec);
         }
         out[l] = in[l] ^ ecount_buf[n];
@@ -43,6 +43,25 @@ void ogs_aes_encrypt(const uint32_t *rk, int nrounds,
 void ogs_aes_decrypt(const uint32_t *rk, int nrounds,
         const uint8_t ciphertext[16], uint8_t plaintext[16]);
 
+typedef struct ogs_aes_key_s {
+    uint32_t rk[OGS_AES_RKLENGTH(OGS_AES_MAX_KEY_BITS)];
+    int nrounds;
+    int keybits;
+    uint8_t key[OGS_AES_KEYLENGTH(OGS_AES_MAX_KEY_BITS)];
+
+    int aesni;
+    uint8_t ni[OGS_AES_NROUNDS(OGS_AES_MAX_KEY_BITS)+1][OGS_AES_BLOCK_SIZE];
+} ogs_aes_key_t;
+
+int ogs_aes_setup_key(ogs_aes_key_t *aes, const uint8_t *key, int keybits);
+void ogs_aes_encrypt_block(const ogs_aes_key_t *aes,
+        const uint8_t in[16], uint8_t out[16]);
+void ogs_aes_encrypt_multi(const ogs_aes_key_t *const aes[],
+        const uint8_t in[][16], uint8_t out[][16], int num);
+const ogs_aes_key_t *ogs_aes_key_lookup(const uint8_t *key, int keybits);
+/* Wipes the calling thread's key cache; also done when it exits */
+void ogs_aes_key_cache_clear(void);
+
 int ogs_aes_cbc_encrypt(const uint8_t *key,
         const uint32_t keybits, uint8_t *ivec,
         const uint8_t *in, const uint32_t inlen,
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-crypt.h"
+
+/*
+ * Vectors are produced OGS_AUC_CHUNK at a time. All AES work of a stage
+ * is handed to ogs_aes_encrypt_multi() together so that the AES-NI
+ * backend can keep several blocks in flight: first TEMP = E_K(RAND ^ OPc)
+ * for every input, then OUT1..OUT4, which only depend on TEMP.
+ * TEMP is computed once per vector instead of once in milenage_f1()
+ * and again in milenage_f2345().
+ */
+#define OGS_AUC_CHUNK 8
+
+static void milenage_chunk(
+        const ogs_auc_input_t *in, ogs_auc_vector_t *out, int num)
+{
+    ogs_aes_key_t key[OGS_AUC_CHUNK];
+    const ogs_aes_key_t *aes[OGS_AUC_CHUNK*4];
+    uint8_t blk[OGS_AUC_CHUNK*4][16], temp[OGS_AUC_CHUNK][16];
+    uint8_t t[16];
+    int n, i;
+
+    ogs_assert(num > 0 && num <= OGS_AUC_CHUNK);
+
+    for (n = 0; n < num; n++) {
+        ogs_assert(in[n].k);
+        ogs_assert(in[n].opc);
+        ogs_assert(in[n].amf);
+        ogs_assert(in[n].sqn);
+        ogs_assert(in[n].rand);
+
+        /* Several vectors for one subscriber share the key schedule */
+        if (n && memcmp(in[n].k, in[n-1].k, OGS_KEY_LEN) == 0)
+            aes[n] = aes[n-1];
+        else {
+            ogs_aes_setup_key(&key[n], in[n].k, 128);
+            aes[n] = &key[n];
+        }
+
+        /* TEMP = E_K(RAND XOR OP_C) */
+        for (i = 0; i < 16; i++)
+            blk[n][i] = in[n].rand[i] ^ in[n].opc[i];
+    }
+    ogs_aes_encrypt_multi(aes, (const uint8_t (*)[16])blk, temp, num);
+
+    for (n = num - 1; n >= 0; n--) {
+        const uint8_t *opc = in[n].opc;
+        uint8_t *b = blk[4*n];
+
+        aes[4*n] = aes[4*n+1] = aes[4*n+2] = aes[4*n+3] = aes[n];
+
+        /* OUT1 = E_K(TEMP XOR rot(IN1 XOR OP_C, r1) XOR c1) XOR OP_C
+         * IN1 = SQN || AMF || SQN || AMF, r1 = 8 bytes, c1 = 0 */
+        memcpy(t, in[n].sqn, OGS_SQN_LEN);
+        memcpy(t + 6, in[n].amf, OGS_AMF_LEN);
+        memcpy(t + 8, t, 8);
+        for (i = 0; i < 16; i++)
+            b[(i + 8) % 16] = t[i] ^ opc[i];
+        for (i = 0; i < 16; i++)
+            b[i] ^= temp[n][i];
+
+        /* OUT2, OUT3, OUT4 = E_K(rot(TEMP XOR OP_C, r) XOR c) XOR OP_C
+         * r2 = 0, r3 = 4 bytes, r4 = 8 bytes; c2 = 1, c3 = 2, c4 = 4 */
+        b += 16;
+        for (i = 0; i < 16; i++)
+            b[i] = temp[n][i] ^ opc[i];
+        b[15] ^= 1;
+
+        b += 16;
+        for (i = 0; i < 16; i++)
+            b[(i + 12) % 16] = temp[n][i] ^ opc[i];
+        b[15] ^= 2;
+
+        b += 16;
+        for (i = 0; i < 16; i++)
+            b[(i + 8) % 16] = temp[n][i] ^ opc[i];
+        b[15] ^= 4;
+    }
+    ogs_aes_encrypt_multi(aes, (const uint8_t (*)[16])blk, blk, 4 * num);
+
+    for (n = 0; n < num; n++) {
+        const uint8_t *opc = in[n].opc;
+        ogs_auc_vector_t *v = &out[n];
+
+        for (i = 0; i < 16; i++) {
+            blk[4*n][i] ^= opc[i];
+            blk[4*n+1][i] ^= opc[i];
+            v->ck[i] = blk[4*n+2][i] ^ opc[i];
+            v->ik[i] = blk[4*n+3][i] ^ opc[i];
+        }
+
+        /* f2 and f5 */
+        memcpy(v->xres, blk[4*n+1] + 8, 8);
+        v->xres_len = 8;
+        memcpy(v->ak, blk[4*n+1], OGS_AK_LEN);
+
+        /* AUTN = (SQN ^ AK) || AMF || MAC-A */
+        for (i = 0; i < OGS_SQN_LEN; i++)
+            v->autn[i] = in[n].sqn[i] ^ v->ak[i];
+        memcpy(v->autn + 6, in[n].amf, OGS_AMF_LEN);
+        memcpy(v->autn + 8, blk[4*n], 8);
+    }
+
+    /* TEMP and the blocks are derived from K */
+    ogs_memzero(key, sizeof(key));
+    ogs_memzero(temp, sizeof(temp));
+    ogs_memzero(blk, sizeof(blk));
+    ogs_memzero(t, sizeof(t));
+}
+
+void ogs_auc_milenage(
+        const ogs_auc_input_t *in, ogs_auc_vector_t *out, int num)
+{
+    int n;
+
+    ogs_assert(in);
+    ogs_assert(out);
+
+    for (n = 0; n < num; n += OGS_AUC_CHUNK)
+        milenage_chunk(in + n, out + n, ogs_min(num - n, OGS_AUC_CHUNK));
+}
+
+void ogs_auc_eps_vectors(const uint8_t *plmn_id,
+        const ogs_auc_input_t *in, ogs_auc_vector_t *out, int num)
+{
+    int n;
+
+    ogs_assert(plmn_id);
+
+    ogs_auc_milenage(in, out, num);
+
+    for (n = 0; n < num; n++)
+        ogs_auc_kasme(out[n].ck, out[n].ik,
+                plmn_id, in[n].sqn, out[n].ak, out[n].kasme);
+}
+
+void ogs_auc_5g_vectors(char *serving_network_name,
+        const ogs_auc_input_t *in, ogs_auc_vector_t *out, int num)
+{
+    int n;
+
+    ogs_assert(serving_network_name);
+
+    ogs_auc_milenage(in, out, num);
+
+    for (n = 0; n < num; n++) {
+        ogs_kdf_kausf(out[n].ck, out[n].ik,
+                serving_network_name, out[n].autn, out[n].kausf);
+        ogs_kdf_xres_star(out[n].ck, out[n].ik,
+                serving_network_name, (uint8_t *)in[n].rand,
+                out[n].xres, out[n].xres_len, out[n].xres_star);
+    }
+}
+
+/*
+ * OPc only changes with K or OP, yet the HSS derives it on every
+ * Authentication-Information-Request for subscribers provisioned with OP.
+ * The entries hold K and OP, so they are wiped on replacement and when
+ * the thread exits.
+ */
+#define OGS_AUC_OPC_CACHE_SIZE 256
+
+typedef struct opc_cache_s {
+    bool valid;
+    uint8_t k[OGS_KEY_LEN];
+    uint8_t op[OGS_KEY_LEN];
+    uint8_t opc[OGS_KEY_LEN];
+} opc_cache_t;
+
+static ogs_thread_local opc_cache_t opc_cache[OGS_AUC_OPC_CACHE_SIZE];
+static ogs_thread_local bool opc_cache_armed;
+
+void ogs_auc_opc_cache_clear(void)
+{
+    ogs_memzero(opc_cache, sizeof(opc_cache));
+}
+
+/* The hook is gone once it has run : the next miss arms it again */
+static void opc_cache_release(void)
+{
+    ogs_auc_opc_cache_clear();
+    opc_cache_armed = false;
+}
+
+void ogs_auc_opc(const uint8_t *k, const uint8_t *op, uint8_t *opc)
+{
+    opc_cache_t *entry = NULL;
+    unsigned int hash = 0;
+    int i;
+
+    ogs_assert(k);
+    ogs_assert(op);
+    ogs_assert(opc);
+
+    for (i = 0; i < OGS_KEY_LEN; i++)
+        hash = hash * 31 + k[i];
+    entry = &opc_cache[hash % OGS_AUC_OPC_CACHE_SIZE];
+
+    if (!entry->valid ||
+        memcmp(entry->k, k, OGS_KEY_LEN) != 0 ||
+        memcmp(entry->op, op, OGS_KEY_LEN) != 0) {
+        if (!opc_cache_armed) {
+            ogs_thread_at_exit(opc_cache_release);
+            opc_cache_armed = true;
+        }
+
+        ogs_memzero(entry, sizeof(*entry));
+        milenage_opc(k, op, entry->opc);
+        memcpy(entry->k, k, OGS_KEY_LEN);
+        memcpy(entry->op, op, OGS_KEY_LEN);
+        entry->valid = true;
+    }
+
+    memcpy(opc, entry->opc, OGS_KEY_LEN);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_CRYPT_INSIDE) && !defined(OGS_CRYPT_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_AUC_H
+#define OGS_AUC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Batched authentication vector generation for the HSS and the UDM.
+ *
+ * Each input describes one vector to produce. Several inputs may refer
+ * to the same subscriber (consecutive SQNs, fresh RANDs) when more than
+ * one vector is requested at a time.
+ */
+typedef struct ogs_auc_input_s {
+    const uint8_t *k;                   /* OGS_KEY_LEN */
+    const uint8_t *opc;                 /* OGS_KEY_LEN */
+    const uint8_t *amf;                 /* OGS_AMF_LEN */
+    const uint8_t *sqn;                 /* OGS_SQN_LEN */
+    const uint8_t *rand;                /* OGS_RAND_LEN */
+} ogs_auc_input_t;
+
+typedef struct ogs_auc_vector_s {
+    uint8_t autn[OGS_AUTN_LEN];
+    uint8_t xres[OGS_MAX_RES_LEN];
+    size_t xres_len;
+    uint8_t ck[OGS_KEY_LEN];
+    uint8_t ik[OGS_KEY_LEN];
+    uint8_t ak[OGS_AK_LEN];
+
+    /* EPS-AKA : TS33.401 Annex A.2 */
+    uint8_t kasme[OGS_SHA256_DIGEST_SIZE];
+
+    /* 5G-AKA : TS33.501 Annex A.2 and A.4 */
+    uint8_t xres_star[OGS_KEY_LEN];
+    uint8_t kausf[OGS_SHA256_DIGEST_SIZE];
+} ogs_auc_vector_t;
+
+/* milenage_generate() for num inputs at once */
+void ogs_auc_milenage(
+        const ogs_auc_input_t *in, ogs_auc_vector_t *out, int num);
+
+/* Milenage followed by the KASME derivation for the given serving PLMN */
+void ogs_auc_eps_vectors(const uint8_t *plmn_id,
+        const ogs_auc_input_t *in, ogs_auc_vector_t *out, int num);
+
+/* Milenage followed by the KAUSF and XRES* derivations */
+void ogs_auc_5g_vectors(char *serving_network_name,
+        const ogs_auc_input_t *in, ogs_auc_vector_t *out, int num);
+
+/* milenage_opc() with a per-thread cache keyed by K and OP */
+void ogs_auc_opc(const uint8_t *k, const uint8_t *op, uint8_t *opc);
+/* Wipes the calling thread's cache; also done when the thread exits */
+void ogs_auc_opc_cache_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_AUC_H */
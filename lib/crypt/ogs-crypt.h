@@ -22,6 +22,23 @@
 
 #include "ogs-core.h"
 
+#define OGS_KEY_LEN                     16
+#define OGS_AMF_LEN                     2
+#define OGS_RAND_LEN                    16
+#define OGS_AUTN_LEN                    16
+#define OGS_AUTS_LEN                    14
+#define OGS_MAX_RES_LEN                 16
+#define OGS_MAC_S_LEN                   8
+
+#define OGS_SQN_XOR_AK_LEN              6
+#define OGS_AK_LEN                      6
+#define OGS_SQN_LEN                     6
+#define OGS_MAX_SQN                     0xffffffffffff
+
+#define OGS_HASH_MME_LEN                8
+
+#define OGS_KEYSTRLEN(x)                ((x*2)+1)
+
 #define OGS_CRYPT_INSIDE
 
 #include "crypt/ogs-sha1.h"
@@ -37,33 +54,9 @@
 #include "crypt/kasumi.h"
 
 #include "crypt/ogs-kdf.h"
+#include "crypt/ogs-auc.h"
 #include "crypt/ogs-base64.h"
 
 #undef OGS_CRYPT_INSIDE
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#define OGS_KEY_LEN                     16
-#define OGS_AMF_LEN                     2
-#define OGS_RAND_LEN                    16
-#define OGS_AUTN_LEN                    16
-#define OGS_AUTS_LEN                    14
-#define OGS_MAX_RES_LEN                 16
-#define OGS_MAC_S_LEN                   8
-
-#define OGS_SQN_XOR_AK_LEN              6
-#define OGS_AK_LEN                      6
-#define OGS_SQN_LEN                     6
-#define OGS_MAX_SQN                     0xffffffffffff
-
-#define OGS_HASH_MME_LEN                8
-
-#define OGS_KEYSTRLEN(x)                ((x*2)+1)
-
-#ifdef __cplusplus
-}
-#endif
-
 #endif /* OGS_CRYPT_H */
@@ -15,24 +15,34 @@ typedef uint8_t u8;
 typedef uint32_t u32;
 typedef uint64_t u64;
 
+/* Keystream generator state: the 16 LFSR words, kept as a ring
+* starting at s[i], and the three FSM registers.
+*/
+typedef struct snow_3g_ctx_s {
+	u32 s[16];
+	u32 i;
+	u32 R1, R2, R3;
+} snow_3g_ctx_t;
+
 /* Initialization.
 * Input k[4]: Four 32-bit words making up 128-bit key.
 * Input IV[4]: Four 32-bit words making 128-bit initialization variable.
-* Output: All the LFSRs and FSM are initialized for key generation.
+* Output: All the LFSRs and FSM in ctx are initialized for key generation.
 * See Section 4.1.
 */
 
-void snow_3g_initialize(u32 k[4], u32 IV[4]);
+void snow_3g_initialize(snow_3g_ctx_t *ctx, u32 k[4], u32 IV[4]);
 
 /* Generation of Keystream.
 * input n: number of 32-bit words of keystream.
 * input z: space for the generated keystream, assumes
 * memory is allocated already.
 * output: generated keystream which is filled in z
+* The keystream continues from where the previous call on ctx left off.
 * See section 4.2.
 */
 
-void snow_3g_generate_key_stream(u32 n, u32 *z);
+void snow_3g_generate_key_stream(snow_3g_ctx_t *ctx, u32 n, u32 *z);
 
 /* f8.
 * Input key: 128 bit Confidentiality Key.
@@ -21,15 +21,26 @@ extern "C" {
 typedef uint8_t u8;
 typedef uint32_t u32;
 
+/* keystream generator state: the 16 LFSR cells, kept as a ring starting
+ * at s[i], the F registers and the BitReorganization outputs */
+typedef struct zuc_ctx_s {
+    u32 s[16];
+    u32 i;
+    u32 R1, R2;
+    u32 X0, X1, X2, X3;
+} zuc_ctx_t;
+
 /*
  * ZUC keystream generator
+ * ctx: generator state (output of zuc_initialize, updated by each call)
  * k: secret key (input, 16 bytes)
  * iv: initialization vector (input, 16 bytes)
  * Keystream: produced keystream (output, variable length)
- * KeystreamLen: length in bits requested for the keystream (input)
+ * KeystreamLen: length in 32-bit words requested for the keystream (input)
 */
-void zuc_initialize(u8* k, u8* iv);
-void zuc_generate_key_stream(u32* pKeystream, u32 KeystreamLen);
+void zuc_initialize(zuc_ctx_t *ctx, u8* k, u8* iv);
+void zuc_generate_key_stream(zuc_ctx_t *ctx,
+        u32* pKeystream, u32 KeystreamLen);
 
 /*
  * CK: ciphering key
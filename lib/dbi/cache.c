@@ -0,0 +1,503 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-dbi.h"
+
+#define WATCH_AWAIT_MSEC        1000
+#define WATCH_RETRY_INTERVAL    ogs_time_from_sec(1)
+
+typedef struct ogs_dbi_cache_entry_s {
+    ogs_lnode_t lnode;          /* LRU order, least recently used first */
+
+    char *supi;
+    bson_oid_t oid;             /* Document '_id' for change events */
+
+    bool auth_info_presence;
+    ogs_dbi_auth_info_t auth_info;
+
+    bool subscription_data_presence;
+    ogs_subscription_data_t subscription_data;
+} ogs_dbi_cache_entry_t;
+
+static struct {
+    bool initialized;
+
+    ogs_thread_mutex_t mutex;
+
+    /* The fields below are protected by the mutex */
+    bool enabled;               /* The change stream is up */
+    uint64_t generation;        /* Bumped on every invalidation */
+
+    int max;
+    int num_of_entry;
+    ogs_list_t lru_list;
+    ogs_hash_t *supi_hash;
+    ogs_hash_t *oid_hash;
+
+    /* Owned by the watcher thread */
+    ogs_thread_t *thread;
+    int stop;
+
+    mongoc_client_t *client;
+    mongoc_collection_t *collection;
+} self;
+
+static OGS_CPOOL(entry_pool, ogs_dbi_cache_entry_t);
+
+/* Called with self.mutex held */
+static void entry_remove(ogs_dbi_cache_entry_t *entry)
+{
+    ogs_assert(entry);
+
+    ogs_list_remove(&self.lru_list, entry);
+    ogs_hash_set(self.supi_hash, entry->supi, OGS_HASH_KEY_STRING, NULL);
+    ogs_hash_set(self.oid_hash, &entry->oid, sizeof(entry->oid), NULL);
+
+    ogs_free(entry->supi);
+    ogs_cpool_free(&entry_pool, entry);
+
+    self.num_of_entry--;
+}
+
+/* Called with self.mutex held */
+static void entry_remove_all(void)
+{
+    ogs_dbi_cache_entry_t *entry = NULL, *next_entry = NULL;
+
+    ogs_list_for_each_safe(&self.lru_list, next_entry, entry)
+        entry_remove(entry);
+
+    self.generation++;
+}
+
+/* Called with self.mutex held */
+static ogs_dbi_cache_entry_t *entry_find(const char *supi)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+
+    entry = ogs_hash_get(self.supi_hash, supi, OGS_HASH_KEY_STRING);
+    if (entry) {
+        ogs_list_remove(&self.lru_list, entry);
+        ogs_list_add(&self.lru_list, entry);
+    }
+
+    return entry;
+}
+
+/* Called with self.mutex held */
+static ogs_dbi_cache_entry_t *entry_find_or_add(
+        const char *supi, const bson_oid_t *oid)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+
+    entry = entry_find(supi);
+    if (entry) {
+        if (!bson_oid_equal(&entry->oid, oid)) {
+            /* The document was replaced; start over */
+            entry_remove(entry);
+            entry = NULL;
+        } else
+            return entry;
+    }
+
+    if (self.num_of_entry >= self.max)
+        entry_remove(ogs_list_first(&self.lru_list));
+
+    ogs_cpool_alloc(&entry_pool, &entry);
+    ogs_assert(entry);
+    memset(entry, 0, sizeof(*entry));
+
+    entry->supi = ogs_strdup(supi);
+    ogs_assert(entry->supi);
+    bson_oid_copy(oid, &entry->oid);
+
+    ogs_hash_set(self.supi_hash, entry->supi, OGS_HASH_KEY_STRING, entry);
+    ogs_hash_set(self.oid_hash, &entry->oid, sizeof(entry->oid), entry);
+    ogs_list_add(&self.lru_list, entry);
+
+    self.num_of_entry++;
+
+    return entry;
+}
+
+uint64_t ogs_dbi_cache_generation(void)
+{
+    uint64_t generation;
+
+    if (self.initialized == false)
+        return 0;
+
+    ogs_thread_mutex_lock(&self.mutex);
+    generation = self.generation;
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return generation;
+}
+
+bool ogs_dbi_cache_get_auth_info(
+        const char *supi, ogs_dbi_auth_info_t *auth_info)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+    bool found = false;
+
+    ogs_assert(supi);
+    ogs_assert(auth_info);
+
+    if (self.initialized == false)
+        return false;
+
+    ogs_thread_mutex_lock(&self.mutex);
+    if (self.enabled) {
+        entry = entry_find(supi);
+        if (entry && entry->auth_info_presence) {
+            memcpy(auth_info, &entry->auth_info, sizeof(*auth_info));
+            found = true;
+        }
+    }
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return found;
+}
+
+void ogs_dbi_cache_put_auth_info(const char *supi, const bson_oid_t *oid,
+        uint64_t generation, const ogs_dbi_auth_info_t *auth_info)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(oid);
+    ogs_assert(auth_info);
+
+    if (self.initialized == false)
+        return;
+
+    ogs_thread_mutex_lock(&self.mutex);
+    if (self.enabled && generation == self.generation) {
+        entry = entry_find_or_add(supi, oid);
+        ogs_assert(entry);
+
+        memcpy(&entry->auth_info, auth_info, sizeof(*auth_info));
+        entry->auth_info.sqn = 0; /* SQN is always read from the DB */
+        entry->auth_info_presence = true;
+    }
+    ogs_thread_mutex_unlock(&self.mutex);
+}
+
+bool ogs_dbi_cache_get_subscription_data(
+        const char *supi, ogs_subscription_data_t *subscription_data)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+    bool found = false;
+
+    ogs_assert(supi);
+    ogs_assert(subscription_data);
+
+    if (self.initialized == false)
+        return false;
+
+    ogs_thread_mutex_lock(&self.mutex);
+    if (self.enabled) {
+        entry = entry_find(supi);
+        if (entry && entry->subscription_data_presence) {
+            memcpy(subscription_data, &entry->subscription_data,
+                    sizeof(*subscription_data));
+            found = true;
+        }
+    }
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    return found;
+}
+
+void ogs_dbi_cache_put_subscription_data(
+        const char *supi, const bson_oid_t *oid, uint64_t generation,
+        const ogs_subscription_data_t *subscription_data)
+{
+    ogs_dbi_cache_entry_t *entry = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(oid);
+    ogs_assert(subscription_data);
+
+    if (self.initialized == false)
+        return;
+
+    ogs_thread_mutex_lock(&self.mutex);
+    if (self.enabled && generation == self.generation) {
+        entry = entry_find_or_add(supi, oid);
+        ogs_assert(entry);
+
+        memcpy(&entry->subscription_data, subscription_data,
+                sizeof(*subscription_data));
+        entry->subscription_data_presence = true;
+    }
+    ogs_thread_mutex_unlock(&self.mutex);
+}
+
+/* Our own SQN updates must not throw the entry away */
+static bool event_is_sqn_only(const bson_t *document)
+{
+    bson_iter_t iter, child1_iter, child2_iter;
+
+    if (!bson_iter_init_find(&iter, document, "updateDescription") ||
+        !BSON_ITER_HOLDS_DOCUMENT(&iter))
+        return false;
+
+    bson_iter_recurse(&iter, &child1_iter);
+    while (bson_iter_next(&child1_iter)) {
+        const char *child1_key = bson_iter_key(&child1_iter);
+
+        if (!strcmp(child1_key, "updatedFields") &&
+            BSON_ITER_HOLDS_DOCUMENT(&child1_iter)) {
+            bson_iter_recurse(&child1_iter, &child2_iter);
+            while (bson_iter_next(&child2_iter)) {
+                if (strcmp(bson_iter_key(&child2_iter), "security.sqn"))
+                    return false;
+            }
+        } else if (BSON_ITER_HOLDS_ARRAY(&child1_iter)) {
+            /* removedFields, truncatedArrays */
+            bson_iter_recurse(&child1_iter, &child2_iter);
+            if (bson_iter_next(&child2_iter))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool ogs_dbi_cache_handle_event(const bson_t *document)
+{
+    bson_iter_t iter, child1_iter;
+    const char *operation = NULL;
+    const bson_oid_t *oid = NULL;
+    ogs_dbi_cache_entry_t *entry = NULL;
+
+    ogs_assert(document);
+
+    if (self.initialized == false)
+        return true;
+
+    if (bson_iter_init_find(&iter, document, "operationType") &&
+        BSON_ITER_HOLDS_UTF8(&iter))
+        operation = bson_iter_utf8(&iter, NULL);
+
+    if (operation) {
+        /* Lookups that missed are not cached, so nothing can be stale */
+        if (!strcmp(operation, "insert"))
+            return true;
+        if (!strcmp(operation, "update") && event_is_sqn_only(document))
+            return true;
+    }
+
+    if (bson_iter_init_find(&iter, document, "documentKey") &&
+        BSON_ITER_HOLDS_DOCUMENT(&iter) &&
+        bson_iter_recurse(&iter, &child1_iter) &&
+        bson_iter_find(&child1_iter, "_id") &&
+        BSON_ITER_HOLDS_OID(&child1_iter))
+        oid = bson_iter_oid(&child1_iter);
+
+    ogs_thread_mutex_lock(&self.mutex);
+    if (oid) {
+        entry = ogs_hash_get(self.oid_hash, oid, sizeof(*oid));
+        if (entry)
+            entry_remove(entry);
+        self.generation++;
+    } else {
+        /* drop, rename, dropDatabase, invalidate */
+        entry_remove_all();
+    }
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    if (operation && !strcmp(operation, "invalidate"))
+        return false;
+
+    return true;
+}
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 9
+static mongoc_change_stream_t *watch_open(void)
+{
+    mongoc_change_stream_t *stream = NULL;
+    bson_t pipeline = BSON_INITIALIZER;
+    bson_t *opts = NULL;
+    const bson_t *reply = NULL;
+    bson_error_t error;
+
+    opts = BCON_NEW("maxAwaitTimeMS", BCON_INT64(WATCH_AWAIT_MSEC));
+    stream = mongoc_collection_watch(self.collection, &pipeline, opts);
+    ogs_assert(stream);
+
+    bson_destroy(opts);
+    bson_destroy(&pipeline);
+
+    if (mongoc_change_stream_error_document(stream, &error, &reply)) {
+        ogs_warn("Cannot watch subscribers: %s", error.message);
+        mongoc_change_stream_destroy(stream);
+        return NULL;
+    }
+
+    return stream;
+}
+
+static void watch_main(void *data)
+{
+    mongoc_change_stream_t *stream = data;
+    const bson_t *document = NULL;
+    const bson_t *reply = NULL;
+    bson_error_t error;
+
+    while (!ogs_atomic_load(&self.stop)) {
+        if (!stream) {
+            ogs_usleep(WATCH_RETRY_INTERVAL);
+
+            stream = watch_open();
+            if (!stream)
+                continue;
+
+            ogs_thread_mutex_lock(&self.mutex);
+            self.enabled = true;
+            ogs_thread_mutex_unlock(&self.mutex);
+
+            ogs_info("Subscriber cache resumed");
+        }
+
+        if (mongoc_change_stream_next(stream, &document)) {
+            if (ogs_dbi_cache_handle_event(document))
+                continue;
+        } else if (!mongoc_change_stream_error_document(
+                    stream, &error, &reply)) {
+            continue; /* maxAwaitTimeMS expired */
+        } else {
+            ogs_error("Change stream failure: %s", error.message);
+        }
+
+        /* Events may have been missed; nothing cached can be trusted */
+        mongoc_change_stream_destroy(stream);
+        stream = NULL;
+
+        ogs_thread_mutex_lock(&self.mutex);
+        self.enabled = false;
+        entry_remove_all();
+        ogs_thread_mutex_unlock(&self.mutex);
+
+        ogs_warn("Subscriber cache suspended");
+    }
+
+    if (stream)
+        mongoc_change_stream_destroy(stream);
+}
+#endif
+
+static void cache_free(void)
+{
+    if (self.collection)
+        ogs_mongoc_collection_put(self.collection, self.client);
+
+    ogs_hash_destroy(self.oid_hash);
+    ogs_hash_destroy(self.supi_hash);
+    ogs_cpool_final(&entry_pool);
+
+    ogs_thread_mutex_destroy(&self.mutex);
+}
+
+static void cache_create(int max)
+{
+    memset(&self, 0, sizeof(self));
+
+    ogs_thread_mutex_init(&self.mutex);
+
+    self.max = max;
+    ogs_list_init(&self.lru_list);
+    self.supi_hash = ogs_hash_make();
+    ogs_assert(self.supi_hash);
+    self.oid_hash = ogs_hash_make();
+    ogs_assert(self.oid_hash);
+    ogs_cpool_init(&entry_pool, max, OGS_CPOOL_DEFAULT_CHUNK);
+}
+
+int ogs_dbi_cache_init(int max)
+{
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 9
+    mongoc_change_stream_t *stream = NULL;
+#endif
+
+    ogs_assert(self.initialized == false);
+
+    if (max <= 0)
+        return OGS_OK;
+
+#if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 9
+    cache_create(max);
+
+    self.collection = ogs_mongoc_collection_get("subscribers", &self.client);
+    ogs_assert(self.collection);
+
+    stream = watch_open();
+    if (!stream) {
+        ogs_warn("Subscriber cache disabled: "
+                "change streams need a replica set");
+        cache_free();
+        return OGS_OK;
+    }
+
+    self.enabled = true;
+    self.initialized = true;
+
+    self.thread = ogs_thread_create(watch_main, stream);
+    ogs_assert(self.thread);
+
+    ogs_info("Subscriber cache: %d entries", max);
+#else
+    ogs_warn("Subscriber cache needs mongo-c-driver 1.9 or later");
+#endif
+
+    return OGS_OK;
+}
+
+int ogs_dbi_cache_init_unwatched(int max)
+{
+    ogs_assert(self.initialized == false);
+    ogs_assert(max > 0);
+
+    cache_create(max);
+
+    self.enabled = true;
+    self.initialized = true;
+
+    return OGS_OK;
+}
+
+void ogs_dbi_cache_final(void)
+{
+    if (self.initialized == false)
+        return;
+
+    if (self.thread) {
+        ogs_atomic_store(&self.stop, 1);
+        ogs_thread_destroy(self.thread);
+    }
+
+    ogs_thread_mutex_lock(&self.mutex);
+    entry_remove_all();
+    ogs_thread_mutex_unlock(&self.mutex);
+
+    cache_free();
+
+    self.initialized = false;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_CACHE_H
+#define OGS_DBI_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Subscriber profile cache
+ *
+ * Keeps the decoded ogs_subscription_data_t and the static part of
+ * ogs_dbi_auth_info_t per SUPI, bounded to 'max' entries with LRU
+ * eviction. A MongoDB change stream on the subscriber collection
+ * invalidates entries, so the cache needs a replica set; without one
+ * it stays disabled. SQN is never served from the cache.
+ *
+ * With max 0 the cache is off and every lookup goes to the DB.
+ */
+int ogs_dbi_cache_init(int max);
+void ogs_dbi_cache_final(void);
+
+/*
+ * Enables the cache without a change stream. The caller feeds the
+ * change events itself, so the cache can be exercised without a
+ * replica set (tests/unit).
+ */
+int ogs_dbi_cache_init_unwatched(int max);
+
+/*
+ * Applies one change stream event. Returns false if the stream has
+ * been invalidated and must be reopened.
+ */
+bool ogs_dbi_cache_handle_event(const bson_t *document);
+
+/*
+ * Used by lib/dbi/subscription.c. Take the generation before reading
+ * the document and pass it to the put function; the entry is not
+ * stored if the collection changed in the meantime.
+ */
+uint64_t ogs_dbi_cache_generation(void);
+
+bool ogs_dbi_cache_get_auth_info(
+        const char *supi, ogs_dbi_auth_info_t *auth_info);
+void ogs_dbi_cache_put_auth_info(const char *supi, const bson_oid_t *oid,
+        uint64_t generation, const ogs_dbi_auth_info_t *auth_info);
+
+bool ogs_dbi_cache_get_subscription_data(
+        const char *supi, ogs_subscription_data_t *subscription_data);
+void ogs_dbi_cache_put_subscription_data(
+        const char *supi, const bson_oid_t *oid, uint64_t generation,
+        const ogs_subscription_data_t *subscription_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_CACHE_H */
@@ -27,6 +27,8 @@
 
 #include "dbi/ogs-mongoc.h"
 #include "dbi/subscription.h"
+#include "dbi/cache.h"
+#include "dbi/worker.h"
 
 #undef OGS_DBI_INSIDE
 
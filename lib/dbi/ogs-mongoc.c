@@ -67,16 +67,30 @@ int ogs_mongoc_init(const char *db_uri)
 
     self.initialized = true;
 
-    self.client = mongoc_client_new(db_uri);
-    if (!self.client) {
+    self.uri = mongoc_uri_new(db_uri);
+    if (!self.uri) {
         ogs_error("Failed to parse DB URI [%s]", db_uri);
         return OGS_ERROR;
     }
 
+    /*
+     * mongoc_client_t is not thread-safe. Every thread that talks to
+     * the DB borrows its own client from this pool.
+     */
+    self.pool = mongoc_client_pool_new(self.uri);
+    if (!self.pool) {
+        ogs_error("Failed to create client pool [%s]", db_uri);
+        return OGS_ERROR;
+    }
+
 #if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 4
-    mongoc_client_set_error_api(self.client, 2);
+    mongoc_client_pool_set_error_api(self.pool, 2);
 #endif
 
+    /* The client kept for the main thread */
+    self.client = mongoc_client_pool_pop(self.pool);
+    ogs_assert(self.client);
+
     uri = mongoc_client_get_uri(self.client);
     ogs_assert(uri);
 
@@ -108,9 +122,18 @@ void ogs_mongoc_final(void)
         self.database = NULL;
     }
     if (self.client) {
-        mongoc_client_destroy(self.client);
+        ogs_assert(self.pool);
+        mongoc_client_pool_push(self.pool, self.client);
         self.client = NULL;
     }
+    if (self.pool) {
+        mongoc_client_pool_destroy(self.pool);
+        self.pool = NULL;
+    }
+    if (self.uri) {
+        mongoc_uri_destroy(self.uri);
+        self.uri = NULL;
+    }
 
     if (self.initialized) {
         mongoc_cleanup();
@@ -118,6 +141,35 @@ void ogs_mongoc_final(void)
     }
 }
 
+mongoc_collection_t *ogs_mongoc_collection_get(
+        const char *name, mongoc_client_t **client)
+{
+    mongoc_collection_t *collection = NULL;
+
+    ogs_assert(name);
+    ogs_assert(client);
+    ogs_assert(self.pool);
+
+    *client = mongoc_client_pool_pop(self.pool);
+    ogs_assert(*client);
+
+    collection = mongoc_client_get_collection(*client, self.name, name);
+    ogs_assert(collection);
+
+    return collection;
+}
+
+void ogs_mongoc_collection_put(
+        mongoc_collection_t *collection, mongoc_client_t *client)
+{
+    ogs_assert(collection);
+    ogs_assert(client);
+    ogs_assert(self.pool);
+
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(self.pool, client);
+}
+
 ogs_mongoc_t *ogs_mongoc(void)
 {
     return &self;
@@ -125,27 +177,12 @@ ogs_mongoc_t *ogs_mongoc(void)
 
 int ogs_dbi_init(const char *db_uri)
 {
-    int rv;
-
     ogs_assert(db_uri);
 
-    rv = ogs_mongoc_init(db_uri);
-    if (rv != OGS_OK) return rv;
-
-    if (ogs_mongoc()->client && ogs_mongoc()->name) {
-        self.collection.subscriber = mongoc_client_get_collection(
-            ogs_mongoc()->client, ogs_mongoc()->name, "subscribers");
-        ogs_assert(self.collection.subscriber);
-    }
-
-    return OGS_OK;
+    return ogs_mongoc_init(db_uri);
 }
 
 void ogs_dbi_final()
 {
-    if (self.collection.subscriber) {
-        mongoc_collection_destroy(self.collection.subscriber);
-    }
-
     ogs_mongoc_final();
 }
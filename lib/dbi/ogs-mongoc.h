@@ -34,18 +34,25 @@ typedef struct ogs_mongoc_s {
     bool initialized;
     const char *name;
     void *uri;
+    void *pool;
     void *client;
     void *database;
-
-    struct {
-        void *subscriber;
-    } collection;
 } ogs_mongoc_t;
 
 int ogs_mongoc_init(const char *db_uri);
 void ogs_mongoc_final(void);
 ogs_mongoc_t *ogs_mongoc(void);
 
+/*
+ * Borrows a client from the pool and opens the collection on it.
+ * Safe to call from any thread; give both back with
+ * ogs_mongoc_collection_put().
+ */
+mongoc_collection_t *ogs_mongoc_collection_get(
+        const char *name, mongoc_client_t **client);
+void ogs_mongoc_collection_put(
+        mongoc_collection_t *collection, mongoc_client_t *client);
+
 int ogs_dbi_init(const char *db_uri);
 void ogs_dbi_final(void);
 
@@ -19,43 +19,100 @@
 
 #include "ogs-dbi.h"
 
+static int auth_info_parse(
+        const bson_t *document, ogs_dbi_auth_info_t *auth_info)
+{
+    bson_iter_t iter;
+    bson_iter_t inner_iter;
+    char buf[OGS_KEY_LEN];
+    char *utf8 = NULL;
+    uint32_t length = 0;
+
+    ogs_assert(document);
+    ogs_assert(auth_info);
+
+    if (!bson_iter_init_find(&iter, document, "security")) {
+        ogs_error("No 'security' field in this document");
+        return OGS_ERROR;
+    }
+
+    bson_iter_recurse(&iter, &inner_iter);
+    while (bson_iter_next(&inner_iter)) {
+        const char *key = bson_iter_key(&inner_iter);
+
+        if (!strcmp(key, "k") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
+            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
+            memcpy(auth_info->k, OGS_HEX(utf8, length, buf), OGS_KEY_LEN);
+        } else if (!strcmp(key, "opc") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
+            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
+            auth_info->use_opc = 1;
+            memcpy(auth_info->opc, OGS_HEX(utf8, length, buf), OGS_KEY_LEN);
+        } else if (!strcmp(key, "op") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
+            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
+            memcpy(auth_info->op, OGS_HEX(utf8, length, buf), OGS_KEY_LEN);
+        } else if (!strcmp(key, "amf") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
+            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
+            memcpy(auth_info->amf, OGS_HEX(utf8, length, buf), OGS_AMF_LEN);
+        } else if (!strcmp(key, "rand") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
+            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
+            memcpy(auth_info->rand, OGS_HEX(utf8, length, buf), OGS_RAND_LEN);
+        } else if (!strcmp(key, "sqn") && BSON_ITER_HOLDS_INT64(&inner_iter)) {
+            auth_info->sqn = bson_iter_int64(&inner_iter);
+        }
+    }
+
+    return OGS_OK;
+}
+
 int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info)
 {
     int rv = OGS_OK;
     mongoc_cursor_t *cursor = NULL;
     bson_t *query = NULL;
+    bson_t *opts = NULL;
     bson_error_t error;
     const bson_t *document;
     bson_iter_t iter;
-    bson_iter_t inner_iter;
-    char buf[OGS_KEY_LEN];
-    char *utf8 = NULL;
-    uint32_t length = 0;
 
     char *supi_type = NULL;
     char *supi_id = NULL;
 
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
+
+    uint64_t generation = 0;
+    bool cached = false;
+
     ogs_assert(supi);
     ogs_assert(auth_info);
 
+    /* On a hit, only SQN is read from the DB */
+    generation = ogs_dbi_cache_generation();
+    cached = ogs_dbi_cache_get_auth_info(supi, auth_info);
+
     supi_type = ogs_id_get_type(supi);
     ogs_assert(supi_type);
     supi_id = ogs_id_get_value(supi);
     ogs_assert(supi_id);
 
+    collection = ogs_mongoc_collection_get("subscribers", &client);
+    ogs_assert(collection);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
 #if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
-    cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
+    if (cached)
+        opts = BCON_NEW("projection",
+                "{", "security.sqn", BCON_BOOL(true), "}");
+    cursor = mongoc_collection_find_with_opts(collection, query, opts, NULL);
 #else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
+    cursor = mongoc_collection_find(collection,
             MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
 #endif
 
     if (!mongoc_cursor_next(cursor, &document)) {
         ogs_info("[%s] Cannot find IMSI in DB", supi);
 
-        rv = OGS_ERROR;
+        rv = OGS_NOTFOUND;
         goto out;
     }
 
@@ -66,43 +123,24 @@ int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info)
         goto out;
     }
 
-    if (!bson_iter_init_find(&iter, document, "security")) {
-        ogs_error("No 'security' field in this document");
-
-        rv = OGS_ERROR;
+    if (!cached)
+        memset(auth_info, 0, sizeof(ogs_dbi_auth_info_t));
+    rv = auth_info_parse(document, auth_info);
+    if (rv != OGS_OK)
         goto out;
-    }
-
-    memset(auth_info, 0, sizeof(ogs_dbi_auth_info_t));
-    bson_iter_recurse(&iter, &inner_iter);
-    while (bson_iter_next(&inner_iter)) {
-        const char *key = bson_iter_key(&inner_iter);
 
-        if (!strcmp(key, "k") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
-            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
-            memcpy(auth_info->k, OGS_HEX(utf8, length, buf), OGS_KEY_LEN);
-        } else if (!strcmp(key, "opc") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
-            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
-            auth_info->use_opc = 1;
-            memcpy(auth_info->opc, OGS_HEX(utf8, length, buf), OGS_KEY_LEN);
-        } else if (!strcmp(key, "op") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
-            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
-            memcpy(auth_info->op, OGS_HEX(utf8, length, buf), OGS_KEY_LEN);
-        } else if (!strcmp(key, "amf") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
-            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
-            memcpy(auth_info->amf, OGS_HEX(utf8, length, buf), OGS_AMF_LEN);
-        } else if (!strcmp(key, "rand") && BSON_ITER_HOLDS_UTF8(&inner_iter)) {
-            utf8 = (char *)bson_iter_utf8(&inner_iter, &length);
-            memcpy(auth_info->rand, OGS_HEX(utf8, length, buf), OGS_RAND_LEN);
-        } else if (!strcmp(key, "sqn") && BSON_ITER_HOLDS_INT64(&inner_iter)) {
-            auth_info->sqn = bson_iter_int64(&inner_iter);
-        }
-    }
+    if (!cached && bson_iter_init_find(&iter, document, "_id") &&
+        BSON_ITER_HOLDS_OID(&iter))
+        ogs_dbi_cache_put_auth_info(
+                supi, bson_iter_oid(&iter), generation, auth_info);
 
 out:
     if (query) bson_destroy(query);
+    if (opts) bson_destroy(opts);
     if (cursor) mongoc_cursor_destroy(cursor);
 
+    ogs_mongoc_collection_put(collection, client);
+
     ogs_free(supi_type);
     ogs_free(supi_id);
 
@@ -119,6 +157,9 @@ int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
     char *supi_type = NULL;
     char *supi_id = NULL;
 
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
+
     ogs_assert(supi);
 
     supi_type = ogs_id_get_type(supi);
@@ -126,13 +167,16 @@ int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
     supi_id = ogs_id_get_value(supi);
     ogs_assert(supi_id);
 
+    collection = ogs_mongoc_collection_get("subscribers", &client);
+    ogs_assert(collection);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
     update = BCON_NEW("$set",
             "{",
                 "security.sqn", BCON_INT64(sqn),
             "}");
 
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+    if (!mongoc_collection_update(collection,
             MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
         ogs_error("mongoc_collection_update() failure: %s", error.message);
 
@@ -142,6 +186,8 @@ int ogs_dbi_update_sqn(char *supi, uint64_t sqn)
     if (query) bson_destroy(query);
     if (update) bson_destroy(update);
 
+    ogs_mongoc_collection_put(collection, client);
+
     ogs_free(supi_type);
     ogs_free(supi_id);
 
@@ -159,6 +205,9 @@ int ogs_dbi_increment_sqn(char *supi)
     char *supi_type = NULL;
     char *supi_id = NULL;
 
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
+
     ogs_assert(supi);
 
     supi_type = ogs_id_get_type(supi);
@@ -166,12 +215,15 @@ int ogs_dbi_increment_sqn(char *supi)
     supi_id = ogs_id_get_value(supi);
     ogs_assert(supi_id);
 
+    collection = ogs_mongoc_collection_get("subscribers", &client);
+    ogs_assert(collection);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
     update = BCON_NEW("$inc",
             "{",
                 "security.sqn", BCON_INT64(32),
             "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+    if (!mongoc_collection_update(collection,
             MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
         ogs_error("mongoc_collection_update() failure: %s", error.message);
 
@@ -185,7 +237,7 @@ int ogs_dbi_increment_sqn(char *supi)
                 "security.sqn", 
                 "{", "and", BCON_INT64(max_sqn), "}",
             "}");
-    if (!mongoc_collection_update(ogs_mongoc()->collection.subscriber,
+    if (!mongoc_collection_update(collection,
             MONGOC_UPDATE_NONE, query, update, NULL, &error)) {
         ogs_error("mongoc_collection_update() failure: %s", error.message);
 
@@ -196,12 +248,163 @@ out:
     if (query) bson_destroy(query);
     if (update) bson_destroy(update);
 
+    ogs_mongoc_collection_put(collection, client);
+
     ogs_free(supi_type);
     ogs_free(supi_id);
 
     return rv;
 }
 
+/*
+ * One findAndModify both reads the authentication data and moves SQN on,
+ * so concurrent requests for the same SUPI never hand out the same SQN.
+ * The pre-image is returned: auth_info->sqn is the value before the update.
+ * OGS_NOTFOUND means no subscriber matched; OGS_ERROR is a DB failure.
+ */
+static int auth_info_find_and_modify(char *supi, const bson_t *update,
+        uint64_t increment, ogs_dbi_auth_info_t *auth_info)
+{
+    int rv = OGS_OK;
+    bson_t *query = NULL;
+    bson_t *fields = NULL;
+    bson_t *mask = NULL;
+    bson_t reply;
+    bson_t document;
+    bson_error_t error;
+    bson_iter_t iter;
+    const uint8_t *data = NULL;
+    uint32_t length = 0;
+    uint64_t max_sqn = OGS_MAX_SQN;
+
+    char *supi_type = NULL;
+    char *supi_id = NULL;
+
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
+
+    ogs_assert(supi);
+    ogs_assert(update);
+    ogs_assert(auth_info);
+
+    supi_type = ogs_id_get_type(supi);
+    ogs_assert(supi_type);
+    supi_id = ogs_id_get_value(supi);
+    ogs_assert(supi_id);
+
+    collection = ogs_mongoc_collection_get("subscribers", &client);
+    ogs_assert(collection);
+
+    query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
+    fields = BCON_NEW("security", BCON_BOOL(true));
+
+    /* reply is always initialized, even on failure */
+    if (!mongoc_collection_find_and_modify(collection, query, NULL,
+                update, fields, false, false, false, &reply, &error)) {
+        ogs_error("mongoc_collection_find_and_modify() failure: %s",
+                error.message);
+
+        rv = OGS_ERROR;
+        goto out;
+    }
+
+    if (!bson_iter_init_find(&iter, &reply, "value") ||
+        !BSON_ITER_HOLDS_DOCUMENT(&iter)) {
+        ogs_info("[%s] Cannot find IMSI in DB", supi);
+
+        rv = OGS_NOTFOUND;
+        goto out;
+    }
+
+    bson_iter_document(&iter, &length, &data);
+    if (!bson_init_static(&document, data, length)) {
+        ogs_error("bson_init_static() failed");
+
+        rv = OGS_ERROR;
+        goto out;
+    }
+
+    memset(auth_info, 0, sizeof(ogs_dbi_auth_info_t));
+    rv = auth_info_parse(&document, auth_info);
+    if (rv != OGS_OK)
+        goto out;
+
+    /*
+     * A concurrent $inc may have landed before an earlier $bit,
+     * so the pre-image is masked here as well.
+     */
+    auth_info->sqn &= max_sqn;
+
+    /* SQN only wraps once in 2^43 increments; mask it the slow way */
+    if (increment && auth_info->sqn + increment > max_sqn) {
+        mask = BCON_NEW("$bit",
+                "{",
+                    "security.sqn",
+                    "{", "and", BCON_INT64(max_sqn), "}",
+                "}");
+        if (!mongoc_collection_update(collection,
+                MONGOC_UPDATE_NONE, query, mask, NULL, &error)) {
+            ogs_error("mongoc_collection_update() failure: %s",
+                    error.message);
+
+            rv = OGS_ERROR;
+        }
+    }
+
+out:
+    bson_destroy(&reply);
+    if (query) bson_destroy(query);
+    if (fields) bson_destroy(fields);
+    if (mask) bson_destroy(mask);
+
+    ogs_mongoc_collection_put(collection, client);
+
+    ogs_free(supi_type);
+    ogs_free(supi_id);
+
+    return rv;
+}
+
+int ogs_dbi_auth_info_and_increment_sqn(
+        char *supi, int num_of_sqn, ogs_dbi_auth_info_t *auth_info)
+{
+    int rv;
+    bson_t *update = NULL;
+    uint64_t increment;
+
+    ogs_assert(num_of_sqn > 0);
+
+    increment = 32 * (uint64_t)num_of_sqn;
+    update = BCON_NEW("$inc",
+            "{",
+                "security.sqn", BCON_INT64(increment),
+            "}");
+
+    rv = auth_info_find_and_modify(supi, update, increment, auth_info);
+
+    bson_destroy(update);
+
+    return rv;
+}
+
+int ogs_dbi_auth_info_and_update_sqn(
+        char *supi, uint64_t sqn, ogs_dbi_auth_info_t *auth_info)
+{
+    int rv;
+    bson_t *update = NULL;
+
+    update = BCON_NEW("$set",
+            "{",
+                "security.sqn", BCON_INT64(sqn & OGS_MAX_SQN),
+            "}");
+
+    rv = auth_info_find_and_modify(supi, update, 0, auth_info);
+
+    bson_destroy(update);
+
+    return rv;
+}
+
 int ogs_dbi_subscription_data(char *supi,
         ogs_subscription_data_t *subscription_data)
 {
@@ -218,20 +421,31 @@ int ogs_dbi_subscription_data(char *supi,
     char *supi_type = NULL;
     char *supi_id = NULL;
 
+    mongoc_client_t *client = NULL;
+    mongoc_collection_t *collection = NULL;
+
+    uint64_t generation = 0;
+
     ogs_assert(subscription_data);
     ogs_assert(supi);
 
+    generation = ogs_dbi_cache_generation();
+    if (ogs_dbi_cache_get_subscription_data(supi, subscription_data))
+        return OGS_OK;
+
     supi_type = ogs_id_get_type(supi);
     ogs_assert(supi_type);
     supi_id = ogs_id_get_value(supi);
     ogs_assert(supi_id);
 
+    collection = ogs_mongoc_collection_get("subscribers", &client);
+    ogs_assert(collection);
+
     query = BCON_NEW(supi_type, BCON_UTF8(supi_id));
 #if MONGOC_MAJOR_VERSION >= 1 && MONGOC_MINOR_VERSION >= 5
-    cursor = mongoc_collection_find_with_opts(
-            ogs_mongoc()->collection.subscriber, query, NULL, NULL);
+    cursor = mongoc_collection_find_with_opts(collection, query, NULL, NULL);
 #else
-    cursor = mongoc_collection_find(ogs_mongoc()->collection.subscriber,
+    cursor = mongoc_collection_find(collection,
             MONGOC_QUERY_NONE, 0, 0, 0, query, NULL, NULL);
 #endif
 
@@ -458,10 +672,17 @@ int ogs_dbi_subscription_data(char *supi,
         }
     }
 
+    if (rv == OGS_OK && bson_iter_init_find(&iter, document, "_id") &&
+        BSON_ITER_HOLDS_OID(&iter))
+        ogs_dbi_cache_put_subscription_data(
+                supi, bson_iter_oid(&iter), generation, subscription_data);
+
 out:
     if (query) bson_destroy(query);
     if (cursor) mongoc_cursor_destroy(cursor);
 
+    ogs_mongoc_collection_put(collection, client);
+
     ogs_free(supi_type);
     ogs_free(supi_id);
 
@@ -42,6 +42,11 @@ int ogs_dbi_auth_info(char *supi, ogs_dbi_auth_info_t *auth_info);
 int ogs_dbi_update_sqn(char *supi, uint64_t sqn);
 int ogs_dbi_increment_sqn(char *supi);
 
+int ogs_dbi_auth_info_and_increment_sqn(
+        char *supi, int num_of_sqn, ogs_dbi_auth_info_t *auth_info);
+int ogs_dbi_auth_info_and_update_sqn(
+        char *supi, uint64_t sqn, ogs_dbi_auth_info_t *auth_info);
+
 int ogs_dbi_subscription_data(char *supi,
         ogs_subscription_data_t *subscription_data);
 
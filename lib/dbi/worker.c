@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-dbi.h"
+
+typedef struct ogs_dbi_worker_s {
+    ogs_thread_t    *thread;
+    ogs_queue_t     *queue;
+} ogs_dbi_worker_t;
+
+static struct {
+    bool initialized;
+
+    int num_of_worker;
+    ogs_dbi_worker_t *worker;
+
+    ogs_queue_t *completion;
+    ogs_pollset_t *pollset;
+
+    /* Only touched from the event loop thread */
+    int max_job;
+    int num_of_job;
+} self;
+
+/* Queued behind the last job of each worker by ogs_dbi_worker_final() */
+static ogs_dbi_job_t stop_job;
+
+static void worker_main(void *data)
+{
+    ogs_dbi_worker_t *worker = data;
+    ogs_dbi_job_t *job = NULL;
+    int rv;
+
+    ogs_assert(worker);
+
+    for ( ;; ) {
+        rv = ogs_queue_pop(worker->queue, (void **)&job);
+        if (rv == OGS_DONE)
+            break;
+        if (rv != OGS_OK)
+            continue;
+
+        ogs_assert(job);
+        if (job == &stop_job)
+            break;
+
+        ogs_assert(job->run);
+        job->run(job);
+
+        /* Never blocks: at most max_job jobs are outstanding */
+        rv = ogs_queue_push(self.completion, job);
+        ogs_assert(rv == OGS_OK);
+
+        ogs_pollset_notify(self.pollset);
+    }
+}
+
+int ogs_dbi_worker_init(
+        int num_of_worker, int max_job, ogs_pollset_t *pollset)
+{
+    int i;
+
+    ogs_assert(self.initialized == false);
+    ogs_assert(num_of_worker > 0);
+    ogs_assert(max_job > 0);
+    ogs_assert(pollset);
+
+    memset(&self, 0, sizeof(self));
+
+    self.num_of_worker = num_of_worker;
+    self.max_job = max_job;
+    self.pollset = pollset;
+
+    self.completion = ogs_queue_create(max_job);
+    ogs_assert(self.completion);
+
+    self.worker = ogs_calloc(num_of_worker, sizeof(ogs_dbi_worker_t));
+    ogs_assert(self.worker);
+
+    for (i = 0; i < num_of_worker; i++) {
+        ogs_dbi_worker_t *worker = &self.worker[i];
+
+        worker->queue = ogs_queue_create(max_job);
+        ogs_assert(worker->queue);
+
+        worker->thread = ogs_thread_create(worker_main, worker);
+        if (!worker->thread) {
+            ogs_error("Cannot create DB worker thread");
+            return OGS_ERROR;
+        }
+    }
+
+    self.initialized = true;
+
+    ogs_info("DB worker: %d thread(s)", num_of_worker);
+
+    return OGS_OK;
+}
+
+void ogs_dbi_worker_final(void)
+{
+    ogs_dbi_job_t *job = NULL;
+    int i, rv;
+
+    if (!self.worker)
+        return;
+
+    /* Let every worker finish what it has already accepted */
+    for (i = 0; i < self.num_of_worker; i++) {
+        ogs_dbi_worker_t *worker = &self.worker[i];
+        if (!worker->thread) continue;
+
+        rv = ogs_queue_push(worker->queue, &stop_job);
+        ogs_assert(rv == OGS_OK);
+    }
+
+    for (i = 0; i < self.num_of_worker; i++) {
+        ogs_dbi_worker_t *worker = &self.worker[i];
+
+        if (worker->thread)
+            ogs_thread_destroy(worker->thread);
+        ogs_queue_destroy(worker->queue);
+    }
+    ogs_free(self.worker);
+    self.worker = NULL;
+
+    /* Nobody is left to take the results; the owners only release them */
+    while (ogs_queue_trypop(self.completion, (void **)&job) == OGS_OK) {
+        ogs_assert(job);
+        ogs_assert(job->done);
+
+        job->cancelled = true;
+        job->done(job);
+    }
+    ogs_queue_destroy(self.completion);
+
+    self.initialized = false;
+}
+
+int ogs_dbi_worker_submit(ogs_dbi_job_t *job, const char *key)
+{
+    ogs_dbi_worker_t *worker = NULL;
+    int klen = OGS_HASH_KEY_STRING;
+    int rv;
+
+    ogs_assert(self.initialized == true);
+    ogs_assert(job);
+    ogs_assert(job->run);
+    ogs_assert(job->done);
+    ogs_assert(key);
+
+    if (self.num_of_job >= self.max_job) {
+        ogs_warn("DB worker busy [%d]", self.num_of_job);
+        return OGS_RETRY;
+    }
+
+    worker = &self.worker[
+        ogs_hashfunc_default(key, &klen) % self.num_of_worker];
+
+    job->cancelled = false;
+
+    rv = ogs_queue_trypush(worker->queue, job);
+    if (rv != OGS_OK) {
+        ogs_error("ogs_queue_trypush() failed [%d]", rv);
+        return rv;
+    }
+
+    self.num_of_job++;
+
+    return OGS_OK;
+}
+
+void ogs_dbi_worker_complete(void)
+{
+    ogs_dbi_job_t *job[OGS_QUEUE_BATCH_SIZE];
+    unsigned int i, num;
+
+    if (self.initialized == false)
+        return;
+
+    for ( ;; ) {
+        num = OGS_QUEUE_BATCH_SIZE;
+        if (ogs_queue_trypop_batch(
+                    self.completion, (void **)job, &num) != OGS_OK)
+            break;
+
+        for (i = 0; i < num; i++) {
+            ogs_assert(job[i]);
+            ogs_assert(job[i]->done);
+
+            ogs_assert(self.num_of_job > 0);
+            self.num_of_job--;
+
+            job[i]->done(job[i]);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined(OGS_DBI_INSIDE) && !defined(OGS_DBI_COMPILATION)
+#error "This header cannot be included directly."
+#endif
+
+#ifndef OGS_DBI_WORKER_H
+#define OGS_DBI_WORKER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * DB worker pool
+ *
+ * Jobs are run on a small set of worker threads so that the NF event
+ * loop never waits on a DB round trip. A job is routed by its key, so
+ * jobs for the same subscriber run in order on the same thread while
+ * different subscribers proceed in parallel.
+ *
+ * Finished jobs are put on a completion queue and the pollset is
+ * notified. The event loop calls ogs_dbi_worker_complete() to run
+ * job->done() on its own thread.
+ */
+typedef struct ogs_dbi_job_s ogs_dbi_job_t;
+typedef void (*ogs_dbi_job_f)(ogs_dbi_job_t *job);
+
+struct ogs_dbi_job_s {
+    ogs_dbi_job_f   run;        /* called on a worker thread */
+    ogs_dbi_job_f   done;       /* called from ogs_dbi_worker_complete() */
+
+    /* Set if the pool is torn down before done() could be delivered */
+    bool            cancelled;
+
+    void            *data;
+};
+
+int ogs_dbi_worker_init(
+        int num_of_worker, int max_job, ogs_pollset_t *pollset);
+void ogs_dbi_worker_final(void);
+
+int ogs_dbi_worker_submit(ogs_dbi_job_t *job, const char *key);
+void ogs_dbi_worker_complete(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OGS_DBI_WORKER_H */
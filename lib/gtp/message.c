@@ -20,7 +20,7 @@
 /*******************************************************************************
  * This file had been created by gtp-tlv.py script v0.1.0
  * Please do not modify this file but regenerate it via script.
- * Created on: 2020-08-11 20:17:53.518172 by acetcom
+ * Created on: 2026-10-17 04:50:26.059094 by root
  * from 29274-g30.docx
  ******************************************************************************/
 
@@ -34,7 +34,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_imsi_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_imsi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_cause_0 =
@@ -45,7 +46,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_cause_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_cause_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_recovery_0 =
@@ -56,7 +58,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_recovery_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_recovery_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_stn_sr_0 =
@@ -67,7 +70,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_stn_sr_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_stn_sr_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_apn_0 =
@@ -78,7 +82,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_apn_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_apn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ambr_0 =
@@ -89,7 +94,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ambr_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ambr_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ebi_0 =
@@ -100,7 +106,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ebi_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_ebi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ebi_1 =
@@ -111,7 +118,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ebi_1 =
     1,
     1,
     sizeof(ogs_gtp_tlv_ebi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ip_address_0 =
@@ -122,7 +130,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ip_address_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ip_address_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ip_address_1 =
@@ -133,7 +142,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ip_address_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_ip_address_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ip_address_2 =
@@ -144,7 +154,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ip_address_2 =
     0,
     2,
     sizeof(ogs_gtp_tlv_ip_address_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ip_address_3 =
@@ -155,7 +166,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ip_address_3 =
     0,
     3,
     sizeof(ogs_gtp_tlv_ip_address_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mei_0 =
@@ -166,7 +178,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mei_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mei_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_msisdn_0 =
@@ -177,7 +190,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_msisdn_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_msisdn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_indication_0 =
@@ -188,7 +202,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_indication_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_indication_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_pco_0 =
@@ -199,7 +214,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_pco_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_pco_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_paa_0 =
@@ -210,7 +226,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_paa_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_paa_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_qos_0 =
@@ -221,7 +238,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_qos_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_bearer_qos_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_flow_qos_0 =
@@ -232,7 +250,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_flow_qos_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_flow_qos_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_rat_type_0 =
@@ -243,7 +262,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_rat_type_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_rat_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_serving_network_0 =
@@ -254,7 +274,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_serving_network_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_serving_network_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_tft_0 =
@@ -265,7 +286,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_tft_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_bearer_tft_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_tad_0 =
@@ -276,7 +298,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_tad_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_tad_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_uli_0 =
@@ -287,7 +310,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_uli_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_uli_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_uli_1 =
@@ -298,7 +322,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_uli_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_uli_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_0 =
@@ -309,7 +334,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_1 =
@@ -320,7 +346,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_2 =
@@ -331,7 +358,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_2 =
     0,
     2,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_3 =
@@ -342,7 +370,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_3 =
     0,
     3,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_4 =
@@ -353,7 +382,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_4 =
     0,
     4,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_5 =
@@ -364,7 +394,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_5 =
     0,
     5,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_6 =
@@ -375,7 +406,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_6 =
     0,
     6,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_7 =
@@ -386,7 +418,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_7 =
     0,
     7,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_8 =
@@ -397,7 +430,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_8 =
     0,
     8,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_9 =
@@ -408,7 +442,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_9 =
     0,
     9,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_10 =
@@ -419,7 +454,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_10 =
     0,
     10,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_11 =
@@ -430,7 +466,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_teid_11 =
     0,
     11,
     sizeof(ogs_gtp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_tmsi_0 =
@@ -441,7 +478,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_tmsi_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_tmsi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_global_cn_id_0 =
@@ -452,7 +490,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_global_cn_id_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_global_cn_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_s103pdf_0 =
@@ -463,7 +502,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_s103pdf_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_s103pdf_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_s1udf_0 =
@@ -474,7 +514,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_s1udf_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_s1udf_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delay_value_0 =
@@ -485,7 +526,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delay_value_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_delay_value_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_charging_id_0 =
@@ -496,7 +538,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_charging_id_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_charging_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_charging_characteristics_0 =
@@ -507,7 +550,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_charging_characteristics_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_charging_characteristics_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_trace_information_0 =
@@ -518,7 +562,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_trace_information_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_trace_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_flags_0 =
@@ -529,7 +574,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_flags_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_bearer_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_pdn_type_0 =
@@ -540,7 +586,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_pdn_type_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_pdn_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_pti_0 =
@@ -551,7 +598,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_pti_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_pti_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mm_context_0 =
@@ -562,7 +610,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mm_context_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mm_context_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_pdu_numbers_0 =
@@ -573,7 +622,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_pdu_numbers_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_pdu_numbers_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_p_tmsi_0 =
@@ -584,7 +634,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_p_tmsi_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_p_tmsi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_p_tmsi_signature_0 =
@@ -595,7 +646,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_p_tmsi_signature_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_p_tmsi_signature_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_hop_counter_0 =
@@ -606,7 +658,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_hop_counter_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_hop_counter_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ue_time_zone_0 =
@@ -617,7 +670,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ue_time_zone_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ue_time_zone_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_trace_reference_0 =
@@ -628,7 +682,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_trace_reference_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_trace_reference_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_complete_request_message_0 =
@@ -639,7 +694,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_complete_request_message_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_complete_request_message_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_guti_0 =
@@ -650,7 +706,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_guti_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_guti_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_container_0 =
@@ -661,7 +718,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_container_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_f_container_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_f_cause_0 =
@@ -672,7 +730,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_f_cause_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_f_cause_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_plmn_id_0 =
@@ -683,7 +742,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_plmn_id_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_plmn_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_target_identification_0 =
@@ -694,7 +754,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_target_identification_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_target_identification_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_packet_flow_id_0 =
@@ -705,7 +766,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_packet_flow_id_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_packet_flow_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_rab_context_0 =
@@ -716,7 +778,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_rab_context_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_rab_context_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_source_rnc_pdcp_context_info_0 =
@@ -727,7 +790,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_source_rnc_pdcp_context_info_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_source_rnc_pdcp_context_info_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_port_number_0 =
@@ -738,7 +802,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_port_number_0 =
     2,
     0,
     sizeof(ogs_gtp_tlv_port_number_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_port_number_1 =
@@ -749,7 +814,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_port_number_1 =
     2,
     1,
     sizeof(ogs_gtp_tlv_port_number_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_port_number_2 =
@@ -760,7 +826,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_port_number_2 =
     2,
     2,
     sizeof(ogs_gtp_tlv_port_number_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_apn_restriction_0 =
@@ -771,7 +838,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_apn_restriction_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_apn_restriction_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_selection_mode_0 =
@@ -782,7 +850,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_selection_mode_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_selection_mode_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_source_identification_0 =
@@ -793,7 +862,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_source_identification_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_source_identification_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_change_reporting_action_0 =
@@ -804,7 +874,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_change_reporting_action_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_change_reporting_action_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_fq_csid_0 =
@@ -815,7 +886,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_fq_csid_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_fq_csid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_fq_csid_1 =
@@ -826,7 +898,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_fq_csid_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_fq_csid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_fq_csid_2 =
@@ -837,7 +910,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_fq_csid_2 =
     0,
     2,
     sizeof(ogs_gtp_tlv_fq_csid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_fq_csid_3 =
@@ -848,7 +922,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_fq_csid_3 =
     0,
     3,
     sizeof(ogs_gtp_tlv_fq_csid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_channel_needed_0 =
@@ -859,7 +934,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_channel_needed_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_channel_needed_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_emlpp_priority_0 =
@@ -870,7 +946,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_emlpp_priority_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_emlpp_priority_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_node_type_0 =
@@ -881,7 +958,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_node_type_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_node_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_fqdn_0 =
@@ -892,7 +970,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_fqdn_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_fqdn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_fqdn_1 =
@@ -903,7 +982,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_fqdn_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_fqdn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ti_0 =
@@ -914,7 +994,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ti_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ti_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_session_duration_0 =
@@ -925,7 +1006,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_session_duration_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mbms_session_duration_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_service_area_0 =
@@ -936,7 +1018,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_service_area_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mbms_service_area_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_session_identifier_0 =
@@ -947,7 +1030,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_session_identifier_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mbms_session_identifier_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_flow_identifier_0 =
@@ -958,7 +1042,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_flow_identifier_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mbms_flow_identifier_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_ip_multicast_distribution_0 =
@@ -969,7 +1054,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_ip_multicast_distribution_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mbms_ip_multicast_distribution_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_distribution_acknowledge_0 =
@@ -980,7 +1066,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_distribution_acknowledge_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mbms_distribution_acknowledge_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_rfsp_index_0 =
@@ -991,7 +1078,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_rfsp_index_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_rfsp_index_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_uci_0 =
@@ -1002,7 +1090,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_uci_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_uci_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_csg_information_reporting_action_0 =
@@ -1013,7 +1102,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_csg_information_reporting_action_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_csg_information_reporting_action_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_csg_id_0 =
@@ -1024,7 +1114,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_csg_id_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_csg_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_cmi_0 =
@@ -1035,7 +1126,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_cmi_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_cmi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_service_indicator_0 =
@@ -1046,7 +1138,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_service_indicator_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_service_indicator_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_detach_type_0 =
@@ -1057,7 +1150,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_detach_type_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_detach_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ldn_0 =
@@ -1068,7 +1162,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ldn_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ldn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ldn_1 =
@@ -1079,7 +1174,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ldn_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_ldn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ldn_2 =
@@ -1090,7 +1186,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ldn_2 =
     0,
     2,
     sizeof(ogs_gtp_tlv_ldn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ldn_3 =
@@ -1101,7 +1198,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ldn_3 =
     0,
     3,
     sizeof(ogs_gtp_tlv_ldn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_node_features_0 =
@@ -1112,7 +1210,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_node_features_0 =
     1,
     0,
     sizeof(ogs_gtp_tlv_node_features_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_time_to_data_transfer_0 =
@@ -1123,7 +1222,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_time_to_data_transfer_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mbms_time_to_data_transfer_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_throttling_0 =
@@ -1134,7 +1234,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_throttling_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_throttling_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_arp_0 =
@@ -1145,7 +1246,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_arp_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_arp_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_epc_timer_0 =
@@ -1156,7 +1258,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_epc_timer_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_epc_timer_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_signalling_priority_indication_0 =
@@ -1167,7 +1270,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_signalling_priority_indication_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_signalling_priority_indication_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_tmgi_0 =
@@ -1178,7 +1282,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_tmgi_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_tmgi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_additional_mm_context_for_srvcc_0 =
@@ -1189,7 +1294,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_additional_mm_context_for_srvcc_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_additional_mm_context_for_srvcc_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_additional_flags_for_srvcc_0 =
@@ -1200,7 +1306,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_additional_flags_for_srvcc_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_additional_flags_for_srvcc_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mdt_configuration_0 =
@@ -1211,7 +1318,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mdt_configuration_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mdt_configuration_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_apco_0 =
@@ -1222,7 +1330,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_apco_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_apco_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_absolute_time_of_mbms_data_transfer_0 =
@@ -1233,7 +1342,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_absolute_time_of_mbms_data_transfer_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_absolute_time_of_mbms_data_transfer_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_enb_information_reporting_0 =
@@ -1244,7 +1354,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_enb_information_reporting_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_enb_information_reporting_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ip4cp_0 =
@@ -1255,7 +1366,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ip4cp_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ip4cp_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_change_to_report_flags_0 =
@@ -1266,7 +1378,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_change_to_report_flags_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_change_to_report_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_action_indication_0 =
@@ -1277,7 +1390,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_action_indication_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_action_indication_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_twan_identifier_0 =
@@ -1288,7 +1402,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_twan_identifier_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_twan_identifier_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_twan_identifier_1 =
@@ -1299,7 +1414,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_twan_identifier_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_twan_identifier_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_uli_timestamp_0 =
@@ -1310,7 +1426,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_uli_timestamp_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_uli_timestamp_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_flags_0 =
@@ -1321,7 +1438,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mbms_flags_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mbms_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ran_nas_cause_0 =
@@ -1332,7 +1450,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ran_nas_cause_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ran_nas_cause_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_cn_operator_selection_entity_0 =
@@ -1343,7 +1462,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_cn_operator_selection_entity_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_cn_operator_selection_entity_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_twmi_0 =
@@ -1354,7 +1474,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_twmi_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_twmi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_node_number_0 =
@@ -1365,7 +1486,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_node_number_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_node_number_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_node_identifier_0 =
@@ -1376,7 +1498,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_node_identifier_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_node_identifier_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_presence_reporting_area_action_0 =
@@ -1387,7 +1510,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_presence_reporting_area_action_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_presence_reporting_area_action_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_presence_reporting_area_information_0 =
@@ -1398,7 +1522,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_presence_reporting_area_information_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_presence_reporting_area_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_twan_identifier_timestamp_0 =
@@ -1409,7 +1534,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_twan_identifier_timestamp_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_twan_identifier_timestamp_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_twan_identifier_timestamp_1 =
@@ -1420,7 +1546,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_twan_identifier_timestamp_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_twan_identifier_timestamp_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_metric_0 =
@@ -1431,7 +1558,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_metric_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_metric_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_sequence_number_0 =
@@ -1442,7 +1570,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_sequence_number_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_sequence_number_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_apn_and_relative_capacity_0 =
@@ -1453,7 +1582,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_apn_and_relative_capacity_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_apn_and_relative_capacity_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_wlan_offloadability_indication_0 =
@@ -1464,7 +1594,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_wlan_offloadability_indication_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_wlan_offloadability_indication_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_paging_and_service_information_0 =
@@ -1475,7 +1606,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_paging_and_service_information_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_paging_and_service_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_integer_number_0 =
@@ -1486,7 +1618,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_integer_number_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_integer_number_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_millisecond_time_stamp_0 =
@@ -1497,7 +1630,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_millisecond_time_stamp_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_millisecond_time_stamp_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_monitoring_event_information_0 =
@@ -1508,7 +1642,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_monitoring_event_information_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_monitoring_event_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ecgi_list_0 =
@@ -1519,7 +1654,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ecgi_list_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ecgi_list_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_remote_user_id_0 =
@@ -1530,7 +1666,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_remote_user_id_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_remote_user_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_remote_ue_ip_information_0 =
@@ -1541,7 +1678,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_remote_ue_ip_information_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_remote_ue_ip_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_ciot_optimizations_support_indication_0 =
@@ -1552,7 +1690,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_ciot_optimizations_support_indication_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_ciot_optimizations_support_indication_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_header_compression_configuration_0 =
@@ -1563,7 +1702,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_header_compression_configuration_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_header_compression_configuration_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_epco_0 =
@@ -1574,7 +1714,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_epco_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_epco_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_serving_plmn_rate_control_0 =
@@ -1585,7 +1726,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_serving_plmn_rate_control_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_serving_plmn_rate_control_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_counter_0 =
@@ -1596,7 +1738,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_counter_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_counter_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_mapped_ue_usage_type_0 =
@@ -1607,7 +1750,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_mapped_ue_usage_type_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_mapped_ue_usage_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0 =
@@ -1618,7 +1762,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_secondary_rat_usage_data_report_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_up_function_selection_indication_flags_0 =
@@ -1629,7 +1774,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_up_function_selection_indication_flags_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_up_function_selection_indication_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_maximum_packet_loss_rate_0 =
@@ -1640,7 +1786,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_maximum_packet_loss_rate_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_maximum_packet_loss_rate_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_apn_rate_control_status_0 =
@@ -1651,7 +1798,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_apn_rate_control_status_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_apn_rate_control_status_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_extended_trace_information_0 =
@@ -1662,7 +1810,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_extended_trace_information_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_extended_trace_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_monitoring_event_extension_information_0 =
@@ -1673,7 +1822,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_monitoring_event_extension_information_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_monitoring_event_extension_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_additional_rrm_policy_index_0 =
@@ -1684,7 +1834,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_additional_rrm_policy_index_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_additional_rrm_policy_index_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_services_authorized_0 =
@@ -1695,7 +1846,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_services_authorized_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_services_authorized_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_services_authorized_1 =
@@ -1706,7 +1858,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_services_authorized_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_services_authorized_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bit_rate_0 =
@@ -1717,7 +1870,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bit_rate_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_bit_rate_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bit_rate_1 =
@@ -1728,7 +1882,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bit_rate_1 =
     0,
     1,
     sizeof(ogs_gtp_tlv_bit_rate_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_pc5_qos_flow_0 =
@@ -1739,8 +1894,34 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_pc5_qos_flow_0 =
     0,
     0,
     sizeof(ogs_gtp_tlv_pc5_qos_flow_t),
-    { NULL }
-};
+    { NULL },
+    NULL
+};
+
+static ogs_tlv_desc_t *find_tlv_pc5_qos_parameters(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_PC5_QOS_FLOW_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_tlv_pc5_qos_parameters_t, pc5_qos_flows) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_pc5_qos_flow_0;
+    case OGS_GTP_BIT_RATE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_tlv_pc5_qos_parameters_t, pc5_link_aggregated_bit_rates) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_bit_rate_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_pc5_qos_parameters_0 =
 {
@@ -1754,8 +1935,34 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_pc5_qos_parameters_0 =
         &ogs_gtp_tlv_desc_pc5_qos_flow_0,
         &ogs_gtp_tlv_desc_bit_rate_0,
         NULL,
+    },
+    find_tlv_pc5_qos_parameters
+};
+
+static ogs_tlv_desc_t *find_tlv_remote_ue_context(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_REMOTE_USER_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_tlv_remote_ue_context_t, remote_user_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_remote_user_id_0;
+    case OGS_GTP_REMOTE_UE_IP_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_tlv_remote_ue_context_t, remote_ue_ip_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_remote_ue_ip_information_0;
+    default:
+        break;
     }
-};
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_remote_ue_context_0 =
 {
@@ -1769,8 +1976,59 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_remote_ue_context_0 =
         &ogs_gtp_tlv_desc_remote_user_id_0,
         &ogs_gtp_tlv_desc_remote_ue_ip_information_0,
         NULL,
+    },
+    find_tlv_remote_ue_context
+};
+
+static ogs_tlv_desc_t *find_tlv_v2x_context(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_SERVICES_AUTHORIZED_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 0;
+            *offset = offsetof(ogs_gtp_tlv_v2x_context_t, lte_v2x_services_authorized) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_services_authorized_0;
+        case 1:
+            *index = 1;
+            *offset = offsetof(ogs_gtp_tlv_v2x_context_t, nr_v2x_services_authorized) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_services_authorized_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_BIT_RATE_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 2;
+            *offset = offsetof(ogs_gtp_tlv_v2x_context_t, lte_ue_sidelink_aggregate_maximum_bit_rate) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_bit_rate_0;
+        case 1:
+            *index = 3;
+            *offset = offsetof(ogs_gtp_tlv_v2x_context_t, nr_ue_sidelink_aggregate_maximum_bit_rate) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_bit_rate_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PC5_QOS_PARAMETERS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_tlv_v2x_context_t, pc5_qos_parameters) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_pc5_qos_parameters_0;
+    default:
+        break;
     }
-};
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_v2x_context_0 =
 {
@@ -1787,8 +2045,184 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_v2x_context_0 =
         &ogs_gtp_tlv_desc_bit_rate_1,
         &ogs_gtp_tlv_desc_pc5_qos_parameters_0,
         NULL,
+    },
+    find_tlv_v2x_context
+};
+
+static ogs_tlv_desc_t *find_tlv_bearer_context(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, eps_bearer_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_BEARER_TFT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, tft) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_bearer_tft_0;
+    case OGS_GTP_F_TEID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 2;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s1_u_enodeb_f_teid) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_0;
+        case 1:
+            *index = 3;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s4_u_sgsn_f_teid) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_1;
+        case 2:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s5_s8_u_sgw_f_teid) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_2;
+        case 3:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s5_s8_u_pgw_f_teid) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_3;
+        case 4:
+            *index = 6;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s12_rnc_f_teid) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_4;
+        case 5:
+            *index = 7;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s2b_u_epdg_f_teid_5) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_5;
+        case 6:
+            *index = 8;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s2a_u_twan_f_teid_6) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_6;
+        case 7:
+            *index = 10;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s11_u_mme_f_teid) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_7;
+        case 8:
+            *index = 17;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s2b_u_epdg_f_teid_8) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_8;
+        case 9:
+            *index = 18;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s2b_u_pgw_f_teid) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_9;
+        case 10:
+            *index = 19;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s2a_u_twan_f_teid_10) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_10;
+        case 11:
+            *index = 20;
+            *offset = offsetof(ogs_gtp_tlv_bearer_context_t, s2a_u_pgw_f_teid) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_f_teid_11;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_BEARER_QOS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, bearer_level_qos) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_bearer_qos_0;
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, cause) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_CHARGING_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, charging_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_charging_id_0;
+    case OGS_GTP_BEARER_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, bearer_flags) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_bearer_flags_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, protocol_configuration_options) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_EPCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, extended_protocol_configuration_options) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_epco_0;
+    case OGS_GTP_MAXIMUM_PACKET_LOSS_RATE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, maximum_packet_loss_rate) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_maximum_packet_loss_rate_0;
+    case OGS_GTP_RAN_NAS_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, ran_nas_cause) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_ran_nas_cause_0;
+    case OGS_GTP_APCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 22;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, additional_protocol_configuration_options) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_apco_0;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 23;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, bss_container) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    case OGS_GTP_TI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 24;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, transaction_identifier) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_ti_0;
+    case OGS_GTP_PACKET_FLOW_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 25;
+        *offset = offsetof(ogs_gtp_tlv_bearer_context_t, packet_flow_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_packet_flow_id_0;
+    default:
+        break;
     }
-};
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_context_0 =
 {
@@ -1826,7 +2260,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_context_0 =
         &ogs_gtp_tlv_desc_ti_0,
         &ogs_gtp_tlv_desc_packet_flow_id_0,
         NULL,
-    }
+    },
+    find_tlv_bearer_context
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_context_1 =
@@ -1865,8 +2300,185 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_context_1 =
         &ogs_gtp_tlv_desc_ti_0,
         &ogs_gtp_tlv_desc_packet_flow_id_0,
         NULL,
+    },
+    find_tlv_bearer_context
+};
+
+static ogs_tlv_desc_t *find_tlv_pdn_connection(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_APN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, apn) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_apn_0;
+    case OGS_GTP_APN_RESTRICTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, apn_restriction) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_apn_restriction_0;
+    case OGS_GTP_SELECTION_MODE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, selection_mode) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_selection_mode_0;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 3;
+            *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, ipv4_address) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_ip_address_0;
+        case 1:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, ipv6_address) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_ip_address_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, linked_eps_bearer_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, pgw_s5_s8_ip_address_for_control_plane_or_pmip) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    case OGS_GTP_FQDN_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 7;
+            *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, pgw_node_name) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_fqdn_0;
+        case 1:
+            *index = 17;
+            *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, local_home_network_id) -
+                sizeof(ogs_tlv_presence_t);
+            return &ogs_gtp_tlv_desc_fqdn_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, bearer_contexts_) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_AMBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, aggregate_maximum_bit_rate) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_ambr_0;
+    case OGS_GTP_CHARGING_CHARACTERISTICS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, charging_characteristics) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_charging_characteristics_0;
+    case OGS_GTP_CHANGE_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, change_reporting_action) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_change_reporting_action_0;
+    case OGS_GTP_CSG_INFORMATION_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, csg_information_reporting_action) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_csg_information_reporting_action_0;
+    case OGS_GTP_ENB_INFORMATION_REPORTING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, hnb_information_reporting_) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_enb_information_reporting_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, indication_flags) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_SIGNALLING_PRIORITY_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, signalling_priority_indication__) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_signalling_priority_indication_0;
+    case OGS_GTP_CHANGE_TO_REPORT_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, change_to_report_flags) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_change_to_report_flags_0;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 18;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, presence_reporting_area_action) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_action_0;
+    case OGS_GTP_WLAN_OFFLOADABILITY_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 19;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, wlan_offloadability_indication) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_wlan_offloadability_indication_0;
+    case OGS_GTP_REMOTE_UE_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 20;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, remote_ue_context_connected) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_remote_ue_context_0;
+    case OGS_GTP_PDN_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, pdn_type) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_pdn_type_0;
+    case OGS_GTP_HEADER_COMPRESSION_CONFIGURATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 22;
+        *offset = offsetof(ogs_gtp_tlv_pdn_connection_t, header_compression_configuration) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_header_compression_configuration_0;
+    default:
+        break;
     }
-};
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_pdn_connection_0 =
 {
@@ -1901,8 +2513,48 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_pdn_connection_0 =
         &ogs_gtp_tlv_desc_pdn_type_0,
         &ogs_gtp_tlv_desc_header_compression_configuration_0,
         NULL,
+    },
+    find_tlv_pdn_connection
+};
+
+static ogs_tlv_desc_t *find_tlv_overload_control_information(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_SEQUENCE_NUMBER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_tlv_overload_control_information_t, overload_control_sequence_number) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_sequence_number_0;
+    case OGS_GTP_METRIC_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_tlv_overload_control_information_t, overload_reduction_metric) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_metric_0;
+    case OGS_GTP_EPC_TIMER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_tlv_overload_control_information_t, period_of_validity) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_epc_timer_0;
+    case OGS_GTP_APN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_tlv_overload_control_information_t, list_of_access_point_name) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_apn_0;
+    default:
+        break;
     }
-};
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_overload_control_information_0 =
 {
@@ -1918,7 +2570,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_overload_control_information_0 =
         &ogs_gtp_tlv_desc_epc_timer_0,
         &ogs_gtp_tlv_desc_apn_0,
         NULL,
-    }
+    },
+    find_tlv_overload_control_information
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_overload_control_information_1 =
@@ -1935,7 +2588,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_overload_control_information_1 =
         &ogs_gtp_tlv_desc_epc_timer_0,
         &ogs_gtp_tlv_desc_apn_0,
         NULL,
-    }
+    },
+    find_tlv_overload_control_information
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_overload_control_information_2 =
@@ -1952,8 +2606,41 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_overload_control_information_2 =
         &ogs_gtp_tlv_desc_epc_timer_0,
         &ogs_gtp_tlv_desc_apn_0,
         NULL,
+    },
+    find_tlv_overload_control_information
+};
+
+static ogs_tlv_desc_t *find_tlv_load_control_information(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_SEQUENCE_NUMBER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_tlv_load_control_information_t, load_control_sequence_number) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_sequence_number_0;
+    case OGS_GTP_METRIC_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_tlv_load_control_information_t, load_metric) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_metric_0;
+    case OGS_GTP_APN_AND_RELATIVE_CAPACITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_tlv_load_control_information_t, list_of_apn_and_relative_capacity) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_apn_and_relative_capacity_0;
+    default:
+        break;
     }
-};
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_load_control_information_0 =
 {
@@ -1968,7 +2655,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_load_control_information_0 =
         &ogs_gtp_tlv_desc_metric_0,
         &ogs_gtp_tlv_desc_apn_and_relative_capacity_0,
         NULL,
-    }
+    },
+    find_tlv_load_control_information
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_load_control_information_1 =
@@ -1984,7 +2672,8 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_load_control_information_1 =
         &ogs_gtp_tlv_desc_metric_0,
         &ogs_gtp_tlv_desc_apn_and_relative_capacity_0,
         NULL,
-    }
+    },
+    find_tlv_load_control_information
 };
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_load_control_information_2 =
@@ -2000,8 +2689,41 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_load_control_information_2 =
         &ogs_gtp_tlv_desc_metric_0,
         &ogs_gtp_tlv_desc_apn_and_relative_capacity_0,
         NULL,
+    },
+    find_tlv_load_control_information
+};
+
+static ogs_tlv_desc_t *find_tlv_scef_pdn_connection(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_APN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_tlv_scef_pdn_connection_t, apn) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_apn_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_tlv_scef_pdn_connection_t, default_eps_bearer_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_NODE_IDENTIFIER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_tlv_scef_pdn_connection_t, scef_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_gtp_tlv_desc_node_identifier_0;
+    default:
+        break;
     }
-};
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_scef_pdn_connection_0 =
 {
@@ -2016,8 +2738,32 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_scef_pdn_connection_0 =
         &ogs_gtp_tlv_desc_ebi_0,
         &ogs_gtp_tlv_desc_node_identifier_0,
         NULL,
+    },
+    find_tlv_scef_pdn_connection
+};
+
+static ogs_tlv_desc_t *find_msg_echo_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_echo_request_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_NODE_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_echo_request_t, sending_node_features);
+        return &ogs_gtp_tlv_desc_node_features_0;
+    default:
+        break;
     }
-};
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_echo_request =
 {
@@ -2027,7 +2773,30 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_echo_request =
         &ogs_gtp_tlv_desc_recovery_0,
         &ogs_gtp_tlv_desc_node_features_0,
     NULL,
-}};
+}, find_msg_echo_request };
+
+static ogs_tlv_desc_t *find_msg_echo_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_echo_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_NODE_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_echo_response_t, sending_node_features);
+        return &ogs_gtp_tlv_desc_node_features_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_echo_response =
 {
@@ -2037,7 +2806,404 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_echo_response =
         &ogs_gtp_tlv_desc_recovery_0,
         &ogs_gtp_tlv_desc_node_features_0,
     NULL,
-}};
+}, find_msg_echo_response };
+
+static ogs_tlv_desc_t *find_msg_create_session_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_IMSI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_create_session_request_t, imsi);
+        return &ogs_gtp_tlv_desc_imsi_0;
+    case OGS_GTP_MSISDN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_create_session_request_t, msisdn);
+        return &ogs_gtp_tlv_desc_msisdn_0;
+    case OGS_GTP_MEI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_create_session_request_t, me_identity);
+        return &ogs_gtp_tlv_desc_mei_0;
+    case OGS_GTP_ULI_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 3;
+            *offset = offsetof(ogs_gtp_create_session_request_t, user_location_information);
+            return &ogs_gtp_tlv_desc_uli_0;
+        case 1:
+            *index = 59;
+            *offset = offsetof(ogs_gtp_create_session_request_t, user_location_information_for_sgw_);
+            return &ogs_gtp_tlv_desc_uli_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_SERVING_NETWORK_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_create_session_request_t, serving_network);
+        return &ogs_gtp_tlv_desc_serving_network_0;
+    case OGS_GTP_RAT_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_create_session_request_t, rat_type);
+        return &ogs_gtp_tlv_desc_rat_type_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_create_session_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_F_TEID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 7;
+            *offset = offsetof(ogs_gtp_create_session_request_t, sender_f_teid_for_control_plane);
+            return &ogs_gtp_tlv_desc_f_teid_0;
+        case 1:
+            *index = 8;
+            *offset = offsetof(ogs_gtp_create_session_request_t, pgw_s5_s8_address_for_control_plane_or_pmip);
+            return &ogs_gtp_tlv_desc_f_teid_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_APN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_create_session_request_t, access_point_name);
+        return &ogs_gtp_tlv_desc_apn_0;
+    case OGS_GTP_SELECTION_MODE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_create_session_request_t, selection_mode);
+        return &ogs_gtp_tlv_desc_selection_mode_0;
+    case OGS_GTP_PDN_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_gtp_create_session_request_t, pdn_type);
+        return &ogs_gtp_tlv_desc_pdn_type_0;
+    case OGS_GTP_PAA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_gtp_create_session_request_t, pdn_address_allocation);
+        return &ogs_gtp_tlv_desc_paa_0;
+    case OGS_GTP_APN_RESTRICTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_gtp_create_session_request_t, maximum_apn_restriction);
+        return &ogs_gtp_tlv_desc_apn_restriction_0;
+    case OGS_GTP_AMBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_gtp_create_session_request_t, aggregate_maximum_bit_rate);
+        return &ogs_gtp_tlv_desc_ambr_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_gtp_create_session_request_t, linked_eps_bearer_id);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_TWMI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_create_session_request_t, trusted_wlan_mode_indication);
+        return &ogs_gtp_tlv_desc_twmi_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 17;
+        *offset = offsetof(ogs_gtp_create_session_request_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 18;
+            *offset = offsetof(ogs_gtp_create_session_request_t, bearer_contexts_to_be_created);
+            return &ogs_gtp_tlv_desc_bearer_context_0;
+        case 1:
+            *index = 19;
+            *offset = offsetof(ogs_gtp_create_session_request_t, bearer_contexts_to_be_removed);
+            return &ogs_gtp_tlv_desc_bearer_context_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_TRACE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 20;
+        *offset = offsetof(ogs_gtp_create_session_request_t, trace_information);
+        return &ogs_gtp_tlv_desc_trace_information_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_gtp_create_session_request_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 22;
+            *offset = offsetof(ogs_gtp_create_session_request_t, mme_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 1:
+            *index = 23;
+            *offset = offsetof(ogs_gtp_create_session_request_t, sgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_1;
+        case 2:
+            *index = 24;
+            *offset = offsetof(ogs_gtp_create_session_request_t, epdg_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_2;
+        case 3:
+            *index = 25;
+            *offset = offsetof(ogs_gtp_create_session_request_t, twan_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_3;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_UE_TIME_ZONE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 26;
+        *offset = offsetof(ogs_gtp_create_session_request_t, ue_time_zone);
+        return &ogs_gtp_tlv_desc_ue_time_zone_0;
+    case OGS_GTP_UCI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 27;
+        *offset = offsetof(ogs_gtp_create_session_request_t, user_csg_information);
+        return &ogs_gtp_tlv_desc_uci_0;
+    case OGS_GTP_CHARGING_CHARACTERISTICS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 28;
+        *offset = offsetof(ogs_gtp_create_session_request_t, charging_characteristics);
+        return &ogs_gtp_tlv_desc_charging_characteristics_0;
+    case OGS_GTP_LDN_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 29;
+            *offset = offsetof(ogs_gtp_create_session_request_t, mme_s4_sgsn_ldn);
+            return &ogs_gtp_tlv_desc_ldn_0;
+        case 1:
+            *index = 30;
+            *offset = offsetof(ogs_gtp_create_session_request_t, sgw_ldn);
+            return &ogs_gtp_tlv_desc_ldn_1;
+        case 2:
+            *index = 31;
+            *offset = offsetof(ogs_gtp_create_session_request_t, epdg_ldn);
+            return &ogs_gtp_tlv_desc_ldn_2;
+        case 3:
+            *index = 32;
+            *offset = offsetof(ogs_gtp_create_session_request_t, twan_ldn);
+            return &ogs_gtp_tlv_desc_ldn_3;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_SIGNALLING_PRIORITY_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 33;
+        *offset = offsetof(ogs_gtp_create_session_request_t, signalling_priority_indication);
+        return &ogs_gtp_tlv_desc_signalling_priority_indication_0;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 34;
+            *offset = offsetof(ogs_gtp_create_session_request_t, ue_local_ip_address);
+            return &ogs_gtp_tlv_desc_ip_address_0;
+        case 1:
+            *index = 37;
+            *offset = offsetof(ogs_gtp_create_session_request_t, hnb_local_ip_address);
+            return &ogs_gtp_tlv_desc_ip_address_1;
+        case 2:
+            *index = 39;
+            *offset = offsetof(ogs_gtp_create_session_request_t, mme_s4_sgsn_identifier);
+            return &ogs_gtp_tlv_desc_ip_address_2;
+        case 3:
+            *index = 41;
+            *offset = offsetof(ogs_gtp_create_session_request_t, epdg_ip_address);
+            return &ogs_gtp_tlv_desc_ip_address_3;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PORT_NUMBER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 35;
+            *offset = offsetof(ogs_gtp_create_session_request_t, ue_udp_port);
+            return &ogs_gtp_tlv_desc_port_number_0;
+        case 1:
+            *index = 38;
+            *offset = offsetof(ogs_gtp_create_session_request_t, hnb_udp_port);
+            return &ogs_gtp_tlv_desc_port_number_1;
+        case 2:
+            *index = 57;
+            *offset = offsetof(ogs_gtp_create_session_request_t, ue_tcp_port);
+            return &ogs_gtp_tlv_desc_port_number_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_APCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 36;
+        *offset = offsetof(ogs_gtp_create_session_request_t, additional_protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_apco_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 40;
+            *offset = offsetof(ogs_gtp_create_session_request_t, twan_identifier);
+            return &ogs_gtp_tlv_desc_twan_identifier_0;
+        case 1:
+            *index = 49;
+            *offset = offsetof(ogs_gtp_create_session_request_t, wlan_location_information);
+            return &ogs_gtp_tlv_desc_twan_identifier_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_CN_OPERATOR_SELECTION_ENTITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 42;
+        *offset = offsetof(ogs_gtp_create_session_request_t, cn_operator_selection_entity);
+        return &ogs_gtp_tlv_desc_cn_operator_selection_entity_0;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 43;
+        *offset = offsetof(ogs_gtp_create_session_request_t, presence_reporting_area_information);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_information_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 44;
+            *offset = offsetof(ogs_gtp_create_session_request_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 45;
+            *offset = offsetof(ogs_gtp_create_session_request_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        case 2:
+            *index = 46;
+            *offset = offsetof(ogs_gtp_create_session_request_t, twan_epdg_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_MILLISECOND_TIME_STAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 47;
+        *offset = offsetof(ogs_gtp_create_session_request_t, origination_time_stamp);
+        return &ogs_gtp_tlv_desc_millisecond_time_stamp_0;
+    case OGS_GTP_INTEGER_NUMBER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 48;
+        *offset = offsetof(ogs_gtp_create_session_request_t, maximum_wait_time);
+        return &ogs_gtp_tlv_desc_integer_number_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TIMESTAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 50;
+        *offset = offsetof(ogs_gtp_create_session_request_t, wlan_location_timestamp);
+        return &ogs_gtp_tlv_desc_twan_identifier_timestamp_0;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 51;
+        *offset = offsetof(ogs_gtp_create_session_request_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    case OGS_GTP_REMOTE_UE_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 52;
+        *offset = offsetof(ogs_gtp_create_session_request_t, remote_ue_context_connected);
+        return &ogs_gtp_tlv_desc_remote_ue_context_0;
+    case OGS_GTP_NODE_IDENTIFIER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 53;
+        *offset = offsetof(ogs_gtp_create_session_request_t, _aaa_server_identifier);
+        return &ogs_gtp_tlv_desc_node_identifier_0;
+    case OGS_GTP_EPCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 54;
+        *offset = offsetof(ogs_gtp_create_session_request_t, extended_protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_epco_0;
+    case OGS_GTP_SERVING_PLMN_RATE_CONTROL_TYPE:
+        if (instance != 0)
+            break;
+        *index = 55;
+        *offset = offsetof(ogs_gtp_create_session_request_t, serving_plmn_rate_control);
+        return &ogs_gtp_tlv_desc_serving_plmn_rate_control_0;
+    case OGS_GTP_COUNTER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 56;
+        *offset = offsetof(ogs_gtp_create_session_request_t, mo_exception_data_counter);
+        return &ogs_gtp_tlv_desc_counter_0;
+    case OGS_GTP_MAPPED_UE_USAGE_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 58;
+        *offset = offsetof(ogs_gtp_create_session_request_t, mapped_ue_usage_type);
+        return &ogs_gtp_tlv_desc_mapped_ue_usage_type_0;
+    case OGS_GTP_FQDN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 60;
+        *offset = offsetof(ogs_gtp_create_session_request_t, sgw_u_node_name);
+        return &ogs_gtp_tlv_desc_fqdn_0;
+    case OGS_GTP_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 61;
+        *offset = offsetof(ogs_gtp_create_session_request_t, secondary_rat_usage_data_report);
+        return &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0;
+    case OGS_GTP_UP_FUNCTION_SELECTION_INDICATION_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 62;
+        *offset = offsetof(ogs_gtp_create_session_request_t, up_function_selection_indication_flags);
+        return &ogs_gtp_tlv_desc_up_function_selection_indication_flags_0;
+    case OGS_GTP_APN_RATE_CONTROL_STATUS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 63;
+        *offset = offsetof(ogs_gtp_create_session_request_t, apn_rate_control_status);
+        return &ogs_gtp_tlv_desc_apn_rate_control_status_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_create_session_request =
 {
@@ -2109,7 +3275,226 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_create_session_request =
         &ogs_gtp_tlv_desc_up_function_selection_indication_flags_0,
         &ogs_gtp_tlv_desc_apn_rate_control_status_0,
     NULL,
-}};
+}, find_msg_create_session_request };
+
+static ogs_tlv_desc_t *find_msg_create_session_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_create_session_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_CHANGE_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_create_session_response_t, change_reporting_action_);
+        return &ogs_gtp_tlv_desc_change_reporting_action_0;
+    case OGS_GTP_CSG_INFORMATION_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_create_session_response_t, csg_information_reporting_action);
+        return &ogs_gtp_tlv_desc_csg_information_reporting_action_0;
+    case OGS_GTP_ENB_INFORMATION_REPORTING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_create_session_response_t, hnb_information_reporting);
+        return &ogs_gtp_tlv_desc_enb_information_reporting_0;
+    case OGS_GTP_F_TEID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_create_session_response_t, sender_f_teid_for_control_plane);
+            return &ogs_gtp_tlv_desc_f_teid_0;
+        case 1:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_create_session_response_t, pgw_s5_s8__s2a_s2b_f_teid_for_pmip_based_interface_or_for_gtp_based_control_plane_interface);
+            return &ogs_gtp_tlv_desc_f_teid_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PAA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_create_session_response_t, pdn_address_allocation);
+        return &ogs_gtp_tlv_desc_paa_0;
+    case OGS_GTP_APN_RESTRICTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_create_session_response_t, apn_restriction);
+        return &ogs_gtp_tlv_desc_apn_restriction_0;
+    case OGS_GTP_AMBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_create_session_response_t, aggregate_maximum_bit_rate);
+        return &ogs_gtp_tlv_desc_ambr_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_create_session_response_t, linked_eps_bearer_id);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_create_session_response_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 11;
+            *offset = offsetof(ogs_gtp_create_session_response_t, bearer_contexts_created);
+            return &ogs_gtp_tlv_desc_bearer_context_0;
+        case 1:
+            *index = 12;
+            *offset = offsetof(ogs_gtp_create_session_response_t, bearer_contexts_marked_for_removal);
+            return &ogs_gtp_tlv_desc_bearer_context_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_gtp_create_session_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_FQDN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_gtp_create_session_response_t, charging_gateway_name);
+        return &ogs_gtp_tlv_desc_fqdn_0;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_gtp_create_session_response_t, charging_gateway_address);
+        return &ogs_gtp_tlv_desc_ip_address_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 16;
+            *offset = offsetof(ogs_gtp_create_session_response_t, pgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 1:
+            *index = 17;
+            *offset = offsetof(ogs_gtp_create_session_response_t, sgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_LDN_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 18;
+            *offset = offsetof(ogs_gtp_create_session_response_t, sgw_ldn);
+            return &ogs_gtp_tlv_desc_ldn_0;
+        case 1:
+            *index = 19;
+            *offset = offsetof(ogs_gtp_create_session_response_t, pgw_ldn);
+            return &ogs_gtp_tlv_desc_ldn_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_EPC_TIMER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 20;
+        *offset = offsetof(ogs_gtp_create_session_response_t, pgw_back_off_time);
+        return &ogs_gtp_tlv_desc_epc_timer_0;
+    case OGS_GTP_APCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_gtp_create_session_response_t, additional_protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_apco_0;
+    case OGS_GTP_IP4CP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 22;
+        *offset = offsetof(ogs_gtp_create_session_response_t, trusted_wlan_ipv4_parameters_);
+        return &ogs_gtp_tlv_desc_ip4cp_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 23;
+        *offset = offsetof(ogs_gtp_create_session_response_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 24;
+        *offset = offsetof(ogs_gtp_create_session_response_t, presence_reporting_area_action);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_action_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 25;
+            *offset = offsetof(ogs_gtp_create_session_response_t, pgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_0;
+        case 1:
+            *index = 26;
+            *offset = offsetof(ogs_gtp_create_session_response_t, pgw_s_apn_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_1;
+        case 2:
+            *index = 27;
+            *offset = offsetof(ogs_gtp_create_session_response_t, sgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 28;
+            *offset = offsetof(ogs_gtp_create_session_response_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 29;
+            *offset = offsetof(ogs_gtp_create_session_response_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 30;
+        *offset = offsetof(ogs_gtp_create_session_response_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    case OGS_GTP_CHARGING_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 31;
+        *offset = offsetof(ogs_gtp_create_session_response_t, pdn_connection_charging_id);
+        return &ogs_gtp_tlv_desc_charging_id_0;
+    case OGS_GTP_EPCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 32;
+        *offset = offsetof(ogs_gtp_create_session_response_t, extended_protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_epco_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_create_session_response =
 {
@@ -2150,7 +3535,224 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_create_session_response =
         &ogs_gtp_tlv_desc_charging_id_0,
         &ogs_gtp_tlv_desc_epco_0,
     NULL,
-}};
+}, find_msg_create_session_response };
+
+static ogs_tlv_desc_t *find_msg_modify_bearer_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_MEI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, me_identity);
+        return &ogs_gtp_tlv_desc_mei_0;
+    case OGS_GTP_ULI_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 1;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, user_location_information);
+            return &ogs_gtp_tlv_desc_uli_0;
+        case 1:
+            *index = 29;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, user_location_information_for_sgw_);
+            return &ogs_gtp_tlv_desc_uli_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_SERVING_NETWORK_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, serving_network);
+        return &ogs_gtp_tlv_desc_serving_network_0;
+    case OGS_GTP_RAT_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, rat_type);
+        return &ogs_gtp_tlv_desc_rat_type_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, sender_f_teid_for_control_plane);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    case OGS_GTP_AMBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, aggregate_maximum_bit_rate);
+        return &ogs_gtp_tlv_desc_ambr_0;
+    case OGS_GTP_DELAY_VALUE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, delay_downlink_packet_notification_request);
+        return &ogs_gtp_tlv_desc_delay_value_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 8;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, bearer_contexts_to_be_modified);
+            return &ogs_gtp_tlv_desc_bearer_context_0;
+        case 1:
+            *index = 9;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, bearer_contexts_to_be_removed);
+            return &ogs_gtp_tlv_desc_bearer_context_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_UE_TIME_ZONE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, ue_time_zone);
+        return &ogs_gtp_tlv_desc_ue_time_zone_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, mme_fq_csid);
+        return &ogs_gtp_tlv_desc_fq_csid_0;
+    case OGS_GTP_UCI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, user_csg_information);
+        return &ogs_gtp_tlv_desc_uci_0;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        switch (instance) {
+        case 1:
+            *index = 14;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, ue_local_ip_address);
+            return &ogs_gtp_tlv_desc_ip_address_1;
+        case 0:
+            *index = 18;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, hnb_local_ip_address);
+            return &ogs_gtp_tlv_desc_ip_address_0;
+        case 2:
+            *index = 20;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, mme_s4_sgsn_identifier);
+            return &ogs_gtp_tlv_desc_ip_address_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PORT_NUMBER_TYPE:
+        switch (instance) {
+        case 1:
+            *index = 15;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, ue_udp_port);
+            return &ogs_gtp_tlv_desc_port_number_1;
+        case 0:
+            *index = 19;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, hnb_udp_port);
+            return &ogs_gtp_tlv_desc_port_number_0;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_LDN_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 16;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, mme_s4_sgsn_ldn);
+            return &ogs_gtp_tlv_desc_ldn_0;
+        case 1:
+            *index = 17;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, sgw_ldn);
+            return &ogs_gtp_tlv_desc_ldn_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_CN_OPERATOR_SELECTION_ENTITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, cn_operator_selection_entity);
+        return &ogs_gtp_tlv_desc_cn_operator_selection_entity_0;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 22;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, presence_reporting_area_information);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_information_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 23;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 24;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        case 2:
+            *index = 25;
+            *offset = offsetof(ogs_gtp_modify_bearer_request_t, epdg_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_SERVING_PLMN_RATE_CONTROL_TYPE:
+        if (instance != 0)
+            break;
+        *index = 26;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, serving_plmn_rate_control);
+        return &ogs_gtp_tlv_desc_serving_plmn_rate_control_0;
+    case OGS_GTP_COUNTER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 27;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, mo_exception_data_counter);
+        return &ogs_gtp_tlv_desc_counter_0;
+    case OGS_GTP_IMSI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 28;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, imsi);
+        return &ogs_gtp_tlv_desc_imsi_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 30;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, wlan_location_information);
+        return &ogs_gtp_tlv_desc_twan_identifier_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TIMESTAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 31;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, wlan_location_timestamp);
+        return &ogs_gtp_tlv_desc_twan_identifier_timestamp_0;
+    case OGS_GTP_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 32;
+        *offset = offsetof(ogs_gtp_modify_bearer_request_t, secondary_rat_usage_data_report);
+        return &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_bearer_request =
 {
@@ -2191,7 +3793,176 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_bearer_request =
         &ogs_gtp_tlv_desc_twan_identifier_timestamp_0,
         &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0,
     NULL,
-}};
+}, find_msg_modify_bearer_request };
+
+static ogs_tlv_desc_t *find_msg_modify_bearer_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_MSISDN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, msisdn);
+        return &ogs_gtp_tlv_desc_msisdn_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, linked_eps_bearer_id);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_APN_RESTRICTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, apn_restriction);
+        return &ogs_gtp_tlv_desc_apn_restriction_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, bearer_contexts_modified);
+            return &ogs_gtp_tlv_desc_bearer_context_0;
+        case 1:
+            *index = 6;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, bearer_contexts_marked_for_removal);
+            return &ogs_gtp_tlv_desc_bearer_context_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_CHANGE_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, change_reporting_action);
+        return &ogs_gtp_tlv_desc_change_reporting_action_0;
+    case OGS_GTP_CSG_INFORMATION_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, csg_information_reporting_action);
+        return &ogs_gtp_tlv_desc_csg_information_reporting_action_0;
+    case OGS_GTP_ENB_INFORMATION_REPORTING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, hnb_information_reporting_);
+        return &ogs_gtp_tlv_desc_enb_information_reporting_0;
+    case OGS_GTP_FQDN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, charging_gateway_name);
+        return &ogs_gtp_tlv_desc_fqdn_0;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, charging_gateway_address);
+        return &ogs_gtp_tlv_desc_ip_address_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 12;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, pgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 1:
+            *index = 13;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, sgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_LDN_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 15;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, sgw_ldn);
+            return &ogs_gtp_tlv_desc_ldn_0;
+        case 1:
+            *index = 16;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, pgw_ldn);
+            return &ogs_gtp_tlv_desc_ldn_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 17;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 18;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, presence_reporting_area_action);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_action_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 19;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, pgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_0;
+        case 1:
+            *index = 20;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, pgw_s_apn_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_1;
+        case 2:
+            *index = 21;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, sgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 22;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 23;
+            *offset = offsetof(ogs_gtp_modify_bearer_response_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_CHARGING_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 24;
+        *offset = offsetof(ogs_gtp_modify_bearer_response_t, pdn_connection_charging_id);
+        return &ogs_gtp_tlv_desc_charging_id_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_bearer_response =
 {
@@ -2224,7 +3995,156 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_bearer_response =
         &ogs_gtp_tlv_desc_overload_control_information_1,
         &ogs_gtp_tlv_desc_charging_id_0,
     NULL,
-}};
+}, find_msg_modify_bearer_response };
+
+static ogs_tlv_desc_t *find_msg_delete_session_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, linked_eps_bearer_id);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_ULI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, user_location_information);
+        return &ogs_gtp_tlv_desc_uli_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_NODE_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, originating_node);
+        return &ogs_gtp_tlv_desc_node_type_0;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, sender_f_teid_for_control_plane);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    case OGS_GTP_UE_TIME_ZONE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, ue_time_zone);
+        return &ogs_gtp_tlv_desc_ue_time_zone_0;
+    case OGS_GTP_ULI_TIMESTAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, uli_timestamp);
+        return &ogs_gtp_tlv_desc_uli_timestamp_0;
+    case OGS_GTP_RAN_NAS_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, ran_nas_release_cause);
+        return &ogs_gtp_tlv_desc_ran_nas_cause_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 10;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, twan_identifier);
+            return &ogs_gtp_tlv_desc_twan_identifier_0;
+        case 1:
+            *index = 15;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, wlan_location_information);
+            return &ogs_gtp_tlv_desc_twan_identifier_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_TWAN_IDENTIFIER_TIMESTAMP_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 11;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, twan_identifier_timestamp);
+            return &ogs_gtp_tlv_desc_twan_identifier_timestamp_0;
+        case 1:
+            *index = 16;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, wlan_location_timestamp);
+            return &ogs_gtp_tlv_desc_twan_identifier_timestamp_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 12;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 13;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        case 2:
+            *index = 14;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, twan_epdg_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 17;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, ue_local_ip_address);
+        return &ogs_gtp_tlv_desc_ip_address_0;
+    case OGS_GTP_PORT_NUMBER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 18;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, ue_udp_port);
+            return &ogs_gtp_tlv_desc_port_number_0;
+        case 1:
+            *index = 20;
+            *offset = offsetof(ogs_gtp_delete_session_request_t, ue_tcp_port);
+            return &ogs_gtp_tlv_desc_port_number_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_EPCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 19;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, extended_protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_epco_0;
+    case OGS_GTP_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_gtp_delete_session_request_t, secondary_rat_usage_data_report);
+        return &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_session_request =
 {
@@ -2254,7 +4174,86 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_session_request =
         &ogs_gtp_tlv_desc_port_number_1,
         &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0,
     NULL,
-}};
+}, find_msg_delete_session_request };
+
+static ogs_tlv_desc_t *find_msg_delete_session_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_delete_session_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_delete_session_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_delete_session_response_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_delete_session_response_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_delete_session_response_t, pgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_0;
+        case 1:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_delete_session_response_t, pgw_s_apn_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_1;
+        case 2:
+            *index = 6;
+            *offset = offsetof(ogs_gtp_delete_session_response_t, sgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 7;
+            *offset = offsetof(ogs_gtp_delete_session_response_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 8;
+            *offset = offsetof(ogs_gtp_delete_session_response_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_EPCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_delete_session_response_t, extended_protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_epco_0;
+    case OGS_GTP_APN_RATE_CONTROL_STATUS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_delete_session_response_t, apn_rate_control_status);
+        return &ogs_gtp_tlv_desc_apn_rate_control_status_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_session_response =
 {
@@ -2273,7 +4272,54 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_session_response =
         &ogs_gtp_tlv_desc_epco_0,
         &ogs_gtp_tlv_desc_apn_rate_control_status_0,
     NULL,
-}};
+}, find_msg_delete_session_response };
+
+static ogs_tlv_desc_t *find_msg_modify_bearer_command(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_AMBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_modify_bearer_command_t, apn_aggregate_maximum_bit_rate);
+        return &ogs_gtp_tlv_desc_ambr_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_modify_bearer_command_t, bearer_context);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 2;
+            *offset = offsetof(ogs_gtp_modify_bearer_command_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 3;
+            *offset = offsetof(ogs_gtp_modify_bearer_command_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        case 2:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_modify_bearer_command_t, twan_epdg_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_modify_bearer_command_t, sender_f_teid_for_control_plane);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_bearer_command =
 {
@@ -2287,7 +4333,50 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_bearer_command =
         &ogs_gtp_tlv_desc_overload_control_information_2,
         &ogs_gtp_tlv_desc_f_teid_0,
     NULL,
-}};
+}, find_msg_modify_bearer_command };
+
+static ogs_tlv_desc_t *find_msg_modify_bearer_failure_indication(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_modify_bearer_failure_indication_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_modify_bearer_failure_indication_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_modify_bearer_failure_indication_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 3;
+            *offset = offsetof(ogs_gtp_modify_bearer_failure_indication_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_modify_bearer_failure_indication_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_bearer_failure_indication =
 {
@@ -2300,7 +4389,68 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_bearer_failure_indication =
         &ogs_gtp_tlv_desc_overload_control_information_0,
         &ogs_gtp_tlv_desc_overload_control_information_1,
     NULL,
-}};
+}, find_msg_modify_bearer_failure_indication };
+
+static ogs_tlv_desc_t *find_msg_delete_bearer_command(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_delete_bearer_command_t, bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_ULI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_delete_bearer_command_t, user_location_information);
+        return &ogs_gtp_tlv_desc_uli_0;
+    case OGS_GTP_ULI_TIMESTAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_delete_bearer_command_t, uli_timestamp);
+        return &ogs_gtp_tlv_desc_uli_timestamp_0;
+    case OGS_GTP_UE_TIME_ZONE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_delete_bearer_command_t, ue_time_zone);
+        return &ogs_gtp_tlv_desc_ue_time_zone_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_delete_bearer_command_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_delete_bearer_command_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_delete_bearer_command_t, sender_f_teid_for_control_plane);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    case OGS_GTP_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_delete_bearer_command_t, secondary_rat_usage_data_report);
+        return &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_bearer_command =
 {
@@ -2316,7 +4466,56 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_bearer_command =
         &ogs_gtp_tlv_desc_f_teid_0,
         &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0,
     NULL,
-}};
+}, find_msg_delete_bearer_command };
+
+static ogs_tlv_desc_t *find_msg_delete_bearer_failure_indication(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_delete_bearer_failure_indication_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_delete_bearer_failure_indication_t, bearer_context);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_delete_bearer_failure_indication_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_delete_bearer_failure_indication_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_delete_bearer_failure_indication_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_delete_bearer_failure_indication_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_bearer_failure_indication =
 {
@@ -2330,7 +4529,130 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_bearer_failure_indication =
         &ogs_gtp_tlv_desc_overload_control_information_0,
         &ogs_gtp_tlv_desc_overload_control_information_1,
     NULL,
-}};
+}, find_msg_delete_bearer_failure_indication };
+
+static ogs_tlv_desc_t *find_msg_bearer_resource_command(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_EBI_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 0;
+            *offset = offsetof(ogs_gtp_bearer_resource_command_t, linked_eps_bearer_id);
+            return &ogs_gtp_tlv_desc_ebi_0;
+        case 1:
+            *index = 7;
+            *offset = offsetof(ogs_gtp_bearer_resource_command_t, eps_bearer_id);
+            return &ogs_gtp_tlv_desc_ebi_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PTI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, procedure_transaction_id);
+        return &ogs_gtp_tlv_desc_pti_0;
+    case OGS_GTP_FLOW_QOS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, flow_quality_of_service);
+        return &ogs_gtp_tlv_desc_flow_qos_0;
+    case OGS_GTP_TAD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, traffic_aggregate_description);
+        return &ogs_gtp_tlv_desc_tad_0;
+    case OGS_GTP_RAT_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, rat_type);
+        return &ogs_gtp_tlv_desc_rat_type_0;
+    case OGS_GTP_SERVING_NETWORK_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, serving_network);
+        return &ogs_gtp_tlv_desc_serving_network_0;
+    case OGS_GTP_ULI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, user_location_information);
+        return &ogs_gtp_tlv_desc_uli_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_F_TEID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 9;
+            *offset = offsetof(ogs_gtp_bearer_resource_command_t, s4_u_sgsn_f_teid);
+            return &ogs_gtp_tlv_desc_f_teid_0;
+        case 1:
+            *index = 10;
+            *offset = offsetof(ogs_gtp_bearer_resource_command_t, s12_rnc_f_teid);
+            return &ogs_gtp_tlv_desc_f_teid_1;
+        case 2:
+            *index = 17;
+            *offset = offsetof(ogs_gtp_bearer_resource_command_t, sender_f_teid_for_control_plane);
+            return &ogs_gtp_tlv_desc_f_teid_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_SIGNALLING_PRIORITY_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, signalling_priority_indication__);
+        return &ogs_gtp_tlv_desc_signalling_priority_indication_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 13;
+            *offset = offsetof(ogs_gtp_bearer_resource_command_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 14;
+            *offset = offsetof(ogs_gtp_bearer_resource_command_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    case OGS_GTP_EPCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_bearer_resource_command_t, extended_protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_epco_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_resource_command =
 {
@@ -2356,7 +4678,68 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_resource_command =
         &ogs_gtp_tlv_desc_epco_0,
         &ogs_gtp_tlv_desc_f_teid_2,
     NULL,
-}};
+}, find_msg_bearer_resource_command };
+
+static ogs_tlv_desc_t *find_msg_bearer_resource_failure_indication(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_bearer_resource_failure_indication_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_bearer_resource_failure_indication_t, linked_eps_bearer_id);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_PTI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_bearer_resource_failure_indication_t, procedure_transaction_id);
+        return &ogs_gtp_tlv_desc_pti_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_bearer_resource_failure_indication_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_bearer_resource_failure_indication_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_bearer_resource_failure_indication_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_bearer_resource_failure_indication_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_bearer_resource_failure_indication_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_resource_failure_indication =
 {
@@ -2372,7 +4755,36 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_bearer_resource_failure_indication =
         &ogs_gtp_tlv_desc_recovery_0,
         &ogs_gtp_tlv_desc_f_container_0,
     NULL,
-}};
+}, find_msg_bearer_resource_failure_indication };
+
+static ogs_tlv_desc_t *find_msg_downlink_data_notification_failure_indication(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_failure_indication_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_NODE_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_failure_indication_t, originating_node);
+        return &ogs_gtp_tlv_desc_node_type_0;
+    case OGS_GTP_IMSI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_failure_indication_t, imsi);
+        return &ogs_gtp_tlv_desc_imsi_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_downlink_data_notification_failure_indication =
 {
@@ -2383,7 +4795,124 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_downlink_data_notification_failure_indication =
         &ogs_gtp_tlv_desc_node_type_0,
         &ogs_gtp_tlv_desc_imsi_0,
     NULL,
-}};
+}, find_msg_downlink_data_notification_failure_indication };
+
+static ogs_tlv_desc_t *find_msg_create_bearer_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_PTI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, procedure_transaction_id);
+        return &ogs_gtp_tlv_desc_pti_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, linked_eps_bearer_id);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_create_bearer_request_t, pgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 1:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_create_bearer_request_t, sgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_CHANGE_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, change_reporting_action);
+        return &ogs_gtp_tlv_desc_change_reporting_action_0;
+    case OGS_GTP_CSG_INFORMATION_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, csg_information_reporting_action);
+        return &ogs_gtp_tlv_desc_csg_information_reporting_action_0;
+    case OGS_GTP_ENB_INFORMATION_REPORTING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, hnb_information_reporting);
+        return &ogs_gtp_tlv_desc_enb_information_reporting_0;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, presence_reporting_area_action);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_action_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 11;
+            *offset = offsetof(ogs_gtp_create_bearer_request_t, pgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_0;
+        case 1:
+            *index = 12;
+            *offset = offsetof(ogs_gtp_create_bearer_request_t, pgw_s_apn_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_1;
+        case 2:
+            *index = 13;
+            *offset = offsetof(ogs_gtp_create_bearer_request_t, sgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 14;
+            *offset = offsetof(ogs_gtp_create_bearer_request_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 15;
+            *offset = offsetof(ogs_gtp_create_bearer_request_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_create_bearer_request_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_create_bearer_request =
 {
@@ -2408,7 +4937,142 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_create_bearer_request =
         &ogs_gtp_tlv_desc_overload_control_information_1,
         &ogs_gtp_tlv_desc_f_container_0,
     NULL,
-}};
+}, find_msg_create_bearer_request };
+
+static ogs_tlv_desc_t *find_msg_create_bearer_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 3;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, mme_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 2:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, epdg_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_2;
+        case 3:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, twan_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_3;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_UE_TIME_ZONE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, ue_time_zone);
+        return &ogs_gtp_tlv_desc_ue_time_zone_0;
+    case OGS_GTP_ULI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, user_location_information);
+        return &ogs_gtp_tlv_desc_uli_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 9;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, twan_identifier);
+            return &ogs_gtp_tlv_desc_twan_identifier_0;
+        case 1:
+            *index = 15;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, wlan_location_information);
+            return &ogs_gtp_tlv_desc_twan_identifier_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 10;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 11;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        case 2:
+            *index = 14;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, twan_epdg_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, presence_reporting_area_information);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_information_0;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, mme_s4_sgsn_identifier);
+        return &ogs_gtp_tlv_desc_ip_address_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TIMESTAMP_TYPE:
+        if (instance != 1)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, wlan_location_timestamp);
+        return &ogs_gtp_tlv_desc_twan_identifier_timestamp_1;
+    case OGS_GTP_PORT_NUMBER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 17;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, ue_udp_port);
+            return &ogs_gtp_tlv_desc_port_number_0;
+        case 1:
+            *index = 19;
+            *offset = offsetof(ogs_gtp_create_bearer_response_t, ue_tcp_port);
+            return &ogs_gtp_tlv_desc_port_number_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 18;
+        *offset = offsetof(ogs_gtp_create_bearer_response_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_create_bearer_response =
 {
@@ -2436,7 +5100,124 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_create_bearer_response =
         &ogs_gtp_tlv_desc_f_container_0,
         &ogs_gtp_tlv_desc_port_number_1,
     NULL,
-}};
+}, find_msg_create_bearer_response };
+
+static ogs_tlv_desc_t *find_msg_update_bearer_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_PTI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, procedure_transaction_id);
+        return &ogs_gtp_tlv_desc_pti_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_AMBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, aggregate_maximum_bit_rate);
+        return &ogs_gtp_tlv_desc_ambr_0;
+    case OGS_GTP_CHANGE_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, change_reporting_action);
+        return &ogs_gtp_tlv_desc_change_reporting_action_0;
+    case OGS_GTP_CSG_INFORMATION_REPORTING_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, csg_information_reporting_action);
+        return &ogs_gtp_tlv_desc_csg_information_reporting_action_0;
+    case OGS_GTP_ENB_INFORMATION_REPORTING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, hnb_information_reporting_);
+        return &ogs_gtp_tlv_desc_enb_information_reporting_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 8;
+            *offset = offsetof(ogs_gtp_update_bearer_request_t, pgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 1:
+            *index = 9;
+            *offset = offsetof(ogs_gtp_update_bearer_request_t, sgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, presence_reporting_area_action);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_action_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 11;
+            *offset = offsetof(ogs_gtp_update_bearer_request_t, pgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_0;
+        case 1:
+            *index = 12;
+            *offset = offsetof(ogs_gtp_update_bearer_request_t, pgw_s_apn_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_1;
+        case 2:
+            *index = 13;
+            *offset = offsetof(ogs_gtp_update_bearer_request_t, sgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 14;
+            *offset = offsetof(ogs_gtp_update_bearer_request_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 15;
+            *offset = offsetof(ogs_gtp_update_bearer_request_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_update_bearer_request_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_update_bearer_request =
 {
@@ -2461,7 +5242,152 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_update_bearer_request =
         &ogs_gtp_tlv_desc_overload_control_information_1,
         &ogs_gtp_tlv_desc_f_container_0,
     NULL,
-}};
+}, find_msg_update_bearer_request };
+
+static ogs_tlv_desc_t *find_msg_update_bearer_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, mme_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 1:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, sgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_1;
+        case 2:
+            *index = 6;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, epdg_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_2;
+        case 3:
+            *index = 7;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, twan_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_3;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_UE_TIME_ZONE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, ue_time_zone);
+        return &ogs_gtp_tlv_desc_ue_time_zone_0;
+    case OGS_GTP_ULI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, user_location_information);
+        return &ogs_gtp_tlv_desc_uli_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 11;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, twan_identifier);
+            return &ogs_gtp_tlv_desc_twan_identifier_0;
+        case 1:
+            *index = 17;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, wlan_location_information);
+            return &ogs_gtp_tlv_desc_twan_identifier_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 12;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 13;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        case 2:
+            *index = 16;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, twan_epdg_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PRESENCE_REPORTING_AREA_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, presence_reporting_area_information);
+        return &ogs_gtp_tlv_desc_presence_reporting_area_information_0;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, mme_s4_sgsn_identifier);
+        return &ogs_gtp_tlv_desc_ip_address_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TIMESTAMP_TYPE:
+        if (instance != 1)
+            break;
+        *index = 18;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, wlan_location_timestamp);
+        return &ogs_gtp_tlv_desc_twan_identifier_timestamp_1;
+    case OGS_GTP_PORT_NUMBER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 19;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, ue_udp_port);
+            return &ogs_gtp_tlv_desc_port_number_0;
+        case 1:
+            *index = 21;
+            *offset = offsetof(ogs_gtp_update_bearer_response_t, ue_tcp_port);
+            return &ogs_gtp_tlv_desc_port_number_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 20;
+        *offset = offsetof(ogs_gtp_update_bearer_response_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_update_bearer_response =
 {
@@ -2491,7 +5417,126 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_update_bearer_response =
         &ogs_gtp_tlv_desc_f_container_0,
         &ogs_gtp_tlv_desc_port_number_1,
     NULL,
-}};
+}, find_msg_update_bearer_response };
+
+static ogs_tlv_desc_t *find_msg_delete_bearer_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_EBI_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 0;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, linked_eps_bearer_id);
+            return &ogs_gtp_tlv_desc_ebi_0;
+        case 1:
+            *index = 1;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, eps_bearer_ids);
+            return &ogs_gtp_tlv_desc_ebi_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_delete_bearer_request_t, failed_bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_PTI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_delete_bearer_request_t, procedure_transaction_id);
+        return &ogs_gtp_tlv_desc_pti_0;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_delete_bearer_request_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, pgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 1:
+            *index = 6;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, sgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_delete_bearer_request_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_delete_bearer_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 9;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, pgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_0;
+        case 1:
+            *index = 10;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, pgw_s_apn_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_1;
+        case 2:
+            *index = 11;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, sgw_s_node_level_load_control_information);
+            return &ogs_gtp_tlv_desc_load_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 12;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, pgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 13;
+            *offset = offsetof(ogs_gtp_delete_bearer_request_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_gtp_delete_bearer_request_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    case OGS_GTP_APN_RATE_CONTROL_STATUS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_gtp_delete_bearer_request_t, apn_rate_control_status);
+        return &ogs_gtp_tlv_desc_apn_rate_control_status_0;
+    case OGS_GTP_EPCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_delete_bearer_request_t, extended_protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_epco_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_bearer_request =
 {
@@ -2516,7 +5561,166 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_bearer_request =
         &ogs_gtp_tlv_desc_apn_rate_control_status_0,
         &ogs_gtp_tlv_desc_epco_0,
     NULL,
-}};
+}, find_msg_delete_bearer_request };
+
+static ogs_tlv_desc_t *find_msg_delete_bearer_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, linked_eps_bearer_id);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_FQ_CSID_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, mme_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_0;
+        case 1:
+            *index = 5;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, sgw_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_1;
+        case 2:
+            *index = 6;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, epdg_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_2;
+        case 3:
+            *index = 7;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, twan_fq_csid);
+            return &ogs_gtp_tlv_desc_fq_csid_3;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_PCO_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, protocol_configuration_options);
+        return &ogs_gtp_tlv_desc_pco_0;
+    case OGS_GTP_UE_TIME_ZONE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, ue_time_zone);
+        return &ogs_gtp_tlv_desc_ue_time_zone_0;
+    case OGS_GTP_ULI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, user_location_information);
+        return &ogs_gtp_tlv_desc_uli_0;
+    case OGS_GTP_ULI_TIMESTAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, uli_timestamp);
+        return &ogs_gtp_tlv_desc_uli_timestamp_0;
+    case OGS_GTP_TWAN_IDENTIFIER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 12;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, twan_identifier);
+            return &ogs_gtp_tlv_desc_twan_identifier_0;
+        case 1:
+            *index = 18;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, wlan_location_information);
+            return &ogs_gtp_tlv_desc_twan_identifier_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_TWAN_IDENTIFIER_TIMESTAMP_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 13;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, twan_identifier_timestamp);
+            return &ogs_gtp_tlv_desc_twan_identifier_timestamp_0;
+        case 1:
+            *index = 19;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, wlan_location_timestamp);
+            return &ogs_gtp_tlv_desc_twan_identifier_timestamp_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 14;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, mme_s4_sgsn_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_0;
+        case 1:
+            *index = 15;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, sgw_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_1;
+        case 2:
+            *index = 17;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, twan_epdg_s_overload_control_information);
+            return &ogs_gtp_tlv_desc_overload_control_information_2;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, mme_s4_sgsn_identifier);
+        return &ogs_gtp_tlv_desc_ip_address_0;
+    case OGS_GTP_PORT_NUMBER_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 20;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, ue_udp_port);
+            return &ogs_gtp_tlv_desc_port_number_0;
+        case 1:
+            *index = 22;
+            *offset = offsetof(ogs_gtp_delete_bearer_response_t, ue_tcp_port);
+            return &ogs_gtp_tlv_desc_port_number_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_F_CONTAINER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, nbifom_container);
+        return &ogs_gtp_tlv_desc_f_container_0;
+    case OGS_GTP_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 23;
+        *offset = offsetof(ogs_gtp_delete_bearer_response_t, secondary_rat_usage_data_report);
+        return &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_bearer_response =
 {
@@ -2548,7 +5752,54 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_bearer_response =
         &ogs_gtp_tlv_desc_port_number_1,
         &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0,
     NULL,
-}};
+}, find_msg_delete_bearer_response };
+
+static ogs_tlv_desc_t *find_msg_create_indirect_data_forwarding_tunnel_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_IMSI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_request_t, imsi);
+        return &ogs_gtp_tlv_desc_imsi_0;
+    case OGS_GTP_MEI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_request_t, me_identity);
+        return &ogs_gtp_tlv_desc_mei_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_request_t, sender_f_teid_for_control_plane);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_request_t, bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_request_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_create_indirect_data_forwarding_tunnel_request =
 {
@@ -2563,7 +5814,42 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_create_indirect_data_forwarding_tunnel_request =
         &ogs_tlv_desc_more8,
         &ogs_gtp_tlv_desc_recovery_0,
     NULL,
-}};
+}, find_msg_create_indirect_data_forwarding_tunnel_request };
+
+static ogs_tlv_desc_t *find_msg_create_indirect_data_forwarding_tunnel_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_response_t, sender_f_teid_for_control_plane);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_response_t, bearer_contexts);
+        return &ogs_gtp_tlv_desc_bearer_context_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_create_indirect_data_forwarding_tunnel_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_create_indirect_data_forwarding_tunnel_response =
 {
@@ -2576,7 +5862,18 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_create_indirect_data_forwarding_tunnel_response
         &ogs_tlv_desc_more8,
         &ogs_gtp_tlv_desc_recovery_0,
     NULL,
-}};
+}, find_msg_create_indirect_data_forwarding_tunnel_response };
+
+static ogs_tlv_desc_t *find_msg_delete_indirect_data_forwarding_tunnel_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_indirect_data_forwarding_tunnel_request =
 {
@@ -2584,7 +5881,30 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_indirect_data_forwarding_tunnel_request =
     "Delete Indirect Data Forwarding Tunnel Request",
     0, 0, 0, 0, {
     NULL,
-}};
+}, find_msg_delete_indirect_data_forwarding_tunnel_request };
+
+static ogs_tlv_desc_t *find_msg_delete_indirect_data_forwarding_tunnel_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_delete_indirect_data_forwarding_tunnel_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_delete_indirect_data_forwarding_tunnel_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_indirect_data_forwarding_tunnel_response =
 {
@@ -2594,7 +5914,42 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_delete_indirect_data_forwarding_tunnel_response
         &ogs_gtp_tlv_desc_cause_0,
         &ogs_gtp_tlv_desc_recovery_0,
     NULL,
-}};
+}, find_msg_delete_indirect_data_forwarding_tunnel_response };
+
+static ogs_tlv_desc_t *find_msg_release_access_bearers_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_release_access_bearers_request_t, list_of_rabs);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_NODE_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_release_access_bearers_request_t, originating_node);
+        return &ogs_gtp_tlv_desc_node_type_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_release_access_bearers_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_release_access_bearers_request_t, secondary_rat_usage_data_report);
+        return &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_release_access_bearers_request =
 {
@@ -2606,7 +5961,48 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_release_access_bearers_request =
         &ogs_gtp_tlv_desc_indication_0,
         &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0,
     NULL,
-}};
+}, find_msg_release_access_bearers_request };
+
+static ogs_tlv_desc_t *find_msg_release_access_bearers_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_release_access_bearers_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_release_access_bearers_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_release_access_bearers_response_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_release_access_bearers_response_t, sgw_s_node_level_load_control_information);
+        return &ogs_gtp_tlv_desc_load_control_information_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_release_access_bearers_response_t, sgw_s_overload_control_information);
+        return &ogs_gtp_tlv_desc_overload_control_information_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_release_access_bearers_response =
 {
@@ -2619,7 +6015,78 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_release_access_bearers_response =
         &ogs_gtp_tlv_desc_load_control_information_0,
         &ogs_gtp_tlv_desc_overload_control_information_0,
     NULL,
-}};
+}, find_msg_release_access_bearers_response };
+
+static ogs_tlv_desc_t *find_msg_downlink_data_notification(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_EBI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, eps_bearer_id);
+        return &ogs_gtp_tlv_desc_ebi_0;
+    case OGS_GTP_ARP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, allocation_retention_priority);
+        return &ogs_gtp_tlv_desc_arp_0;
+    case OGS_GTP_IMSI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, imsi);
+        return &ogs_gtp_tlv_desc_imsi_0;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, sender_f_teid_for_control_plane);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, sgw_s_node_level_load_control_information);
+        return &ogs_gtp_tlv_desc_load_control_information_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, sgw_s_overload_control_information);
+        return &ogs_gtp_tlv_desc_overload_control_information_0;
+    case OGS_GTP_PAGING_AND_SERVICE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, paging_and_service_information);
+        return &ogs_gtp_tlv_desc_paging_and_service_information_0;
+    case OGS_GTP_INTEGER_NUMBER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_t, dl_data_packets_size);
+        return &ogs_gtp_tlv_desc_integer_number_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_downlink_data_notification =
 {
@@ -2637,7 +6104,60 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_downlink_data_notification =
         &ogs_gtp_tlv_desc_paging_and_service_information_0,
         &ogs_gtp_tlv_desc_integer_number_0,
     NULL,
-}};
+}, find_msg_downlink_data_notification };
+
+static ogs_tlv_desc_t *find_msg_downlink_data_notification_acknowledge(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_acknowledge_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_DELAY_VALUE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_acknowledge_t, data_notification_delay);
+        return &ogs_gtp_tlv_desc_delay_value_0;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_acknowledge_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_THROTTLING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_acknowledge_t, dl_low_priority_traffic_throttling_);
+        return &ogs_gtp_tlv_desc_throttling_0;
+    case OGS_GTP_IMSI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_acknowledge_t, imsi);
+        return &ogs_gtp_tlv_desc_imsi_0;
+    case OGS_GTP_EPC_TIMER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_acknowledge_t, dl_buffering_duration);
+        return &ogs_gtp_tlv_desc_epc_timer_0;
+    case OGS_GTP_INTEGER_NUMBER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_downlink_data_notification_acknowledge_t, dl_buffering_suggested_packet_count);
+        return &ogs_gtp_tlv_desc_integer_number_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_downlink_data_notification_acknowledge =
 {
@@ -2652,7 +6172,62 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_downlink_data_notification_acknowledge =
         &ogs_gtp_tlv_desc_epc_timer_0,
         &ogs_gtp_tlv_desc_integer_number_0,
     NULL,
-}};
+}, find_msg_downlink_data_notification_acknowledge };
+
+static ogs_tlv_desc_t *find_msg_modify_access_bearers_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_request_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_request_t, sender_f_teid_for_control_plane);
+        return &ogs_gtp_tlv_desc_f_teid_0;
+    case OGS_GTP_DELAY_VALUE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_request_t, delay_downlink_packet_notification_request);
+        return &ogs_gtp_tlv_desc_delay_value_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 3;
+            *offset = offsetof(ogs_gtp_modify_access_bearers_request_t, bearer_contexts_to_be_modified);
+            return &ogs_gtp_tlv_desc_bearer_context_0;
+        case 1:
+            *index = 4;
+            *offset = offsetof(ogs_gtp_modify_access_bearers_request_t, bearer_contexts_to_be_removed);
+            return &ogs_gtp_tlv_desc_bearer_context_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_request_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_SECONDARY_RAT_USAGE_DATA_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_request_t, secondary_rat_usage_data_report);
+        return &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_access_bearers_request =
 {
@@ -2667,7 +6242,62 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_access_bearers_request =
         &ogs_gtp_tlv_desc_recovery_0,
         &ogs_gtp_tlv_desc_secondary_rat_usage_data_report_0,
     NULL,
-}};
+}, find_msg_modify_access_bearers_request };
+
+static ogs_tlv_desc_t *find_msg_modify_access_bearers_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_GTP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_response_t, cause);
+        return &ogs_gtp_tlv_desc_cause_0;
+    case OGS_GTP_BEARER_CONTEXT_TYPE:
+        switch (instance) {
+        case 0:
+            *index = 1;
+            *offset = offsetof(ogs_gtp_modify_access_bearers_response_t, bearer_contexts_modified);
+            return &ogs_gtp_tlv_desc_bearer_context_0;
+        case 1:
+            *index = 2;
+            *offset = offsetof(ogs_gtp_modify_access_bearers_response_t, bearer_contexts_marked_for_removal);
+            return &ogs_gtp_tlv_desc_bearer_context_1;
+        default:
+            break;
+        }
+        break;
+    case OGS_GTP_RECOVERY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_response_t, recovery);
+        return &ogs_gtp_tlv_desc_recovery_0;
+    case OGS_GTP_INDICATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_response_t, indication_flags);
+        return &ogs_gtp_tlv_desc_indication_0;
+    case OGS_GTP_LOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_response_t, sgw_s_node_level_load_control_information);
+        return &ogs_gtp_tlv_desc_load_control_information_0;
+    case OGS_GTP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_gtp_modify_access_bearers_response_t, sgw_s_overload_control_information);
+        return &ogs_gtp_tlv_desc_overload_control_information_0;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_access_bearers_response =
 {
@@ -2682,7 +6312,7 @@ ogs_tlv_desc_t ogs_gtp_tlv_desc_modify_access_bearers_response =
         &ogs_gtp_tlv_desc_load_control_information_0,
         &ogs_gtp_tlv_desc_overload_control_information_0,
     NULL,
-}};
+}, find_msg_modify_access_bearers_response };
 
 
 int ogs_gtp_parse_msg(ogs_gtp_message_t *gtp_message, ogs_pkbuf_t *pkbuf)
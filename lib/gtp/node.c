@@ -47,6 +47,10 @@ ogs_gtp_node_t *ogs_gtp_node_new(ogs_sockaddr_t *sa_list)
 
     ogs_list_init(&node->local_list);
     ogs_list_init(&node->remote_list);
+    node->local_hash = ogs_hash_make();
+    ogs_assert(node->local_hash);
+    node->remote_hash = ogs_hash_make();
+    ogs_assert(node->remote_hash);
 
     return node;
 }
@@ -59,6 +63,8 @@ void ogs_gtp_node_free(ogs_gtp_node_t *node)
         ogs_sock_destroy(node->sock);
 
     ogs_gtp_xact_delete_all(node);
+    ogs_hash_destroy(node->local_hash);
+    ogs_hash_destroy(node->remote_hash);
 
     ogs_freeaddrinfo(node->sa_list);
     ogs_pool_free(&pool, node);
@@ -50,6 +50,8 @@ typedef struct ogs_gtp_node_s {
 
     ogs_list_t      local_list;    
     ogs_list_t      remote_list;   
+    ogs_hash_t      *local_hash;    /* Local transactions by xid */
+    ogs_hash_t      *remote_hash;   /* Remote transactions by xid */
 } ogs_gtp_node_t;
 
 int ogs_gtp_node_init(void);
@@ -19,6 +19,18 @@
 
 #include "ogs-gtp.h"
 
+/* Each data-plane thread owns its burst */
+static ogs_thread_local struct {
+    bool enabled;
+
+    int num;
+    ogs_socket_t fd[OGS_MAX_NUM_OF_UDP_BURST];
+    ogs_pkbuf_t *pkbuf[OGS_MAX_NUM_OF_UDP_BURST];
+    ogs_sockaddr_t addr[OGS_MAX_NUM_OF_UDP_BURST];
+} burst;
+
+static void burst_flush(void);
+
 ogs_sock_t *ogs_gtp_server(ogs_socknode_t *node)
 {
     char buf[OGS_ADDRSTRLEN];
@@ -123,6 +135,73 @@ int ogs_gtp_sendto(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf)
     return OGS_OK;
 }
 
+void ogs_gtp_burst_begin(void)
+{
+    ogs_assert(burst.enabled == false);
+    ogs_assert(burst.num == 0);
+
+    burst.enabled = true;
+}
+
+void ogs_gtp_burst_end(void)
+{
+    ogs_assert(burst.enabled == true);
+
+    burst_flush();
+    burst.enabled = false;
+}
+
+int ogs_gtp_sendto_burst(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf)
+{
+    int rv;
+
+    ogs_assert(gnode);
+    ogs_assert(gnode->sock);
+    ogs_assert(pkbuf);
+
+    if (burst.enabled == false) {
+        rv = ogs_gtp_sendto(gnode, pkbuf);
+        ogs_pkbuf_free(pkbuf);
+        return rv;
+    }
+
+    if (burst.num == OGS_MAX_NUM_OF_UDP_BURST)
+        burst_flush();
+
+    burst.fd[burst.num] = gnode->sock->fd;
+    burst.pkbuf[burst.num] = pkbuf;
+    memcpy(&burst.addr[burst.num], &gnode->addr, sizeof gnode->addr);
+    burst.num++;
+
+    return OGS_OK;
+}
+
+static void burst_flush(void)
+{
+    int i, j, sent;
+
+    i = 0;
+    while (i < burst.num) {
+        /* Coalesce the consecutive G-PDUs sent through the same socket.
+         * Each message carries its own peer address */
+        j = i + 1;
+        while (j < burst.num && burst.fd[j] == burst.fd[i])
+            j++;
+
+        sent = ogs_sendmmsg(burst.fd[i],
+                &burst.pkbuf[i], &burst.addr[i], j - i);
+        if (sent != j - i && ogs_socket_errno != OGS_EAGAIN)
+            ogs_error("G-PDU burst : %d of %d sent",
+                    sent < 0 ? 0 : sent, j - i);
+
+        i = j;
+    }
+
+    for (i = 0; i < burst.num; i++)
+        ogs_pkbuf_free(burst.pkbuf[i]);
+    burst.num = 0;
+}
+
 ogs_pkbuf_t *ogs_gtp_handle_echo_req(ogs_pkbuf_t *pkb)
 {
     ogs_gtp_header_t *gtph = NULL;
@@ -36,6 +36,20 @@ int ogs_gtp_connect(ogs_sock_t *ipv4, ogs_sock_t *ipv6, ogs_gtp_node_t *gnode);
 int ogs_gtp_send(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf);
 int ogs_gtp_sendto(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf);
 
+/*
+ * G-PDU transmit burst
+ *
+ * Between ogs_gtp_burst_begin() and ogs_gtp_burst_end(),
+ * ogs_gtp_sendto_burst() queues the packet and the queue is flushed
+ * with sendmmsg() when it is full or when the burst ends.
+ * Outside of a burst, the packet is sent immediately.
+ *
+ * ogs_gtp_sendto_burst() always consumes pkbuf.
+ */
+void ogs_gtp_burst_begin(void);
+void ogs_gtp_burst_end(void);
+int ogs_gtp_sendto_burst(ogs_gtp_node_t *gnode, ogs_pkbuf_t *pkbuf);
+
 ogs_pkbuf_t *ogs_gtp_handle_echo_req(ogs_pkbuf_t *pkt);
 void ogs_gtp_send_error_message(
         ogs_gtp_xact_t *xact, uint32_t teid, uint8_t type, uint8_t cause_value);
@@ -95,6 +95,78 @@ def v_upper(v):
 def v_lower(v):
     return re.sub('3gpp', '', re.sub('\'', '_', re.sub('/', '_', re.sub('-', '_', re.sub(' ', '_', v)))).lower())
 
+def output_find_to_file(f, name, struct, children, compound):
+    # children : (type macro, instance, member, descriptor, index)
+    types = []
+    cases = {}
+    for (t, instance, member, desc, index) in children:
+        if t not in cases:
+            types.append(t)
+            cases[t] = []
+        if instance in [c[0] for c in cases[t]]:
+            continue
+        cases[t].append((instance, member, desc, index))
+
+    f.write("static ogs_tlv_desc_t *%s(\n" % name)
+    f.write("        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)\n")
+    f.write("{\n")
+    f.write("    switch (type) {\n")
+    for t in types:
+        f.write("    case %s:\n" % t)
+        if len(cases[t]) > 1:
+            f.write("        switch (instance) {\n")
+            indent = "            "
+        else:
+            indent = "        "
+        for (instance, member, desc, index) in cases[t]:
+            if len(cases[t]) > 1:
+                f.write("        case %s:\n" % instance)
+            else:
+                f.write("%sif (instance != %s)\n" % (indent, instance))
+                f.write("%s    break;\n" % indent)
+            f.write("%s*index = %d;\n" % (indent, index))
+            if compound:
+                f.write("%s*offset = offsetof(%s, %s) -\n" % (indent, struct, member))
+                f.write("%s    sizeof(ogs_tlv_presence_t);\n" % indent)
+            else:
+                f.write("%s*offset = offsetof(%s, %s);\n" % (indent, struct, member))
+            f.write("%sreturn &%s;\n" % (indent, desc))
+        if len(cases[t]) > 1:
+            f.write("        default:\n")
+            f.write("            break;\n")
+            f.write("        }\n")
+            f.write("        break;\n")
+    f.write("    default:\n")
+    f.write("        break;\n")
+    f.write("    }\n")
+    f.write("\n")
+    f.write("    return NULL;\n")
+    f.write("}\n\n")
+
+def group_member(ies):
+    if ies["ie_type"] == "F-TEID" and \
+            (ies["ie_value"] == "S2b-U ePDG F-TEID" or \
+             ies["ie_value"] == "S2a-U TWAN F-TEID"):
+        return v_lower(ies["ie_value"]) + "_" + ies["instance"]
+    return v_lower(ies["ie_value"])
+
+def find_children(k, ies_list, compound):
+    children = []
+    index = 0
+    for ies in ies_list:
+        if compound:
+            member = group_member(ies)
+        else:
+            member = v_lower(ies["ie_value"])
+        children.append(("OGS_GTP_%s_TYPE" % v_upper(ies["ie_type"]),
+            ies["instance"], member,
+            "ogs_gtp_tlv_desc_%s_%s" % (v_lower(ies["ie_type"]), v_lower(ies["instance"])),
+            index))
+        index += 1
+        if (k == 'Create Indirect Data Forwarding Tunnel Request' or k == 'Create Indirect Data Forwarding Tunnel Response') and ies["ie_value"] == 'Bearer Contexts':
+            index += 1
+    return children
+
 def get_cells(cells):
     instance = cells[4].text.encode('ascii', 'ignore')
     if instance.isdigit() is not True:
@@ -589,10 +661,14 @@ for (k, v) in sorted_type_list:
             f.write("    0,\n")
         f.write("    %d,\n" % instance)
         f.write("    sizeof(ogs_gtp_tlv_%s_t),\n" % v_lower(k))
-        f.write("    { NULL }\n")
+        f.write("    { NULL },\n")
+        f.write("    NULL\n")
         f.write("};\n\n")
 
 for (k, v) in sorted_group_list:
+    output_find_to_file(f, "find_tlv_%s" % v_lower(k),
+            "ogs_gtp_tlv_%s_t" % v_lower(k),
+            find_children(k, group_list[k]["ies"], True), True)
     for instance in range(0, int(type_list[k]["max_instance"])+1):
         f.write("ogs_tlv_desc_t ogs_gtp_tlv_desc_%s_%d =\n" % (v_lower(k), instance))
         f.write("{\n")
@@ -606,11 +682,15 @@ for (k, v) in sorted_group_list:
         for ies in group_list[k]["ies"]:
                 f.write("        &ogs_gtp_tlv_desc_%s_%s,\n" % (v_lower(ies["ie_type"]), v_lower(ies["instance"])))
         f.write("        NULL,\n")
-        f.write("    }\n")
+        f.write("    },\n")
+        f.write("    find_tlv_%s\n" % v_lower(k))
         f.write("};\n\n")
 
 for (k, v) in sorted_msg_list:
     if "ies" in msg_list[k]:
+        output_find_to_file(f, "find_msg_%s" % v_lower(k),
+                "ogs_gtp_%s_t" % v_lower(k),
+                find_children(k, msg_list[k]["ies"], False), False)
         f.write("ogs_tlv_desc_t ogs_gtp_tlv_desc_%s =\n" % v_lower(k))
         f.write("{\n")
         f.write("    OGS_TLV_MESSAGE,\n")
@@ -621,7 +701,7 @@ for (k, v) in sorted_msg_list:
             if (k == 'Create Indirect Data Forwarding Tunnel Request' or k == 'Create Indirect Data Forwarding Tunnel Response') and ies["ie_value"] == 'Bearer Contexts':
                 f.write("        &ogs_tlv_desc_more8,\n")
         f.write("    NULL,\n")
-        f.write("}};\n\n")
+        f.write("}, find_msg_%s };\n\n" % v_lower(k))
 f.write("\n")
 
 f.write("""int ogs_gtp_parse_msg(ogs_gtp_message_t *gtp_message, ogs_pkbuf_t *pkbuf)
@@ -30,7 +30,7 @@ typedef enum {
 static int ogs_gtp_xact_initialized = 0;
 static uint32_t g_xact_id = 0;
 
-static OGS_POOL(pool, ogs_gtp_xact_t);
+static OGS_CPOOL(pool, ogs_gtp_xact_t);
 
 static ogs_gtp_xact_stage_t ogs_gtp_xact_get_stage(uint8_t type, uint32_t sqn);
 static int ogs_gtp_xact_delete(ogs_gtp_xact_t *xact);
@@ -42,7 +42,8 @@ int ogs_gtp_xact_init(void)
 {
     ogs_assert(ogs_gtp_xact_initialized == 0);
 
-    ogs_pool_init(&pool, ogs_app()->pool.gtp_xact);
+    ogs_cpool_init(&pool, ogs_app()->pool.gtp_xact, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&pool, true);
 
     g_xact_id = 0;
 
@@ -55,7 +56,7 @@ void ogs_gtp_xact_final(void)
 {
     ogs_assert(ogs_gtp_xact_initialized == 1);
 
-    ogs_pool_final(&pool);
+    ogs_cpool_final(&pool);
 
     ogs_gtp_xact_initialized = 0;
 }
@@ -71,19 +72,25 @@ ogs_gtp_xact_t *ogs_gtp_xact_local_create(ogs_gtp_node_t *gnode,
     ogs_assert(gnode);
     ogs_assert(hdesc);
 
-    ogs_pool_alloc(&pool, &xact);
+    ogs_cpool_alloc(&pool, &xact);
     ogs_assert(xact);
     memset(xact, 0, sizeof *xact);
-    xact->index = ogs_pool_index(&pool, xact);
+    xact->index = ogs_cpool_index(&pool, xact);
 
     xact->org = OGS_GTP_LOCAL_ORIGINATOR;
-    xact->xid = OGS_NEXT_ID(g_xact_id,
-            OGS_GTP_MIN_XACT_ID, OGS_GTP_CMD_XACT_ID);
-    if (hdesc->type == OGS_GTP_MODIFY_BEARER_COMMAND_TYPE ||
-        hdesc->type == OGS_GTP_DELETE_BEARER_COMMAND_TYPE ||
-        hdesc->type == OGS_GTP_BEARER_RESOURCE_COMMAND_TYPE) {
-        xact->xid |= OGS_GTP_CMD_XACT_ID;
-    }
+    /*
+     * The hash holds one transaction per xid. After a wrap-around,
+     * skip the xids still in use so that no live one is shadowed.
+     */
+    do {
+        xact->xid = OGS_NEXT_ID(g_xact_id,
+                OGS_GTP_MIN_XACT_ID, OGS_GTP_CMD_XACT_ID);
+        if (hdesc->type == OGS_GTP_MODIFY_BEARER_COMMAND_TYPE ||
+            hdesc->type == OGS_GTP_DELETE_BEARER_COMMAND_TYPE ||
+            hdesc->type == OGS_GTP_BEARER_RESOURCE_COMMAND_TYPE) {
+            xact->xid |= OGS_GTP_CMD_XACT_ID;
+        }
+    } while (ogs_hash_get(gnode->local_hash, &xact->xid, sizeof(xact->xid)));
     xact->gnode = gnode;
     xact->cb = cb;
     xact->data = data;
@@ -100,6 +107,9 @@ ogs_gtp_xact_t *ogs_gtp_xact_local_create(ogs_gtp_node_t *gnode,
 
     ogs_list_add(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?  
             &xact->gnode->local_list : &xact->gnode->remote_list, xact);
+    ogs_hash_set(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
+            xact->gnode->local_hash : xact->gnode->remote_hash,
+            &xact->xid, sizeof(xact->xid), xact);
 
     rv = ogs_gtp_xact_update_tx(xact, hdesc, pkbuf);
     if (rv != OGS_OK) {
@@ -124,10 +134,10 @@ ogs_gtp_xact_t *ogs_gtp_xact_remote_create(ogs_gtp_node_t *gnode, uint32_t sqn)
 
     ogs_assert(gnode);
 
-    ogs_pool_alloc(&pool, &xact);
+    ogs_cpool_alloc(&pool, &xact);
     ogs_assert(xact);
     memset(xact, 0, sizeof *xact);
-    xact->index = ogs_pool_index(&pool, xact);
+    xact->index = ogs_cpool_index(&pool, xact);
 
     xact->org = OGS_GTP_REMOTE_ORIGINATOR;
     xact->xid = OGS_GTP_SQN_TO_XID(sqn);
@@ -145,6 +155,9 @@ ogs_gtp_xact_t *ogs_gtp_xact_remote_create(ogs_gtp_node_t *gnode, uint32_t sqn)
 
     ogs_list_add(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?  
             &xact->gnode->local_list : &xact->gnode->remote_list, xact);
+    ogs_hash_set(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
+            xact->gnode->local_hash : xact->gnode->remote_hash,
+            &xact->xid, sizeof(xact->xid), xact);
 
     ogs_debug("[%d] %s Create  peer [%s]:%d",
             xact->xid,
@@ -683,7 +696,7 @@ int ogs_gtp_xact_receive(
 ogs_gtp_xact_t *ogs_gtp_xact_find(ogs_index_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&pool, index);
+    return ogs_cpool_find(&pool, index);
 }
 
 static ogs_gtp_xact_stage_t ogs_gtp_xact_get_stage(uint8_t type, uint32_t xid)
@@ -740,31 +753,29 @@ static ogs_gtp_xact_stage_t ogs_gtp_xact_get_stage(uint8_t type, uint32_t xid)
 ogs_gtp_xact_t *ogs_gtp_xact_find_by_xid(
         ogs_gtp_node_t *gnode, uint8_t type, uint32_t xid)
 {
-    char buf[OGS_ADDRSTRLEN];
-
-    ogs_list_t *list = NULL;
+    ogs_hash_t *hash = NULL;
     ogs_gtp_xact_t *xact = NULL;
 
     ogs_assert(gnode);
 
     switch (ogs_gtp_xact_get_stage(type, xid)) {
     case GTP_XACT_INITIAL_STAGE:
-        list = &gnode->remote_list;
+        hash = gnode->remote_hash;
         break;
     case GTP_XACT_INTERMEDIATE_STAGE:
-        list = &gnode->local_list;
+        hash = gnode->local_hash;
         break;
     case GTP_XACT_FINAL_STAGE:
         if (xid & OGS_GTP_CMD_XACT_ID) {
             if (type == OGS_GTP_MODIFY_BEARER_FAILURE_INDICATION_TYPE ||
                 type == OGS_GTP_DELETE_BEARER_FAILURE_INDICATION_TYPE ||
                 type == OGS_GTP_BEARER_RESOURCE_FAILURE_INDICATION_TYPE) {
-                list = &gnode->local_list;
+                hash = gnode->local_hash;
             } else {
-                list = &gnode->remote_list;
+                hash = gnode->remote_hash;
             }
         } else {
-            list = &gnode->local_list;
+            hash = gnode->local_hash;
         }
         break;
     default:
@@ -772,17 +783,12 @@ ogs_gtp_xact_t *ogs_gtp_xact_find_by_xid(
         break;
     }
 
-    ogs_assert(list);
-    ogs_list_for_each(list, xact) {
-        if (xact->xid == xid) {
-            ogs_debug("[%d] %s Find    peer [%s]:%d",
-                    xact->xid,
-                    xact->org == OGS_GTP_LOCAL_ORIGINATOR ? "LOCAL " : "REMOTE",
-                    OGS_ADDR(&gnode->addr, buf),
-                    OGS_PORT(&gnode->addr));
-            break;
-        }
-    }
+    ogs_assert(hash);
+    xact = ogs_hash_get(hash, &xid, sizeof(xid));
+    if (xact)
+        ogs_debug("[%d] %s Find",
+                xact->xid,
+                xact->org == OGS_GTP_LOCAL_ORIGINATOR ? "LOCAL " : "REMOTE");
 
     return xact;
 }
@@ -814,6 +820,7 @@ void ogs_gtp_xact_deassociate(ogs_gtp_xact_t *xact1, ogs_gtp_xact_t *xact2)
 static int ogs_gtp_xact_delete(ogs_gtp_xact_t *xact)
 {
     char buf[OGS_ADDRSTRLEN];
+    ogs_hash_t *hash = NULL;
 
     ogs_assert(xact);
     ogs_assert(xact->gnode);
@@ -839,9 +846,15 @@ static int ogs_gtp_xact_delete(ogs_gtp_xact_t *xact)
     if (xact->assoc_xact)
         ogs_gtp_xact_deassociate(xact, xact->assoc_xact);
 
+    /* Leave the entry alone if another transaction holds the xid */
+    hash = xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
+            xact->gnode->local_hash : xact->gnode->remote_hash;
+    if (ogs_hash_get(hash, &xact->xid, sizeof(xact->xid)) == xact)
+        ogs_hash_set(hash, &xact->xid, sizeof(xact->xid), NULL);
+
     ogs_list_remove(xact->org == OGS_GTP_LOCAL_ORIGINATOR ?
             &xact->gnode->local_list : &xact->gnode->remote_list, xact);
-    ogs_pool_free(&pool, xact);
+    ogs_cpool_free(&pool, xact);
 
     return OGS_OK;
 }
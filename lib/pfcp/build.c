@@ -582,6 +582,9 @@ ogs_pkbuf_t *ogs_pfcp_build_session_report_request(
     ogs_pfcp_message_t pfcp_message;
     ogs_pfcp_session_report_request_t *req = NULL;
 
+    uint32_t ur_seqn, start_time, end_time, dur_measurement;
+    char vol_measurement_buf[OGS_PFCP_VOLUME_MEASUREMENT_LEN];
+
     ogs_assert(report);
 
     ogs_debug("PFCP session report request");
@@ -637,6 +640,51 @@ ogs_pkbuf_t *ogs_pfcp_build_session_report_request(
         }
     }
 
+    if (report->type.usage_report) {
+        ogs_pfcp_tlv_usage_report_session_report_request_t *message =
+            &req->usage_report;
+
+        message->presence = 1;
+        message->urr_id.presence = 1;
+        message->urr_id.u32 = report->usage_report.id;
+
+        ur_seqn = htobe32(report->usage_report.seqn);
+        message->ur_seqn.presence = 1;
+        message->ur_seqn.data = &ur_seqn;
+        message->ur_seqn.len = sizeof(ur_seqn);
+
+        message->usage_report_trigger.presence = 1;
+        message->usage_report_trigger.data =
+            &report->usage_report.rep_trigger;
+        message->usage_report_trigger.len =
+            OGS_PFCP_USAGE_REPORT_TRIGGER_LEN;
+
+        start_time = htobe32(report->usage_report.start_time);
+        message->start_time.presence = 1;
+        message->start_time.data = &start_time;
+        message->start_time.len = sizeof(start_time);
+
+        end_time = htobe32(report->usage_report.end_time);
+        message->end_time.presence = 1;
+        message->end_time.data = &end_time;
+        message->end_time.len = sizeof(end_time);
+
+        if (report->usage_report.vol_measurement.flags) {
+            message->volume_measurement.presence = 1;
+            ogs_pfcp_build_volume_measurement(
+                    &message->volume_measurement,
+                    &report->usage_report.vol_measurement,
+                    vol_measurement_buf, sizeof(vol_measurement_buf));
+        }
+
+        if (report->usage_report.dur_measurement_presence) {
+            dur_measurement = htobe32(report->usage_report.dur_measurement);
+            message->duration_measurement.presence = 1;
+            message->duration_measurement.data = &dur_measurement;
+            message->duration_measurement.len = sizeof(dur_measurement);
+        }
+    }
+
     pfcp_message.h.type = type;
     return ogs_pfcp_build_msg(&pfcp_message);
 }
@@ -25,16 +25,16 @@ static ogs_pfcp_context_t self;
 static OGS_POOL(ogs_pfcp_node_pool, ogs_pfcp_node_t);
 static OGS_POOL(ogs_pfcp_gtpu_resource_pool, ogs_pfcp_gtpu_resource_t);
 
-static OGS_POOL(ogs_pfcp_sess_pool, ogs_pfcp_sess_t);
-static OGS_POOL(ogs_pfcp_pdr_pool, ogs_pfcp_pdr_t);
-static OGS_POOL(ogs_pfcp_far_pool, ogs_pfcp_far_t);
-static OGS_POOL(ogs_pfcp_urr_pool, ogs_pfcp_urr_t);
-static OGS_POOL(ogs_pfcp_qer_pool, ogs_pfcp_qer_t);
-static OGS_POOL(ogs_pfcp_bar_pool, ogs_pfcp_bar_t);
+static OGS_CPOOL(ogs_pfcp_sess_pool, ogs_pfcp_sess_t);
+static OGS_CPOOL(ogs_pfcp_pdr_pool, ogs_pfcp_pdr_t);
+static OGS_CPOOL(ogs_pfcp_far_pool, ogs_pfcp_far_t);
+static OGS_CPOOL(ogs_pfcp_urr_pool, ogs_pfcp_urr_t);
+static OGS_CPOOL(ogs_pfcp_qer_pool, ogs_pfcp_qer_t);
+static OGS_CPOOL(ogs_pfcp_bar_pool, ogs_pfcp_bar_t);
 
 static OGS_POOL(ogs_pfcp_dev_pool, ogs_pfcp_dev_t);
 static OGS_POOL(ogs_pfcp_subnet_pool, ogs_pfcp_subnet_t);
-static OGS_POOL(ogs_pfcp_rule_pool, ogs_pfcp_rule_t);
+static OGS_CPOOL(ogs_pfcp_rule_pool, ogs_pfcp_rule_t);
 
 static int context_initialized = 0;
 
@@ -70,21 +70,36 @@ void ogs_pfcp_context_init(int num_of_gtpu_resource)
     ogs_list_init(&self.peer_list);
     ogs_list_init(&self.gtpu_resource_list);
 
-    ogs_pool_init(&ogs_pfcp_sess_pool, ogs_app()->pool.sess);
-
-    ogs_pool_init(&ogs_pfcp_pdr_pool,
-            ogs_app()->pool.sess * OGS_MAX_NUM_OF_PDR);
-    ogs_pool_init(&ogs_pfcp_far_pool,
-            ogs_app()->pool.sess * OGS_MAX_NUM_OF_FAR);
-    ogs_pool_init(&ogs_pfcp_urr_pool,
-            ogs_app()->pool.sess * OGS_MAX_NUM_OF_URR);
-    ogs_pool_init(&ogs_pfcp_qer_pool,
-            ogs_app()->pool.sess * OGS_MAX_NUM_OF_QER);
-    ogs_pool_init(&ogs_pfcp_bar_pool,
-            ogs_app()->pool.sess * OGS_MAX_NUM_OF_BAR);
-
-    ogs_pool_init(&ogs_pfcp_rule_pool,
-            ogs_app()->pool.sess * OGS_MAX_NUM_OF_RULE);
+    ogs_cpool_init(&ogs_pfcp_sess_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ogs_pfcp_sess_pool, true);
+
+    /* Rules are sized for the worst case per session; grow on demand */
+    ogs_cpool_init(&ogs_pfcp_pdr_pool,
+            ogs_app()->pool.sess * OGS_MAX_NUM_OF_PDR,
+            OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ogs_pfcp_pdr_pool, true);
+    ogs_cpool_init(&ogs_pfcp_far_pool,
+            ogs_app()->pool.sess * OGS_MAX_NUM_OF_FAR,
+            OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ogs_pfcp_far_pool, true);
+    ogs_cpool_init(&ogs_pfcp_urr_pool,
+            ogs_app()->pool.sess * OGS_MAX_NUM_OF_URR,
+            OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ogs_pfcp_urr_pool, true);
+    ogs_cpool_init(&ogs_pfcp_qer_pool,
+            ogs_app()->pool.sess * OGS_MAX_NUM_OF_QER,
+            OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ogs_pfcp_qer_pool, true);
+    ogs_cpool_init(&ogs_pfcp_bar_pool,
+            ogs_app()->pool.sess * OGS_MAX_NUM_OF_BAR,
+            OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ogs_pfcp_bar_pool, true);
+
+    ogs_cpool_init(&ogs_pfcp_rule_pool,
+            ogs_app()->pool.sess * OGS_MAX_NUM_OF_RULE,
+            OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ogs_pfcp_rule_pool, true);
 
     ogs_list_init(&self.dev_list);
     ogs_pool_init(&ogs_pfcp_dev_pool, OGS_MAX_NUM_OF_DEV);
@@ -108,14 +123,14 @@ void ogs_pfcp_context_final(void)
 
     ogs_pool_final(&ogs_pfcp_dev_pool);
     ogs_pool_final(&ogs_pfcp_subnet_pool);
-    ogs_pool_final(&ogs_pfcp_rule_pool);
+    ogs_cpool_final(&ogs_pfcp_rule_pool);
 
-    ogs_pool_final(&ogs_pfcp_sess_pool);
-    ogs_pool_final(&ogs_pfcp_pdr_pool);
-    ogs_pool_final(&ogs_pfcp_far_pool);
-    ogs_pool_final(&ogs_pfcp_urr_pool);
-    ogs_pool_final(&ogs_pfcp_qer_pool);
-    ogs_pool_final(&ogs_pfcp_bar_pool);
+    ogs_cpool_final(&ogs_pfcp_sess_pool);
+    ogs_cpool_final(&ogs_pfcp_pdr_pool);
+    ogs_cpool_final(&ogs_pfcp_far_pool);
+    ogs_cpool_final(&ogs_pfcp_urr_pool);
+    ogs_cpool_final(&ogs_pfcp_qer_pool);
+    ogs_cpool_final(&ogs_pfcp_bar_pool);
 
     ogs_pfcp_node_remove_all(&self.peer_list);
     ogs_pfcp_gtpu_resource_remove_all(&self.gtpu_resource_list);
@@ -645,6 +660,10 @@ ogs_pfcp_node_t *ogs_pfcp_node_new(ogs_sockaddr_t *sa_list)
 
     ogs_list_init(&node->local_list);
     ogs_list_init(&node->remote_list);
+    node->local_hash = ogs_hash_make();
+    ogs_assert(node->local_hash);
+    node->remote_hash = ogs_hash_make();
+    ogs_assert(node->remote_hash);
 
     ogs_list_init(&node->gtpu_resource_list);
 
@@ -661,6 +680,8 @@ void ogs_pfcp_node_free(ogs_pfcp_node_t *node)
         ogs_sock_destroy(node->sock);
 
     ogs_pfcp_xact_delete_all(node);
+    ogs_hash_destroy(node->local_hash);
+    ogs_hash_destroy(node->remote_hash);
 
     ogs_freeaddrinfo(node->sa_list);
     ogs_pool_free(&ogs_pfcp_node_pool, node);
@@ -828,7 +849,7 @@ ogs_pfcp_pdr_t *ogs_pfcp_pdr_add(ogs_pfcp_sess_t *sess)
 
     ogs_assert(sess);
 
-    ogs_pool_alloc(&ogs_pfcp_pdr_pool, &pdr);
+    ogs_cpool_alloc(&ogs_pfcp_pdr_pool, &pdr);
     ogs_assert(pdr);
     memset(pdr, 0, sizeof *pdr);
 
@@ -955,7 +976,7 @@ void ogs_pfcp_pdr_remove(ogs_pfcp_pdr_t *pdr)
     if (pdr->id_node)
         ogs_pool_free(&pdr->sess->pdr_id_pool, pdr->id_node);
 
-    ogs_pool_free(&ogs_pfcp_pdr_pool, pdr);
+    ogs_cpool_free(&ogs_pfcp_pdr_pool, pdr);
 }
 
 void ogs_pfcp_pdr_remove_all(ogs_pfcp_sess_t *sess)
@@ -973,7 +994,7 @@ ogs_pfcp_far_t *ogs_pfcp_far_add(ogs_pfcp_sess_t *sess)
 
     ogs_assert(sess);
 
-    ogs_pool_alloc(&ogs_pfcp_far_pool, &far);
+    ogs_cpool_alloc(&ogs_pfcp_far_pool, &far);
     ogs_assert(far);
     memset(far, 0, sizeof *far);
 
@@ -1038,7 +1059,7 @@ void ogs_pfcp_far_remove(ogs_pfcp_far_t *far)
     if (far->id_node)
         ogs_pool_free(&far->sess->far_id_pool, far->id_node);
 
-    ogs_pool_free(&ogs_pfcp_far_pool, far);
+    ogs_cpool_free(&ogs_pfcp_far_pool, far);
 }
 
 void ogs_pfcp_far_remove_all(ogs_pfcp_sess_t *sess)
@@ -1057,7 +1078,7 @@ ogs_pfcp_urr_t *ogs_pfcp_urr_add(ogs_pfcp_sess_t *sess)
 
     ogs_assert(sess);
 
-    ogs_pool_alloc(&ogs_pfcp_urr_pool, &urr);
+    ogs_cpool_alloc(&ogs_pfcp_urr_pool, &urr);
     ogs_assert(urr);
     memset(urr, 0, sizeof *urr);
 
@@ -1067,6 +1088,9 @@ ogs_pfcp_urr_t *ogs_pfcp_urr_add(ogs_pfcp_sess_t *sess)
     urr->index = *(urr->id_node);
     ogs_assert(urr->index > 0 && urr->index <= OGS_MAX_NUM_OF_URR);
 
+    urr->start_time = ogs_time_now();
+    urr->last_report = ogs_get_monotonic_time();
+
     urr->sess = sess;
     ogs_list_add(&sess->urr_list, urr);
 
@@ -1106,17 +1130,130 @@ ogs_pfcp_urr_t *ogs_pfcp_urr_find_or_add(
 void ogs_pfcp_urr_remove(ogs_pfcp_urr_t *urr)
 {
     ogs_pfcp_sess_t *sess = NULL;
+    ogs_pfcp_pdr_t *pdr = NULL;
 
     ogs_assert(urr);
     sess = urr->sess;
     ogs_assert(sess);
 
+    /* PDRs left pointing at this URR would count into freed memory */
+    ogs_list_for_each(&sess->pdr_list, pdr) {
+        if (pdr->urr == urr)
+            pdr->urr = NULL;
+    }
+
     ogs_list_remove(&sess->urr_list, urr);
 
     if (urr->id_node)
         ogs_pool_free(&urr->sess->urr_id_pool, urr->id_node);
 
-    ogs_pool_free(&ogs_pfcp_urr_pool, urr);
+    ogs_cpool_free(&ogs_pfcp_urr_pool, urr);
+}
+
+void ogs_pfcp_urr_collect(ogs_pfcp_urr_t *urr)
+{
+    uint64_t ul_octets, dl_octets, ul_packets, dl_packets;
+    ogs_pfcp_volume_measurement_t *vol = NULL;
+
+    ogs_assert(urr);
+
+    ul_octets = ogs_atomic_exchange(&urr->counter.ul_octets, 0);
+    dl_octets = ogs_atomic_exchange(&urr->counter.dl_octets, 0);
+    ul_packets = ogs_atomic_exchange(&urr->counter.ul_packets, 0);
+    dl_packets = ogs_atomic_exchange(&urr->counter.dl_packets, 0);
+
+    vol = &urr->vol_measurement;
+    vol->uplink_volume += ul_octets;
+    vol->downlink_volume += dl_octets;
+    vol->total_volume += ul_octets + dl_octets;
+    vol->uplink_n_packets += ul_packets;
+    vol->downlink_n_packets += dl_packets;
+    vol->total_n_packets += ul_packets + dl_packets;
+}
+
+bool ogs_pfcp_urr_check_report(ogs_pfcp_urr_t *urr,
+        ogs_pfcp_usage_report_trigger_t *rep_trigger)
+{
+    ogs_time_t elapsed;
+    ogs_pfcp_volume_measurement_t *vol = NULL;
+    ogs_pfcp_volume_threshold_t *threshold = NULL;
+
+    ogs_assert(urr);
+    ogs_assert(rep_trigger);
+
+    memset(rep_trigger, 0, sizeof(*rep_trigger));
+
+    vol = &urr->vol_measurement;
+    threshold = &urr->vol_threshold;
+    elapsed = ogs_get_monotonic_time() - urr->last_report;
+
+    if (urr->rep_triggers.volume_threshold) {
+        if ((threshold->tovol &&
+                vol->total_volume >= threshold->total_volume) ||
+            (threshold->ulvol &&
+                vol->uplink_volume >= threshold->uplink_volume) ||
+            (threshold->dlvol &&
+                vol->downlink_volume >= threshold->downlink_volume))
+            rep_trigger->volume_threshold = 1;
+    }
+
+    if (urr->rep_triggers.time_threshold && urr->time_threshold) {
+        if (elapsed >= ogs_time_from_sec(urr->time_threshold))
+            rep_trigger->time_threshold = 1;
+    }
+
+    if (urr->rep_triggers.periodic_reporting && urr->meas_period) {
+        if (elapsed >= ogs_time_from_sec(urr->meas_period))
+            rep_trigger->periodic_reporting = 1;
+    }
+
+    return rep_trigger->reptri_5 != 0;
+}
+
+void ogs_pfcp_urr_build_report(ogs_pfcp_urr_t *urr,
+        ogs_pfcp_usage_report_trigger_t *rep_trigger,
+        ogs_pfcp_user_plane_report_t *report)
+{
+    ogs_time_t now;
+
+    ogs_assert(urr);
+    ogs_assert(rep_trigger);
+    ogs_assert(report);
+
+    now = ogs_get_monotonic_time();
+
+    report->type.usage_report = 1;
+    report->usage_report.id = urr->id;
+    report->usage_report.seqn = urr->seqn++;
+    memcpy(&report->usage_report.rep_trigger,
+            rep_trigger, sizeof(*rep_trigger));
+
+    /* NTP time : seconds since 1900 */
+    report->usage_report.start_time =
+        ogs_time_sec(urr->start_time) + 2208988800;
+    report->usage_report.end_time = ogs_time_sec(ogs_time_now()) + 2208988800;
+
+    if (urr->meas_method.volume) {
+        memcpy(&report->usage_report.vol_measurement,
+                &urr->vol_measurement, sizeof(urr->vol_measurement));
+        report->usage_report.vol_measurement.tovol = 1;
+        report->usage_report.vol_measurement.ulvol = 1;
+        report->usage_report.vol_measurement.dlvol = 1;
+        report->usage_report.vol_measurement.tonop = 1;
+        report->usage_report.vol_measurement.ulnop = 1;
+        report->usage_report.vol_measurement.dlnop = 1;
+    }
+
+    if (urr->meas_method.duration) {
+        report->usage_report.dur_measurement_presence = true;
+        report->usage_report.dur_measurement =
+            ogs_time_sec(now - urr->last_report);
+    }
+
+    /* Start the next measurement */
+    memset(&urr->vol_measurement, 0, sizeof(urr->vol_measurement));
+    urr->start_time = ogs_time_now();
+    urr->last_report = now;
 }
 
 void ogs_pfcp_urr_remove_all(ogs_pfcp_sess_t *sess)
@@ -1135,7 +1272,7 @@ ogs_pfcp_qer_t *ogs_pfcp_qer_add(ogs_pfcp_sess_t *sess)
 
     ogs_assert(sess);
 
-    ogs_pool_alloc(&ogs_pfcp_qer_pool, &qer);
+    ogs_cpool_alloc(&ogs_pfcp_qer_pool, &qer);
     ogs_assert(qer);
     memset(qer, 0, sizeof *qer);
 
@@ -1145,6 +1282,8 @@ ogs_pfcp_qer_t *ogs_pfcp_qer_add(ogs_pfcp_sess_t *sess)
     qer->index = *(qer->id_node);
     ogs_assert(qer->index > 0 && qer->index <= OGS_MAX_NUM_OF_QER);
 
+    ogs_thread_mutex_init(&qer->policer.mutex);
+
     qer->sess = sess;
     ogs_list_add(&sess->qer_list, qer);
 
@@ -1184,17 +1323,51 @@ ogs_pfcp_qer_t *ogs_pfcp_qer_find_or_add(
 void ogs_pfcp_qer_remove(ogs_pfcp_qer_t *qer)
 {
     ogs_pfcp_sess_t *sess = NULL;
+    ogs_pfcp_pdr_t *pdr = NULL;
 
     ogs_assert(qer);
     sess = qer->sess;
     ogs_assert(sess);
 
+    /* PDRs left pointing at this QER would police with freed memory */
+    ogs_list_for_each(&sess->pdr_list, pdr) {
+        if (pdr->qer == qer)
+            pdr->qer = NULL;
+    }
+
     ogs_list_remove(&sess->qer_list, qer);
 
+    ogs_thread_mutex_destroy(&qer->policer.mutex);
+
     if (qer->id_node)
         ogs_pool_free(&qer->sess->qer_id_pool, qer->id_node);
 
-    ogs_pool_free(&ogs_pfcp_qer_pool, qer);
+    ogs_cpool_free(&ogs_pfcp_qer_pool, qer);
+}
+
+static void policer_set(ogs_pfcp_policer_t *policer, uint64_t bitrate)
+{
+    ogs_assert(policer);
+
+    policer->rate = bitrate / 8;
+    policer->bucket_size = policer->rate /
+        (OGS_USEC_PER_SEC / OGS_PFCP_POLICER_BURST_TIME);
+    if (policer->rate && policer->bucket_size < OGS_MAX_PKT_LEN)
+        policer->bucket_size = OGS_MAX_PKT_LEN;
+
+    /* Start with a full bucket */
+    policer->tokens = policer->bucket_size;
+    policer->last = ogs_get_monotonic_coarse_time();
+}
+
+void ogs_pfcp_qer_set_policer(ogs_pfcp_qer_t *qer)
+{
+    ogs_assert(qer);
+
+    ogs_thread_mutex_lock(&qer->policer.mutex);
+    policer_set(&qer->policer.uplink, qer->mbr.uplink);
+    policer_set(&qer->policer.downlink, qer->mbr.downlink);
+    ogs_thread_mutex_unlock(&qer->policer.mutex);
 }
 
 void ogs_pfcp_qer_remove_all(ogs_pfcp_sess_t *sess)
@@ -1214,7 +1387,7 @@ ogs_pfcp_bar_t *ogs_pfcp_bar_new(ogs_pfcp_sess_t *sess)
     ogs_assert(sess);
     ogs_assert(sess->bar == NULL); /* Only One BAR is supported */
 
-    ogs_pool_alloc(&ogs_pfcp_bar_pool, &bar);
+    ogs_cpool_alloc(&ogs_pfcp_bar_pool, &bar);
     ogs_assert(bar);
     memset(bar, 0, sizeof *bar);
 
@@ -1241,7 +1414,7 @@ void ogs_pfcp_bar_delete(ogs_pfcp_bar_t *bar)
     if (bar->id_node)
         ogs_pool_free(&bar->sess->bar_id_pool, bar->id_node);
 
-    ogs_pool_free(&ogs_pfcp_bar_pool, bar);
+    ogs_cpool_free(&ogs_pfcp_bar_pool, bar);
 }
 
 ogs_pfcp_rule_t *ogs_pfcp_rule_add(ogs_pfcp_pdr_t *pdr)
@@ -1250,7 +1423,7 @@ ogs_pfcp_rule_t *ogs_pfcp_rule_add(ogs_pfcp_pdr_t *pdr)
 
     ogs_assert(pdr);
 
-    ogs_pool_alloc(&ogs_pfcp_rule_pool, &rule);
+    ogs_cpool_alloc(&ogs_pfcp_rule_pool, &rule);
     ogs_assert(rule);
     memset(rule, 0, sizeof *rule);
 
@@ -1269,7 +1442,7 @@ void ogs_pfcp_rule_remove(ogs_pfcp_rule_t *rule)
     ogs_assert(pdr);
 
     ogs_list_remove(&pdr->rule_list, rule);
-    ogs_pool_free(&ogs_pfcp_rule_pool, rule);
+    ogs_cpool_free(&ogs_pfcp_rule_pool, rule);
 }
 
 void ogs_pfcp_rule_remove_all(ogs_pfcp_pdr_t *pdr)
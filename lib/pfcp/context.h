@@ -80,10 +80,13 @@ typedef struct ogs_pfcp_node_s {
 
     ogs_list_t      local_list;    
     ogs_list_t      remote_list;   
+    ogs_hash_t      *local_hash;    /* Local transactions by xid */
+    ogs_hash_t      *remote_hash;   /* Remote transactions by xid */
 
     ogs_fsm_t       sm;             /* A state machine */
     ogs_timer_t     *t_association; /* timer to retry to associate peer node */
     ogs_timer_t     *t_no_heartbeat; /* heartbeat timer to check aliveness */
+    ogs_timer_t     *t_usage_report; /* timer to check the URRs */
 
     uint16_t        tac[OGS_MAX_NUM_OF_TAI];
     uint8_t         num_of_tac;
@@ -180,9 +183,49 @@ typedef struct ogs_pfcp_urr_s {
     uint8_t                 *id_node;      /* Pool-Node for ID */
     ogs_pfcp_urr_id_t       id;
 
+    ogs_pfcp_measurement_method_t meas_method;
+    ogs_pfcp_reporting_triggers_t rep_triggers;
+    uint32_t                meas_period;    /* Seconds */
+    ogs_pfcp_volume_threshold_t vol_threshold;
+    uint32_t                time_threshold; /* Seconds */
+
+    /*
+     * Updated by the data path with ogs_atomic_add(),
+     * and collected by the control thread with ogs_atomic_exchange()
+     */
+    struct {
+        uint64_t            ul_octets;
+        uint64_t            dl_octets;
+        uint64_t            ul_packets;
+        uint64_t            dl_packets;
+    } counter;
+
+    ogs_pfcp_volume_measurement_t vol_measurement; /* Since last report */
+    ogs_time_t              start_time;     /* Measurement started */
+    ogs_time_t              last_report;    /* Monotonic */
+    uint32_t                seqn;
+
     ogs_pfcp_sess_t         *sess;
 } ogs_pfcp_urr_t;
 
+/*
+ * Token-bucket policer
+ *
+ * The bucket is filled at the MBR and can hold
+ * OGS_PFCP_POLICER_BURST_TIME worth of traffic.
+ */
+#define OGS_PFCP_POLICER_BURST_TIME ogs_time_from_msec(100)
+
+typedef struct ogs_pfcp_policer_s {
+    uint64_t                rate;           /* Bytes per second, 0: No limit */
+    uint64_t                bucket_size;    /* Bytes */
+    uint64_t                tokens;         /* Bytes */
+    ogs_time_t              last;
+
+    uint64_t                dropped_packets;
+    uint64_t                dropped_bytes;
+} ogs_pfcp_policer_t;
+
 typedef struct ogs_pfcp_qer_s {
     ogs_lnode_t             lnode;
     uint32_t                index;
@@ -196,6 +239,12 @@ typedef struct ogs_pfcp_qer_s {
 
     uint8_t                 qfi;
 
+    struct {
+        ogs_thread_mutex_t  mutex;
+        ogs_pfcp_policer_t  uplink;
+        ogs_pfcp_policer_t  downlink;
+    } policer;
+
     ogs_pfcp_sess_t         *sess;
 } ogs_pfcp_qer_t;
 
@@ -333,6 +382,12 @@ ogs_pfcp_urr_t *ogs_pfcp_urr_find(
 ogs_pfcp_urr_t *ogs_pfcp_urr_find_or_add(
         ogs_pfcp_sess_t *sess, ogs_pfcp_urr_id_t id);
 void ogs_pfcp_urr_remove(ogs_pfcp_urr_t *urr);
+void ogs_pfcp_urr_collect(ogs_pfcp_urr_t *urr);
+bool ogs_pfcp_urr_check_report(ogs_pfcp_urr_t *urr,
+        ogs_pfcp_usage_report_trigger_t *rep_trigger);
+void ogs_pfcp_urr_build_report(ogs_pfcp_urr_t *urr,
+        ogs_pfcp_usage_report_trigger_t *rep_trigger,
+        ogs_pfcp_user_plane_report_t *report);
 void ogs_pfcp_urr_remove_all(ogs_pfcp_sess_t *sess);
 
 ogs_pfcp_qer_t *ogs_pfcp_qer_add(ogs_pfcp_sess_t *sess);
@@ -341,6 +396,7 @@ ogs_pfcp_qer_t *ogs_pfcp_qer_find(
 ogs_pfcp_qer_t *ogs_pfcp_qer_find_or_add(
         ogs_pfcp_sess_t *sess, ogs_pfcp_qer_id_t id);
 void ogs_pfcp_qer_remove(ogs_pfcp_qer_t *qer);
+void ogs_pfcp_qer_set_policer(ogs_pfcp_qer_t *qer);
 void ogs_pfcp_qer_remove_all(ogs_pfcp_sess_t *sess);
 
 ogs_pfcp_bar_t *ogs_pfcp_bar_new(ogs_pfcp_sess_t *sess);
@@ -110,13 +110,98 @@ void ogs_pfcp_up_handle_association_setup_response(
     ogs_pfcp_xact_commit(xact);
 }
 
+bool ogs_pfcp_up_police_pdr(ogs_pfcp_pdr_t *pdr, int len)
+{
+    ogs_pfcp_qer_t *qer = NULL;
+    ogs_pfcp_policer_t *policer = NULL;
+    ogs_time_t now, elapsed;
+    uint8_t gate;
+    bool conform;
+
+    ogs_assert(pdr);
+
+    qer = pdr->qer;
+    if (!qer)
+        return true;
+
+    if (pdr->src_if == OGS_PFCP_INTERFACE_ACCESS) {
+        gate = qer->gate_status.uplink;
+        policer = &qer->policer.uplink;
+    } else {
+        gate = qer->gate_status.downlink;
+        policer = &qer->policer.downlink;
+    }
+
+    if (gate != OGS_PFCP_GATE_OPEN) {
+        ogs_thread_mutex_lock(&qer->policer.mutex);
+        policer->dropped_packets++;
+        policer->dropped_bytes += len;
+        ogs_thread_mutex_unlock(&qer->policer.mutex);
+        return false;
+    }
+
+    if (policer->rate == 0)
+        return true;
+
+    now = ogs_get_monotonic_coarse_time();
+
+    ogs_thread_mutex_lock(&qer->policer.mutex);
+
+    /* Refill the bucket */
+    elapsed = now - policer->last;
+    if (elapsed >= OGS_PFCP_POLICER_BURST_TIME) {
+        policer->tokens = policer->bucket_size;
+        policer->last = now;
+    } else if (elapsed > 0) {
+        policer->tokens +=
+            (policer->rate / OGS_USEC_PER_SEC) * elapsed +
+            (policer->rate % OGS_USEC_PER_SEC) * elapsed / OGS_USEC_PER_SEC;
+        if (policer->tokens > policer->bucket_size)
+            policer->tokens = policer->bucket_size;
+        policer->last = now;
+    }
+
+    if (policer->tokens >= (uint64_t)len) {
+        policer->tokens -= len;
+        conform = true;
+    } else {
+        policer->dropped_packets++;
+        policer->dropped_bytes += len;
+        conform = false;
+    }
+
+    ogs_thread_mutex_unlock(&qer->policer.mutex);
+
+    return conform;
+}
+
+void ogs_pfcp_up_measure_pdr(ogs_pfcp_pdr_t *pdr, int len)
+{
+    ogs_pfcp_urr_t *urr = NULL;
+
+    ogs_assert(pdr);
+
+    urr = pdr->urr;
+    if (!urr)
+        return;
+
+    /* Lock-free : the data-plane workers may share the URR */
+    if (pdr->src_if == OGS_PFCP_INTERFACE_ACCESS) {
+        ogs_atomic_add(&urr->counter.ul_octets, len);
+        ogs_atomic_add(&urr->counter.ul_packets, 1);
+    } else {
+        ogs_atomic_add(&urr->counter.dl_octets, len);
+        ogs_atomic_add(&urr->counter.dl_packets, 1);
+    }
+}
+
 void ogs_pfcp_up_handle_pdr(
         ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *recvbuf,
         ogs_pfcp_user_plane_report_t *report)
 {
     ogs_pfcp_far_t *far = NULL;
-    ogs_pkbuf_t *sendbuf = NULL;
     bool buffering;
+    int len;
 
     ogs_assert(recvbuf);
     ogs_assert(pdr);
@@ -127,14 +212,19 @@ void ogs_pfcp_up_handle_pdr(
 
     memset(report, 0, sizeof(*report));
 
-    sendbuf = ogs_pkbuf_copy(recvbuf);
-    if (!sendbuf) {
-        ogs_fatal("Not enough packet buffer");
-        ogs_assert_if_reached();
+    /* Usage is counted only for packets that the FAR lets through */
+    len = recvbuf->len;
 
+    if (ogs_pfcp_up_police_pdr(pdr, len) == false) {
+        ogs_pkbuf_free(recvbuf);
         return;
     }
 
+    /*
+     * The ownership of recvbuf is transferred to this function.
+     * It is forwarded, buffered in the FAR or freed here,
+     * so the caller MUST NOT touch it after the call.
+     */
     buffering = false;
 
     if (!far->gnode) {
@@ -144,7 +234,8 @@ void ogs_pfcp_up_handle_pdr(
         if (far->apply_action & OGS_PFCP_APPLY_ACTION_FORW) {
 
             /* Forward packet */
-            ogs_pfcp_send_g_pdu(pdr, sendbuf);
+            ogs_pfcp_up_measure_pdr(pdr, len);
+            ogs_pfcp_send_g_pdu(pdr, recvbuf);
 
         } else if (far->apply_action & OGS_PFCP_APPLY_ACTION_BUFF) {
 
@@ -152,7 +243,7 @@ void ogs_pfcp_up_handle_pdr(
 
         } else {
             ogs_error("Not implemented");
-            ogs_pkbuf_free(sendbuf);
+            ogs_pkbuf_free(recvbuf);
         }
     }
 
@@ -165,9 +256,10 @@ void ogs_pfcp_up_handle_pdr(
         }
 
         if (far->num_of_buffered_packet < OGS_MAX_NUM_OF_PACKET_BUFFER) {
-            far->buffered_packet[far->num_of_buffered_packet++] = sendbuf;
+            /* Counted by ogs_pfcp_send_buffered_packet() once sent */
+            far->buffered_packet[far->num_of_buffered_packet++] = recvbuf;
         } else {
-            ogs_pkbuf_free(sendbuf);
+            ogs_pkbuf_free(recvbuf);
         }
     }
 }
@@ -178,6 +270,7 @@ ogs_pfcp_pdr_t *ogs_pfcp_handle_create_pdr(ogs_pfcp_sess_t *sess,
 {
     ogs_pfcp_pdr_t *pdr = NULL;
     ogs_pfcp_far_t *far = NULL;
+    ogs_pfcp_urr_t *urr = NULL;
     ogs_pfcp_qer_t *qer = NULL;
     int i, len;
     int rv;
@@ -336,6 +429,12 @@ ogs_pfcp_pdr_t *ogs_pfcp_handle_create_pdr(ogs_pfcp_sess_t *sess,
         ogs_pfcp_pdr_associate_qer(pdr, qer);
     }
 
+    if (message->urr_id.presence) {
+        urr = ogs_pfcp_urr_find_or_add(sess, message->urr_id.u32);
+        ogs_assert(urr);
+        ogs_pfcp_pdr_associate_urr(pdr, urr);
+    }
+
     return pdr;
 }
 
@@ -683,6 +782,184 @@ bool ogs_pfcp_handle_remove_far(ogs_pfcp_sess_t *sess,
     return true;
 }
 
+static bool octet_to_uint32(ogs_tlv_octet_t *octet, uint32_t *value)
+{
+    ogs_assert(octet);
+    ogs_assert(value);
+
+    if (octet->len != sizeof(*value)) {
+        ogs_error("Invalid length [%d]", octet->len);
+        return false;
+    }
+
+    memcpy(value, octet->data, sizeof(*value));
+    *value = be32toh(*value);
+
+    return true;
+}
+
+static bool urr_update(ogs_pfcp_urr_t *urr,
+        ogs_pfcp_tlv_measurement_method_t *measurement_method,
+        ogs_pfcp_tlv_reporting_triggers_t *reporting_triggers,
+        ogs_pfcp_tlv_measurement_period_t *measurement_period,
+        ogs_pfcp_tlv_volume_threshold_t *volume_threshold,
+        ogs_pfcp_tlv_time_threshold_t *time_threshold,
+        uint8_t *cause_value, uint8_t *offending_ie_value)
+{
+    uint32_t meas_period = 0, time_threshold_value = 0;
+    ogs_pfcp_volume_threshold_t vol_threshold;
+
+    ogs_assert(urr);
+
+    /* Validate every IE before touching the URR */
+    if (measurement_period->presence &&
+        octet_to_uint32(measurement_period, &meas_period) == false) {
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_INCORRECT;
+        *offending_ie_value = OGS_PFCP_MEASUREMENT_PERIOD_TYPE;
+        return false;
+    }
+    if (volume_threshold->presence &&
+        ogs_pfcp_parse_volume(&vol_threshold, volume_threshold) < 0) {
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_INCORRECT;
+        *offending_ie_value = OGS_PFCP_VOLUME_THRESHOLD_TYPE;
+        return false;
+    }
+    if (time_threshold->presence &&
+        octet_to_uint32(time_threshold, &time_threshold_value) == false) {
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_INCORRECT;
+        *offending_ie_value = OGS_PFCP_TIME_THRESHOLD_TYPE;
+        return false;
+    }
+
+    if (measurement_method->presence)
+        urr->meas_method.value = measurement_method->u8;
+    if (reporting_triggers->presence)
+        urr->rep_triggers.value = reporting_triggers->u8;
+    if (measurement_period->presence)
+        urr->meas_period = meas_period;
+    if (volume_threshold->presence)
+        memcpy(&urr->vol_threshold, &vol_threshold, sizeof(vol_threshold));
+    if (time_threshold->presence)
+        urr->time_threshold = time_threshold_value;
+
+    return true;
+}
+
+ogs_pfcp_urr_t *ogs_pfcp_handle_create_urr(ogs_pfcp_sess_t *sess,
+        ogs_pfcp_tlv_create_urr_t *message,
+        uint8_t *cause_value, uint8_t *offending_ie_value)
+{
+    ogs_pfcp_urr_t *urr = NULL;
+
+    ogs_assert(message);
+    ogs_assert(sess);
+
+    if (message->presence == 0)
+        return NULL;
+
+    if (message->urr_id.presence == 0) {
+        ogs_error("No URR-ID");
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_MISSING;
+        *offending_ie_value = OGS_PFCP_URR_ID_TYPE;
+        return NULL;
+    }
+
+    /* The URR may not be referenced by any PDR */
+    urr = ogs_pfcp_urr_find_or_add(sess, message->urr_id.u32);
+    ogs_assert(urr);
+
+    if (message->measurement_method.presence == 0) {
+        ogs_error("No Measurement Method");
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_MISSING;
+        *offending_ie_value = OGS_PFCP_MEASUREMENT_METHOD_TYPE;
+        return NULL;
+    }
+
+    if (message->reporting_triggers.presence == 0) {
+        ogs_error("No Reporting Triggers");
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_MISSING;
+        *offending_ie_value = OGS_PFCP_REPORTING_TRIGGERS_TYPE;
+        return NULL;
+    }
+
+    if (urr_update(urr,
+            &message->measurement_method, &message->reporting_triggers,
+            &message->measurement_period, &message->volume_threshold,
+            &message->time_threshold,
+            cause_value, offending_ie_value) == false)
+        return NULL;
+
+    return urr;
+}
+
+ogs_pfcp_urr_t *ogs_pfcp_handle_update_urr(ogs_pfcp_sess_t *sess,
+        ogs_pfcp_tlv_update_urr_t *message,
+        uint8_t *cause_value, uint8_t *offending_ie_value)
+{
+    ogs_pfcp_urr_t *urr = NULL;
+
+    ogs_assert(message);
+    ogs_assert(sess);
+
+    if (message->presence == 0)
+        return NULL;
+
+    if (message->urr_id.presence == 0) {
+        ogs_error("No URR-ID");
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_MISSING;
+        *offending_ie_value = OGS_PFCP_URR_ID_TYPE;
+        return NULL;
+    }
+
+    urr = ogs_pfcp_urr_find(sess, message->urr_id.u32);
+    if (!urr) {
+        ogs_error("Cannot find URR-ID[%d] in PDR", message->urr_id.u32);
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_INCORRECT;
+        *offending_ie_value = OGS_PFCP_URR_ID_TYPE;
+        return NULL;
+    }
+
+    if (urr_update(urr,
+            &message->measurement_method, &message->reporting_triggers,
+            &message->measurement_period, &message->volume_threshold,
+            &message->time_threshold,
+            cause_value, offending_ie_value) == false)
+        return NULL;
+
+    return urr;
+}
+
+bool ogs_pfcp_handle_remove_urr(ogs_pfcp_sess_t *sess,
+        ogs_pfcp_tlv_remove_urr_t *message,
+        uint8_t *cause_value, uint8_t *offending_ie_value)
+{
+    ogs_pfcp_urr_t *urr = NULL;
+
+    ogs_assert(sess);
+    ogs_assert(message);
+
+    if (message->presence == 0)
+        return false;
+
+    if (message->urr_id.presence == 0) {
+        ogs_error("No URR-ID");
+        *cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_MISSING;
+        *offending_ie_value = OGS_PFCP_URR_ID_TYPE;
+        return false;
+    }
+
+    urr = ogs_pfcp_urr_find(sess, message->urr_id.u32);
+    if (!urr) {
+        ogs_error("Unknown URR-ID[%d]", message->urr_id.u32);
+        *cause_value = OGS_PFCP_CAUSE_SESSION_CONTEXT_NOT_FOUND;
+        return false;
+    }
+
+    ogs_pfcp_urr_remove(urr);
+
+    return true;
+}
+
 ogs_pfcp_qer_t *ogs_pfcp_handle_create_qer(ogs_pfcp_sess_t *sess,
         ogs_pfcp_tlv_create_qer_t *message,
         uint8_t *cause_value, uint8_t *offending_ie_value)
@@ -724,6 +1001,8 @@ ogs_pfcp_qer_t *ogs_pfcp_handle_create_qer(ogs_pfcp_sess_t *sess,
     if (message->guaranteed_bitrate.presence)
         ogs_pfcp_parse_bitrate(&qer->gbr, &message->guaranteed_bitrate);
 
+    ogs_pfcp_qer_set_policer(qer);
+
     if (message->qos_flow_identifier.presence)
         qer->qfi = message->qos_flow_identifier.u8;
 
@@ -762,6 +1041,8 @@ ogs_pfcp_qer_t *ogs_pfcp_handle_update_qer(ogs_pfcp_sess_t *sess,
     if (message->guaranteed_bitrate.presence)
         ogs_pfcp_parse_bitrate(&qer->gbr, &message->guaranteed_bitrate);
 
+    ogs_pfcp_qer_set_policer(qer);
+
     return qer;
 }
 
@@ -45,6 +45,21 @@ void ogs_pfcp_up_handle_association_setup_response(
         ogs_pfcp_node_t *node, ogs_pfcp_xact_t *xact,
         ogs_pfcp_association_setup_response_t *req);
 
+/*
+ * Returns false if the gate of the PDR's QER is closed or the packet
+ * exceeds its MBR, and the packet has to be dropped.
+ */
+bool ogs_pfcp_up_police_pdr(ogs_pfcp_pdr_t *pdr, int len);
+
+/*
+ * Counts the packet against the URR of the PDR
+ */
+void ogs_pfcp_up_measure_pdr(ogs_pfcp_pdr_t *pdr, int len);
+
+/*
+ * recvbuf is consumed: it is forwarded, buffered or freed.
+ * The caller must not free or reference it after the call.
+ */
 void ogs_pfcp_up_handle_pdr(
         ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *recvbuf,
         ogs_pfcp_user_plane_report_t *report);
@@ -82,6 +97,16 @@ bool ogs_pfcp_handle_remove_qer(ogs_pfcp_sess_t *sess,
         ogs_pfcp_tlv_remove_qer_t *message,
         uint8_t *cause_value, uint8_t *offending_ie_value);
 
+ogs_pfcp_urr_t *ogs_pfcp_handle_create_urr(ogs_pfcp_sess_t *sess,
+        ogs_pfcp_tlv_create_urr_t *message,
+        uint8_t *cause_value, uint8_t *offending_ie_value);
+ogs_pfcp_urr_t *ogs_pfcp_handle_update_urr(ogs_pfcp_sess_t *sess,
+        ogs_pfcp_tlv_update_urr_t *message,
+        uint8_t *cause_value, uint8_t *offending_ie_value);
+bool ogs_pfcp_handle_remove_urr(ogs_pfcp_sess_t *sess,
+        ogs_pfcp_tlv_remove_urr_t *message,
+        uint8_t *cause_value, uint8_t *offending_ie_value);
+
 #ifdef __cplusplus
 }
 #endif
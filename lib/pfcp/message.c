@@ -20,7 +20,7 @@
 /*******************************************************************************
  * This file had been created by pfcp-tlv.py script v0.1.0
  * Please do not modify this file but regenerate it via script.
- * Created on: 2020-08-28 21:50:38.885547 by acetcom
+ * Created on: 2026-10-17 04:50:09.974905 by root
  * from 29244-g10.docx
  ******************************************************************************/
 
@@ -34,7 +34,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_cause =
     1,
     0,
     sizeof(ogs_pfcp_tlv_cause_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_source_interface =
@@ -45,7 +46,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_source_interface =
     1,
     0,
     sizeof(ogs_pfcp_tlv_source_interface_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_f_teid =
@@ -56,7 +58,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_f_teid =
     0,
     0,
     sizeof(ogs_pfcp_tlv_f_teid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_network_instance =
@@ -67,7 +70,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_network_instance =
     0,
     0,
     sizeof(ogs_pfcp_tlv_network_instance_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_sdf_filter =
@@ -78,7 +82,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_sdf_filter =
     0,
     0,
     sizeof(ogs_pfcp_tlv_sdf_filter_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_application_id =
@@ -89,7 +94,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_application_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_application_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_gate_status =
@@ -100,7 +106,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_gate_status =
     1,
     0,
     sizeof(ogs_pfcp_tlv_gate_status_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_mbr =
@@ -111,7 +118,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_mbr =
     0,
     0,
     sizeof(ogs_pfcp_tlv_mbr_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_gbr =
@@ -122,7 +130,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_gbr =
     0,
     0,
     sizeof(ogs_pfcp_tlv_gbr_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_qer_correlation_id =
@@ -133,7 +142,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_qer_correlation_id =
     4,
     0,
     sizeof(ogs_pfcp_tlv_qer_correlation_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_precedence =
@@ -144,7 +154,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_precedence =
     4,
     0,
     sizeof(ogs_pfcp_tlv_precedence_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_transport_level_marking =
@@ -155,7 +166,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_transport_level_marking =
     0,
     0,
     sizeof(ogs_pfcp_tlv_transport_level_marking_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_volume_threshold =
@@ -166,7 +178,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_volume_threshold =
     0,
     0,
     sizeof(ogs_pfcp_tlv_volume_threshold_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_threshold =
@@ -177,7 +190,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_threshold =
     0,
     0,
     sizeof(ogs_pfcp_tlv_time_threshold_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_monitoring_time =
@@ -188,7 +202,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_monitoring_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_monitoring_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_volume_threshold =
@@ -199,7 +214,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_volume_threshold =
     0,
     0,
     sizeof(ogs_pfcp_tlv_subsequent_volume_threshold_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_time_threshold =
@@ -210,7 +226,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_time_threshold =
     0,
     0,
     sizeof(ogs_pfcp_tlv_subsequent_time_threshold_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_inactivity_detection_time =
@@ -221,7 +238,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_inactivity_detection_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_inactivity_detection_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_reporting_triggers =
@@ -232,7 +250,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_reporting_triggers =
     1,
     0,
     sizeof(ogs_pfcp_tlv_reporting_triggers_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_redirect_information =
@@ -243,7 +262,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_redirect_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_redirect_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_report_type =
@@ -254,7 +274,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_report_type =
     1,
     0,
     sizeof(ogs_pfcp_tlv_report_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_offending_ie =
@@ -265,7 +286,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_offending_ie =
     2,
     0,
     sizeof(ogs_pfcp_tlv_offending_ie_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_forwarding_policy =
@@ -276,7 +298,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_forwarding_policy =
     0,
     0,
     sizeof(ogs_pfcp_tlv_forwarding_policy_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_destination_interface =
@@ -287,7 +310,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_destination_interface =
     1,
     0,
     sizeof(ogs_pfcp_tlv_destination_interface_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_up_function_features =
@@ -298,7 +322,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_up_function_features =
     0,
     0,
     sizeof(ogs_pfcp_tlv_up_function_features_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_apply_action =
@@ -309,7 +334,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_apply_action =
     1,
     0,
     sizeof(ogs_pfcp_tlv_apply_action_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_downlink_data_service_information =
@@ -320,7 +346,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_downlink_data_service_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_downlink_data_service_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_downlink_data_notification_delay =
@@ -331,7 +358,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_downlink_data_notification_delay =
     0,
     0,
     sizeof(ogs_pfcp_tlv_downlink_data_notification_delay_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_dl_buffering_duration =
@@ -342,7 +370,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_dl_buffering_duration =
     0,
     0,
     sizeof(ogs_pfcp_tlv_dl_buffering_duration_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_dl_buffering_suggested_packet_count =
@@ -353,7 +382,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_dl_buffering_suggested_packet_count =
     0,
     0,
     sizeof(ogs_pfcp_tlv_dl_buffering_suggested_packet_count_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcpsmreq_flags =
@@ -364,7 +394,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcpsmreq_flags =
     1,
     0,
     sizeof(ogs_pfcp_tlv_pfcpsmreq_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcpsrrsp_flags =
@@ -375,7 +406,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcpsrrsp_flags =
     1,
     0,
     sizeof(ogs_pfcp_tlv_pfcpsrrsp_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_sequence_number =
@@ -386,7 +418,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_sequence_number =
     0,
     0,
     sizeof(ogs_pfcp_tlv_sequence_number_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_metric =
@@ -397,7 +430,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_metric =
     0,
     0,
     sizeof(ogs_pfcp_tlv_metric_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_timer =
@@ -408,7 +442,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_timer =
     0,
     0,
     sizeof(ogs_pfcp_tlv_timer_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pdr_id =
@@ -419,7 +454,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pdr_id =
     2,
     0,
     sizeof(ogs_pfcp_tlv_pdr_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_f_seid =
@@ -430,7 +466,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_f_seid =
     0,
     0,
     sizeof(ogs_pfcp_tlv_f_seid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_node_id =
@@ -441,7 +478,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_node_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_node_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfd_contents =
@@ -452,7 +490,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfd_contents =
     0,
     0,
     sizeof(ogs_pfcp_tlv_pfd_contents_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_measurement_method =
@@ -463,7 +502,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_measurement_method =
     1,
     0,
     sizeof(ogs_pfcp_tlv_measurement_method_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_report_trigger =
@@ -474,7 +514,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_report_trigger =
     0,
     0,
     sizeof(ogs_pfcp_tlv_usage_report_trigger_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_measurement_period =
@@ -485,7 +526,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_measurement_period =
     0,
     0,
     sizeof(ogs_pfcp_tlv_measurement_period_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_fq_csid =
@@ -496,7 +538,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_fq_csid =
     0,
     0,
     sizeof(ogs_pfcp_tlv_fq_csid_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_volume_measurement =
@@ -507,7 +550,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_volume_measurement =
     0,
     0,
     sizeof(ogs_pfcp_tlv_volume_measurement_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_duration_measurement =
@@ -518,7 +562,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_duration_measurement =
     0,
     0,
     sizeof(ogs_pfcp_tlv_duration_measurement_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_of_first_packet =
@@ -529,7 +574,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_of_first_packet =
     0,
     0,
     sizeof(ogs_pfcp_tlv_time_of_first_packet_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_of_last_packet =
@@ -540,7 +586,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_of_last_packet =
     0,
     0,
     sizeof(ogs_pfcp_tlv_time_of_last_packet_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_quota_holding_time =
@@ -551,7 +598,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_quota_holding_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_quota_holding_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_dropped_dl_traffic_threshold =
@@ -562,7 +610,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_dropped_dl_traffic_threshold =
     0,
     0,
     sizeof(ogs_pfcp_tlv_dropped_dl_traffic_threshold_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_volume_quota =
@@ -573,7 +622,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_volume_quota =
     0,
     0,
     sizeof(ogs_pfcp_tlv_volume_quota_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_quota =
@@ -584,7 +634,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_quota =
     0,
     0,
     sizeof(ogs_pfcp_tlv_time_quota_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_start_time =
@@ -595,7 +646,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_start_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_start_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_end_time =
@@ -606,7 +658,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_end_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_end_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_urr_id =
@@ -617,7 +670,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_urr_id =
     4,
     0,
     sizeof(ogs_pfcp_tlv_urr_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_linked_urr_id =
@@ -628,7 +682,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_linked_urr_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_linked_urr_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_outer_header_creation =
@@ -639,7 +694,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_outer_header_creation =
     0,
     0,
     sizeof(ogs_pfcp_tlv_outer_header_creation_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_bar_id =
@@ -650,7 +706,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_bar_id =
     1,
     0,
     sizeof(ogs_pfcp_tlv_bar_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_cp_function_features =
@@ -661,7 +718,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_cp_function_features =
     1,
     0,
     sizeof(ogs_pfcp_tlv_cp_function_features_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_information =
@@ -672,7 +730,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_usage_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_application_instance_id =
@@ -683,7 +742,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_application_instance_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_application_instance_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_flow_information =
@@ -694,7 +754,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_flow_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_flow_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ue_ip_address =
@@ -705,7 +766,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ue_ip_address =
     0,
     0,
     sizeof(ogs_pfcp_tlv_ue_ip_address_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_packet_rate =
@@ -716,7 +778,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_packet_rate =
     0,
     0,
     sizeof(ogs_pfcp_tlv_packet_rate_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_outer_header_removal =
@@ -727,7 +790,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_outer_header_removal =
     0,
     0,
     sizeof(ogs_pfcp_tlv_outer_header_removal_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_recovery_time_stamp =
@@ -738,7 +802,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_recovery_time_stamp =
     4,
     0,
     sizeof(ogs_pfcp_tlv_recovery_time_stamp_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_dl_flow_level_marking =
@@ -749,7 +814,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_dl_flow_level_marking =
     0,
     0,
     sizeof(ogs_pfcp_tlv_dl_flow_level_marking_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_header_enrichment =
@@ -760,7 +826,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_header_enrichment =
     0,
     0,
     sizeof(ogs_pfcp_tlv_header_enrichment_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_measurement_information =
@@ -771,7 +838,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_measurement_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_measurement_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_node_report_type =
@@ -782,7 +850,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_node_report_type =
     0,
     0,
     sizeof(ogs_pfcp_tlv_node_report_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_remote_gtp_u_peer =
@@ -793,7 +862,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_remote_gtp_u_peer =
     0,
     0,
     sizeof(ogs_pfcp_tlv_remote_gtp_u_peer_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ur_seqn =
@@ -804,7 +874,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ur_seqn =
     0,
     0,
     sizeof(ogs_pfcp_tlv_ur_seqn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_activate_predefined_rules =
@@ -815,7 +886,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_activate_predefined_rules =
     0,
     0,
     sizeof(ogs_pfcp_tlv_activate_predefined_rules_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_deactivate_predefined_rules =
@@ -826,7 +898,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_deactivate_predefined_rules =
     0,
     0,
     sizeof(ogs_pfcp_tlv_deactivate_predefined_rules_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_far_id =
@@ -837,7 +910,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_far_id =
     4,
     0,
     sizeof(ogs_pfcp_tlv_far_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_qer_id =
@@ -848,7 +922,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_qer_id =
     4,
     0,
     sizeof(ogs_pfcp_tlv_qer_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_oci_flags =
@@ -859,7 +934,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_oci_flags =
     0,
     0,
     sizeof(ogs_pfcp_tlv_oci_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcp_association_release_request =
@@ -870,7 +946,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcp_association_release_request =
     0,
     0,
     sizeof(ogs_pfcp_tlv_pfcp_association_release_request_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_graceful_release_period =
@@ -881,7 +958,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_graceful_release_period =
     0,
     0,
     sizeof(ogs_pfcp_tlv_graceful_release_period_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pdn_type =
@@ -892,7 +970,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pdn_type =
     1,
     0,
     sizeof(ogs_pfcp_tlv_pdn_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_failed_rule_id =
@@ -903,7 +982,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_failed_rule_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_failed_rule_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_quota_mechanism =
@@ -914,7 +994,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_time_quota_mechanism =
     0,
     0,
     sizeof(ogs_pfcp_tlv_time_quota_mechanism_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_user_plane_ip_resource_information =
@@ -925,7 +1006,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_user_plane_ip_resource_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_user_plane_ip_resource_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_user_plane_inactivity_timer =
@@ -936,7 +1018,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_user_plane_inactivity_timer =
     0,
     0,
     sizeof(ogs_pfcp_tlv_user_plane_inactivity_timer_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_aggregated_urrs =
@@ -947,7 +1030,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_aggregated_urrs =
     0,
     0,
     sizeof(ogs_pfcp_tlv_aggregated_urrs_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_multiplier =
@@ -958,7 +1042,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_multiplier =
     0,
     0,
     sizeof(ogs_pfcp_tlv_multiplier_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_aggregated_urr_id =
@@ -969,7 +1054,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_aggregated_urr_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_aggregated_urr_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_volume_quota =
@@ -980,7 +1066,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_volume_quota =
     0,
     0,
     sizeof(ogs_pfcp_tlv_subsequent_volume_quota_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_time_quota =
@@ -991,7 +1078,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_time_quota =
     0,
     0,
     sizeof(ogs_pfcp_tlv_subsequent_time_quota_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_rqi =
@@ -1002,7 +1090,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_rqi =
     1,
     0,
     sizeof(ogs_pfcp_tlv_rqi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_qfi =
@@ -1013,7 +1102,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_qfi =
     1,
     0,
     sizeof(ogs_pfcp_tlv_qfi_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_query_urr_reference =
@@ -1024,7 +1114,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_query_urr_reference =
     0,
     0,
     sizeof(ogs_pfcp_tlv_query_urr_reference_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_additional_usage_reports_information =
@@ -1035,7 +1126,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_additional_usage_reports_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_additional_usage_reports_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_traffic_endpoint =
@@ -1046,7 +1138,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_traffic_endpoint =
     0,
     0,
     sizeof(ogs_pfcp_tlv_update_traffic_endpoint_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_traffic_endpoint_id =
@@ -1057,7 +1150,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_traffic_endpoint_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_traffic_endpoint_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_mac_address =
@@ -1068,7 +1162,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_mac_address =
     0,
     0,
     sizeof(ogs_pfcp_tlv_mac_address_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_c_tag =
@@ -1079,7 +1174,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_c_tag =
     0,
     0,
     sizeof(ogs_pfcp_tlv_c_tag_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_s_tag =
@@ -1090,7 +1186,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_s_tag =
     0,
     0,
     sizeof(ogs_pfcp_tlv_s_tag_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethertype =
@@ -1101,7 +1198,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethertype =
     0,
     0,
     sizeof(ogs_pfcp_tlv_ethertype_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_proxying =
@@ -1112,7 +1210,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_proxying =
     0,
     0,
     sizeof(ogs_pfcp_tlv_proxying_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_filter_id =
@@ -1123,7 +1222,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_filter_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_ethernet_filter_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_filter_properties =
@@ -1134,7 +1234,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_filter_properties =
     0,
     0,
     sizeof(ogs_pfcp_tlv_ethernet_filter_properties_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_suggested_buffering_packets_count =
@@ -1145,7 +1246,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_suggested_buffering_packets_count =
     0,
     0,
     sizeof(ogs_pfcp_tlv_suggested_buffering_packets_count_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_user_id =
@@ -1156,7 +1258,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_user_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_user_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_pdu_session_information =
@@ -1167,7 +1270,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_pdu_session_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_ethernet_pdu_session_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_mac_addresses_detected =
@@ -1178,7 +1282,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_mac_addresses_detected =
     0,
     0,
     sizeof(ogs_pfcp_tlv_mac_addresses_detected_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_mac_addresses_removed =
@@ -1189,7 +1294,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_mac_addresses_removed =
     0,
     0,
     sizeof(ogs_pfcp_tlv_mac_addresses_removed_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_inactivity_timer =
@@ -1200,7 +1306,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_inactivity_timer =
     0,
     0,
     sizeof(ogs_pfcp_tlv_ethernet_inactivity_timer_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_additional_monitoring_time =
@@ -1211,7 +1318,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_additional_monitoring_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_additional_monitoring_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_event_quota =
@@ -1222,7 +1330,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_event_quota =
     0,
     0,
     sizeof(ogs_pfcp_tlv_event_quota_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_event_threshold =
@@ -1233,7 +1342,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_event_threshold =
     0,
     0,
     sizeof(ogs_pfcp_tlv_event_threshold_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_event_quota =
@@ -1244,7 +1354,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_event_quota =
     0,
     0,
     sizeof(ogs_pfcp_tlv_subsequent_event_quota_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_event_threshold =
@@ -1255,7 +1366,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_subsequent_event_threshold =
     0,
     0,
     sizeof(ogs_pfcp_tlv_subsequent_event_threshold_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_trace_information =
@@ -1266,7 +1378,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_trace_information =
     0,
     0,
     sizeof(ogs_pfcp_tlv_trace_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_framed_route =
@@ -1277,7 +1390,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_framed_route =
     0,
     0,
     sizeof(ogs_pfcp_tlv_framed_route_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_framed_routing =
@@ -1288,7 +1402,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_framed_routing =
     0,
     0,
     sizeof(ogs_pfcp_tlv_framed_routing_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_framed_ipv6_route =
@@ -1299,7 +1414,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_framed_ipv6_route =
     0,
     0,
     sizeof(ogs_pfcp_tlv_framed_ipv6_route_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_event_time_stamp =
@@ -1310,7 +1426,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_event_time_stamp =
     0,
     0,
     sizeof(ogs_pfcp_tlv_event_time_stamp_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_averaging_window =
@@ -1321,7 +1438,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_averaging_window =
     4,
     0,
     sizeof(ogs_pfcp_tlv_averaging_window_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_paging_policy_indicator =
@@ -1332,7 +1450,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_paging_policy_indicator =
     1,
     0,
     sizeof(ogs_pfcp_tlv_paging_policy_indicator_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_apn_dnn =
@@ -1343,7 +1462,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_apn_dnn =
     0,
     0,
     sizeof(ogs_pfcp_tlv_apn_dnn_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc__interface_type =
@@ -1354,7 +1474,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc__interface_type =
     0,
     0,
     sizeof(ogs_pfcp_tlv__interface_type_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcpsrreq_flags =
@@ -1365,7 +1486,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcpsrreq_flags =
     1,
     0,
     sizeof(ogs_pfcp_tlv_pfcpsrreq_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcpaureq_flags =
@@ -1376,7 +1498,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfcpaureq_flags =
     1,
     0,
     sizeof(ogs_pfcp_tlv_pfcpaureq_flags_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_activation_time =
@@ -1387,7 +1510,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_activation_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_activation_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_deactivation_time =
@@ -1398,7 +1522,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_deactivation_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_deactivation_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_mar_id =
@@ -1409,7 +1534,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_mar_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_mar_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_steering_functionality =
@@ -1420,7 +1546,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_steering_functionality =
     0,
     0,
     sizeof(ogs_pfcp_tlv_steering_functionality_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_steering_mode =
@@ -1431,7 +1558,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_steering_mode =
     0,
     0,
     sizeof(ogs_pfcp_tlv_steering_mode_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_weight =
@@ -1442,7 +1570,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_weight =
     0,
     0,
     sizeof(ogs_pfcp_tlv_weight_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_priority =
@@ -1453,7 +1582,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_priority =
     0,
     0,
     sizeof(ogs_pfcp_tlv_priority_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ue_ip_address_pool_identity =
@@ -1464,7 +1594,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ue_ip_address_pool_identity =
     0,
     0,
     sizeof(ogs_pfcp_tlv_ue_ip_address_pool_identity_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_alternative_smf_ip_address =
@@ -1475,7 +1606,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_alternative_smf_ip_address =
     0,
     0,
     sizeof(ogs_pfcp_tlv_alternative_smf_ip_address_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_packet_replication_and_detection_carry_on_information =
@@ -1486,7 +1618,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_packet_replication_and_detection_carry_on_infor
     0,
     0,
     sizeof(ogs_pfcp_tlv_packet_replication_and_detection_carry_on_information_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_smf_set_id =
@@ -1497,7 +1630,8 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_smf_set_id =
     0,
     0,
     sizeof(ogs_pfcp_tlv_smf_set_id_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_quota_validity_time =
@@ -1508,9 +1642,70 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_quota_validity_time =
     0,
     0,
     sizeof(ogs_pfcp_tlv_quota_validity_time_t),
-    { NULL }
+    { NULL },
+    NULL
 };
 
+static ogs_tlv_desc_t *find_tlv_ethernet_packet_filter(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_ETHERNET_FILTER_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_packet_filter_t, ethernet_filter_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_filter_id;
+    case OGS_PFCP_ETHERNET_FILTER_PROPERTIES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_packet_filter_t, ethernet_filter_properties) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_filter_properties;
+    case OGS_PFCP_MAC_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_packet_filter_t, mac_address) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mac_address;
+    case OGS_PFCP_ETHERTYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_packet_filter_t, ethertype) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethertype;
+    case OGS_PFCP_C_TAG_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_packet_filter_t, c_tag) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_c_tag;
+    case OGS_PFCP_S_TAG_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_packet_filter_t, s_tag) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_s_tag;
+    case OGS_PFCP_SDF_FILTER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_packet_filter_t, sdf_filter) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_sdf_filter;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_packet_filter =
 {
     OGS_TLV_COMPOUND,
@@ -1529,9 +1724,119 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_packet_filter =
         &ogs_pfcp_tlv_desc_sdf_filter,
         &ogs_tlv_desc_more8,
         NULL,
-    }
+    },
+    find_tlv_ethernet_packet_filter
 };
 
+static ogs_tlv_desc_t *find_tlv_pdi(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_SOURCE_INTERFACE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, source_interface) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_source_interface;
+    case OGS_PFCP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, local_f_teid) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_f_teid;
+    case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, network_instance) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_network_instance;
+    case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, ue_ip_address) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ue_ip_address;
+    case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, traffic_endpoint_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_traffic_endpoint_id;
+    case OGS_PFCP_SDF_FILTER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, sdf_filter) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_sdf_filter;
+    case OGS_PFCP_APPLICATION_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, application_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_application_id;
+    case OGS_PFCP_ETHERNET_PDU_SESSION_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, ethernet_pdu_session_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_pdu_session_information;
+    case OGS_PFCP_ETHERNET_PACKET_FILTER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, ethernet_packet_filter) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_packet_filter;
+    case OGS_PFCP_QFI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, qfi) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qfi;
+    case OGS_PFCP_FRAMED_ROUTE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, framed_route) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_framed_route;
+    case OGS_PFCP_FRAMED_ROUTING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, framed_routing) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_framed_routing;
+    case OGS_PFCP_FRAMED_IPV6_ROUTE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, framed_ipv6_route) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_framed_ipv6_route;
+    case OGS_PFCP__INTERFACE_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_pfcp_tlv_pdi_t, source_interface_type) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc__interface_type;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pdi =
 {
     OGS_TLV_COMPOUND,
@@ -1557,9 +1862,105 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pdi =
         &ogs_pfcp_tlv_desc_framed_ipv6_route,
         &ogs_pfcp_tlv_desc__interface_type,
         NULL,
-    }
+    },
+    find_tlv_pdi
 };
 
+static ogs_tlv_desc_t *find_tlv_create_pdr(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_PDR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, pdr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pdr_id;
+    case OGS_PFCP_PRECEDENCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, precedence) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_precedence;
+    case OGS_PFCP_PDI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, pdi) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pdi;
+    case OGS_PFCP_OUTER_HEADER_REMOVAL_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, outer_header_removal) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_outer_header_removal;
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    case OGS_PFCP_QER_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, qer_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qer_id;
+    case OGS_PFCP_ACTIVATE_PREDEFINED_RULES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, activate_predefined_rules) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_activate_predefined_rules;
+    case OGS_PFCP_ACTIVATION_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, activation_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_activation_time;
+    case OGS_PFCP_DEACTIVATION_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, deactivation_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_deactivation_time;
+    case OGS_PFCP_MAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, mar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mar_id;
+    case OGS_PFCP_PACKET_REPLICATION_AND_DETECTION_CARRY_ON_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_tlv_create_pdr_t, packet_replication_and_detection_carry_on_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_packet_replication_and_detection_carry_on_information;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_pdr =
 {
     OGS_TLV_COMPOUND,
@@ -1582,9 +1983,91 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_pdr =
         &ogs_pfcp_tlv_desc_mar_id,
         &ogs_pfcp_tlv_desc_packet_replication_and_detection_carry_on_information,
         NULL,
-    }
+    },
+    find_tlv_create_pdr
 };
 
+static ogs_tlv_desc_t *find_tlv_forwarding_parameters(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_DESTINATION_INTERFACE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, destination_interface) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_destination_interface;
+    case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, network_instance) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_network_instance;
+    case OGS_PFCP_REDIRECT_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, redirect_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_redirect_information;
+    case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, outer_header_creation) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_outer_header_creation;
+    case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, transport_level_marking) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_transport_level_marking;
+    case OGS_PFCP_FORWARDING_POLICY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, forwarding_policy) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_forwarding_policy;
+    case OGS_PFCP_HEADER_ENRICHMENT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, header_enrichment) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_header_enrichment;
+    case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, linked_traffic_endpoint_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_traffic_endpoint_id;
+    case OGS_PFCP_PROXYING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, proxying) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_proxying;
+    case OGS_PFCP__INTERFACE_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_forwarding_parameters_t, destination_interface_type) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc__interface_type;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_forwarding_parameters =
 {
     OGS_TLV_COMPOUND,
@@ -1605,9 +2088,49 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_forwarding_parameters =
         &ogs_pfcp_tlv_desc_proxying,
         &ogs_pfcp_tlv_desc__interface_type,
         NULL,
-    }
+    },
+    find_tlv_forwarding_parameters
 };
 
+static ogs_tlv_desc_t *find_tlv_duplicating_parameters(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_DESTINATION_INTERFACE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_duplicating_parameters_t, destination_interface) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_destination_interface;
+    case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_duplicating_parameters_t, outer_header_creation) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_outer_header_creation;
+    case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_duplicating_parameters_t, transport_level_marking) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_transport_level_marking;
+    case OGS_PFCP_FORWARDING_POLICY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_duplicating_parameters_t, forwarding_policy) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_forwarding_policy;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_duplicating_parameters =
 {
     OGS_TLV_COMPOUND,
@@ -1622,9 +2145,56 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_duplicating_parameters =
         &ogs_pfcp_tlv_desc_transport_level_marking,
         &ogs_pfcp_tlv_desc_forwarding_policy,
         NULL,
-    }
+    },
+    find_tlv_duplicating_parameters
 };
 
+static ogs_tlv_desc_t *find_tlv_create_far(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_create_far_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_APPLY_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_create_far_t, apply_action) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_apply_action;
+    case OGS_PFCP_FORWARDING_PARAMETERS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_create_far_t, forwarding_parameters) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_forwarding_parameters;
+    case OGS_PFCP_DUPLICATING_PARAMETERS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_create_far_t, duplicating_parameters) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_duplicating_parameters;
+    case OGS_PFCP_BAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_create_far_t, bar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_bar_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_far =
 {
     OGS_TLV_COMPOUND,
@@ -1640,9 +2210,91 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_far =
         &ogs_pfcp_tlv_desc_duplicating_parameters,
         &ogs_pfcp_tlv_desc_bar_id,
         NULL,
-    }
+    },
+    find_tlv_create_far
 };
 
+static ogs_tlv_desc_t *find_tlv_update_forwarding_parameters(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_DESTINATION_INTERFACE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, destination_interface) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_destination_interface;
+    case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, network_instance) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_network_instance;
+    case OGS_PFCP_REDIRECT_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, redirect_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_redirect_information;
+    case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, outer_header_creation) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_outer_header_creation;
+    case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, transport_level_marking) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_transport_level_marking;
+    case OGS_PFCP_FORWARDING_POLICY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, forwarding_policy) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_forwarding_policy;
+    case OGS_PFCP_HEADER_ENRICHMENT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, header_enrichment) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_header_enrichment;
+    case OGS_PFCP_PFCPSMREQ_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, pfcpsmreq_flags) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pfcpsmreq_flags;
+    case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, linked_traffic_endpoint_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_traffic_endpoint_id;
+    case OGS_PFCP__INTERFACE_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_update_forwarding_parameters_t, destination_interface_type) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc__interface_type;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_forwarding_parameters =
 {
     OGS_TLV_COMPOUND,
@@ -1663,9 +2315,49 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_forwarding_parameters =
         &ogs_pfcp_tlv_desc_traffic_endpoint_id,
         &ogs_pfcp_tlv_desc__interface_type,
         NULL,
-    }
+    },
+    find_tlv_update_forwarding_parameters
 };
 
+static ogs_tlv_desc_t *find_tlv_update_duplicating_parameters(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_DESTINATION_INTERFACE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_duplicating_parameters_t, destination_interface) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_destination_interface;
+    case OGS_PFCP_OUTER_HEADER_CREATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_duplicating_parameters_t, outer_header_creation) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_outer_header_creation;
+    case OGS_PFCP_TRANSPORT_LEVEL_MARKING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_duplicating_parameters_t, transport_level_marking) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_transport_level_marking;
+    case OGS_PFCP_FORWARDING_POLICY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_duplicating_parameters_t, forwarding_policy) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_forwarding_policy;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_duplicating_parameters =
 {
     OGS_TLV_COMPOUND,
@@ -1680,9 +2372,56 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_duplicating_parameters =
         &ogs_pfcp_tlv_desc_transport_level_marking,
         &ogs_pfcp_tlv_desc_forwarding_policy,
         NULL,
-    }
+    },
+    find_tlv_update_duplicating_parameters
 };
 
+static ogs_tlv_desc_t *find_tlv_update_far(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_far_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_APPLY_ACTION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_far_t, apply_action) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_apply_action;
+    case OGS_PFCP_UPDATE_FORWARDING_PARAMETERS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_far_t, update_forwarding_parameters) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_update_forwarding_parameters;
+    case OGS_PFCP_UPDATE_DUPLICATING_PARAMETERS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_far_t, update_duplicating_parameters) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_update_duplicating_parameters;
+    case OGS_PFCP_BAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_update_far_t, bar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_bar_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_far =
 {
     OGS_TLV_COMPOUND,
@@ -1698,9 +2437,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_far =
         &ogs_pfcp_tlv_desc_update_duplicating_parameters,
         &ogs_pfcp_tlv_desc_bar_id,
         NULL,
-    }
+    },
+    find_tlv_update_far
 };
 
+static ogs_tlv_desc_t *find_tlv_pfd_context(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_PFD_CONTENTS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_pfd_context_t, pfd_contents) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pfd_contents;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfd_context =
 {
     OGS_TLV_COMPOUND,
@@ -1712,9 +2470,35 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_pfd_context =
     {
         &ogs_pfcp_tlv_desc_pfd_contents,
         NULL,
-    }
+    },
+    find_tlv_pfd_context
 };
 
+static ogs_tlv_desc_t *find_tlv_application_id_s_pfds(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_APPLICATION_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_application_id_s_pfds_t, application_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_application_id;
+    case OGS_PFCP_PFD_CONTEXT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_application_id_s_pfds_t, pfd_context) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pfd_context;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_application_id_s_pfds =
 {
     OGS_TLV_COMPOUND,
@@ -1727,9 +2511,35 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_application_id_s_pfds =
         &ogs_pfcp_tlv_desc_application_id,
         &ogs_pfcp_tlv_desc_pfd_context,
         NULL,
-    }
+    },
+    find_tlv_application_id_s_pfds
 };
 
+static ogs_tlv_desc_t *find_tlv_ethernet_traffic_information(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_MAC_ADDRESSES_DETECTED_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_traffic_information_t, mac_addresses_detected) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mac_addresses_detected;
+    case OGS_PFCP_MAC_ADDRESSES_REMOVED_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_ethernet_traffic_information_t, mac_addresses_removed) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mac_addresses_removed;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_traffic_information =
 {
     OGS_TLV_COMPOUND,
@@ -1742,9 +2552,49 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_ethernet_traffic_information =
         &ogs_pfcp_tlv_desc_mac_addresses_detected,
         &ogs_pfcp_tlv_desc_mac_addresses_removed,
         NULL,
-    }
+    },
+    find_tlv_ethernet_traffic_information
 };
 
+static ogs_tlv_desc_t *find_tlv_access_forwarding_action_information_1(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_access_forwarding_action_information_1_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_WEIGHT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_access_forwarding_action_information_1_t, weight) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_weight;
+    case OGS_PFCP_PRIORITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_access_forwarding_action_information_1_t, priority) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_priority;
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_access_forwarding_action_information_1_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_access_forwarding_action_information_1 =
 {
     OGS_TLV_COMPOUND,
@@ -1759,9 +2609,49 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_access_forwarding_action_information_1 =
         &ogs_pfcp_tlv_desc_priority,
         &ogs_pfcp_tlv_desc_urr_id,
         NULL,
-    }
+    },
+    find_tlv_access_forwarding_action_information_1
 };
 
+static ogs_tlv_desc_t *find_tlv_access_forwarding_action_information_2(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_access_forwarding_action_information_2_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_WEIGHT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_access_forwarding_action_information_2_t, weight) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_weight;
+    case OGS_PFCP_PRIORITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_access_forwarding_action_information_2_t, priority) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_priority;
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_access_forwarding_action_information_2_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_access_forwarding_action_information_2 =
 {
     OGS_TLV_COMPOUND,
@@ -1776,9 +2666,49 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_access_forwarding_action_information_2 =
         &ogs_pfcp_tlv_desc_priority,
         &ogs_pfcp_tlv_desc_urr_id,
         NULL,
-    }
+    },
+    find_tlv_access_forwarding_action_information_2
 };
 
+static ogs_tlv_desc_t *find_tlv_update_access_forwarding_action_information_1(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_access_forwarding_action_information_1_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_WEIGHT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_access_forwarding_action_information_1_t, weight) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_weight;
+    case OGS_PFCP_PRIORITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_access_forwarding_action_information_1_t, priority) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_priority;
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_access_forwarding_action_information_1_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_access_forwarding_action_information_1 =
 {
     OGS_TLV_COMPOUND,
@@ -1793,9 +2723,49 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_access_forwarding_action_information_1 =
         &ogs_pfcp_tlv_desc_priority,
         &ogs_pfcp_tlv_desc_urr_id,
         NULL,
-    }
+    },
+    find_tlv_update_access_forwarding_action_information_1
 };
 
+static ogs_tlv_desc_t *find_tlv_update_access_forwarding_action_information_2(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_access_forwarding_action_information_2_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_WEIGHT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_access_forwarding_action_information_2_t, weight) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_weight;
+    case OGS_PFCP_PRIORITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_access_forwarding_action_information_2_t, priority) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_priority;
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_access_forwarding_action_information_2_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_access_forwarding_action_information_2 =
 {
     OGS_TLV_COMPOUND,
@@ -1810,9 +2780,217 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_access_forwarding_action_information_2 =
         &ogs_pfcp_tlv_desc_priority,
         &ogs_pfcp_tlv_desc_urr_id,
         NULL,
-    }
+    },
+    find_tlv_update_access_forwarding_action_information_2
 };
 
+static ogs_tlv_desc_t *find_tlv_create_urr(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    case OGS_PFCP_MEASUREMENT_METHOD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, measurement_method) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_measurement_method;
+    case OGS_PFCP_REPORTING_TRIGGERS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, reporting_triggers) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_reporting_triggers;
+    case OGS_PFCP_MEASUREMENT_PERIOD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, measurement_period) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_measurement_period;
+    case OGS_PFCP_VOLUME_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, volume_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_volume_threshold;
+    case OGS_PFCP_VOLUME_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, volume_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_volume_quota;
+    case OGS_PFCP_EVENT_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, event_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_event_threshold;
+    case OGS_PFCP_EVENT_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, event_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_event_quota;
+    case OGS_PFCP_TIME_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, time_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_threshold;
+    case OGS_PFCP_TIME_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, time_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_quota;
+    case OGS_PFCP_QUOTA_HOLDING_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, quota_holding_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_quota_holding_time;
+    case OGS_PFCP_DROPPED_DL_TRAFFIC_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, dropped_dl_traffic_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_dropped_dl_traffic_threshold;
+    case OGS_PFCP_QUOTA_VALIDITY_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, quota_validity_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_quota_validity_time;
+    case OGS_PFCP_MONITORING_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, monitoring_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_monitoring_time;
+    case OGS_PFCP_SUBSEQUENT_VOLUME_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, subsequent_volume_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_volume_threshold;
+    case OGS_PFCP_SUBSEQUENT_TIME_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, subsequent_time_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_time_threshold;
+    case OGS_PFCP_SUBSEQUENT_VOLUME_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, subsequent_volume_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_volume_quota;
+    case OGS_PFCP_SUBSEQUENT_TIME_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 17;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, subsequent_time_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_time_quota;
+    case OGS_PFCP_SUBSEQUENT_EVENT_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 18;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, subsequent_event_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_event_threshold;
+    case OGS_PFCP_SUBSEQUENT_EVENT_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 19;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, subsequent_event_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_event_quota;
+    case OGS_PFCP_INACTIVITY_DETECTION_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 20;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, inactivity_detection_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_inactivity_detection_time;
+    case OGS_PFCP_LINKED_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, linked_urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_linked_urr_id;
+    case OGS_PFCP_MEASUREMENT_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 22;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, measurement_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_measurement_information;
+    case OGS_PFCP_TIME_QUOTA_MECHANISM_TYPE:
+        if (instance != 0)
+            break;
+        *index = 23;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, time_quota_mechanism) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_quota_mechanism;
+    case OGS_PFCP_AGGREGATED_URRS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 24;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, aggregated_urrs) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_aggregated_urrs;
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 25;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, far_id_for_quota_action) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_ETHERNET_INACTIVITY_TIMER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 26;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, ethernet_inactivity_timer) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_inactivity_timer;
+    case OGS_PFCP_ADDITIONAL_MONITORING_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 27;
+        *offset = offsetof(ogs_pfcp_tlv_create_urr_t, additional_monitoring_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_additional_monitoring_time;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_urr =
 {
     OGS_TLV_COMPOUND,
@@ -1851,9 +3029,98 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_urr =
         &ogs_pfcp_tlv_desc_ethernet_inactivity_timer,
         &ogs_pfcp_tlv_desc_additional_monitoring_time,
         NULL,
-    }
+    },
+    find_tlv_create_urr
 };
 
+static ogs_tlv_desc_t *find_tlv_create_qer(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_QER_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, qer_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qer_id;
+    case OGS_PFCP_QER_CORRELATION_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, qer_correlation_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qer_correlation_id;
+    case OGS_PFCP_GATE_STATUS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, gate_status) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_gate_status;
+    case OGS_PFCP_MBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, maximum_bitrate) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mbr;
+    case OGS_PFCP_GBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, guaranteed_bitrate) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_gbr;
+    case OGS_PFCP_PACKET_RATE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, packet_rate) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_packet_rate;
+    case OGS_PFCP_DL_FLOW_LEVEL_MARKING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, dl_flow_level_marking) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_dl_flow_level_marking;
+    case OGS_PFCP_QFI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, qos_flow_identifier) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qfi;
+    case OGS_PFCP_RQI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, reflective_qos) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_rqi;
+    case OGS_PFCP_PAGING_POLICY_INDICATOR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, paging_policy_indicator) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_paging_policy_indicator;
+    case OGS_PFCP_AVERAGING_WINDOW_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_create_qer_t, averaging_window) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_averaging_window;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_qer =
 {
     OGS_TLV_COMPOUND,
@@ -1875,9 +3142,42 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_qer =
         &ogs_pfcp_tlv_desc_paging_policy_indicator,
         &ogs_pfcp_tlv_desc_averaging_window,
         NULL,
-    }
+    },
+    find_tlv_create_qer
 };
 
+static ogs_tlv_desc_t *find_tlv_created_pdr(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_PDR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_created_pdr_t, pdr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pdr_id;
+    case OGS_PFCP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_created_pdr_t, local_f_teid) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_f_teid;
+    case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_created_pdr_t, ue_ip_address) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ue_ip_address;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_created_pdr =
 {
     OGS_TLV_COMPOUND,
@@ -1891,18 +3191,107 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_created_pdr =
         &ogs_pfcp_tlv_desc_f_teid,
         &ogs_pfcp_tlv_desc_ue_ip_address,
         NULL,
-    }
+    },
+    find_tlv_created_pdr
 };
 
-ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_pdr =
+static ogs_tlv_desc_t *find_tlv_update_pdr(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
 {
-    OGS_TLV_COMPOUND,
-    "Update PDR",
-    OGS_PFCP_UPDATE_PDR_TYPE,
-    0,
-    0,
-    sizeof(ogs_pfcp_tlv_update_pdr_t),
-    {
+    switch (type) {
+    case OGS_PFCP_PDR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, pdr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pdr_id;
+    case OGS_PFCP_OUTER_HEADER_REMOVAL_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, outer_header_removal) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_outer_header_removal;
+    case OGS_PFCP_PRECEDENCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, precedence) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_precedence;
+    case OGS_PFCP_PDI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, pdi) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pdi;
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    case OGS_PFCP_QER_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, qer_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qer_id;
+    case OGS_PFCP_ACTIVATE_PREDEFINED_RULES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, activate_predefined_rules) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_activate_predefined_rules;
+    case OGS_PFCP_DEACTIVATE_PREDEFINED_RULES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, deactivate_predefined_rules) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_deactivate_predefined_rules;
+    case OGS_PFCP_ACTIVATION_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, activation_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_activation_time;
+    case OGS_PFCP_DEACTIVATION_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_update_pdr_t, deactivation_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_deactivation_time;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
+ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_pdr =
+{
+    OGS_TLV_COMPOUND,
+    "Update PDR",
+    OGS_PFCP_UPDATE_PDR_TYPE,
+    0,
+    0,
+    sizeof(ogs_pfcp_tlv_update_pdr_t),
+    {
         &ogs_pfcp_tlv_desc_pdr_id,
         &ogs_pfcp_tlv_desc_outer_header_removal,
         &ogs_pfcp_tlv_desc_precedence,
@@ -1915,9 +3304,56 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_pdr =
         &ogs_pfcp_tlv_desc_activation_time,
         &ogs_pfcp_tlv_desc_deactivation_time,
         NULL,
-    }
+    },
+    find_tlv_update_pdr
 };
 
+static ogs_tlv_desc_t *find_tlv_update_bar_pfcp_session_report_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_BAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_bar_pfcp_session_report_response_t, bar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_bar_id;
+    case OGS_PFCP_DOWNLINK_DATA_NOTIFICATION_DELAY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_bar_pfcp_session_report_response_t, downlink_data_notification_delay) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_downlink_data_notification_delay;
+    case OGS_PFCP_DL_BUFFERING_DURATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_bar_pfcp_session_report_response_t, dl_buffering_duration) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_dl_buffering_duration;
+    case OGS_PFCP_DL_BUFFERING_SUGGESTED_PACKET_COUNT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_bar_pfcp_session_report_response_t, dl_buffering_suggested_packet_count) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_dl_buffering_suggested_packet_count;
+    case OGS_PFCP_SUGGESTED_BUFFERING_PACKETS_COUNT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_update_bar_pfcp_session_report_response_t, suggested_buffering_packets_count) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_suggested_buffering_packets_count;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_bar_pfcp_session_report_response =
 {
     OGS_TLV_COMPOUND,
@@ -1933,9 +3369,217 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_bar_pfcp_session_report_response =
         &ogs_pfcp_tlv_desc_dl_buffering_suggested_packet_count,
         &ogs_pfcp_tlv_desc_suggested_buffering_packets_count,
         NULL,
-    }
+    },
+    find_tlv_update_bar_pfcp_session_report_response
 };
 
+static ogs_tlv_desc_t *find_tlv_update_urr(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    case OGS_PFCP_MEASUREMENT_METHOD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, measurement_method) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_measurement_method;
+    case OGS_PFCP_REPORTING_TRIGGERS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, reporting_triggers) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_reporting_triggers;
+    case OGS_PFCP_MEASUREMENT_PERIOD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, measurement_period) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_measurement_period;
+    case OGS_PFCP_VOLUME_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, volume_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_volume_threshold;
+    case OGS_PFCP_VOLUME_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, volume_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_volume_quota;
+    case OGS_PFCP_TIME_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, time_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_threshold;
+    case OGS_PFCP_TIME_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, time_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_quota;
+    case OGS_PFCP_EVENT_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, event_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_event_threshold;
+    case OGS_PFCP_EVENT_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, event_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_event_quota;
+    case OGS_PFCP_QUOTA_HOLDING_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, quota_holding_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_quota_holding_time;
+    case OGS_PFCP_DROPPED_DL_TRAFFIC_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, dropped_dl_traffic_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_dropped_dl_traffic_threshold;
+    case OGS_PFCP_QUOTA_VALIDITY_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, quota_validity_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_quota_validity_time;
+    case OGS_PFCP_MONITORING_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, monitoring_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_monitoring_time;
+    case OGS_PFCP_SUBSEQUENT_VOLUME_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, subsequent_volume_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_volume_threshold;
+    case OGS_PFCP_SUBSEQUENT_TIME_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, subsequent_time_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_time_threshold;
+    case OGS_PFCP_SUBSEQUENT_VOLUME_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 16;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, subsequent_volume_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_volume_quota;
+    case OGS_PFCP_SUBSEQUENT_TIME_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 17;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, subsequent_time_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_time_quota;
+    case OGS_PFCP_SUBSEQUENT_EVENT_THRESHOLD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 18;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, subsequent_event_threshold) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_event_threshold;
+    case OGS_PFCP_SUBSEQUENT_EVENT_QUOTA_TYPE:
+        if (instance != 0)
+            break;
+        *index = 19;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, subsequent_event_quota) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_subsequent_event_quota;
+    case OGS_PFCP_INACTIVITY_DETECTION_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 20;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, inactivity_detection_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_inactivity_detection_time;
+    case OGS_PFCP_LINKED_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, linked_urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_linked_urr_id;
+    case OGS_PFCP_MEASUREMENT_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 22;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, measurement_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_measurement_information;
+    case OGS_PFCP_TIME_QUOTA_MECHANISM_TYPE:
+        if (instance != 0)
+            break;
+        *index = 23;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, time_quota_mechanism) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_quota_mechanism;
+    case OGS_PFCP_AGGREGATED_URRS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 24;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, aggregated_urrs) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_aggregated_urrs;
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 25;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, far_id_for_quota_action) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    case OGS_PFCP_ETHERNET_INACTIVITY_TIMER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 26;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, ethernet_inactivity_timer) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_inactivity_timer;
+    case OGS_PFCP_ADDITIONAL_MONITORING_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 27;
+        *offset = offsetof(ogs_pfcp_tlv_update_urr_t, additional_monitoring_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_additional_monitoring_time;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_urr =
 {
     OGS_TLV_COMPOUND,
@@ -1974,9 +3618,98 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_urr =
         &ogs_pfcp_tlv_desc_ethernet_inactivity_timer,
         &ogs_pfcp_tlv_desc_additional_monitoring_time,
         NULL,
-    }
+    },
+    find_tlv_update_urr
 };
 
+static ogs_tlv_desc_t *find_tlv_update_qer(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_QER_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, qer_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qer_id;
+    case OGS_PFCP_QER_CORRELATION_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, qer_correlation_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qer_correlation_id;
+    case OGS_PFCP_GATE_STATUS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, gate_status) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_gate_status;
+    case OGS_PFCP_MBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, maximum_bitrate) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mbr;
+    case OGS_PFCP_GBR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, guaranteed_bitrate) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_gbr;
+    case OGS_PFCP_PACKET_RATE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, packet_rate) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_packet_rate;
+    case OGS_PFCP_DL_FLOW_LEVEL_MARKING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, dl_flow_level_marking) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_dl_flow_level_marking;
+    case OGS_PFCP_QFI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, qos_flow_identifier) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qfi;
+    case OGS_PFCP_RQI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, reflective_qos) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_rqi;
+    case OGS_PFCP_PAGING_POLICY_INDICATOR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, paging_policy_indicator) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_paging_policy_indicator;
+    case OGS_PFCP_AVERAGING_WINDOW_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_update_qer_t, averaging_window) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_averaging_window;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_qer =
 {
     OGS_TLV_COMPOUND,
@@ -1998,9 +3731,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_qer =
         &ogs_pfcp_tlv_desc_paging_policy_indicator,
         &ogs_pfcp_tlv_desc_averaging_window,
         NULL,
-    }
+    },
+    find_tlv_update_qer
 };
 
+static ogs_tlv_desc_t *find_tlv_remove_pdr(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_PDR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_remove_pdr_t, pdr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pdr_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_pdr =
 {
     OGS_TLV_COMPOUND,
@@ -2012,9 +3764,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_pdr =
     {
         &ogs_pfcp_tlv_desc_pdr_id,
         NULL,
-    }
+    },
+    find_tlv_remove_pdr
 };
 
+static ogs_tlv_desc_t *find_tlv_remove_far(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_FAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_remove_far_t, far_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_far_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_far =
 {
     OGS_TLV_COMPOUND,
@@ -2026,9 +3797,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_far =
     {
         &ogs_pfcp_tlv_desc_far_id,
         NULL,
-    }
+    },
+    find_tlv_remove_far
 };
 
+static ogs_tlv_desc_t *find_tlv_remove_urr(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_remove_urr_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_urr =
 {
     OGS_TLV_COMPOUND,
@@ -2040,9 +3830,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_urr =
     {
         &ogs_pfcp_tlv_desc_urr_id,
         NULL,
-    }
+    },
+    find_tlv_remove_urr
 };
 
+static ogs_tlv_desc_t *find_tlv_remove_qer(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_QER_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_remove_qer_t, qer_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qer_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_qer =
 {
     OGS_TLV_COMPOUND,
@@ -2054,9 +3863,35 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_qer =
     {
         &ogs_pfcp_tlv_desc_qer_id,
         NULL,
-    }
+    },
+    find_tlv_remove_qer
 };
 
+static ogs_tlv_desc_t *find_tlv_load_control_information(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_SEQUENCE_NUMBER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_load_control_information_t, load_control_sequence_number) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_sequence_number;
+    case OGS_PFCP_METRIC_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_load_control_information_t, load_metric) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_metric;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_load_control_information =
 {
     OGS_TLV_COMPOUND,
@@ -2069,9 +3904,49 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_load_control_information =
         &ogs_pfcp_tlv_desc_sequence_number,
         &ogs_pfcp_tlv_desc_metric,
         NULL,
-    }
+    },
+    find_tlv_load_control_information
 };
 
+static ogs_tlv_desc_t *find_tlv_overload_control_information(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_SEQUENCE_NUMBER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_overload_control_information_t, overload_control_sequence_number) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_sequence_number;
+    case OGS_PFCP_METRIC_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_overload_control_information_t, overload_reduction_metric) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_metric;
+    case OGS_PFCP_TIMER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_overload_control_information_t, period_of_validity) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_timer;
+    case OGS_PFCP_OCI_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_overload_control_information_t, overload_control_information_flags) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_oci_flags;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_overload_control_information =
 {
     OGS_TLV_COMPOUND,
@@ -2086,9 +3961,42 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_overload_control_information =
         &ogs_pfcp_tlv_desc_timer,
         &ogs_pfcp_tlv_desc_oci_flags,
         NULL,
-    }
+    },
+    find_tlv_overload_control_information
 };
 
+static ogs_tlv_desc_t *find_tlv_application_detection_information(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_APPLICATION_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_application_detection_information_t, application_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_application_id;
+    case OGS_PFCP_APPLICATION_INSTANCE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_application_detection_information_t, application_instance_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_application_instance_id;
+    case OGS_PFCP_FLOW_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_application_detection_information_t, flow_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_flow_information;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_application_detection_information =
 {
     OGS_TLV_COMPOUND,
@@ -2102,9 +4010,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_application_detection_information =
         &ogs_pfcp_tlv_desc_application_instance_id,
         &ogs_pfcp_tlv_desc_flow_information,
         NULL,
-    }
+    },
+    find_tlv_application_detection_information
 };
 
+static ogs_tlv_desc_t *find_tlv_query_urr(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_query_urr_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_query_urr =
 {
     OGS_TLV_COMPOUND,
@@ -2116,9 +4043,105 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_query_urr =
     {
         &ogs_pfcp_tlv_desc_urr_id,
         NULL,
-    }
+    },
+    find_tlv_query_urr
 };
 
+static ogs_tlv_desc_t *find_tlv_usage_report_session_modification_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    case OGS_PFCP_UR_SEQN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, ur_seqn) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ur_seqn;
+    case OGS_PFCP_USAGE_REPORT_TRIGGER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, usage_report_trigger) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_usage_report_trigger;
+    case OGS_PFCP_START_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, start_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_start_time;
+    case OGS_PFCP_END_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, end_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_end_time;
+    case OGS_PFCP_VOLUME_MEASUREMENT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, volume_measurement) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_volume_measurement;
+    case OGS_PFCP_DURATION_MEASUREMENT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, duration_measurement) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_duration_measurement;
+    case OGS_PFCP_TIME_OF_FIRST_PACKET_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, time_of_first_packet) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_of_first_packet;
+    case OGS_PFCP_TIME_OF_LAST_PACKET_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, time_of_last_packet) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_of_last_packet;
+    case OGS_PFCP_USAGE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, usage_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_usage_information;
+    case OGS_PFCP_QUERY_URR_REFERENCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, query_urr_reference) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_query_urr_reference;
+    case OGS_PFCP_ETHERNET_TRAFFIC_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_modification_response_t, ethernet_traffic_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_traffic_information;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_report_session_modification_response =
 {
     OGS_TLV_COMPOUND,
@@ -2141,9 +4164,98 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_report_session_modification_response =
         &ogs_pfcp_tlv_desc_query_urr_reference,
         &ogs_pfcp_tlv_desc_ethernet_traffic_information,
         NULL,
-    }
+    },
+    find_tlv_usage_report_session_modification_response
 };
 
+static ogs_tlv_desc_t *find_tlv_usage_report_session_deletion_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    case OGS_PFCP_UR_SEQN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, ur_seqn) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ur_seqn;
+    case OGS_PFCP_USAGE_REPORT_TRIGGER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, usage_report_trigger) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_usage_report_trigger;
+    case OGS_PFCP_START_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, start_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_start_time;
+    case OGS_PFCP_END_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, end_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_end_time;
+    case OGS_PFCP_VOLUME_MEASUREMENT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, volume_measurement) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_volume_measurement;
+    case OGS_PFCP_DURATION_MEASUREMENT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, duration_measurement) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_duration_measurement;
+    case OGS_PFCP_TIME_OF_FIRST_PACKET_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, time_of_first_packet) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_of_first_packet;
+    case OGS_PFCP_TIME_OF_LAST_PACKET_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, time_of_last_packet) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_of_last_packet;
+    case OGS_PFCP_USAGE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, usage_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_usage_information;
+    case OGS_PFCP_ETHERNET_TRAFFIC_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_deletion_response_t, ethernet_traffic_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_traffic_information;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_report_session_deletion_response =
 {
     OGS_TLV_COMPOUND,
@@ -2165,9 +4277,133 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_report_session_deletion_response =
         &ogs_pfcp_tlv_desc_usage_information,
         &ogs_pfcp_tlv_desc_ethernet_traffic_information,
         NULL,
-    }
+    },
+    find_tlv_usage_report_session_deletion_response
 };
 
+static ogs_tlv_desc_t *find_tlv_usage_report_session_report_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_URR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, urr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_urr_id;
+    case OGS_PFCP_UR_SEQN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, ur_seqn) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ur_seqn;
+    case OGS_PFCP_USAGE_REPORT_TRIGGER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, usage_report_trigger) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_usage_report_trigger;
+    case OGS_PFCP_START_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, start_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_start_time;
+    case OGS_PFCP_END_TIME_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, end_time) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_end_time;
+    case OGS_PFCP_VOLUME_MEASUREMENT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, volume_measurement) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_volume_measurement;
+    case OGS_PFCP_DURATION_MEASUREMENT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, duration_measurement) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_duration_measurement;
+    case OGS_PFCP_APPLICATION_DETECTION_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, application_detection_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_application_detection_information;
+    case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, ue_ip_address) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ue_ip_address;
+    case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, network_instance) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_network_instance;
+    case OGS_PFCP_TIME_OF_FIRST_PACKET_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, time_of_first_packet) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_of_first_packet;
+    case OGS_PFCP_TIME_OF_LAST_PACKET_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, time_of_last_packet) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_time_of_last_packet;
+    case OGS_PFCP_USAGE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, usage_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_usage_information;
+    case OGS_PFCP_QUERY_URR_REFERENCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, query_urr_reference) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_query_urr_reference;
+    case OGS_PFCP_EVENT_TIME_STAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 14;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, event_time_stamp) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_event_time_stamp;
+    case OGS_PFCP_ETHERNET_TRAFFIC_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_pfcp_tlv_usage_report_session_report_request_t, ethernet_traffic_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_traffic_information;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_report_session_report_request =
 {
     OGS_TLV_COMPOUND,
@@ -2194,9 +4430,35 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_usage_report_session_report_request =
         &ogs_pfcp_tlv_desc_event_time_stamp,
         &ogs_pfcp_tlv_desc_ethernet_traffic_information,
         NULL,
-    }
+    },
+    find_tlv_usage_report_session_report_request
 };
 
+static ogs_tlv_desc_t *find_tlv_downlink_data_report(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_PDR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_downlink_data_report_t, pdr_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_pdr_id;
+    case OGS_PFCP_DOWNLINK_DATA_SERVICE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_downlink_data_report_t, downlink_data_service_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_downlink_data_service_information;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_downlink_data_report =
 {
     OGS_TLV_COMPOUND,
@@ -2209,9 +4471,42 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_downlink_data_report =
         &ogs_pfcp_tlv_desc_pdr_id,
         &ogs_pfcp_tlv_desc_downlink_data_service_information,
         NULL,
-    }
+    },
+    find_tlv_downlink_data_report
 };
 
+static ogs_tlv_desc_t *find_tlv_create_bar(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_BAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_create_bar_t, bar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_bar_id;
+    case OGS_PFCP_DOWNLINK_DATA_NOTIFICATION_DELAY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_create_bar_t, downlink_data_notification_delay) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_downlink_data_notification_delay;
+    case OGS_PFCP_SUGGESTED_BUFFERING_PACKETS_COUNT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_create_bar_t, suggested_buffering_packets_count) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_suggested_buffering_packets_count;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_bar =
 {
     OGS_TLV_COMPOUND,
@@ -2225,9 +4520,42 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_bar =
         &ogs_pfcp_tlv_desc_downlink_data_notification_delay,
         &ogs_pfcp_tlv_desc_suggested_buffering_packets_count,
         NULL,
-    }
+    },
+    find_tlv_create_bar
 };
 
+static ogs_tlv_desc_t *find_tlv_update_bar_session_modification_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_BAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_bar_session_modification_request_t, bar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_bar_id;
+    case OGS_PFCP_DOWNLINK_DATA_NOTIFICATION_DELAY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_bar_session_modification_request_t, downlink_data_notification_delay) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_downlink_data_notification_delay;
+    case OGS_PFCP_SUGGESTED_BUFFERING_PACKETS_COUNT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_bar_session_modification_request_t, suggested_buffering_packets_count) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_suggested_buffering_packets_count;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_bar_session_modification_request =
 {
     OGS_TLV_COMPOUND,
@@ -2241,9 +4569,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_bar_session_modification_request =
         &ogs_pfcp_tlv_desc_downlink_data_notification_delay,
         &ogs_pfcp_tlv_desc_suggested_buffering_packets_count,
         NULL,
-    }
+    },
+    find_tlv_update_bar_session_modification_request
 };
 
+static ogs_tlv_desc_t *find_tlv_remove_bar(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_BAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_remove_bar_t, bar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_bar_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_bar =
 {
     OGS_TLV_COMPOUND,
@@ -2255,9 +4602,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_bar =
     {
         &ogs_pfcp_tlv_desc_bar_id,
         NULL,
-    }
+    },
+    find_tlv_remove_bar
 };
 
+static ogs_tlv_desc_t *find_tlv_error_indication_report(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_error_indication_report_t, remote_f_teid) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_f_teid;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_error_indication_report =
 {
     OGS_TLV_COMPOUND,
@@ -2269,9 +4635,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_error_indication_report =
     {
         &ogs_pfcp_tlv_desc_f_teid,
         NULL,
-    }
+    },
+    find_tlv_error_indication_report
 };
 
+static ogs_tlv_desc_t *find_tlv_user_plane_path_failure_report(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_REMOTE_GTP_U_PEER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_user_plane_path_failure_report_t, remote_gtp_u_peer_) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_remote_gtp_u_peer;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_user_plane_path_failure_report =
 {
     OGS_TLV_COMPOUND,
@@ -2283,13 +4668,88 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_user_plane_path_failure_report =
     {
         &ogs_pfcp_tlv_desc_remote_gtp_u_peer,
         NULL,
-    }
+    },
+    find_tlv_user_plane_path_failure_report
 };
 
-ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_traffic_endpoint =
+static ogs_tlv_desc_t *find_tlv_create_traffic_endpoint(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
 {
-    OGS_TLV_COMPOUND,
-    "Create Traffic Endpoint",
+    switch (type) {
+    case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, traffic_endpoint_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_traffic_endpoint_id;
+    case OGS_PFCP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, local_f_teid) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_f_teid;
+    case OGS_PFCP_NETWORK_INSTANCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, network_instance) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_network_instance;
+    case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, ue_ip_address) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ue_ip_address;
+    case OGS_PFCP_ETHERNET_PDU_SESSION_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, ethernet_pdu_session_information) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ethernet_pdu_session_information;
+    case OGS_PFCP_FRAMED_ROUTE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, framed_route) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_framed_route;
+    case OGS_PFCP_FRAMED_ROUTING_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, framed_routing) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_framed_routing;
+    case OGS_PFCP_FRAMED_IPV6_ROUTE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, framed_ipv6_route) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_framed_ipv6_route;
+    case OGS_PFCP_QFI_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_tlv_create_traffic_endpoint_t, qfi) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_qfi;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
+ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_traffic_endpoint =
+{
+    OGS_TLV_COMPOUND,
+    "Create Traffic Endpoint",
     OGS_PFCP_CREATE_TRAFFIC_ENDPOINT_TYPE,
     0,
     0,
@@ -2305,9 +4765,42 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_traffic_endpoint =
         &ogs_pfcp_tlv_desc_framed_ipv6_route,
         &ogs_pfcp_tlv_desc_qfi,
         NULL,
-    }
+    },
+    find_tlv_create_traffic_endpoint
 };
 
+static ogs_tlv_desc_t *find_tlv_created_traffic_endpoint(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_created_traffic_endpoint_t, traffic_endpoint_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_traffic_endpoint_id;
+    case OGS_PFCP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_created_traffic_endpoint_t, local_f_teid) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_f_teid;
+    case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_created_traffic_endpoint_t, ue_ip_address) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_ue_ip_address;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_created_traffic_endpoint =
 {
     OGS_TLV_COMPOUND,
@@ -2321,9 +4814,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_created_traffic_endpoint =
         &ogs_pfcp_tlv_desc_f_teid,
         &ogs_pfcp_tlv_desc_ue_ip_address,
         NULL,
-    }
+    },
+    find_tlv_created_traffic_endpoint
 };
 
+static ogs_tlv_desc_t *find_tlv_remove_traffic_endpoint(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_TRAFFIC_ENDPOINT_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_remove_traffic_endpoint_t, traffic_endpoint_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_traffic_endpoint_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_traffic_endpoint =
 {
     OGS_TLV_COMPOUND,
@@ -2335,9 +4847,56 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_traffic_endpoint =
     {
         &ogs_pfcp_tlv_desc_traffic_endpoint_id,
         NULL,
-    }
+    },
+    find_tlv_remove_traffic_endpoint
 };
 
+static ogs_tlv_desc_t *find_tlv_create_mar(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_MAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_create_mar_t, mar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mar_id;
+    case OGS_PFCP_STEERING_FUNCTIONALITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_create_mar_t, steering_functionality) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_steering_functionality;
+    case OGS_PFCP_STEERING_MODE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_create_mar_t, steering_mode) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_steering_mode;
+    case OGS_PFCP_ACCESS_FORWARDING_ACTION_INFORMATION_1_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_create_mar_t, access_forwarding_action_information_1) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_access_forwarding_action_information_1;
+    case OGS_PFCP_ACCESS_FORWARDING_ACTION_INFORMATION_2_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_create_mar_t, access_forwarding_action_information_2) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_access_forwarding_action_information_2;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_mar =
 {
     OGS_TLV_COMPOUND,
@@ -2353,9 +4912,28 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_create_mar =
         &ogs_pfcp_tlv_desc_access_forwarding_action_information_1,
         &ogs_pfcp_tlv_desc_access_forwarding_action_information_2,
         NULL,
-    }
+    },
+    find_tlv_create_mar
 };
 
+static ogs_tlv_desc_t *find_tlv_remove_mar(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_MAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_remove_mar_t, mar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mar_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_mar =
 {
     OGS_TLV_COMPOUND,
@@ -2367,9 +4945,70 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_remove_mar =
     {
         &ogs_pfcp_tlv_desc_mar_id,
         NULL,
-    }
+    },
+    find_tlv_remove_mar
 };
 
+static ogs_tlv_desc_t *find_tlv_update_mar(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_MAR_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_tlv_update_mar_t, mar_id) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_mar_id;
+    case OGS_PFCP_STEERING_FUNCTIONALITY_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_tlv_update_mar_t, steering_functionality) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_steering_functionality;
+    case OGS_PFCP_STEERING_MODE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_tlv_update_mar_t, steering_mode) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_steering_mode;
+    case OGS_PFCP_UPDATE_ACCESS_FORWARDING_ACTION_INFORMATION_1_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_tlv_update_mar_t, update_access_forwarding_action_information_1) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_update_access_forwarding_action_information_1;
+    case OGS_PFCP_UPDATE_ACCESS_FORWARDING_ACTION_INFORMATION_2_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_tlv_update_mar_t, update_access_forwarding_action_information_2) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_update_access_forwarding_action_information_2;
+    case OGS_PFCP_ACCESS_FORWARDING_ACTION_INFORMATION_1_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_tlv_update_mar_t, access_forwarding_action_information_1) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_access_forwarding_action_information_1;
+    case OGS_PFCP_ACCESS_FORWARDING_ACTION_INFORMATION_2_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_tlv_update_mar_t, access_forwarding_action_information_2) -
+            sizeof(ogs_tlv_presence_t);
+        return &ogs_pfcp_tlv_desc_access_forwarding_action_information_2;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_mar =
 {
     OGS_TLV_COMPOUND,
@@ -2387,9 +5026,27 @@ ogs_tlv_desc_t ogs_pfcp_tlv_desc_update_mar =
         &ogs_pfcp_tlv_desc_access_forwarding_action_information_1,
         &ogs_pfcp_tlv_desc_access_forwarding_action_information_2,
         NULL,
-    }
+    },
+    find_tlv_update_mar
 };
 
+static ogs_tlv_desc_t *find_msg_pfcp_heartbeat_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_heartbeat_request_t, recovery_time_stamp);
+        return &ogs_pfcp_tlv_desc_recovery_time_stamp;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_heartbeat_request =
 {
     OGS_TLV_MESSAGE,
@@ -2397,7 +5054,24 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_heartbeat_request =
     0, 0, 0, 0, {
         &ogs_pfcp_tlv_desc_recovery_time_stamp,
     NULL,
-}};
+}, find_msg_pfcp_heartbeat_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_heartbeat_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_heartbeat_response_t, recovery_time_stamp);
+        return &ogs_pfcp_tlv_desc_recovery_time_stamp;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_heartbeat_response =
 {
@@ -2406,7 +5080,24 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_heartbeat_response =
     0, 0, 0, 0, {
         &ogs_pfcp_tlv_desc_recovery_time_stamp,
     NULL,
-}};
+}, find_msg_pfcp_heartbeat_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_pfd_management_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_APPLICATION_ID_S_PFDS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_pfd_management_request_t, application_id_s_pfds);
+        return &ogs_pfcp_tlv_desc_application_id_s_pfds;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_pfd_management_request =
 {
@@ -2415,7 +5106,30 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_pfd_management_request =
     0, 0, 0, 0, {
         &ogs_pfcp_tlv_desc_application_id_s_pfds,
     NULL,
-}};
+}, find_msg_pfcp_pfd_management_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_pfd_management_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_pfd_management_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_OFFENDING_IE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_pfd_management_response_t, offending_ie);
+        return &ogs_pfcp_tlv_desc_offending_ie;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_pfd_management_response =
 {
@@ -2425,7 +5139,66 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_pfd_management_response =
         &ogs_pfcp_tlv_desc_cause,
         &ogs_pfcp_tlv_desc_offending_ie,
     NULL,
-}};
+}, find_msg_pfcp_pfd_management_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_association_setup_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_association_setup_request_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_association_setup_request_t, recovery_time_stamp);
+        return &ogs_pfcp_tlv_desc_recovery_time_stamp;
+    case OGS_PFCP_UP_FUNCTION_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_association_setup_request_t, up_function_features);
+        return &ogs_pfcp_tlv_desc_up_function_features;
+    case OGS_PFCP_CP_FUNCTION_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_association_setup_request_t, cp_function_features);
+        return &ogs_pfcp_tlv_desc_cp_function_features;
+    case OGS_PFCP_USER_PLANE_IP_RESOURCE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_association_setup_request_t, user_plane_ip_resource_information);
+        return &ogs_pfcp_tlv_desc_user_plane_ip_resource_information;
+    case OGS_PFCP_UE_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_association_setup_request_t, ue_ip_address_pool_identity);
+        return &ogs_pfcp_tlv_desc_ue_ip_address;
+    case OGS_PFCP_ALTERNATIVE_SMF_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_association_setup_request_t, alternative_smf_ip_address);
+        return &ogs_pfcp_tlv_desc_alternative_smf_ip_address;
+    case OGS_PFCP_SMF_SET_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_association_setup_request_t, smf_set_id);
+        return &ogs_pfcp_tlv_desc_smf_set_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_setup_request =
 {
@@ -2442,7 +5215,60 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_setup_request =
         &ogs_pfcp_tlv_desc_alternative_smf_ip_address,
         &ogs_pfcp_tlv_desc_smf_set_id,
     NULL,
-}};
+}, find_msg_pfcp_association_setup_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_association_setup_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_association_setup_response_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_association_setup_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_RECOVERY_TIME_STAMP_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_association_setup_response_t, recovery_time_stamp);
+        return &ogs_pfcp_tlv_desc_recovery_time_stamp;
+    case OGS_PFCP_UP_FUNCTION_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_association_setup_response_t, up_function_features);
+        return &ogs_pfcp_tlv_desc_up_function_features;
+    case OGS_PFCP_CP_FUNCTION_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_association_setup_response_t, cp_function_features);
+        return &ogs_pfcp_tlv_desc_cp_function_features;
+    case OGS_PFCP_USER_PLANE_IP_RESOURCE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_association_setup_response_t, user_plane_ip_resource_information);
+        return &ogs_pfcp_tlv_desc_user_plane_ip_resource_information;
+    case OGS_PFCP_ALTERNATIVE_SMF_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_association_setup_response_t, alternative_smf_ip_address);
+        return &ogs_pfcp_tlv_desc_alternative_smf_ip_address;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_setup_response =
 {
@@ -2458,7 +5284,66 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_setup_response =
         &ogs_tlv_desc_more4,
         &ogs_pfcp_tlv_desc_alternative_smf_ip_address,
     NULL,
-}};
+}, find_msg_pfcp_association_setup_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_association_update_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_association_update_request_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_UP_FUNCTION_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_association_update_request_t, up_function_features);
+        return &ogs_pfcp_tlv_desc_up_function_features;
+    case OGS_PFCP_CP_FUNCTION_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_association_update_request_t, cp_function_features);
+        return &ogs_pfcp_tlv_desc_cp_function_features;
+    case OGS_PFCP_PFCP_ASSOCIATION_RELEASE_REQUEST_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_association_update_request_t, pfcp_association_release_request);
+        return &ogs_pfcp_tlv_desc_pfcp_association_release_request;
+    case OGS_PFCP_GRACEFUL_RELEASE_PERIOD_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_association_update_request_t, graceful_release_period);
+        return &ogs_pfcp_tlv_desc_graceful_release_period;
+    case OGS_PFCP_USER_PLANE_IP_RESOURCE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_association_update_request_t, user_plane_ip_resource_information);
+        return &ogs_pfcp_tlv_desc_user_plane_ip_resource_information;
+    case OGS_PFCP_PFCPAUREQ_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_association_update_request_t, pfcpaureq_flags);
+        return &ogs_pfcp_tlv_desc_pfcpaureq_flags;
+    case OGS_PFCP_ALTERNATIVE_SMF_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_association_update_request_t, alternative_smf_ip_address);
+        return &ogs_pfcp_tlv_desc_alternative_smf_ip_address;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_update_request =
 {
@@ -2475,7 +5360,42 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_update_request =
         &ogs_pfcp_tlv_desc_pfcpaureq_flags,
         &ogs_pfcp_tlv_desc_alternative_smf_ip_address,
     NULL,
-}};
+}, find_msg_pfcp_association_update_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_association_update_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_association_update_response_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_association_update_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_UP_FUNCTION_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_association_update_response_t, up_function_features);
+        return &ogs_pfcp_tlv_desc_up_function_features;
+    case OGS_PFCP_CP_FUNCTION_FEATURES_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_association_update_response_t, cp_function_features);
+        return &ogs_pfcp_tlv_desc_cp_function_features;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_update_response =
 {
@@ -2487,7 +5407,24 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_update_response =
         &ogs_pfcp_tlv_desc_up_function_features,
         &ogs_pfcp_tlv_desc_cp_function_features,
     NULL,
-}};
+}, find_msg_pfcp_association_update_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_association_release_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_association_release_request_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_release_request =
 {
@@ -2496,7 +5433,30 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_release_request =
     0, 0, 0, 0, {
         &ogs_pfcp_tlv_desc_node_id,
     NULL,
-}};
+}, find_msg_pfcp_association_release_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_association_release_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_association_release_response_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_association_release_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_release_response =
 {
@@ -2506,7 +5466,18 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_association_release_response =
         &ogs_pfcp_tlv_desc_node_id,
         &ogs_pfcp_tlv_desc_cause,
     NULL,
-}};
+}, find_msg_pfcp_association_release_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_version_not_supported_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_version_not_supported_response =
 {
@@ -2514,7 +5485,36 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_version_not_supported_response =
     "PFCP Version Not Supported Response",
     0, 0, 0, 0, {
     NULL,
-}};
+}, find_msg_pfcp_version_not_supported_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_node_report_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_node_report_request_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_NODE_REPORT_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_node_report_request_t, node_report_type);
+        return &ogs_pfcp_tlv_desc_node_report_type;
+    case OGS_PFCP_USER_PLANE_PATH_FAILURE_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_node_report_request_t, user_plane_path_failure_report);
+        return &ogs_pfcp_tlv_desc_user_plane_path_failure_report;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_node_report_request =
 {
@@ -2525,7 +5525,36 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_node_report_request =
         &ogs_pfcp_tlv_desc_node_report_type,
         &ogs_pfcp_tlv_desc_user_plane_path_failure_report,
     NULL,
-}};
+}, find_msg_pfcp_node_report_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_node_report_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_node_report_response_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_node_report_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_OFFENDING_IE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_node_report_response_t, offending_ie);
+        return &ogs_pfcp_tlv_desc_offending_ie;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_node_report_response =
 {
@@ -2536,7 +5565,30 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_node_report_response =
         &ogs_pfcp_tlv_desc_cause,
         &ogs_pfcp_tlv_desc_offending_ie,
     NULL,
-}};
+}, find_msg_pfcp_node_report_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_set_deletion_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_set_deletion_request_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_FQ_CSID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_set_deletion_request_t, sgw_c_fq_csid);
+        return &ogs_pfcp_tlv_desc_fq_csid;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_set_deletion_request =
 {
@@ -2552,7 +5604,36 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_set_deletion_request =
         &ogs_pfcp_tlv_desc_fq_csid,
         &ogs_pfcp_tlv_desc_fq_csid,
     NULL,
-}};
+}, find_msg_pfcp_session_set_deletion_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_set_deletion_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_set_deletion_response_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_set_deletion_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_OFFENDING_IE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_session_set_deletion_response_t, offending_ie);
+        return &ogs_pfcp_tlv_desc_offending_ie;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_set_deletion_response =
 {
@@ -2563,7 +5644,108 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_set_deletion_response =
         &ogs_pfcp_tlv_desc_cause,
         &ogs_pfcp_tlv_desc_offending_ie,
     NULL,
-}};
+}, find_msg_pfcp_session_set_deletion_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_establishment_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_F_SEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, cp_f_seid);
+        return &ogs_pfcp_tlv_desc_f_seid;
+    case OGS_PFCP_CREATE_PDR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, create_pdr);
+        return &ogs_pfcp_tlv_desc_create_pdr;
+    case OGS_PFCP_CREATE_FAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, create_far);
+        return &ogs_pfcp_tlv_desc_create_far;
+    case OGS_PFCP_CREATE_URR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, create_urr);
+        return &ogs_pfcp_tlv_desc_create_urr;
+    case OGS_PFCP_CREATE_QER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, create_qer);
+        return &ogs_pfcp_tlv_desc_create_qer;
+    case OGS_PFCP_CREATE_BAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, create_bar);
+        return &ogs_pfcp_tlv_desc_create_bar;
+    case OGS_PFCP_CREATE_TRAFFIC_ENDPOINT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, create_traffic_endpoint);
+        return &ogs_pfcp_tlv_desc_create_traffic_endpoint;
+    case OGS_PFCP_PDN_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 12;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, pdn_type);
+        return &ogs_pfcp_tlv_desc_pdn_type;
+    case OGS_PFCP_FQ_CSID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, sgw_c_fq_csid);
+        return &ogs_pfcp_tlv_desc_fq_csid;
+    case OGS_PFCP_USER_PLANE_INACTIVITY_TIMER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 18;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, user_plane_inactivity_timer);
+        return &ogs_pfcp_tlv_desc_user_plane_inactivity_timer;
+    case OGS_PFCP_USER_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 19;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, user_id);
+        return &ogs_pfcp_tlv_desc_user_id;
+    case OGS_PFCP_TRACE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 20;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, trace_information);
+        return &ogs_pfcp_tlv_desc_trace_information;
+    case OGS_PFCP_APN_DNN_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, apn_dnn);
+        return &ogs_pfcp_tlv_desc_apn_dnn;
+    case OGS_PFCP_CREATE_MAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 22;
+        *offset = offsetof(ogs_pfcp_session_establishment_request_t, create_mar);
+        return &ogs_pfcp_tlv_desc_create_mar;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_establishment_request =
 {
@@ -2594,7 +5776,78 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_establishment_request =
         &ogs_pfcp_tlv_desc_apn_dnn,
         &ogs_pfcp_tlv_desc_create_mar,
     NULL,
-}};
+}, find_msg_pfcp_session_establishment_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_establishment_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_OFFENDING_IE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, offending_ie);
+        return &ogs_pfcp_tlv_desc_offending_ie;
+    case OGS_PFCP_F_SEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, up_f_seid);
+        return &ogs_pfcp_tlv_desc_f_seid;
+    case OGS_PFCP_CREATED_PDR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, created_pdr);
+        return &ogs_pfcp_tlv_desc_created_pdr;
+    case OGS_PFCP_LOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, load_control_information);
+        return &ogs_pfcp_tlv_desc_load_control_information;
+    case OGS_PFCP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, overload_control_information);
+        return &ogs_pfcp_tlv_desc_overload_control_information;
+    case OGS_PFCP_FQ_CSID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, sgw_u_fq_csid);
+        return &ogs_pfcp_tlv_desc_fq_csid;
+    case OGS_PFCP_FAILED_RULE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, failed_rule_id);
+        return &ogs_pfcp_tlv_desc_failed_rule_id;
+    case OGS_PFCP_CREATED_TRAFFIC_ENDPOINT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_session_establishment_response_t, created_traffic_endpoint);
+        return &ogs_pfcp_tlv_desc_created_traffic_endpoint;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_establishment_response =
 {
@@ -2614,7 +5867,192 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_establishment_response =
         &ogs_pfcp_tlv_desc_failed_rule_id,
         &ogs_pfcp_tlv_desc_created_traffic_endpoint,
     NULL,
-}};
+}, find_msg_pfcp_session_establishment_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_modification_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_F_SEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, cp_f_seid);
+        return &ogs_pfcp_tlv_desc_f_seid;
+    case OGS_PFCP_REMOVE_PDR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, remove_pdr);
+        return &ogs_pfcp_tlv_desc_remove_pdr;
+    case OGS_PFCP_REMOVE_FAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, remove_far);
+        return &ogs_pfcp_tlv_desc_remove_far;
+    case OGS_PFCP_REMOVE_URR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, remove_urr);
+        return &ogs_pfcp_tlv_desc_remove_urr;
+    case OGS_PFCP_REMOVE_QER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, remove_qer);
+        return &ogs_pfcp_tlv_desc_remove_qer;
+    case OGS_PFCP_REMOVE_BAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, remove_bar);
+        return &ogs_pfcp_tlv_desc_remove_bar;
+    case OGS_PFCP_REMOVE_TRAFFIC_ENDPOINT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 10;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, remove_traffic_endpoint);
+        return &ogs_pfcp_tlv_desc_remove_traffic_endpoint;
+    case OGS_PFCP_CREATE_PDR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 11;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, create_pdr);
+        return &ogs_pfcp_tlv_desc_create_pdr;
+    case OGS_PFCP_CREATE_FAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 13;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, create_far);
+        return &ogs_pfcp_tlv_desc_create_far;
+    case OGS_PFCP_CREATE_URR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 15;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, create_urr);
+        return &ogs_pfcp_tlv_desc_create_urr;
+    case OGS_PFCP_CREATE_QER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 17;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, create_qer);
+        return &ogs_pfcp_tlv_desc_create_qer;
+    case OGS_PFCP_CREATE_BAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 19;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, create_bar);
+        return &ogs_pfcp_tlv_desc_create_bar;
+    case OGS_PFCP_CREATE_TRAFFIC_ENDPOINT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 20;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, create_traffic_endpoint);
+        return &ogs_pfcp_tlv_desc_create_traffic_endpoint;
+    case OGS_PFCP_UPDATE_PDR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 21;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, update_pdr);
+        return &ogs_pfcp_tlv_desc_update_pdr;
+    case OGS_PFCP_UPDATE_FAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 23;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, update_far);
+        return &ogs_pfcp_tlv_desc_update_far;
+    case OGS_PFCP_UPDATE_URR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 25;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, update_urr);
+        return &ogs_pfcp_tlv_desc_update_urr;
+    case OGS_PFCP_UPDATE_QER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 27;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, update_qer);
+        return &ogs_pfcp_tlv_desc_update_qer;
+    case OGS_PFCP_UPDATE_BAR_SESSION_MODIFICATION_REQUEST_TYPE:
+        if (instance != 0)
+            break;
+        *index = 29;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, update_bar);
+        return &ogs_pfcp_tlv_desc_update_bar_session_modification_request;
+    case OGS_PFCP_UPDATE_TRAFFIC_ENDPOINT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 30;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, update_traffic_endpoint);
+        return &ogs_pfcp_tlv_desc_update_traffic_endpoint;
+    case OGS_PFCP_PFCPSMREQ_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 31;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, pfcpsmreq_flags);
+        return &ogs_pfcp_tlv_desc_pfcpsmreq_flags;
+    case OGS_PFCP_QUERY_URR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 32;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, query_urr);
+        return &ogs_pfcp_tlv_desc_query_urr;
+    case OGS_PFCP_FQ_CSID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 33;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, pgw_c_fq_csid);
+        return &ogs_pfcp_tlv_desc_fq_csid;
+    case OGS_PFCP_USER_PLANE_INACTIVITY_TIMER_TYPE:
+        if (instance != 0)
+            break;
+        *index = 38;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, user_plane_inactivity_timer);
+        return &ogs_pfcp_tlv_desc_user_plane_inactivity_timer;
+    case OGS_PFCP_QUERY_URR_REFERENCE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 39;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, query_urr_reference);
+        return &ogs_pfcp_tlv_desc_query_urr_reference;
+    case OGS_PFCP_TRACE_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 40;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, trace_information);
+        return &ogs_pfcp_tlv_desc_trace_information;
+    case OGS_PFCP_REMOVE_MAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 41;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, remove_mar);
+        return &ogs_pfcp_tlv_desc_remove_mar;
+    case OGS_PFCP_UPDATE_MAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 42;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, update_mar);
+        return &ogs_pfcp_tlv_desc_update_mar;
+    case OGS_PFCP_CREATE_MAR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 43;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, create_mar);
+        return &ogs_pfcp_tlv_desc_create_mar;
+    case OGS_PFCP_NODE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 44;
+        *offset = offsetof(ogs_pfcp_session_modification_request_t, node_id);
+        return &ogs_pfcp_tlv_desc_node_id;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_modification_request =
 {
@@ -2667,7 +6105,72 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_modification_request =
         &ogs_pfcp_tlv_desc_create_mar,
         &ogs_pfcp_tlv_desc_node_id,
     NULL,
-}};
+}, find_msg_pfcp_session_modification_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_modification_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_OFFENDING_IE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, offending_ie);
+        return &ogs_pfcp_tlv_desc_offending_ie;
+    case OGS_PFCP_CREATED_PDR_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, created_pdr);
+        return &ogs_pfcp_tlv_desc_created_pdr;
+    case OGS_PFCP_LOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, load_control_information);
+        return &ogs_pfcp_tlv_desc_load_control_information;
+    case OGS_PFCP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, overload_control_information);
+        return &ogs_pfcp_tlv_desc_overload_control_information;
+    case OGS_PFCP_USAGE_REPORT_SESSION_MODIFICATION_RESPONSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, usage_report);
+        return &ogs_pfcp_tlv_desc_usage_report_session_modification_response;
+    case OGS_PFCP_FAILED_RULE_ID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, failed_rule_id);
+        return &ogs_pfcp_tlv_desc_failed_rule_id;
+    case OGS_PFCP_ADDITIONAL_USAGE_REPORTS_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, additional_usage_reports_information);
+        return &ogs_pfcp_tlv_desc_additional_usage_reports_information;
+    case OGS_PFCP_CREATED_TRAFFIC_ENDPOINT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 9;
+        *offset = offsetof(ogs_pfcp_session_modification_response_t, created_updated_traffic_endpoint);
+        return &ogs_pfcp_tlv_desc_created_traffic_endpoint;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_modification_response =
 {
@@ -2685,7 +6188,18 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_modification_response =
         &ogs_pfcp_tlv_desc_additional_usage_reports_information,
         &ogs_pfcp_tlv_desc_created_traffic_endpoint,
     NULL,
-}};
+}, find_msg_pfcp_session_modification_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_deletion_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_deletion_request =
 {
@@ -2693,7 +6207,48 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_deletion_request =
     "PFCP Session Deletion Request",
     0, 0, 0, 0, {
     NULL,
-}};
+}, find_msg_pfcp_session_deletion_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_deletion_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_deletion_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_OFFENDING_IE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_deletion_response_t, offending_ie);
+        return &ogs_pfcp_tlv_desc_offending_ie;
+    case OGS_PFCP_LOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_session_deletion_response_t, load_control_information);
+        return &ogs_pfcp_tlv_desc_load_control_information;
+    case OGS_PFCP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_session_deletion_response_t, overload_control_information);
+        return &ogs_pfcp_tlv_desc_overload_control_information;
+    case OGS_PFCP_USAGE_REPORT_SESSION_DELETION_RESPONSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_session_deletion_response_t, usage_report);
+        return &ogs_pfcp_tlv_desc_usage_report_session_deletion_response;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_deletion_response =
 {
@@ -2706,7 +6261,72 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_deletion_response =
         &ogs_pfcp_tlv_desc_overload_control_information,
         &ogs_pfcp_tlv_desc_usage_report_session_deletion_response,
     NULL,
-}};
+}, find_msg_pfcp_session_deletion_response };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_report_request(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_REPORT_TYPE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, report_type);
+        return &ogs_pfcp_tlv_desc_report_type;
+    case OGS_PFCP_DOWNLINK_DATA_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, downlink_data_report);
+        return &ogs_pfcp_tlv_desc_downlink_data_report;
+    case OGS_PFCP_USAGE_REPORT_SESSION_REPORT_REQUEST_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, usage_report);
+        return &ogs_pfcp_tlv_desc_usage_report_session_report_request;
+    case OGS_PFCP_ERROR_INDICATION_REPORT_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, error_indication_report);
+        return &ogs_pfcp_tlv_desc_error_indication_report;
+    case OGS_PFCP_LOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, load_control_information);
+        return &ogs_pfcp_tlv_desc_load_control_information;
+    case OGS_PFCP_OVERLOAD_CONTROL_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, overload_control_information);
+        return &ogs_pfcp_tlv_desc_overload_control_information;
+    case OGS_PFCP_ADDITIONAL_USAGE_REPORTS_INFORMATION_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, additional_usage_reports_information);
+        return &ogs_pfcp_tlv_desc_additional_usage_reports_information;
+    case OGS_PFCP_PFCPSRREQ_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 7;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, pfcpsrreq_flags);
+        return &ogs_pfcp_tlv_desc_pfcpsrreq_flags;
+    case OGS_PFCP_F_SEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 8;
+        *offset = offsetof(ogs_pfcp_session_report_request_t, old_cp_f_seid);
+        return &ogs_pfcp_tlv_desc_f_seid;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_report_request =
 {
@@ -2723,7 +6343,60 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_report_request =
         &ogs_pfcp_tlv_desc_pfcpsrreq_flags,
         &ogs_pfcp_tlv_desc_f_seid,
     NULL,
-}};
+}, find_msg_pfcp_session_report_request };
+
+static ogs_tlv_desc_t *find_msg_pfcp_session_report_response(
+        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)
+{
+    switch (type) {
+    case OGS_PFCP_CAUSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 0;
+        *offset = offsetof(ogs_pfcp_session_report_response_t, cause);
+        return &ogs_pfcp_tlv_desc_cause;
+    case OGS_PFCP_OFFENDING_IE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 1;
+        *offset = offsetof(ogs_pfcp_session_report_response_t, offending_ie);
+        return &ogs_pfcp_tlv_desc_offending_ie;
+    case OGS_PFCP_UPDATE_BAR_PFCP_SESSION_REPORT_RESPONSE_TYPE:
+        if (instance != 0)
+            break;
+        *index = 2;
+        *offset = offsetof(ogs_pfcp_session_report_response_t, update_bar);
+        return &ogs_pfcp_tlv_desc_update_bar_pfcp_session_report_response;
+    case OGS_PFCP_PFCPSRRSP_FLAGS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 3;
+        *offset = offsetof(ogs_pfcp_session_report_response_t, pfcpsrrsp_flags);
+        return &ogs_pfcp_tlv_desc_pfcpsrrsp_flags;
+    case OGS_PFCP_F_SEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 4;
+        *offset = offsetof(ogs_pfcp_session_report_response_t, cp_f_seid);
+        return &ogs_pfcp_tlv_desc_f_seid;
+    case OGS_PFCP_F_TEID_TYPE:
+        if (instance != 0)
+            break;
+        *index = 5;
+        *offset = offsetof(ogs_pfcp_session_report_response_t, n4_u_f_teid);
+        return &ogs_pfcp_tlv_desc_f_teid;
+    case OGS_PFCP_ALTERNATIVE_SMF_IP_ADDRESS_TYPE:
+        if (instance != 0)
+            break;
+        *index = 6;
+        *offset = offsetof(ogs_pfcp_session_report_response_t, alternative_smf_ip_address);
+        return &ogs_pfcp_tlv_desc_alternative_smf_ip_address;
+    default:
+        break;
+    }
+
+    return NULL;
+}
 
 ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_report_response =
 {
@@ -2738,7 +6411,7 @@ ogs_tlv_desc_t ogs_pfcp_msg_desc_pfcp_session_report_response =
         &ogs_pfcp_tlv_desc_f_teid,
         &ogs_pfcp_tlv_desc_alternative_smf_ip_address,
     NULL,
-}};
+}, find_msg_pfcp_session_report_response };
 
 
 int ogs_pfcp_parse_msg(ogs_pfcp_message_t *pfcp_message, ogs_pkbuf_t *pkbuf)
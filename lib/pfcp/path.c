@@ -329,15 +329,13 @@ void ogs_pfcp_send_g_pdu(ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *sendbuf)
     /* Send G-PDU */
     ogs_debug("SEND G-PDU to Peer[%s] : TEID[0x%x]",
         OGS_ADDR(&gnode->addr, buf), far->outer_header_creation.teid);
-    rv = ogs_gtp_sendto(gnode, sendbuf);
+    rv = ogs_gtp_sendto_burst(gnode, sendbuf);
     if (rv != OGS_OK) {
         if (ogs_socket_errno != OGS_EAGAIN) {
             ogs_error("SEND G-PDU to Peer[%s] : TEID[0x%x]",
                 OGS_ADDR(&gnode->addr, buf), far->outer_header_creation.teid);
         }
     }
-
-    ogs_pkbuf_free(sendbuf);
 }
 
 void ogs_pfcp_send_end_marker(ogs_pfcp_pdr_t *pdr)
@@ -435,6 +433,7 @@ void ogs_pfcp_send_buffered_packet(ogs_pfcp_pdr_t *pdr)
     if (far && far->gnode) {
         if (far->apply_action & OGS_PFCP_APPLY_ACTION_FORW) {
             for (i = 0; i < far->num_of_buffered_packet; i++) {
+                ogs_pfcp_up_measure_pdr(pdr, far->buffered_packet[i]->len);
                 ogs_pfcp_send_g_pdu(pdr, far->buffered_packet[i]);
             }
             far->num_of_buffered_packet = 0;
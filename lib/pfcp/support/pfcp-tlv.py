@@ -95,6 +95,53 @@ def v_upper(v):
 def v_lower(v):
     return re.sub('3gpp', '', re.sub('\'', '_', re.sub('/', '_', re.sub('-', '_', re.sub(' ', '_', v)))).lower())
 
+def output_find_to_file(f, name, struct, children, compound):
+    # children : (type macro, instance, member, descriptor, index)
+    types = []
+    cases = {}
+    for (t, instance, member, desc, index) in children:
+        if t not in cases:
+            types.append(t)
+            cases[t] = []
+        if instance in [c[0] for c in cases[t]]:
+            continue
+        cases[t].append((instance, member, desc, index))
+
+    f.write("static ogs_tlv_desc_t *%s(\n" % name)
+    f.write("        uint32_t type, uint8_t instance, uint8_t *index, uint32_t *offset)\n")
+    f.write("{\n")
+    f.write("    switch (type) {\n")
+    for t in types:
+        f.write("    case %s:\n" % t)
+        for (instance, member, desc, index) in cases[t]:
+            f.write("        if (instance != %s)\n" % instance)
+            f.write("            break;\n")
+            f.write("        *index = %d;\n" % index)
+            if compound:
+                f.write("        *offset = offsetof(%s, %s) -\n" % (struct, member))
+                f.write("            sizeof(ogs_tlv_presence_t);\n")
+            else:
+                f.write("        *offset = offsetof(%s, %s);\n" % (struct, member))
+            f.write("        return &%s;\n" % desc)
+    f.write("    default:\n")
+    f.write("        break;\n")
+    f.write("    }\n")
+    f.write("\n")
+    f.write("    return NULL;\n")
+    f.write("}\n\n")
+
+def find_children(ies_list):
+    children = []
+    index = 0
+    for ies in ies_list:
+        children.append(("OGS_PFCP_%s_TYPE" % v_upper(ies["ie_type"]), "0",
+            v_lower(ies["ie_value"]),
+            "ogs_pfcp_tlv_desc_%s" % v_lower(ies["ie_type"]), index))
+        index += 1
+        if type_list[ies["ie_type"]]["max_tlv_more"] != "0":
+            index += 1
+    return children
+
 def get_cells(cells):
     note = cells[0].text.encode('ascii', 'ignore')
     if note.find('NOTE') != -1:
@@ -638,10 +685,14 @@ for (k, v) in sorted_type_list:
         f.write("    0,\n")
     f.write("    0,\n")
     f.write("    sizeof(ogs_pfcp_tlv_%s_t),\n" % v_lower(k))
-    f.write("    { NULL }\n")
+    f.write("    { NULL },\n")
+    f.write("    NULL\n")
     f.write("};\n\n")
 
 for (k, v) in sorted_group_list:
+    output_find_to_file(f, "find_tlv_%s" % v_lower(k),
+            "ogs_pfcp_tlv_%s_t" % v_lower(k),
+            find_children(group_list[k]["ies"]), True)
     f.write("ogs_tlv_desc_t ogs_pfcp_tlv_desc_%s =\n" % v_lower(k))
     f.write("{\n")
     f.write("    OGS_TLV_COMPOUND,\n")
@@ -656,11 +707,15 @@ for (k, v) in sorted_group_list:
         if type_list[ies["ie_type"]]["max_tlv_more"] != "0":
             f.write("        &ogs_tlv_desc_more" + str(int(ies["tlv_more"])+1) + ",\n")
     f.write("        NULL,\n")
-    f.write("    }\n")
+    f.write("    },\n")
+    f.write("    find_tlv_%s\n" % v_lower(k))
     f.write("};\n\n")
 
 for (k, v) in sorted_msg_list:
     if "ies" in msg_list[k]:
+        output_find_to_file(f, "find_msg_%s" % v_lower(k),
+                "ogs_%s_t" % v_lower(k),
+                find_children(msg_list[k]["ies"]), False)
         f.write("ogs_tlv_desc_t ogs_pfcp_msg_desc_%s =\n" % v_lower(k))
         f.write("{\n")
         f.write("    OGS_TLV_MESSAGE,\n")
@@ -671,7 +726,7 @@ for (k, v) in sorted_msg_list:
             if type_list[ies["ie_type"]]["max_tlv_more"] != "0":
                 f.write("        &ogs_tlv_desc_more" + str(int(ies["tlv_more"])+1) + ",\n")
         f.write("    NULL,\n")
-        f.write("}};\n\n")
+        f.write("}, find_msg_%s };\n\n" % v_lower(k))
 f.write("\n")
 
 f.write("""int ogs_pfcp_parse_msg(ogs_pfcp_message_t *pfcp_message, ogs_pkbuf_t *pkbuf)
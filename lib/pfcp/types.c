@@ -405,3 +405,101 @@ int16_t ogs_pfcp_parse_bitrate(
 
     return size;
 }
+
+int16_t ogs_pfcp_parse_volume(
+        ogs_pfcp_volume_threshold_t *volume, ogs_tlv_octet_t *octet)
+{
+    ogs_pfcp_volume_threshold_t *source = NULL;
+    int16_t size = 0;
+
+    ogs_assert(volume);
+    ogs_assert(octet);
+
+    /* The IE comes from the peer : report a malformed one with -1 */
+    if (octet->len < 1) {
+        ogs_error("Invalid Volume length [%d]", octet->len);
+        return -1;
+    }
+
+    memset(volume, 0, sizeof(ogs_pfcp_volume_threshold_t));
+
+    source = (ogs_pfcp_volume_threshold_t *)octet->data;
+    volume->flags = source->flags;
+    size++;
+
+    if (volume->tovol) {
+        if (size + sizeof(volume->total_volume) > octet->len)
+            goto invalid;
+        memcpy(&volume->total_volume, (unsigned char *)octet->data + size,
+                sizeof(volume->total_volume));
+        volume->total_volume = be64toh(volume->total_volume);
+        size += sizeof(volume->total_volume);
+    }
+    if (volume->ulvol) {
+        if (size + sizeof(volume->uplink_volume) > octet->len)
+            goto invalid;
+        memcpy(&volume->uplink_volume, (unsigned char *)octet->data + size,
+                sizeof(volume->uplink_volume));
+        volume->uplink_volume = be64toh(volume->uplink_volume);
+        size += sizeof(volume->uplink_volume);
+    }
+    if (volume->dlvol) {
+        if (size + sizeof(volume->downlink_volume) > octet->len)
+            goto invalid;
+        memcpy(&volume->downlink_volume, (unsigned char *)octet->data + size,
+                sizeof(volume->downlink_volume));
+        volume->downlink_volume = be64toh(volume->downlink_volume);
+        size += sizeof(volume->downlink_volume);
+    }
+
+    if (size != octet->len)
+        goto invalid;
+
+    return size;
+
+invalid:
+    ogs_error("Invalid Volume [flags:0x%x, length:%d]",
+            volume->flags, octet->len);
+    return -1;
+}
+
+int16_t ogs_pfcp_build_volume_measurement(ogs_tlv_octet_t *octet,
+        ogs_pfcp_volume_measurement_t *volume, void *data, int data_len)
+{
+    uint64_t value[6];
+    uint8_t present[6];
+    int16_t size = 0;
+    int i;
+
+    ogs_assert(volume);
+    ogs_assert(octet);
+    ogs_assert(data);
+    ogs_assert(data_len >= OGS_PFCP_VOLUME_MEASUREMENT_LEN);
+
+    octet->data = data;
+
+    value[0] = volume->total_volume;        present[0] = volume->tovol;
+    value[1] = volume->uplink_volume;       present[1] = volume->ulvol;
+    value[2] = volume->downlink_volume;     present[2] = volume->dlvol;
+    value[3] = volume->total_n_packets;     present[3] = volume->tonop;
+    value[4] = volume->uplink_n_packets;    present[4] = volume->ulnop;
+    value[5] = volume->downlink_n_packets;  present[5] = volume->dlnop;
+
+    *((unsigned char *)octet->data + size) = volume->flags;
+    size++;
+
+    for (i = 0; i < 6; i++) {
+        uint64_t be;
+
+        if (!present[i])
+            continue;
+
+        be = htobe64(value[i]);
+        memcpy((unsigned char *)octet->data + size, &be, sizeof(be));
+        size += sizeof(be);
+    }
+
+    octet->len = size;
+
+    return octet->len;
+}
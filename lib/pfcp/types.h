@@ -750,6 +750,181 @@ ED4(uint8_t     spare:5;,
     };
 } __attribute__ ((packed)) ogs_pfcp_smreq_flags_t;
 
+/*
+ * 8.2.40 Measurement Method
+ *
+ * Octet 5 shall be encoded as follows:
+ *
+ * - Bit 1 – DURAT (Duration): when set to 1, this indicates a request
+ *   for measuring the duration of the traffic.
+ * - Bit 2 – VOLUM (Volume): when set to 1, this indicates a request
+ *   for measuring the volume of the traffic.
+ * - Bit 3 – EVENT (Event): when set to 1, this indicates a request
+ *   for measuring the events.
+ * - Bit 4 to 8: Spare, for future use and set to 0.
+ */
+typedef struct ogs_pfcp_measurement_method_s {
+    union {
+        struct {
+ED4(uint8_t     spare:5;,
+    uint8_t     event:1;,
+    uint8_t     volume:1;,
+    uint8_t     duration:1;)
+        };
+        uint8_t value;
+    };
+} __attribute__ ((packed)) ogs_pfcp_measurement_method_t;
+
+/*
+ * 8.2.19 Reporting Triggers
+ *
+ * Octet 5 shall be encoded as follows:
+ *
+ * - Bit 1 – PERIO (Periodic Reporting)
+ * - Bit 2 – VOLTH (Volume Threshold)
+ * - Bit 3 – TIMTH (Time Threshold)
+ * - Bit 4 – QUHTI (Quota Holding Time)
+ * - Bit 5 – START (Start of Traffic)
+ * - Bit 6 – STOPT (Stop of Traffic)
+ * - Bit 7 – DROTH (Dropped DL Traffic Threshold)
+ * - Bit 8 – LIUSA (Linked Usage Reporting)
+ */
+typedef struct ogs_pfcp_reporting_triggers_s {
+    union {
+        struct {
+ED8(uint8_t     linked_usage_reporting:1;,
+    uint8_t     dropped_dl_traffic_threshold:1;,
+    uint8_t     stop_of_traffic:1;,
+    uint8_t     start_of_traffic:1;,
+    uint8_t     quota_holding_time:1;,
+    uint8_t     time_threshold:1;,
+    uint8_t     volume_threshold:1;,
+    uint8_t     periodic_reporting:1;)
+        };
+        uint8_t value;
+    };
+} __attribute__ ((packed)) ogs_pfcp_reporting_triggers_t;
+
+/*
+ * 8.2.13 Volume Threshold
+ *
+ * Octet 5 shall be encoded as follows:
+ *
+ * - Bit 1 – TOVOL: If this bit is set to "1", then the Total Volume field
+ *   shall be present.
+ * - Bit 2 – ULVOL: If this bit is set to "1", then the Uplink Volume field
+ *   shall be present.
+ * - Bit 3 – DLVOL: If this bit is set to "1", then the Downlink Volume field
+ *   shall be present.
+ * - Bit 4 to 8: Spare, for future use and set to 0.
+ *
+ * The Total Volume, Uplink Volume and Downlink Volume fields shall be
+ * encoded as an Unsigned64 binary integer value.
+ * They shall contain the total, uplink or downlink number of octets
+ * respectively.
+ */
+typedef struct ogs_pfcp_volume_threshold_s {
+    union {
+        struct {
+ED4(uint8_t     spare:5;,
+    uint8_t     dlvol:1;,
+    uint8_t     ulvol:1;,
+    uint8_t     tovol:1;)
+        };
+        uint8_t flags;
+    };
+
+    uint64_t total_volume;
+    uint64_t uplink_volume;
+    uint64_t downlink_volume;
+} __attribute__ ((packed)) ogs_pfcp_volume_threshold_t;
+
+int16_t ogs_pfcp_parse_volume(
+        ogs_pfcp_volume_threshold_t *volume, ogs_tlv_octet_t *octet);
+
+/*
+ * 8.2.41 Usage Report Trigger
+ *
+ * Octet 5 : IMMER DROTH STOPT START QUHTI TIMTH VOLTH PERIO
+ * Octet 6 : EVETH MACAR ENVCL MONIT TERMR LIUSA TIMQU VOLQU
+ * Octet 7 : Spare EVEQU
+ */
+#define OGS_PFCP_USAGE_REPORT_TRIGGER_LEN 3
+typedef struct ogs_pfcp_usage_report_trigger_s {
+    union {
+        struct {
+ED8(uint8_t     immediate_report:1;,
+    uint8_t     dropped_dl_traffic_threshold:1;,
+    uint8_t     stop_of_traffic:1;,
+    uint8_t     start_of_traffic:1;,
+    uint8_t     quota_holding_time:1;,
+    uint8_t     time_threshold:1;,
+    uint8_t     volume_threshold:1;,
+    uint8_t     periodic_reporting:1;)
+        };
+        uint8_t reptri_5;
+    };
+    union {
+        struct {
+ED8(uint8_t     event_threshold:1;,
+    uint8_t     mac_addresses_reporting:1;,
+    uint8_t     envelope_closure:1;,
+    uint8_t     monitoring_time:1;,
+    uint8_t     termination_report:1;,
+    uint8_t     linked_usage_reporting:1;,
+    uint8_t     time_quota:1;,
+    uint8_t     volume_quota:1;)
+        };
+        uint8_t reptri_6;
+    };
+    union {
+        struct {
+ED2(uint8_t     spare:7;,
+    uint8_t     event_quota:1;)
+        };
+        uint8_t reptri_7;
+    };
+} __attribute__ ((packed)) ogs_pfcp_usage_report_trigger_t;
+
+/*
+ * 8.2.44 Volume Measurement
+ *
+ * Octet 5 shall be encoded as follows:
+ *
+ * - Bit 1 – TOVOL: Total Volume field present
+ * - Bit 2 – ULVOL: Uplink Volume field present
+ * - Bit 3 – DLVOL: Downlink Volume field present
+ * - Bit 4 – TONOP: Total Number of Packets field present
+ * - Bit 5 – ULNOP: Uplink Number of Packets field present
+ * - Bit 6 – DLNOP: Downlink Number of Packets field present
+ * - Bit 7 to 8: Spare, for future use and set to 0.
+ */
+#define OGS_PFCP_VOLUME_MEASUREMENT_LEN (1 + 8 * 6)
+typedef struct ogs_pfcp_volume_measurement_s {
+    union {
+        struct {
+ED7(uint8_t     spare:2;,
+    uint8_t     dlnop:1;,
+    uint8_t     ulnop:1;,
+    uint8_t     tonop:1;,
+    uint8_t     dlvol:1;,
+    uint8_t     ulvol:1;,
+    uint8_t     tovol:1;)
+        };
+        uint8_t flags;
+    };
+
+    uint64_t total_volume;
+    uint64_t uplink_volume;
+    uint64_t downlink_volume;
+    uint64_t total_n_packets;
+    uint64_t uplink_n_packets;
+    uint64_t downlink_n_packets;
+} __attribute__ ((packed)) ogs_pfcp_volume_measurement_t;
+
+int16_t ogs_pfcp_build_volume_measurement(ogs_tlv_octet_t *octet,
+        ogs_pfcp_volume_measurement_t *volume, void *data, int data_len);
+
 typedef struct ogs_pfcp_user_plane_report_s {
     ogs_pfcp_report_type_t type;
     struct {
@@ -757,6 +932,16 @@ typedef struct ogs_pfcp_user_plane_report_s {
         uint8_t paging_policy_indication_value;
         uint8_t qfi;
     } downlink_data;
+    struct {
+        uint32_t id;
+        uint32_t seqn;
+        ogs_pfcp_usage_report_trigger_t rep_trigger;
+        uint32_t start_time;                /* NTP seconds */
+        uint32_t end_time;                  /* NTP seconds */
+        ogs_pfcp_volume_measurement_t vol_measurement;
+        bool dur_measurement_presence;      /* DURAT measured */
+        uint32_t dur_measurement;           /* Seconds */
+    } usage_report;
     struct {
         ogs_pfcp_f_teid_t remote_f_teid;
         int remote_f_teid_len;
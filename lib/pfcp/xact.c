@@ -33,7 +33,7 @@ typedef enum {
 static int ogs_pfcp_xact_initialized = 0;
 static uint32_t g_xact_id = 0;
 
-static OGS_POOL(pool, ogs_pfcp_xact_t);
+static OGS_CPOOL(pool, ogs_pfcp_xact_t);
 
 static ogs_pfcp_xact_stage_t ogs_pfcp_xact_get_stage(
         uint8_t type, uint32_t sqn);
@@ -46,7 +46,8 @@ int ogs_pfcp_xact_init(void)
 {
     ogs_assert(ogs_pfcp_xact_initialized == 0);
 
-    ogs_pool_init(&pool, ogs_app()->pool.pfcp_xact);
+    ogs_cpool_init(&pool, ogs_app()->pool.pfcp_xact, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&pool, true);
 
     g_xact_id = 0;
 
@@ -59,7 +60,7 @@ void ogs_pfcp_xact_final(void)
 {
     ogs_assert(ogs_pfcp_xact_initialized == 1);
 
-    ogs_pool_final(&pool);
+    ogs_cpool_final(&pool);
 
     ogs_pfcp_xact_initialized = 0;
 }
@@ -74,13 +75,20 @@ ogs_pfcp_xact_t *ogs_pfcp_xact_local_create(ogs_pfcp_node_t *node,
 
     ogs_assert(node);
 
-    ogs_pool_alloc(&pool, &xact);
+    ogs_cpool_alloc(&pool, &xact);
     ogs_assert(xact);
     memset(xact, 0, sizeof *xact);
-    xact->index = ogs_pool_index(&pool, xact);
+    xact->index = ogs_cpool_index(&pool, xact);
 
     xact->org = OGS_PFCP_LOCAL_ORIGINATOR;
-    xact->xid = OGS_NEXT_ID(g_xact_id, PFCP_MIN_XACT_ID, PFCP_MAX_XACT_ID);
+    /*
+     * The hash holds one transaction per xid. After a wrap-around,
+     * skip the xids still in use so that no live one is shadowed.
+     */
+    do {
+        xact->xid = OGS_NEXT_ID(
+                g_xact_id, PFCP_MIN_XACT_ID, PFCP_MAX_XACT_ID);
+    } while (ogs_hash_get(node->local_hash, &xact->xid, sizeof(xact->xid)));
     xact->node = node;
     xact->cb = cb;
     xact->data = data;
@@ -97,6 +105,9 @@ ogs_pfcp_xact_t *ogs_pfcp_xact_local_create(ogs_pfcp_node_t *node,
 
     ogs_list_add(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?  
             &xact->node->local_list : &xact->node->remote_list, xact);
+    ogs_hash_set(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?
+            xact->node->local_hash : xact->node->remote_hash,
+            &xact->xid, sizeof(xact->xid), xact);
 
     rv = ogs_pfcp_xact_update_tx(xact, hdesc, pkbuf);
     if (rv != OGS_OK) {
@@ -122,10 +133,10 @@ ogs_pfcp_xact_t *ogs_pfcp_xact_remote_create(
 
     ogs_assert(node);
 
-    ogs_pool_alloc(&pool, &xact);
+    ogs_cpool_alloc(&pool, &xact);
     ogs_assert(xact);
     memset(xact, 0, sizeof *xact);
-    xact->index = ogs_pool_index(&pool, xact);
+    xact->index = ogs_cpool_index(&pool, xact);
 
     xact->org = OGS_PFCP_REMOTE_ORIGINATOR;
     xact->xid = OGS_PFCP_SQN_TO_XID(sqn);
@@ -143,6 +154,9 @@ ogs_pfcp_xact_t *ogs_pfcp_xact_remote_create(
 
     ogs_list_add(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?  
             &xact->node->local_list : &xact->node->remote_list, xact);
+    ogs_hash_set(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?
+            xact->node->local_hash : xact->node->remote_hash,
+            &xact->xid, sizeof(xact->xid), xact);
 
     ogs_debug("[%d] %s Create  peer [%s]:%d",
             xact->xid,
@@ -678,7 +692,7 @@ int ogs_pfcp_xact_receive(
 ogs_pfcp_xact_t *ogs_pfcp_xact_find(ogs_index_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&pool, index);
+    return ogs_cpool_find(&pool, index);
 }
 
 static ogs_pfcp_xact_stage_t ogs_pfcp_xact_get_stage(uint8_t type, uint32_t xid)
@@ -719,39 +733,32 @@ static ogs_pfcp_xact_stage_t ogs_pfcp_xact_get_stage(uint8_t type, uint32_t xid)
 ogs_pfcp_xact_t *ogs_pfcp_xact_find_by_xid(
         ogs_pfcp_node_t *node, uint8_t type, uint32_t xid)
 {
-    char buf[OGS_ADDRSTRLEN];
-
-    ogs_list_t *list = NULL;
+    ogs_hash_t *hash = NULL;
     ogs_pfcp_xact_t *xact = NULL;
 
     ogs_assert(node);
 
     switch (ogs_pfcp_xact_get_stage(type, xid)) {
     case PFCP_XACT_INITIAL_STAGE:
-        list = &node->remote_list;
+        hash = node->remote_hash;
         break;
     case PFCP_XACT_INTERMEDIATE_STAGE:
-        list = &node->local_list;
+        hash = node->local_hash;
         break;
     case PFCP_XACT_FINAL_STAGE:
-        list = &node->local_list;
+        hash = node->local_hash;
         break;
     default:
         ogs_assert_if_reached();
         break;
     }
 
-    ogs_assert(list);
-    ogs_list_for_each(list, xact) {
-        if (xact->xid == xid) {
-            ogs_debug("[%d] %s Find    peer [%s]:%d",
-                    xact->xid,
-                    xact->org == OGS_PFCP_LOCAL_ORIGINATOR ? "LOCAL " : "REMOTE",
-                    OGS_ADDR(&node->addr, buf),
-                    OGS_PORT(&node->addr));
-            break;
-        }
-    }
+    ogs_assert(hash);
+    xact = ogs_hash_get(hash, &xid, sizeof(xid));
+    if (xact)
+        ogs_debug("[%d] %s Find",
+                xact->xid,
+                xact->org == OGS_PFCP_LOCAL_ORIGINATOR ? "LOCAL " : "REMOTE");
 
     return xact;
 }
@@ -759,6 +766,7 @@ ogs_pfcp_xact_t *ogs_pfcp_xact_find_by_xid(
 static int ogs_pfcp_xact_delete(ogs_pfcp_xact_t *xact)
 {
     char buf[OGS_ADDRSTRLEN];
+    ogs_hash_t *hash = NULL;
 
     ogs_assert(xact);
     ogs_assert(xact->node);
@@ -781,9 +789,15 @@ static int ogs_pfcp_xact_delete(ogs_pfcp_xact_t *xact)
     if (xact->tm_holding)
         ogs_timer_delete(xact->tm_holding);
 
+    /* Leave the entry alone if another transaction holds the xid */
+    hash = xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?
+            xact->node->local_hash : xact->node->remote_hash;
+    if (ogs_hash_get(hash, &xact->xid, sizeof(xact->xid)) == xact)
+        ogs_hash_set(hash, &xact->xid, sizeof(xact->xid), NULL);
+
     ogs_list_remove(xact->org == OGS_PFCP_LOCAL_ORIGINATOR ?
             &xact->node->local_list : &xact->node->remote_list, xact);
-    ogs_pool_free(&pool, xact);
+    ogs_cpool_free(&pool, xact);
 
     return OGS_OK;
 }
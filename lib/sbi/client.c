@@ -37,8 +37,6 @@ typedef struct connection_s {
 
     char *method;
 
-    int num_of_header;
-    char **headers;
     struct curl_slist *header_list;
 
     char *memory;
@@ -46,7 +44,6 @@ typedef struct connection_s {
 
     char *location;
 
-    ogs_timer_t *timer;
     CURL *easy;
 
     char error[CURL_ERROR_SIZE];
@@ -59,12 +56,20 @@ static OGS_POOL(client_pool, ogs_sbi_client_t);
 static OGS_POOL(sockinfo_pool, sockinfo_t);
 static OGS_POOL(connection_pool, connection_t);
 
+/*
+ * Easy handles are recycled instead of being created per request.
+ * curl_easy_reset() keeps the handle's DNS and TLS session caches,
+ * and the TCP connections themselves stay in each client's multi handle.
+ */
+static CURL **idle_easy;
+static int num_of_idle_easy;
+static int max_num_of_idle_easy;
+
 static size_t write_cb(void *contents, size_t size, size_t nmemb, void *data);
 static size_t header_cb(void *ptr, size_t size, size_t nmemb, void *data);
 static int sock_cb(CURL *e, curl_socket_t s, int what, void *cbp, void *sockp);
 static int multi_timer_cb(CURLM *multi, long timeout_ms, void *cbp);
 static void multi_timer_expired(void *data);
-static void connection_timer_expired(void *data);
 static void connection_remove_all(ogs_sbi_client_t *client);
 
 void ogs_sbi_client_init(int num_of_sockinfo_pool, int num_of_connection_pool)
@@ -77,9 +82,17 @@ void ogs_sbi_client_init(int num_of_sockinfo_pool, int num_of_connection_pool)
     ogs_pool_init(&sockinfo_pool, num_of_sockinfo_pool);
     ogs_pool_init(&connection_pool, num_of_connection_pool);
 
+    idle_easy = ogs_calloc(num_of_connection_pool, sizeof(CURL *));
+    ogs_assert(idle_easy);
+    num_of_idle_easy = 0;
+    max_num_of_idle_easy = num_of_connection_pool;
 }
 void ogs_sbi_client_final(void)
 {
+    while (num_of_idle_easy)
+        curl_easy_cleanup(idle_easy[--num_of_idle_easy]);
+    ogs_free(idle_easy);
+
     ogs_pool_final(&client_pool);
     ogs_pool_final(&sockinfo_pool);
     ogs_pool_final(&connection_pool);
@@ -114,6 +127,16 @@ ogs_sbi_client_t *ogs_sbi_client_add(ogs_sockaddr_t *addr)
     curl_multi_setopt(multi, CURLMOPT_TIMERFUNCTION, multi_timer_cb);
     curl_multi_setopt(multi, CURLMOPT_TIMERDATA, client);
 
+    if (ogs_app()->parameter.http2) {
+        /* Keep one long-lived connection per peer NF and multiplex
+         * every request on it as a separate HTTP/2 stream */
+        curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#if LIBCURL_VERSION_NUM >= 0x074300
+        curl_multi_setopt(multi, CURLMOPT_MAX_CONCURRENT_STREAMS,
+                (long)ogs_app()->max.concurrent_streams);
+#endif
+    }
+
     ogs_list_add(&ogs_sbi_self()->client_list, client);
 
     return client;
@@ -232,12 +255,30 @@ static char *add_params_to_uri(CURL *easy, char *uri, ogs_hash_t *params)
     return uri;
 }
 
+static CURL *easy_get(void)
+{
+    if (num_of_idle_easy)
+        return idle_easy[--num_of_idle_easy];
+
+    return curl_easy_init();
+}
+
+static void easy_put(CURL *easy)
+{
+    ogs_assert(easy);
+
+    if (num_of_idle_easy < max_num_of_idle_easy) {
+        curl_easy_reset(easy);
+        idle_easy[num_of_idle_easy++] = easy;
+    } else
+        curl_easy_cleanup(easy);
+}
+
 static connection_t *connection_add(
         ogs_sbi_client_t *client, ogs_sbi_client_cb_f client_cb,
         ogs_sbi_request_t *request, void *data)
 {
     ogs_hash_index_t *hi;
-    int i;
     connection_t *conn = NULL;
     CURLMcode rc;
 
@@ -256,35 +297,42 @@ static connection_t *connection_add(
 
     conn->method = ogs_strdup(request->h.method);
 
-    conn->num_of_header = ogs_hash_count(request->http.headers);
-    if (conn->num_of_header) {
-        conn->headers = ogs_calloc(conn->num_of_header, sizeof(char *));
-        ogs_assert(conn->headers);
-        for (hi = ogs_hash_first(request->http.headers), i = 0;
-                hi && i < conn->num_of_header; hi = ogs_hash_next(hi), i++) {
-            const char *key = ogs_hash_this_key(hi);
-            char *val = ogs_hash_this_val(hi);
-
-            conn->headers[i] = ogs_msprintf("%s: %s", key, val);
-            ogs_assert(conn->headers[i]);
-            conn->header_list = curl_slist_append(
-                    conn->header_list, conn->headers[i]);
-        }
+    /* curl_slist_append() keeps its own copy of each header line */
+    for (hi = ogs_hash_first(request->http.headers);
+            hi; hi = ogs_hash_next(hi)) {
+        const char *key = ogs_hash_this_key(hi);
+        char *val = ogs_hash_this_val(hi);
+        char *header = NULL;
+
+        header = ogs_msprintf("%s: %s", key, val);
+        ogs_assert(header);
+        conn->header_list = curl_slist_append(conn->header_list, header);
+        ogs_free(header);
     }
 
-    conn->timer = ogs_timer_add(
-            ogs_app()->timer_mgr, connection_timer_expired, conn);
-    ogs_assert(conn->timer);
-
     ogs_list_add(&client->connection_list, conn);
 
+    conn->easy = easy_get();
+    ogs_assert(conn->easy);
+
     /* If http response is not received within deadline,
      * Open5GS will discard this request. */
-    ogs_timer_start(conn->timer,
-            ogs_app()->time.message.sbi.connection_deadline);
+    curl_easy_setopt(conn->easy, CURLOPT_TIMEOUT_MS, (long)ogs_time_to_msec(
+                ogs_app()->time.message.sbi.connection_deadline));
 
-    conn->easy = curl_easy_init();
-    ogs_assert(conn->easy);
+    if (ogs_app()->parameter.http2) {
+#if LIBCURL_VERSION_NUM >= 0x073100
+        curl_easy_setopt(conn->easy,
+                CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE);
+#else
+        curl_easy_setopt(conn->easy,
+                CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
+#endif
+        /* Queue on the existing connection instead of opening another.
+         * libcurl holds requests made on a new connection until the peer's
+         * first response confirms HTTP/2, then multiplexes all of them. */
+        curl_easy_setopt(conn->easy, CURLOPT_PIPEWAIT, 1L);
+    }
 
     /* HTTP Method */
     if (strcmp(request->h.method, OGS_SBI_HTTP_METHOD_PUT) == 0 ||
@@ -334,7 +382,6 @@ static connection_t *connection_add(
 static void connection_remove(connection_t *conn)
 {
     ogs_sbi_client_t *client = NULL;
-    int i;
 
     ogs_assert(conn);
     client = conn->client;
@@ -342,13 +389,10 @@ static void connection_remove(connection_t *conn)
 
     ogs_list_remove(&client->connection_list, conn);
 
-    ogs_assert(conn->timer);
-    ogs_timer_delete(conn->timer);
-
     ogs_assert(conn->easy);
     ogs_assert(client->multi);
     curl_multi_remove_handle(client->multi, conn->easy);
-    curl_easy_cleanup(conn->easy);
+    easy_put(conn->easy);
 
     ogs_assert(conn->method);
     ogs_free(conn->method);
@@ -356,11 +400,6 @@ static void connection_remove(connection_t *conn)
     if (conn->location)
         ogs_free(conn->location);
 
-    if (conn->num_of_header) {
-        for (i = 0; i < conn->num_of_header; i++)
-            ogs_free(conn->headers[i]);
-        ogs_free(conn->headers);
-    }
     curl_slist_free_all(conn->header_list);
 
     if (conn->memory)
@@ -379,16 +418,6 @@ static void connection_remove_all(ogs_sbi_client_t *client)
         connection_remove(conn);
 }
 
-static void connection_timer_expired(void *data)
-{
-    connection_t *conn = NULL;
-
-    conn = data;
-    ogs_assert(conn);
-
-    connection_remove(conn);
-}
-
 static void check_multi_info(ogs_sbi_client_t *client)
 {
     CURLM *multi = NULL;
@@ -434,7 +463,10 @@ static void check_multi_info(ogs_sbi_client_t *client)
                 /* remove https://localhost:8000 */
                 response->h.uri = ogs_strdup(url);
 
-                response->http.content = ogs_memdup(conn->memory, conn->size);
+                /* Keep the NUL that write_cb() adds; the body is parsed
+                 * as a string */
+                response->http.content =
+                    ogs_memdup(conn->memory, conn->size + 1);
                 response->http.content_length = conn->size;
 
                 if (content_type)
@@ -509,7 +541,9 @@ static size_t header_cb(void *ptr, size_t size, size_t nmemb, void *data)
     conn = data;
     ogs_assert(conn);
 
-    if (strncmp(ptr, OGS_SBI_LOCATION, strlen(OGS_SBI_LOCATION)) == 0) {
+    /* HTTP/2 delivers header names in lowercase */
+    if (ogs_strncasecmp(ptr,
+                OGS_SBI_LOCATION, strlen(OGS_SBI_LOCATION)) == 0) {
         /* ptr : "Location: http://xxx/xxx/xxx\r\n"
            We need to truncate "Location" + ": " + "\r\n" in 'ptr' string */
         int len = strlen(ptr) - strlen(OGS_SBI_LOCATION) - 2 - 2;
@@ -0,0 +1,968 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-app.h"
+#include "ogs-sbi.h"
+
+#include <ctype.h>
+#include <netinet/tcp.h>
+#include <nghttp2/nghttp2.h>
+
+/*
+ * HTTP/2 over cleartext TCP (h2c) with prior knowledge.
+ *
+ * Each accepted socket is a connection_t running one nghttp2 session,
+ * and each request stream on it is an ogs_sbi_session_t. A stream that
+ * the peer resets or abandons while the NF still owes it a response is
+ * detached from its connection and parked on the server's
+ * suspended_session_list until ogs_sbi_server_send_response() is called.
+ */
+typedef struct connection_s {
+    ogs_lnode_t             lnode;
+
+    ogs_sock_t              *sock;
+    ogs_poll_t              *poll;          /* POLLIN */
+    ogs_poll_t              *write_poll;    /* POLLOUT with pending frames */
+
+    nghttp2_session         *session;
+    ogs_list_t              stream_list;
+
+    ogs_sbi_server_t        *server;
+} connection_t;
+
+/*
+ * ogs_sbi_header_set() keeps the key pointer, but nghttp2 only lends
+ * us the header name for the duration of on_header(). The session owns
+ * a copy of every request header and query parameter name until the
+ * request is freed.
+ */
+typedef struct session_key_s {
+    ogs_lnode_t             lnode;
+    char                    *name;
+} session_key_t;
+
+typedef struct ogs_sbi_session_s {
+    ogs_lnode_t             lnode;
+
+    int32_t                 stream_id;
+    connection_t            *conn;          /* NULL once detached */
+
+    ogs_sbi_request_t       *request;
+    ogs_list_t              key_list;
+    bool                    dispatched;
+
+    ogs_sbi_response_t      *response;
+    size_t                  offset;         /* response content sent */
+
+    ogs_sbi_server_t        *server;
+
+    /* Same deadline as the MHD backend */
+    ogs_timer_t             *timer;
+
+    void *data;
+} ogs_sbi_session_t;
+
+static void server_init(int num_of_session_pool);
+static void server_final(void);
+
+static void server_start(ogs_sbi_server_t *server);
+static void server_stop(ogs_sbi_server_t *server);
+
+static void server_send_response(
+        ogs_sbi_session_t *session, ogs_sbi_response_t *response);
+
+static ogs_sbi_server_t *session_get_server(ogs_sbi_session_t *session);
+static void session_set_data(ogs_sbi_session_t *session, void *data);
+static void *session_get_data(ogs_sbi_session_t *session);
+
+const ogs_sbi_server_actions_t ogs_nghttp2_server_actions = {
+    server_init,
+    server_final,
+
+    server_start,
+    server_stop,
+
+    server_send_response,
+
+    session_get_server,
+    session_set_data,
+    session_get_data,
+};
+
+static OGS_POOL(connection_pool, connection_t);
+static OGS_POOL(session_pool, ogs_sbi_session_t);
+
+static nghttp2_session_callbacks *callbacks;
+
+static void accept_handler(short when, ogs_socket_t fd, void *data);
+static void recv_handler(short when, ogs_socket_t fd, void *data);
+static void send_handler(short when, ogs_socket_t fd, void *data);
+
+static void connection_remove(connection_t *conn);
+static void connection_remove_all(ogs_sbi_server_t *server);
+
+static void session_set_field(ogs_sbi_session_t *session, ogs_hash_t *ht,
+        const char *name, size_t namelen, const char *value);
+static void session_detach(ogs_sbi_session_t *session);
+static void session_remove(ogs_sbi_session_t *session);
+static void session_timer_expired(void *data);
+
+static ssize_t send_callback(nghttp2_session *session,
+        const uint8_t *data, size_t length, int flags, void *user_data);
+static int on_begin_headers(nghttp2_session *session,
+        const nghttp2_frame *frame, void *user_data);
+static int on_header(nghttp2_session *session,
+        const nghttp2_frame *frame,
+        const uint8_t *name, size_t namelen,
+        const uint8_t *value, size_t valuelen,
+        uint8_t flags, void *user_data);
+static int on_data_chunk_recv(nghttp2_session *session, uint8_t flags,
+        int32_t stream_id, const uint8_t *data, size_t len, void *user_data);
+static int on_frame_recv(nghttp2_session *session,
+        const nghttp2_frame *frame, void *user_data);
+static int on_stream_close(nghttp2_session *session,
+        int32_t stream_id, uint32_t error_code, void *user_data);
+
+static void server_init(int num_of_session_pool)
+{
+    int rv;
+
+    /* Every connection holds an accepted socket */
+    ogs_pool_init(&connection_pool, ogs_app()->pool.socket);
+    ogs_pool_init(&session_pool, num_of_session_pool);
+
+    rv = nghttp2_session_callbacks_new(&callbacks);
+    ogs_assert(rv == 0);
+
+    nghttp2_session_callbacks_set_send_callback(callbacks, send_callback);
+    nghttp2_session_callbacks_set_on_begin_headers_callback(
+            callbacks, on_begin_headers);
+    nghttp2_session_callbacks_set_on_header_callback(callbacks, on_header);
+    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(
+            callbacks, on_data_chunk_recv);
+    nghttp2_session_callbacks_set_on_frame_recv_callback(
+            callbacks, on_frame_recv);
+    nghttp2_session_callbacks_set_on_stream_close_callback(
+            callbacks, on_stream_close);
+}
+
+static void server_final(void)
+{
+    nghttp2_session_callbacks_del(callbacks);
+    callbacks = NULL;
+
+    ogs_pool_final(&session_pool);
+    ogs_pool_final(&connection_pool);
+}
+
+static void server_start(ogs_sbi_server_t *server)
+{
+    char buf[OGS_ADDRSTRLEN];
+    ogs_sockaddr_t *addr = NULL;
+    ogs_sock_t *sock = NULL;
+
+    ogs_assert(server);
+    ogs_assert(server->addr);
+
+    ogs_copyaddrinfo(&addr, server->addr);
+    server->node = ogs_socknode_new(addr);
+    ogs_assert(server->node);
+
+    sock = ogs_tcp_server(server->node);
+    if (!sock) {
+        ogs_error("Cannot start SBI server");
+        ogs_socknode_free(server->node);
+        server->node = NULL;
+        return;
+    }
+
+    server->node->poll = ogs_pollset_add(ogs_app()->pollset,
+            OGS_POLLIN, sock->fd, accept_handler, server);
+    ogs_assert(server->node->poll);
+
+    addr = server->addr;
+    if (addr) {
+        char *hostname = ogs_gethostname(addr);
+        if (hostname)
+            ogs_info("sbi_server(http2) [%s]:%d",
+                    hostname, OGS_PORT(addr));
+        else
+            ogs_info("sbi_server(http2) [%s]:%d",
+                    OGS_ADDR(addr, buf), OGS_PORT(addr));
+    } else
+        ogs_info("sbi_server(http2) [any]:any");
+}
+
+static void server_stop(ogs_sbi_server_t *server)
+{
+    ogs_sbi_session_t *session = NULL, *next_session = NULL;
+
+    ogs_assert(server);
+
+    if (server->node) {
+        ogs_socknode_free(server->node);
+        server->node = NULL;
+    }
+
+    connection_remove_all(server);
+
+    ogs_list_for_each_safe(
+            &server->suspended_session_list, next_session, session)
+        session_remove(session);
+}
+
+static void connection_add(ogs_sbi_server_t *server, ogs_sock_t *sock)
+{
+    int rv;
+    int on = 1;
+    connection_t *conn = NULL;
+    nghttp2_settings_entry iv[1];
+
+    ogs_assert(server);
+    ogs_assert(sock);
+
+    ogs_pool_alloc(&connection_pool, &conn);
+    if (!conn) {
+        ogs_error("No connection pool");
+        ogs_sock_destroy(sock);
+        return;
+    }
+    memset(conn, 0, sizeof(connection_t));
+
+    conn->server = server;
+    conn->sock = sock;
+    ogs_list_init(&conn->stream_list);
+
+    rv = ogs_nonblocking(sock->fd);
+    ogs_assert(rv == OGS_OK);
+    rv = ogs_closeonexec(sock->fd);
+    ogs_assert(rv == OGS_OK);
+
+    /* HEADERS and DATA go out in separate writes */
+    if (setsockopt(sock->fd, IPPROTO_TCP, TCP_NODELAY,
+                (const void *)&on, sizeof(on)) != 0)
+        ogs_log_message(OGS_LOG_WARN, ogs_socket_errno,
+                "setsockopt(TCP_NODELAY) failed");
+
+    rv = nghttp2_session_server_new(&conn->session, callbacks, conn);
+    ogs_assert(rv == 0);
+
+    iv[0].settings_id = NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS;
+    iv[0].value = ogs_app()->max.concurrent_streams;
+    rv = nghttp2_submit_settings(
+            conn->session, NGHTTP2_FLAG_NONE, iv, OGS_ARRAY_SIZE(iv));
+    ogs_assert(rv == 0);
+
+    conn->poll = ogs_pollset_add(ogs_app()->pollset,
+            OGS_POLLIN, sock->fd, recv_handler, conn);
+    ogs_assert(conn->poll);
+
+    ogs_list_add(&server->connection_list, conn);
+
+    /* SETTINGS is sent once the socket is writable */
+    conn->write_poll = ogs_pollset_add(ogs_app()->pollset,
+            OGS_POLLOUT, sock->fd, send_handler, conn);
+    ogs_assert(conn->write_poll);
+}
+
+static void connection_remove(connection_t *conn)
+{
+    ogs_sbi_server_t *server = NULL;
+    ogs_sbi_session_t *session = NULL, *next_session = NULL;
+
+    ogs_assert(conn);
+    server = conn->server;
+    ogs_assert(server);
+
+    ogs_list_remove(&server->connection_list, conn);
+
+    /*
+     * nghttp2_session_del() does not call on_stream_close(),
+     * so every stream is settled here.
+     */
+    ogs_list_for_each_safe(&conn->stream_list, next_session, session) {
+        if (session->dispatched && !session->response)
+            session_detach(session);
+        else
+            session_remove(session);
+    }
+
+    nghttp2_session_del(conn->session);
+
+    if (conn->write_poll)
+        ogs_pollset_remove(conn->write_poll);
+    ogs_assert(conn->poll);
+    ogs_pollset_remove(conn->poll);
+
+    ogs_sock_destroy(conn->sock);
+
+    ogs_pool_free(&connection_pool, conn);
+}
+
+static void connection_remove_all(ogs_sbi_server_t *server)
+{
+    connection_t *conn = NULL, *next_conn = NULL;
+
+    ogs_assert(server);
+
+    ogs_list_for_each_safe(&server->connection_list, next_conn, conn)
+        connection_remove(conn);
+}
+
+/*
+ * Flushes queued frames. POLLOUT stays armed only while nghttp2 still
+ * has something to write, so an idle connection costs no wakeups.
+ */
+static int connection_send(connection_t *conn)
+{
+    int rv;
+
+    ogs_assert(conn);
+
+    rv = nghttp2_session_send(conn->session);
+    if (rv != 0) {
+        ogs_error("nghttp2_session_send() failed [%s]", nghttp2_strerror(rv));
+        return OGS_ERROR;
+    }
+
+    if (nghttp2_session_want_write(conn->session)) {
+        if (!conn->write_poll) {
+            conn->write_poll = ogs_pollset_add(ogs_app()->pollset,
+                    OGS_POLLOUT, conn->sock->fd, send_handler, conn);
+            ogs_assert(conn->write_poll);
+        }
+    } else {
+        if (conn->write_poll) {
+            ogs_pollset_remove(conn->write_poll);
+            conn->write_poll = NULL;
+        }
+
+        if (!nghttp2_session_want_read(conn->session))
+            return OGS_DONE;
+    }
+
+    return OGS_OK;
+}
+
+static void accept_handler(short when, ogs_socket_t fd, void *data)
+{
+    ogs_sbi_server_t *server = data;
+    ogs_sock_t *sock = NULL;
+
+    ogs_assert(server);
+    ogs_assert(server->node);
+
+    sock = ogs_sock_accept(server->node->sock);
+    if (!sock)
+        return;
+
+    connection_add(server, sock);
+}
+
+static void recv_handler(short when, ogs_socket_t fd, void *data)
+{
+    connection_t *conn = data;
+    uint8_t buf[OGS_MAX_SDU_LEN];
+    ssize_t size;
+
+    ogs_assert(conn);
+
+    size = ogs_recv(fd, buf, sizeof(buf), 0);
+    if (size < 0) {
+        if (ogs_socket_errno == OGS_EAGAIN)
+            return;
+
+        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "ogs_recv() failed");
+        connection_remove(conn);
+        return;
+    }
+
+    if (size == 0) {
+        ogs_debug("Connection closed by peer");
+        connection_remove(conn);
+        return;
+    }
+
+    size = nghttp2_session_mem_recv(conn->session, buf, size);
+    if (size < 0) {
+        ogs_error("nghttp2_session_mem_recv() failed [%s]",
+                nghttp2_strerror((int)size));
+        connection_remove(conn);
+        return;
+    }
+
+    if (connection_send(conn) != OGS_OK)
+        connection_remove(conn);
+}
+
+static void send_handler(short when, ogs_socket_t fd, void *data)
+{
+    connection_t *conn = data;
+
+    ogs_assert(conn);
+
+    if (connection_send(conn) != OGS_OK)
+        connection_remove(conn);
+}
+
+static ssize_t send_callback(nghttp2_session *session,
+        const uint8_t *data, size_t length, int flags, void *user_data)
+{
+    connection_t *conn = user_data;
+    ssize_t sent;
+
+    ogs_assert(conn);
+    ogs_assert(conn->sock);
+
+#ifdef MSG_NOSIGNAL
+    sent = ogs_send(conn->sock->fd, data, length, MSG_NOSIGNAL);
+#else
+    sent = ogs_send(conn->sock->fd, data, length, 0);
+#endif
+    if (sent < 0) {
+        if (ogs_socket_errno == OGS_EAGAIN)
+            return NGHTTP2_ERR_WOULDBLOCK;
+
+        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno, "ogs_send() failed");
+        return NGHTTP2_ERR_CALLBACK_FAILURE;
+    }
+
+    return sent;
+}
+
+static ogs_sbi_session_t *session_add(connection_t *conn, int32_t stream_id)
+{
+    ogs_sbi_session_t *session = NULL;
+
+    ogs_assert(conn);
+
+    ogs_pool_alloc(&session_pool, &session);
+    if (!session)
+        return NULL;
+    memset(session, 0, sizeof(ogs_sbi_session_t));
+
+    session->stream_id = stream_id;
+    session->conn = conn;
+    session->server = conn->server;
+
+    session->request = ogs_sbi_request_new();
+    ogs_assert(session->request);
+
+    ogs_list_add(&conn->stream_list, session);
+
+    return session;
+}
+
+static void session_set_field(ogs_sbi_session_t *session, ogs_hash_t *ht,
+        const char *name, size_t namelen, const char *value)
+{
+    session_key_t *key = NULL;
+    char *old = NULL;
+
+    ogs_assert(session);
+    ogs_assert(ht);
+    ogs_assert(name);
+    ogs_assert(value);
+
+    /* A repeated field keeps the first key and takes the last value */
+    old = ogs_hash_get(ht, name, namelen);
+    if (old) {
+        ogs_hash_set(ht, name, namelen, ogs_strdup(value));
+        ogs_free(old);
+        return;
+    }
+
+    key = ogs_calloc(1, sizeof(session_key_t));
+    ogs_assert(key);
+    key->name = ogs_strndup(name, namelen);
+    ogs_assert(key->name);
+
+    ogs_list_add(&session->key_list, key);
+
+    ogs_sbi_header_set(ht, key->name, value);
+}
+
+static void session_detach(ogs_sbi_session_t *session)
+{
+    connection_t *conn = NULL;
+
+    ogs_assert(session);
+    conn = session->conn;
+    ogs_assert(conn);
+
+    ogs_list_remove(&conn->stream_list, session);
+    nghttp2_session_set_stream_user_data(
+            conn->session, session->stream_id, NULL);
+
+    session->conn = NULL;
+    session->stream_id = 0;
+
+    ogs_assert(session->server);
+    ogs_list_add(&session->server->suspended_session_list, session);
+}
+
+static void session_remove(ogs_sbi_session_t *session)
+{
+    session_key_t *key = NULL, *next_key = NULL;
+
+    ogs_assert(session);
+
+    if (session->conn) {
+        ogs_list_remove(&session->conn->stream_list, session);
+        nghttp2_session_set_stream_user_data(
+                session->conn->session, session->stream_id, NULL);
+    } else {
+        ogs_assert(session->server);
+        ogs_list_remove(&session->server->suspended_session_list, session);
+    }
+
+    if (session->timer)
+        ogs_timer_delete(session->timer);
+
+    if (session->request)
+        ogs_sbi_request_free(session->request);
+    if (session->response)
+        ogs_sbi_response_free(session->response);
+
+    /* Only after the request whose header hash points at these names */
+    ogs_list_for_each_safe(&session->key_list, next_key, key) {
+        ogs_list_remove(&session->key_list, key);
+        ogs_free(key->name);
+        ogs_free(key);
+    }
+
+    ogs_pool_free(&session_pool, session);
+}
+
+static void session_timer_expired(void *data)
+{
+    ogs_sbi_session_t *session = NULL;
+
+    session = data;
+    ogs_assert(session);
+
+    ogs_fatal("An HTTP request was received, "
+                "but the HTTP response is missing.");
+    ogs_fatal("Please send the related pcap files for this case.");
+
+    session_remove(session);
+
+    ogs_assert_if_reached();
+}
+
+static void session_dispatch(ogs_sbi_session_t *session)
+{
+    ogs_sbi_server_t *server = NULL;
+
+    ogs_assert(session);
+    ogs_assert(session->request);
+    server = session->server;
+    ogs_assert(server);
+
+    session->dispatched = true;
+
+    session->timer = ogs_timer_add(
+            ogs_app()->timer_mgr, session_timer_expired, session);
+    ogs_assert(session->timer);
+
+    /* If User does not send http response within deadline,
+     * Open5GS will assert this program. */
+    ogs_timer_start(session->timer,
+            ogs_app()->time.message.sbi.connection_deadline);
+
+    if (server->cb) {
+        if (server->cb(server, session, session->request) != OGS_OK) {
+            ogs_warn("server callback error");
+            ogs_sbi_server_send_error(session,
+                    OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR, NULL,
+                    "server callback error", NULL);
+        }
+    } else {
+        ogs_fatal("server callback is not registered");
+        ogs_assert_if_reached();
+    }
+}
+
+static ssize_t response_read(nghttp2_session *session, int32_t stream_id,
+        uint8_t *buf, size_t length, uint32_t *data_flags,
+        nghttp2_data_source *source, void *user_data)
+{
+    ogs_sbi_session_t *sbi_session = source->ptr;
+    ogs_sbi_response_t *response = NULL;
+    size_t size;
+
+    ogs_assert(sbi_session);
+    response = sbi_session->response;
+    ogs_assert(response);
+
+    size = ogs_min(length,
+            response->http.content_length - sbi_session->offset);
+    if (size)
+        memcpy(buf, response->http.content + sbi_session->offset, size);
+    sbi_session->offset += size;
+
+    if (sbi_session->offset == response->http.content_length)
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+
+    return size;
+}
+
+static void server_send_response(
+        ogs_sbi_session_t *session, ogs_sbi_response_t *response)
+{
+    int rv;
+    int i, num_of_nv;
+    nghttp2_nv *nva = NULL;
+    nghttp2_data_provider data_prd;
+    char status_string[4];
+    char length_string[32];
+
+    ogs_hash_index_t *hi;
+
+    ogs_assert(session);
+    ogs_assert(response);
+    ogs_assert(!session->response);
+
+    if (session->timer) {
+        ogs_timer_delete(session->timer);
+        session->timer = NULL;
+    }
+
+    if (!session->conn) {
+        ogs_warn("Peer has gone away; response dropped");
+        ogs_sbi_response_free(response);
+        session_remove(session);
+        return;
+    }
+
+    session->response = response;
+    session->offset = 0;
+
+    ogs_assert(response->status >= 100 && response->status <= 999);
+    ogs_snprintf(status_string, sizeof(status_string),
+            "%d", response->status);
+    ogs_snprintf(length_string, sizeof(length_string),
+            "%d", (int)response->http.content_length);
+
+    num_of_nv = ogs_hash_count(response->http.headers) + 2;
+    nva = ogs_calloc(num_of_nv, sizeof(nghttp2_nv));
+    ogs_assert(nva);
+
+    i = 0;
+    nva[i].name = (uint8_t *)":status";
+    nva[i].namelen = strlen(":status");
+    nva[i].value = (uint8_t *)status_string;
+    nva[i].valuelen = strlen(status_string);
+    i++;
+
+    nva[i].name = (uint8_t *)"content-length";
+    nva[i].namelen = strlen("content-length");
+    nva[i].value = (uint8_t *)length_string;
+    nva[i].valuelen = strlen(length_string);
+    i++;
+
+    /* HTTP/2 field names must be lowercase */
+    for (hi = ogs_hash_first(response->http.headers);
+            hi; hi = ogs_hash_next(hi)) {
+        const char *key = ogs_hash_this_key(hi);
+        char *val = ogs_hash_this_val(hi);
+        char *name = NULL;
+        int j;
+
+        ogs_assert(i < num_of_nv);
+
+        name = ogs_strdup(key);
+        ogs_assert(name);
+        for (j = 0; name[j]; j++)
+            name[j] = tolower((unsigned char)name[j]);
+
+        nva[i].name = (uint8_t *)name;
+        nva[i].namelen = strlen(name);
+        nva[i].value = (uint8_t *)val;
+        nva[i].valuelen = strlen(val);
+        i++;
+    }
+
+    memset(&data_prd, 0, sizeof(data_prd));
+    data_prd.source.ptr = session;
+    data_prd.read_callback = response_read;
+
+    /* nghttp2 copies the header block */
+    rv = nghttp2_submit_response(session->conn->session, session->stream_id,
+            nva, i, response->http.content_length ? &data_prd : NULL);
+    if (rv != 0)
+        ogs_error("nghttp2_submit_response() failed [%s]",
+                nghttp2_strerror(rv));
+
+    for (i = 2; i < num_of_nv; i++)
+        ogs_free(nva[i].name);
+    ogs_free(nva);
+
+    if (rv != 0) {
+        session_remove(session);
+        return;
+    }
+
+    /* The frames are written from send_handler() */
+    if (!session->conn->write_poll) {
+        session->conn->write_poll = ogs_pollset_add(ogs_app()->pollset,
+                OGS_POLLOUT, session->conn->sock->fd,
+                send_handler, session->conn);
+        ogs_assert(session->conn->write_poll);
+    }
+}
+
+static int on_begin_headers(nghttp2_session *session,
+        const nghttp2_frame *frame, void *user_data)
+{
+    connection_t *conn = user_data;
+    ogs_sbi_session_t *sbi_session = NULL;
+
+    ogs_assert(conn);
+    ogs_assert(frame);
+
+    if (frame->hd.type != NGHTTP2_HEADERS ||
+        frame->headers.cat != NGHTTP2_HCAT_REQUEST)
+        return 0;
+
+    sbi_session = session_add(conn, frame->hd.stream_id);
+    if (!sbi_session) {
+        ogs_error("No session pool");
+        nghttp2_submit_rst_stream(session, NGHTTP2_FLAG_NONE,
+                frame->hd.stream_id, NGHTTP2_REFUSED_STREAM);
+        return 0;
+    }
+
+    nghttp2_session_set_stream_user_data(
+            session, frame->hd.stream_id, sbi_session);
+
+    return 0;
+}
+
+static int hex_value(int c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/* In-place percent-decoding, as MHD does for the URL and its arguments */
+static void unescape(char *s, bool plus_as_space)
+{
+    char *r = s, *w = s;
+
+    ogs_assert(s);
+
+    while (*r) {
+        if (*r == '%' && hex_value(r[1]) >= 0 && hex_value(r[2]) >= 0) {
+            *w++ = (char)(hex_value(r[1]) << 4 | hex_value(r[2]));
+            r += 3;
+        } else if (*r == '+' && plus_as_space) {
+            *w++ = ' ';
+            r++;
+        } else
+            *w++ = *r++;
+    }
+    *w = '\0';
+}
+
+static void parse_path(ogs_sbi_session_t *session,
+        const uint8_t *value, size_t valuelen)
+{
+    ogs_sbi_request_t *request = NULL;
+    char *path = NULL, *query = NULL, *arg = NULL, *saveptr = NULL;
+
+    ogs_assert(session);
+    request = session->request;
+    ogs_assert(request);
+
+    path = ogs_strndup((const char *)value, valuelen);
+    ogs_assert(path);
+
+    query = strchr(path, '?');
+    if (query)
+        *query++ = '\0';
+
+    unescape(path, false);
+    request->h.uri = path;
+
+    if (!query)
+        return;
+
+    for (arg = strtok_r(query, "&", &saveptr);
+            arg; arg = strtok_r(NULL, "&", &saveptr)) {
+        char *val = strchr(arg, '=');
+
+        if (!val)
+            continue;
+        *val++ = '\0';
+
+        unescape(arg, true);
+        unescape(val, true);
+        session_set_field(session, request->http.params,
+                arg, strlen(arg), val);
+    }
+}
+
+static int on_header(nghttp2_session *session,
+        const nghttp2_frame *frame,
+        const uint8_t *name, size_t namelen,
+        const uint8_t *value, size_t valuelen,
+        uint8_t flags, void *user_data)
+{
+    ogs_sbi_session_t *sbi_session = NULL;
+    ogs_sbi_request_t *request = NULL;
+    ogs_assert(frame);
+
+    if (frame->hd.type != NGHTTP2_HEADERS ||
+        frame->headers.cat != NGHTTP2_HCAT_REQUEST)
+        return 0;
+
+    sbi_session = nghttp2_session_get_stream_user_data(
+            session, frame->hd.stream_id);
+    if (!sbi_session)
+        return 0;
+
+    request = sbi_session->request;
+    ogs_assert(request);
+
+    /* nghttp2 validates pseudo-headers and NUL-terminates both fields */
+    if (name[0] == ':') {
+        if (!strcmp((const char *)name, ":method")) {
+            request->h.method = ogs_strndup((const char *)value, valuelen);
+            ogs_assert(request->h.method);
+        } else if (!strcmp((const char *)name, ":path")) {
+            parse_path(sbi_session, value, valuelen);
+        }
+        return 0;
+    }
+
+    session_set_field(sbi_session, request->http.headers,
+            (const char *)name, namelen, (const char *)value);
+
+    return 0;
+}
+
+static int on_data_chunk_recv(nghttp2_session *session, uint8_t flags,
+        int32_t stream_id, const uint8_t *data, size_t len, void *user_data)
+{
+    ogs_sbi_session_t *sbi_session = NULL;
+    ogs_sbi_request_t *request = NULL;
+    size_t offset = 0;
+
+    sbi_session = nghttp2_session_get_stream_user_data(session, stream_id);
+    if (!sbi_session)
+        return 0;
+
+    request = sbi_session->request;
+    ogs_assert(request);
+
+    if (request->http.content == NULL) {
+        request->http.content_length = len;
+        request->http.content =
+            (char*)ogs_malloc(request->http.content_length + 1);
+        ogs_assert(request->http.content);
+    } else {
+        offset = request->http.content_length;
+        if ((request->http.content_length + len) > OGS_HUGE_LEN) {
+            ogs_error("Overflow : Content-Length[%d], len[%d]",
+                        (int)request->http.content_length, (int)len);
+            return 0;
+        }
+        request->http.content_length += len;
+        request->http.content = (char *)ogs_realloc(
+                request->http.content, request->http.content_length + 1);
+        ogs_assert(request->http.content);
+    }
+
+    memcpy(request->http.content + offset, data, len);
+    request->http.content[request->http.content_length] = '\0';
+
+    return 0;
+}
+
+static int on_frame_recv(nghttp2_session *session,
+        const nghttp2_frame *frame, void *user_data)
+{
+    ogs_sbi_session_t *sbi_session = NULL;
+
+    ogs_assert(frame);
+
+    switch (frame->hd.type) {
+    case NGHTTP2_HEADERS:
+    case NGHTTP2_DATA:
+        if (!(frame->hd.flags & NGHTTP2_FLAG_END_STREAM))
+            break;
+
+        sbi_session = nghttp2_session_get_stream_user_data(
+                session, frame->hd.stream_id);
+        if (sbi_session && !sbi_session->dispatched)
+            session_dispatch(sbi_session);
+        break;
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+static int on_stream_close(nghttp2_session *session,
+        int32_t stream_id, uint32_t error_code, void *user_data)
+{
+    connection_t *conn = user_data;
+    ogs_sbi_session_t *sbi_session = NULL;
+
+    ogs_assert(conn);
+
+    sbi_session = nghttp2_session_get_stream_user_data(session, stream_id);
+    if (!sbi_session)
+        return 0;
+
+    /* The NF may still owe this stream a response */
+    if (sbi_session->dispatched && !sbi_session->response)
+        session_detach(sbi_session);
+    else
+        session_remove(sbi_session);
+
+    return 0;
+}
+
+static ogs_sbi_server_t *session_get_server(ogs_sbi_session_t *session)
+{
+    ogs_assert(session);
+    ogs_assert(session->server);
+
+    return session->server;
+}
+
+static void session_set_data(ogs_sbi_session_t *session, void *data)
+{
+    ogs_assert(session);
+    ogs_assert(data);
+
+    session->data = data;
+}
+
+static void *session_get_data(ogs_sbi_session_t *session)
+{
+    ogs_assert(session);
+
+    return session->data;
+}
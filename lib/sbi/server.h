@@ -50,8 +50,35 @@ typedef struct ogs_sbi_server_s {
     void            *mhd;                   /* MHD instance */
     ogs_poll_t      *poll;                  /* MHD server poll */
 
+    ogs_socknode_t  *node;                  /* nghttp2 listening socket */
+    ogs_list_t      connection_list;        /* nghttp2 connection list */
+
 } ogs_sbi_server_t;
 
+/*
+ * One backend serves all SBI servers of a process. It is selected
+ * in ogs_sbi_server_init() and owns the layout of ogs_sbi_session_t.
+ */
+typedef struct ogs_sbi_server_actions_s {
+    void (*init)(int num_of_session_pool);
+    void (*cleanup)(void);
+
+    void (*start)(ogs_sbi_server_t *server);
+    void (*stop)(ogs_sbi_server_t *server);
+
+    void (*send_response)(
+            ogs_sbi_session_t *session, ogs_sbi_response_t *response);
+
+    ogs_sbi_server_t *(*get_server)(ogs_sbi_session_t *session);
+    void (*set_data)(ogs_sbi_session_t *session, void *data);
+    void *(*get_data)(ogs_sbi_session_t *session);
+} ogs_sbi_server_actions_t;
+
+extern const ogs_sbi_server_actions_t ogs_mhd_server_actions;
+#if HAVE_NGHTTP2
+extern const ogs_sbi_server_actions_t ogs_nghttp2_server_actions;
+#endif
+
 void ogs_sbi_server_init(int num_of_connection_pool);
 void ogs_sbi_server_final(void);
 
@@ -25,9 +25,9 @@ int __amf_log_domain;
 int __gmm_log_domain;
 
 static OGS_POOL(amf_gnb_pool, amf_gnb_t);
-static OGS_POOL(amf_ue_pool, amf_ue_t);
-static OGS_POOL(ran_ue_pool, ran_ue_t);
-static OGS_POOL(amf_sess_pool, amf_sess_t);
+static OGS_CPOOL(amf_ue_pool, amf_ue_t);
+static OGS_CPOOL(ran_ue_pool, ran_ue_t);
+static OGS_CPOOL(amf_sess_pool, amf_sess_t);
 
 static int context_initialized = 0;
 
@@ -57,9 +57,13 @@ void amf_context_init(void)
 
     /* Allocate TWICE the pool to check if maximum number of gNBs is reached */
     ogs_pool_init(&amf_gnb_pool, ogs_app()->max.gnb*2);
-    ogs_pool_init(&amf_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&ran_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&amf_sess_pool, ogs_app()->pool.sess);
+    ogs_cpool_init(&amf_ue_pool, ogs_app()->max.ue, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&amf_ue_pool, true);
+    ogs_cpool_init(&ran_ue_pool, ogs_app()->max.ue, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ran_ue_pool, true);
+    ogs_cpool_init(&amf_sess_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&amf_sess_pool, true);
     ogs_pool_init(&self.m_tmsi, ogs_app()->max.ue);
 
     ogs_list_init(&self.gnb_list);
@@ -94,9 +98,9 @@ void amf_context_final(void)
     ogs_hash_destroy(self.supi_hash);
 
     ogs_pool_final(&self.m_tmsi);
-    ogs_pool_final(&amf_sess_pool);
-    ogs_pool_final(&amf_ue_pool);
-    ogs_pool_final(&ran_ue_pool);
+    ogs_cpool_final(&amf_sess_pool);
+    ogs_cpool_final(&amf_ue_pool);
+    ogs_cpool_final(&ran_ue_pool);
     ogs_pool_final(&amf_gnb_pool);
 
     context_initialized = 0;
@@ -958,11 +962,11 @@ ran_ue_t *ran_ue_add(amf_gnb_t *gnb, uint32_t ran_ue_ngap_id)
 
     ogs_assert(gnb);
 
-    ogs_pool_alloc(&ran_ue_pool, &ran_ue);
+    ogs_cpool_alloc(&ran_ue_pool, &ran_ue);
     ogs_assert(ran_ue);
     memset(ran_ue, 0, sizeof *ran_ue);
 
-    ran_ue->index = ogs_pool_index(&ran_ue_pool, ran_ue);
+    ran_ue->index = ogs_cpool_index(&ran_ue_pool, ran_ue);
     ogs_assert(ran_ue->index > 0 && ran_ue->index <= ogs_app()->max.ue);
 
     ran_ue->ran_ue_ngap_id = ran_ue_ngap_id;
@@ -1001,7 +1005,7 @@ void ran_ue_remove(ran_ue_t *ran_ue)
 
     ogs_timer_delete(ran_ue->t_ng_holding);
 
-    ogs_pool_free(&ran_ue_pool, ran_ue);
+    ogs_cpool_free(&ran_ue_pool, ran_ue);
 
     stats_remove_ran_ue();
 }
@@ -1055,7 +1059,7 @@ ran_ue_t *ran_ue_find_by_ran_ue_ngap_id(
 ran_ue_t *ran_ue_find(uint32_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&ran_ue_pool, index);
+    return ogs_cpool_find(&ran_ue_pool, index);
 }
 
 ran_ue_t *ran_ue_find_by_amf_ue_ngap_id(uint64_t amf_ue_ngap_id)
@@ -1107,7 +1111,7 @@ amf_ue_t *amf_ue_add(ran_ue_t *ran_ue)
     gnb = ran_ue->gnb;
     ogs_assert(gnb);
 
-    ogs_pool_alloc(&amf_ue_pool, &amf_ue);
+    ogs_cpool_alloc(&amf_ue_pool, &amf_ue);
     ogs_assert(amf_ue);
     memset(amf_ue, 0, sizeof *amf_ue);
 
@@ -1209,7 +1213,7 @@ void amf_ue_remove(amf_ue_t *amf_ue)
 
     amf_sess_remove_all(amf_ue);
 
-    ogs_pool_free(&amf_ue_pool, amf_ue);
+    ogs_cpool_free(&amf_ue_pool, amf_ue);
 
     ogs_info("[Removed] Number of AMF-UEs is now %d",
             ogs_list_count(&self.amf_ue_list));
@@ -1257,7 +1261,7 @@ amf_ue_t *amf_ue_find_by_guti(ogs_nas_5gs_guti_t *guti)
 
 amf_ue_t *amf_ue_find_by_teid(uint32_t teid)
 {
-    return ogs_pool_find(&amf_ue_pool, teid);
+    return ogs_cpool_find(&amf_ue_pool, teid);
 }
 
 amf_ue_t *amf_ue_find_by_suci(char *suci)
@@ -1365,8 +1369,8 @@ void amf_ue_set_suci(amf_ue_t *amf_ue,
     old_amf_ue = amf_ue_find_by_suci(suci);
     if (old_amf_ue) {
         /* Check if OLD amf_ue_t is different with NEW amf_ue_t */
-        if (ogs_pool_index(&amf_ue_pool, amf_ue) !=
-            ogs_pool_index(&amf_ue_pool, old_amf_ue)) {
+        if (ogs_cpool_index(&amf_ue_pool, amf_ue) !=
+            ogs_cpool_index(&amf_ue_pool, old_amf_ue)) {
             ogs_warn("[%s] OLD UE Context Release", suci);
             if (CM_CONNECTED(old_amf_ue)) {
                 /* Implcit NG release */
@@ -1471,7 +1475,7 @@ amf_sess_t *amf_sess_add(amf_ue_t *amf_ue, uint8_t psi)
     ogs_assert(amf_ue);
     ogs_assert(psi != OGS_NAS_PDU_SESSION_IDENTITY_UNASSIGNED);
 
-    ogs_pool_alloc(&amf_sess_pool, &sess);
+    ogs_cpool_alloc(&amf_sess_pool, &sess);
     ogs_assert(sess);
     memset(sess, 0, sizeof *sess);
 
@@ -1514,7 +1518,7 @@ void amf_sess_remove(amf_sess_t *sess)
     OGS_NAS_CLEAR_DATA(&sess->ue_pco);
     OGS_TLV_CLEAR_DATA(&sess->pgw_pco);
 
-    ogs_pool_free(&amf_sess_pool, sess);
+    ogs_cpool_free(&amf_sess_pool, sess);
 
     stats_remove_amf_session();
 }
@@ -1541,12 +1545,12 @@ amf_sess_t *amf_sess_find_by_psi(amf_ue_t *amf_ue, uint8_t psi)
 
 amf_ue_t *amf_ue_cycle(amf_ue_t *amf_ue)
 {
-    return ogs_pool_cycle(&amf_ue_pool, amf_ue);
+    return ogs_cpool_cycle(&amf_ue_pool, amf_ue);
 }
 
 amf_sess_t *amf_sess_cycle(amf_sess_t *sess)
 {
-    return ogs_pool_cycle(&amf_sess_pool, sess);
+    return ogs_cpool_cycle(&amf_sess_pool, sess);
 }
 
 int amf_sess_xact_count(amf_ue_t *amf_ue)
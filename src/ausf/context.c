@@ -23,7 +23,7 @@ static ausf_context_t self;
 
 int __ausf_log_domain;
 
-static OGS_POOL(ausf_ue_pool, ausf_ue_t);
+static OGS_CPOOL(ausf_ue_pool, ausf_ue_t);
 
 static int context_initialized = 0;
 
@@ -37,7 +37,8 @@ void ausf_context_init(void)
     ogs_log_install_domain(&__ausf_log_domain, "ausf", ogs_core()->log.level);
 
     /* Allocate TWICE the pool to check if maximum number of gNBs is reached */
-    ogs_pool_init(&ausf_ue_pool, ogs_app()->max.ue);
+    ogs_cpool_init(&ausf_ue_pool, ogs_app()->max.ue, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&ausf_ue_pool, true);
 
     ogs_list_init(&self.ausf_ue_list);
     self.suci_hash = ogs_hash_make();
@@ -57,7 +58,7 @@ void ausf_context_final(void)
     ogs_assert(self.supi_hash);
     ogs_hash_destroy(self.supi_hash);
 
-    ogs_pool_final(&ausf_ue_pool);
+    ogs_cpool_final(&ausf_ue_pool);
 
     context_initialized = 0;
 }
@@ -122,12 +123,12 @@ ausf_ue_t *ausf_ue_add(char *suci)
 
     ogs_assert(suci);
 
-    ogs_pool_alloc(&ausf_ue_pool, &ausf_ue);
+    ogs_cpool_alloc(&ausf_ue_pool, &ausf_ue);
     ogs_assert(ausf_ue);
     memset(ausf_ue, 0, sizeof *ausf_ue);
 
     ausf_ue->ctx_id =
-        ogs_msprintf("%d", (int)ogs_pool_index(&ausf_ue_pool, ausf_ue));
+        ogs_msprintf("%d", (int)ogs_cpool_index(&ausf_ue_pool, ausf_ue));
     ogs_assert(ausf_ue->ctx_id);
 
     ausf_ue->suci = ogs_strdup(suci);
@@ -181,7 +182,7 @@ void ausf_ue_remove(ausf_ue_t *ausf_ue)
     if (ausf_ue->serving_network_name)
         ogs_free(ausf_ue->serving_network_name);
     
-    ogs_pool_free(&ausf_ue_pool, ausf_ue);
+    ogs_cpool_free(&ausf_ue_pool, ausf_ue);
 }
 
 void ausf_ue_remove_all()
@@ -215,11 +216,18 @@ ausf_ue_t *ausf_ue_find_by_suci_or_supi(char *suci_or_supi)
 
 ausf_ue_t *ausf_ue_find_by_ctx_id(char *ctx_id)
 {
+    long long index;
+
     ogs_assert(ctx_id);
-    return ogs_pool_find(&ausf_ue_pool, atoll(ctx_id));
+
+    index = atoll(ctx_id);
+    if (index <= 0 || index > ogs_cpool_size(&ausf_ue_pool))
+        return NULL;
+
+    return ogs_cpool_find(&ausf_ue_pool, index);
 }
 
 ausf_ue_t *ausf_ue_cycle(ausf_ue_t *ausf_ue)
 {
-    return ogs_pool_cycle(&ausf_ue_pool, ausf_ue);
+    return ogs_cpool_cycle(&ausf_ue_pool, ausf_ue);
 }
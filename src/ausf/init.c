@@ -111,9 +111,10 @@ static void ausf_main(void *data)
         ogs_timer_mgr_expire(ogs_app()->timer_mgr);
 
         for ( ;; ) {
-            ausf_event_t *e = NULL;
+            ausf_event_t *e[OGS_QUEUE_BATCH_SIZE];
+            unsigned int i, num = OGS_QUEUE_BATCH_SIZE;
 
-            rv = ogs_queue_trypop(ogs_app()->queue, (void**)&e);
+            rv = ogs_queue_trypop_batch(ogs_app()->queue, (void**)e, &num);
             ogs_assert(rv != OGS_ERROR);
 
             if (rv == OGS_DONE)
@@ -122,9 +123,11 @@ static void ausf_main(void *data)
             if (rv == OGS_RETRY)
                 break;
 
-            ogs_assert(e);
-            ogs_fsm_dispatch(&ausf_sm, e);
-            ausf_event_free(e);
+            for (i = 0; i < num; i++) {
+                ogs_assert(e[i]);
+                ogs_fsm_dispatch(&ausf_sm, e[i]);
+                ausf_event_free(e[i]);
+            }
         }
     }
 done:
@@ -47,8 +47,6 @@ void hss_context_init(void)
     ogs_log_install_domain(&__ogs_dbi_domain, "dbi", ogs_core()->log.level);
     ogs_log_install_domain(&__hss_log_domain, "hss", ogs_core()->log.level);
 
-    ogs_thread_mutex_init(&self.db_lock);
-
     context_initialized = 1;
 }
 
@@ -56,8 +54,6 @@ void hss_context_final(void)
 {
     ogs_assert(context_initialized == 1);
 
-    ogs_thread_mutex_destroy(&self.db_lock);
-
     context_initialized = 0;
 }
 
@@ -264,14 +260,12 @@ int hss_db_auth_info(char *imsi_bcd, ogs_dbi_auth_info_t *auth_info)
     ogs_assert(imsi_bcd);
     ogs_assert(auth_info);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_auth_info(supi, auth_info);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -284,33 +278,31 @@ int hss_db_update_rand_and_sqn(
 
     ogs_assert(imsi_bcd);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_update_sqn(supi, sqn);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
 
-int hss_db_increment_sqn(char *imsi_bcd)
+int hss_db_auth_info_and_increment_sqn(char *imsi_bcd,
+        int num_of_sqn, ogs_dbi_auth_info_t *auth_info)
 {
     int rv;
     char *supi = NULL;
 
     ogs_assert(imsi_bcd);
+    ogs_assert(auth_info);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
-    rv = ogs_dbi_increment_sqn(supi);
+    rv = ogs_dbi_auth_info_and_increment_sqn(supi, num_of_sqn, auth_info);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
@@ -324,14 +316,12 @@ int hss_db_subscription_data(
     ogs_assert(imsi_bcd);
     ogs_assert(subscription_data);
 
-    ogs_thread_mutex_lock(&self.db_lock);
     supi = ogs_msprintf("%s-%s", OGS_ID_SUPI_TYPE_IMSI, imsi_bcd);
     ogs_assert(supi);
 
     rv = ogs_dbi_subscription_data(supi, subscription_data);
 
     ogs_free(supi);
-    ogs_thread_mutex_unlock(&self.db_lock);
 
     return rv;
 }
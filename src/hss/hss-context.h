@@ -36,8 +36,6 @@ extern int __hss_log_domain;
 typedef struct _hss_context_t {
     const char          *diam_conf_path;      /* HSS Diameter conf path */
     ogs_diam_config_t   *diam_config;         /* HSS Diameter config */
-
-    ogs_thread_mutex_t  db_lock;
 } hss_context_t;
 
 void hss_context_init(void);
@@ -48,7 +46,8 @@ int hss_context_parse_config(void);
 
 int hss_db_auth_info(char *imsi_bcd, ogs_dbi_auth_info_t *auth_info);
 int hss_db_update_rand_and_sqn(char *imsi_bcd, uint8_t *rand, uint64_t sqn);
-int hss_db_increment_sqn(char *imsi_bcd);
+int hss_db_auth_info_and_increment_sqn(char *imsi_bcd,
+        int num_of_sqn, ogs_dbi_auth_info_t *auth_info);
 
 int hss_db_subscription_data(
     char *imsi_bcd, ogs_subscription_data_t *subscription_data);
@@ -22,6 +22,9 @@
 #include "hss-context.h"
 #include "hss-fd-path.h"
 
+/* TS29.272 7.3.14 : Number-Of-Requested-Vectors */
+#define HSS_MAX_NUM_OF_VECTORS 5
+
 /* handler for fallback cb */
 static struct disp_hdl *hdl_s6a_fb = NULL; 
 /* handler for Authentication-Information-Request cb */
@@ -46,7 +49,7 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
     int ret;
 
 	struct msg *ans, *qry;
-    struct avp *avpch;
+    struct avp *avpch, *avp_resync = NULL;
     struct avp *avp_e_utran_vector, *avp_xres, *avp_kasme, *avp_rand, *avp_autn;
     struct avp_hdr *hdr;
     union avp_value val;
@@ -54,13 +57,12 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
     char imsi_bcd[OGS_MAX_IMSI_BCD_LEN+1];
     uint8_t opc[OGS_KEY_LEN];
     uint8_t sqn[OGS_SQN_LEN];
-    uint8_t autn[OGS_AUTN_LEN];
-    uint8_t ik[OGS_KEY_LEN];
-    uint8_t ck[OGS_KEY_LEN];
-    uint8_t ak[OGS_AK_LEN];
-    uint8_t xres[OGS_MAX_RES_LEN];
-    uint8_t kasme[OGS_SHA256_DIGEST_SIZE];
-    size_t xres_len = 8;
+
+    uint8_t rand[HSS_MAX_NUM_OF_VECTORS][OGS_RAND_LEN];
+    uint8_t vector_sqn[HSS_MAX_NUM_OF_VECTORS][OGS_SQN_LEN];
+    ogs_auc_input_t input[HSS_MAX_NUM_OF_VECTORS];
+    ogs_auc_vector_t vector[HSS_MAX_NUM_OF_VECTORS];
+    int i, num_of_vectors = 1;
 
     uint8_t mac_s[OGS_MAC_S_LEN];
 
@@ -86,10 +88,39 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
     ogs_cpystrn(imsi_bcd, (char*)hdr->avp_value->os.data, 
         ogs_min(hdr->avp_value->os.len, OGS_MAX_IMSI_BCD_LEN)+1);
 
-    rv = hss_db_auth_info(imsi_bcd, &auth_info);
-    if (rv != OGS_OK) {
+    ret = fd_msg_search_avp(qry, ogs_diam_s6a_req_eutran_auth_info, &avp);
+    ogs_assert(ret == 0);
+    if (avp) {
+        ret = fd_avp_search_avp(
+                avp, ogs_diam_s6a_number_of_requested_vectors, &avpch);
+        ogs_assert(ret == 0);
+        if (avpch) {
+            ret = fd_msg_avp_hdr(avpch, &hdr);
+            ogs_assert(ret == 0);
+            num_of_vectors = ogs_max(1, ogs_min(
+                    hdr->avp_value->u32, HSS_MAX_NUM_OF_VECTORS));
+        }
+
+        ret = fd_avp_search_avp(
+                avp, ogs_diam_s6a_re_synchronization_info, &avp_resync);
+        ogs_assert(ret == 0);
+    }
+
+    /*
+     * Each vector consumes one SQN. Without re-sync, all of them are
+     * reserved in the same DB operation that reads the keys.
+     */
+    if (avp_resync)
+        rv = hss_db_auth_info(imsi_bcd, &auth_info);
+    else
+        rv = hss_db_auth_info_and_increment_sqn(
+                imsi_bcd, num_of_vectors, &auth_info);
+    if (rv == OGS_NOTFOUND) {
         result_code = OGS_DIAM_S6A_ERROR_USER_UNKNOWN;
         goto out;
+    } else if (rv != OGS_OK) {
+        result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
+        goto out;
     }
 
     memset(zero, 0, sizeof(zero));
@@ -100,55 +131,42 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
     if (auth_info.use_opc)
         memcpy(opc, auth_info.opc, sizeof(opc));
     else
-        milenage_opc(auth_info.k, auth_info.op, opc);
+        ogs_auc_opc(auth_info.k, auth_info.op, opc);
 
-    ret = fd_msg_search_avp(qry, ogs_diam_s6a_req_eutran_auth_info, &avp);
-    ogs_assert(ret == 0);
-    if (avp) {
-        ret = fd_avp_search_avp(
-                avp, ogs_diam_s6a_re_synchronization_info, &avpch);
+    if (avp_resync) {
+        ret = fd_msg_avp_hdr(avp_resync, &hdr);
         ogs_assert(ret == 0);
-        if (avpch) {
-            ret = fd_msg_avp_hdr(avpch, &hdr);
-            ogs_assert(ret == 0);
-            ogs_auc_sqn(opc, auth_info.k,
-                    hdr->avp_value->os.data,
-                    hdr->avp_value->os.data + OGS_RAND_LEN,
-                    sqn, mac_s);
-            if (memcmp(mac_s, hdr->avp_value->os.data +
-                        OGS_RAND_LEN + OGS_SQN_LEN, OGS_MAC_S_LEN) == 0) {
-                ogs_random(auth_info.rand, OGS_RAND_LEN);
-                auth_info.sqn = ogs_buffer_to_uint64(sqn, OGS_SQN_LEN);
-                /* 33.102 C.3.4 Guide : IND + 1 */
-                auth_info.sqn = (auth_info.sqn + 32 + 1) & OGS_MAX_SQN;
-            } else {
-                ogs_error("Re-synch MAC failed for IMSI:`%s`", imsi_bcd);
-                ogs_log_print(OGS_LOG_ERROR, "MAC_S: ");
-                ogs_log_hexdump(OGS_LOG_ERROR, mac_s, OGS_MAC_S_LEN);
-                ogs_log_hexdump(OGS_LOG_ERROR,
-                    (void*)(hdr->avp_value->os.data + 
-                        OGS_RAND_LEN + OGS_SQN_LEN),
-                    OGS_MAC_S_LEN);
-                ogs_log_print(OGS_LOG_ERROR, "SQN: ");
-                ogs_log_hexdump(OGS_LOG_ERROR, sqn, OGS_SQN_LEN);
-                result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
-                goto out;
-            }
+        ogs_auc_sqn(opc, auth_info.k,
+                hdr->avp_value->os.data,
+                hdr->avp_value->os.data + OGS_RAND_LEN,
+                sqn, mac_s);
+        if (memcmp(mac_s, hdr->avp_value->os.data +
+                    OGS_RAND_LEN + OGS_SQN_LEN, OGS_MAC_S_LEN) == 0) {
+            ogs_random(auth_info.rand, OGS_RAND_LEN);
+            auth_info.sqn = ogs_buffer_to_uint64(sqn, OGS_SQN_LEN);
+            /* 33.102 C.3.4 Guide : IND + 1 */
+            auth_info.sqn = (auth_info.sqn + 32 + 1) & OGS_MAX_SQN;
+        } else {
+            ogs_error("Re-synch MAC failed for IMSI:`%s`", imsi_bcd);
+            ogs_log_print(OGS_LOG_ERROR, "MAC_S: ");
+            ogs_log_hexdump(OGS_LOG_ERROR, mac_s, OGS_MAC_S_LEN);
+            ogs_log_hexdump(OGS_LOG_ERROR,
+                (void*)(hdr->avp_value->os.data + 
+                    OGS_RAND_LEN + OGS_SQN_LEN),
+                OGS_MAC_S_LEN);
+            ogs_log_print(OGS_LOG_ERROR, "SQN: ");
+            ogs_log_hexdump(OGS_LOG_ERROR, sqn, OGS_SQN_LEN);
+            result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
+            goto out;
         }
-    }
 
-    rv = hss_db_update_rand_and_sqn(imsi_bcd, auth_info.rand, auth_info.sqn);
-    if (rv != OGS_OK) {
-        ogs_error("Cannot update rand and sqn for IMSI:'%s'", imsi_bcd);
-        result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
-        goto out;
-    }
-
-    rv = hss_db_increment_sqn(imsi_bcd);
-    if (rv != OGS_OK) {
-        ogs_error("Cannot increment sqn for IMSI:'%s'", imsi_bcd);
-        result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
-        goto out;
+        rv = hss_db_update_rand_and_sqn(imsi_bcd, auth_info.rand,
+                (auth_info.sqn + 32 * num_of_vectors) & OGS_MAX_SQN);
+        if (rv != OGS_OK) {
+            ogs_error("Cannot update rand and sqn for IMSI:'%s'", imsi_bcd);
+            result_code = OGS_DIAM_S6A_AUTHENTICATION_DATA_UNAVAILABLE;
+            goto out;
+        }
     }
 
     ret = fd_msg_search_avp(qry, ogs_diam_s6a_visited_plmn_id, &avp);
@@ -159,55 +177,77 @@ static int hss_ogs_diam_s6a_air_cb( struct msg **msg, struct avp *avp,
     memcpy(visited_plmn_id, hdr->avp_value->os.data, hdr->avp_value->os.len);
 #endif
 
-    milenage_generate(opc, auth_info.amf, auth_info.k,
-        ogs_uint64_to_buffer(auth_info.sqn, OGS_SQN_LEN, sqn), auth_info.rand,
-        autn, ik, ck, ak, xres, &xres_len);
-    ogs_auc_kasme(ck, ik, hdr->avp_value->os.data, sqn, ak, kasme);
+    for (i = 0; i < num_of_vectors; i++) {
+        if (i == 0)
+            memcpy(rand[i], auth_info.rand, OGS_RAND_LEN);
+        else
+            ogs_random(rand[i], OGS_RAND_LEN);
+        ogs_uint64_to_buffer((auth_info.sqn + 32 * i) & OGS_MAX_SQN,
+                OGS_SQN_LEN, vector_sqn[i]);
+
+        input[i].k = auth_info.k;
+        input[i].opc = opc;
+        input[i].amf = auth_info.amf;
+        input[i].sqn = vector_sqn[i];
+        input[i].rand = rand[i];
+    }
+
+    ogs_auc_eps_vectors(hdr->avp_value->os.data,
+            input, vector, num_of_vectors);
 
     /* Set the Authentication-Info */
     ret = fd_msg_avp_new(ogs_diam_s6a_authentication_info, 0, &avp);
     ogs_assert(ret == 0);
-    ret = fd_msg_avp_new(ogs_diam_s6a_e_utran_vector, 0, &avp_e_utran_vector);
-    ogs_assert(ret == 0);
 
-    ret = fd_msg_avp_new(ogs_diam_s6a_rand, 0, &avp_rand);
-    ogs_assert(ret == 0);
-    val.os.data = auth_info.rand;
-    val.os.len = OGS_KEY_LEN;
-    ret = fd_msg_avp_setvalue(avp_rand, &val);
-    ogs_assert(ret == 0);
-    ret = fd_msg_avp_add(avp_e_utran_vector, MSG_BRW_LAST_CHILD, avp_rand);
-    ogs_assert(ret == 0);
+    for (i = 0; i < num_of_vectors; i++) {
+        ret = fd_msg_avp_new(
+                ogs_diam_s6a_e_utran_vector, 0, &avp_e_utran_vector);
+        ogs_assert(ret == 0);
 
-    ret = fd_msg_avp_new(ogs_diam_s6a_xres, 0, &avp_xres);
-    ogs_assert(ret == 0);
-    val.os.data = xres;
-    val.os.len = xres_len;
-    ret = fd_msg_avp_setvalue(avp_xres, &val);
-    ogs_assert(ret == 0);
-    ret = fd_msg_avp_add(avp_e_utran_vector, MSG_BRW_LAST_CHILD, avp_xres);
-    ogs_assert(ret == 0);
+        ret = fd_msg_avp_new(ogs_diam_s6a_rand, 0, &avp_rand);
+        ogs_assert(ret == 0);
+        val.os.data = rand[i];
+        val.os.len = OGS_KEY_LEN;
+        ret = fd_msg_avp_setvalue(avp_rand, &val);
+        ogs_assert(ret == 0);
+        ret = fd_msg_avp_add(
+                avp_e_utran_vector, MSG_BRW_LAST_CHILD, avp_rand);
+        ogs_assert(ret == 0);
 
-    ret = fd_msg_avp_new(ogs_diam_s6a_autn, 0, &avp_autn);
-    ogs_assert(ret == 0);
-    val.os.data = autn;
-    val.os.len = OGS_AUTN_LEN;
-    ret = fd_msg_avp_setvalue(avp_autn, &val);
-    ogs_assert(ret == 0);
-    ret = fd_msg_avp_add(avp_e_utran_vector, MSG_BRW_LAST_CHILD, avp_autn);
-    ogs_assert(ret == 0);
+        ret = fd_msg_avp_new(ogs_diam_s6a_xres, 0, &avp_xres);
+        ogs_assert(ret == 0);
+        val.os.data = vector[i].xres;
+        val.os.len = vector[i].xres_len;
+        ret = fd_msg_avp_setvalue(avp_xres, &val);
+        ogs_assert(ret == 0);
+        ret = fd_msg_avp_add(
+                avp_e_utran_vector, MSG_BRW_LAST_CHILD, avp_xres);
+        ogs_assert(ret == 0);
 
-    ret = fd_msg_avp_new(ogs_diam_s6a_kasme, 0, &avp_kasme);
-    ogs_assert(ret == 0);
-    val.os.data = kasme;
-    val.os.len = OGS_SHA256_DIGEST_SIZE;
-    ret = fd_msg_avp_setvalue(avp_kasme, &val);
-    ogs_assert(ret == 0);
-    ret = fd_msg_avp_add(avp_e_utran_vector, MSG_BRW_LAST_CHILD, avp_kasme);
-    ogs_assert(ret == 0);
+        ret = fd_msg_avp_new(ogs_diam_s6a_autn, 0, &avp_autn);
+        ogs_assert(ret == 0);
+        val.os.data = vector[i].autn;
+        val.os.len = OGS_AUTN_LEN;
+        ret = fd_msg_avp_setvalue(avp_autn, &val);
+        ogs_assert(ret == 0);
+        ret = fd_msg_avp_add(
+                avp_e_utran_vector, MSG_BRW_LAST_CHILD, avp_autn);
+        ogs_assert(ret == 0);
+
+        ret = fd_msg_avp_new(ogs_diam_s6a_kasme, 0, &avp_kasme);
+        ogs_assert(ret == 0);
+        val.os.data = vector[i].kasme;
+        val.os.len = OGS_SHA256_DIGEST_SIZE;
+        ret = fd_msg_avp_setvalue(avp_kasme, &val);
+        ogs_assert(ret == 0);
+        ret = fd_msg_avp_add(
+                avp_e_utran_vector, MSG_BRW_LAST_CHILD, avp_kasme);
+        ogs_assert(ret == 0);
+
+        ret = fd_msg_avp_add(avp, MSG_BRW_LAST_CHILD, avp_e_utran_vector);
+        ogs_assert(ret == 0);
+    }
 
-    ret = fd_msg_avp_add(avp, MSG_BRW_LAST_CHILD, avp_e_utran_vector);
-    ogs_assert(ret == 0);
     ret = fd_msg_avp_add(ans, MSG_BRW_LAST_CHILD, avp);
     ogs_assert(ret == 0);
 
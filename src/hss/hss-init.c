@@ -38,6 +38,9 @@ int hss_initialize(void)
     rv = ogs_dbi_init(ogs_app()->db_uri);
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_dbi_cache_init(ogs_app()->db_cache);
+    if (rv != OGS_OK) return rv;
+
     rv = hss_fd_init();
     if (rv != OGS_OK) return OGS_ERROR;
 
@@ -52,6 +55,7 @@ void hss_terminate(void)
 
     hss_fd_final();
 
+    ogs_dbi_cache_final();
     ogs_dbi_final();
     hss_context_final();
 	
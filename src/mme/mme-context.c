@@ -42,10 +42,10 @@ static OGS_POOL(mme_vlr_pool, mme_vlr_t);
 static OGS_POOL(mme_csmap_pool, mme_csmap_t);
 
 static OGS_POOL(mme_enb_pool, mme_enb_t);
-static OGS_POOL(mme_ue_pool, mme_ue_t);
-static OGS_POOL(enb_ue_pool, enb_ue_t);
-static OGS_POOL(mme_sess_pool, mme_sess_t);
-static OGS_POOL(mme_bearer_pool, mme_bearer_t);
+static OGS_CPOOL(mme_ue_pool, mme_ue_t);
+static OGS_CPOOL(enb_ue_pool, enb_ue_t);
+static OGS_CPOOL(mme_sess_pool, mme_sess_t);
+static OGS_CPOOL(mme_bearer_pool, mme_bearer_t);
 
 static int context_initialized = 0;
 
@@ -98,10 +98,16 @@ void mme_context_init()
     /* Allocate TWICE the pool to check if maximum number of eNBs is reached */
     ogs_pool_init(&mme_enb_pool, ogs_app()->max.gnb*2);
 
-    ogs_pool_init(&mme_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&enb_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&mme_sess_pool, ogs_app()->pool.sess);
-    ogs_pool_init(&mme_bearer_pool, ogs_app()->pool.bearer);
+    ogs_cpool_init(&mme_ue_pool, ogs_app()->max.ue, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&mme_ue_pool, true);
+    ogs_cpool_init(&enb_ue_pool, ogs_app()->max.ue, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&enb_ue_pool, true);
+    ogs_cpool_init(&mme_sess_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&mme_sess_pool, true);
+    ogs_cpool_init(&mme_bearer_pool,
+            ogs_app()->pool.bearer, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&mme_bearer_pool, true);
     ogs_pool_init(&self.m_tmsi, ogs_app()->max.ue);
 
     self.enb_addr_hash = ogs_hash_make();
@@ -137,10 +143,10 @@ void mme_context_final()
     ogs_hash_destroy(self.guti_ue_hash);
 
     ogs_pool_final(&self.m_tmsi);
-    ogs_pool_final(&mme_bearer_pool);
-    ogs_pool_final(&mme_sess_pool);
-    ogs_pool_final(&mme_ue_pool);
-    ogs_pool_final(&enb_ue_pool);
+    ogs_cpool_final(&mme_bearer_pool);
+    ogs_cpool_final(&mme_sess_pool);
+    ogs_cpool_final(&mme_ue_pool);
+    ogs_cpool_final(&enb_ue_pool);
 
     ogs_pool_final(&mme_enb_pool);
 
@@ -2004,11 +2010,11 @@ enb_ue_t *enb_ue_add(mme_enb_t *enb, uint32_t enb_ue_s1ap_id)
 
     ogs_assert(enb);
 
-    ogs_pool_alloc(&enb_ue_pool, &enb_ue);
+    ogs_cpool_alloc(&enb_ue_pool, &enb_ue);
     ogs_assert(enb_ue);
     memset(enb_ue, 0, sizeof *enb_ue);
 
-    enb_ue->index = ogs_pool_index(&enb_ue_pool, enb_ue);
+    enb_ue->index = ogs_cpool_index(&enb_ue_pool, enb_ue);
     ogs_assert(enb_ue->index > 0 && enb_ue->index <= ogs_app()->max.ue);
 
     enb_ue->enb_ue_s1ap_id = enb_ue_s1ap_id;
@@ -2050,7 +2056,7 @@ void enb_ue_remove(enb_ue_t *enb_ue)
 
     ogs_timer_delete(enb_ue->t_s1_holding);
 
-    ogs_pool_free(&enb_ue_pool, enb_ue);
+    ogs_cpool_free(&enb_ue_pool, enb_ue);
 
     stats_remove_enb_ue();
 }
@@ -2104,7 +2110,7 @@ enb_ue_t *enb_ue_find_by_enb_ue_s1ap_id(
 enb_ue_t *enb_ue_find(uint32_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&enb_ue_pool, index);
+    return ogs_cpool_find(&enb_ue_pool, index);
 }
 
 enb_ue_t *enb_ue_find_by_mme_ue_s1ap_id(uint32_t mme_ue_s1ap_id)
@@ -2206,7 +2212,7 @@ mme_ue_t *mme_ue_add(enb_ue_t *enb_ue)
     enb = enb_ue->enb;
     ogs_assert(enb);
 
-    ogs_pool_alloc(&mme_ue_pool, &mme_ue);
+    ogs_cpool_alloc(&mme_ue_pool, &mme_ue);
     ogs_assert(mme_ue);
     memset(mme_ue, 0, sizeof *mme_ue);
 
@@ -2214,7 +2220,7 @@ mme_ue_t *mme_ue_add(enb_ue_t *enb_ue)
 
     ogs_list_init(&mme_ue->sess_list);
 
-    mme_ue->mme_s11_teid = ogs_pool_index(&mme_ue_pool, mme_ue);
+    mme_ue->mme_s11_teid = ogs_cpool_index(&mme_ue_pool, mme_ue);
     ogs_assert(mme_ue->mme_s11_teid > 0 &&
             mme_ue->mme_s11_teid <= ogs_app()->max.ue);
 
@@ -2309,7 +2315,7 @@ void mme_ue_remove(mme_ue_t *mme_ue)
 
     mme_ebi_pool_final(mme_ue);
 
-    ogs_pool_free(&mme_ue_pool, mme_ue);
+    ogs_cpool_free(&mme_ue_pool, mme_ue);
 
     ogs_info("[Removed] Number of MME-UEs is now %d",
             ogs_list_count(&self.mme_ue_list));
@@ -2376,7 +2382,7 @@ mme_ue_t *mme_ue_find_by_guti(ogs_nas_eps_guti_t *guti)
 
 mme_ue_t *mme_ue_find_by_teid(uint32_t teid)
 {
-    return ogs_pool_find(&mme_ue_pool, teid);
+    return ogs_cpool_find(&mme_ue_pool, teid);
 }
 
 mme_ue_t *mme_ue_find_by_message(ogs_nas_eps_message_t *message)
@@ -2528,8 +2534,8 @@ int mme_ue_set_imsi(mme_ue_t *mme_ue, char *imsi_bcd)
     old_mme_ue = mme_ue_find_by_imsi(mme_ue->imsi, mme_ue->imsi_len);
     if (old_mme_ue) {
         /* Check if OLD mme_ue_t is different with NEW mme_ue_t */
-        if (ogs_pool_index(&mme_ue_pool, mme_ue) !=
-            ogs_pool_index(&mme_ue_pool, old_mme_ue)) {
+        if (ogs_cpool_index(&mme_ue_pool, mme_ue) !=
+            ogs_cpool_index(&mme_ue_pool, old_mme_ue)) {
             ogs_warn("[%s] OLD UE Context Release", mme_ue->imsi_bcd);
             if (ECM_CONNECTED(old_mme_ue)) {
                 /* Implcit S1 release */
@@ -2663,7 +2669,7 @@ mme_sess_t *mme_sess_add(mme_ue_t *mme_ue, uint8_t pti)
     ogs_assert(mme_ue);
     ogs_assert(pti != OGS_NAS_PROCEDURE_TRANSACTION_IDENTITY_UNASSIGNED);
 
-    ogs_pool_alloc(&mme_sess_pool, &sess);
+    ogs_cpool_alloc(&mme_sess_pool, &sess);
     ogs_assert(sess);
     memset(sess, 0, sizeof *sess);
 
@@ -2697,7 +2703,7 @@ void mme_sess_remove(mme_sess_t *sess)
     OGS_NAS_CLEAR_DATA(&sess->ue_pco);
     OGS_TLV_CLEAR_DATA(&sess->pgw_pco);
 
-    ogs_pool_free(&mme_sess_pool, sess);
+    ogs_cpool_free(&mme_sess_pool, sess);
 
     stats_remove_mme_session();
 }
@@ -2803,7 +2809,7 @@ mme_bearer_t *mme_bearer_add(mme_sess_t *sess)
     mme_ue = sess->mme_ue;
     ogs_assert(mme_ue);
 
-    ogs_pool_alloc(&mme_bearer_pool, &bearer);
+    ogs_cpool_alloc(&mme_bearer_pool, &bearer);
     ogs_assert(bearer);
     memset(bearer, 0, sizeof *bearer);
 
@@ -2855,7 +2861,7 @@ void mme_bearer_remove(mme_bearer_t *bearer)
     ogs_assert(bearer->ebi_node);
     ogs_pool_free(&bearer->mme_ue->ebi_pool, bearer->ebi_node);
     
-    ogs_pool_free(&mme_bearer_pool, bearer);
+    ogs_cpool_free(&mme_bearer_pool, bearer);
 }
 
 void mme_bearer_remove_all(mme_sess_t *sess)
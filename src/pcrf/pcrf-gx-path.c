@@ -50,8 +50,8 @@ ED3(uint8_t     ipv4:1;,
     struct timespec ts;             /* Time of sending the message */
 };
 
-static OGS_POOL(sess_state_pool, struct sess_state);
-static OGS_POOL(rx_sess_state_pool, struct rx_sess_state);
+static OGS_CPOOL(sess_state_pool, struct sess_state);
+static OGS_CPOOL(rx_sess_state_pool, struct rx_sess_state);
 static ogs_thread_mutex_t sess_state_mutex;
 
 static struct session_handler *pcrf_gx_reg = NULL;
@@ -76,7 +76,7 @@ static __inline__ struct sess_state *new_state(os0_t sid)
     ogs_assert(sid);
 
     ogs_thread_mutex_lock(&sess_state_mutex);
-    ogs_pool_alloc(&sess_state_pool, &new);
+    ogs_cpool_alloc(&sess_state_pool, &new);
     ogs_assert(new);
     memset(new, 0, sizeof(*new));
     ogs_thread_mutex_unlock(&sess_state_mutex);
@@ -97,7 +97,7 @@ static struct rx_sess_state *add_rx_state(struct sess_state *gx, os0_t sid)
     ogs_assert(sid);
 
     ogs_thread_mutex_lock(&sess_state_mutex);
-    ogs_pool_alloc(&rx_sess_state_pool, &new);
+    ogs_cpool_alloc(&rx_sess_state_pool, &new);
     ogs_assert(new);
     memset(new, 0, sizeof(*new));
     ogs_thread_mutex_unlock(&sess_state_mutex);
@@ -131,7 +131,7 @@ static int remove_rx_state(struct rx_sess_state *rx_sess_data)
         ogs_free(rx_sess_data->sid);
 
     ogs_thread_mutex_lock(&sess_state_mutex);
-    ogs_pool_free(&rx_sess_state_pool, rx_sess_data);
+    ogs_cpool_free(&rx_sess_state_pool, rx_sess_data);
     ogs_thread_mutex_unlock(&sess_state_mutex);
 
     return OGS_OK;
@@ -187,7 +187,7 @@ static void state_cleanup(struct sess_state *sess_data, os0_t sid, void *opaque)
     remove_rx_state_all(sess_data);
     
     ogs_thread_mutex_lock(&sess_state_mutex);
-    ogs_pool_free(&sess_state_pool, sess_data);
+    ogs_cpool_free(&sess_state_pool, sess_data);
     ogs_thread_mutex_unlock(&sess_state_mutex);
 }
 
@@ -1132,8 +1132,12 @@ int pcrf_gx_init(void)
 	struct disp_when data;
 
     ogs_thread_mutex_init(&sess_state_mutex);
-    ogs_pool_init(&sess_state_pool, ogs_app()->pool.sess);
-    ogs_pool_init(&rx_sess_state_pool, ogs_app()->pool.sess);
+    ogs_cpool_init(&sess_state_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&sess_state_pool, true);
+    ogs_cpool_init(&rx_sess_state_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&rx_sess_state_pool, true);
 
 	/* Install objects definitions for this application */
 	ret = ogs_diam_gx_init();
@@ -1174,8 +1178,8 @@ void pcrf_gx_final(void)
 	if (hdl_gx_ccr)
 		(void) fd_disp_unregister(&hdl_gx_ccr, NULL);
 
-    ogs_pool_final(&sess_state_pool);
-    ogs_pool_final(&rx_sess_state_pool);
+    ogs_cpool_final(&sess_state_pool);
+    ogs_cpool_final(&rx_sess_state_pool);
     ogs_thread_mutex_destroy(&sess_state_mutex);
 }
 
@@ -35,7 +35,7 @@ struct sess_state {
     struct timespec ts;         /* Time of sending the message */
 };
 
-static OGS_POOL(sess_state_pool, struct sess_state);
+static OGS_CPOOL(sess_state_pool, struct sess_state);
 static ogs_thread_mutex_t sess_state_mutex;
 
 static struct session_handler *pcrf_rx_reg = NULL;
@@ -50,7 +50,7 @@ static __inline__ struct sess_state *new_state(os0_t sid)
     struct sess_state *new = NULL;
 
     ogs_thread_mutex_lock(&sess_state_mutex);
-    ogs_pool_alloc(&sess_state_pool, &new);
+    ogs_cpool_alloc(&sess_state_pool, &new);
     ogs_assert(new);
     memset(new, 0, sizeof(*new));
     ogs_thread_mutex_unlock(&sess_state_mutex);
@@ -74,7 +74,7 @@ static void state_cleanup(struct sess_state *sess_data, os0_t sid, void *opaque)
         ogs_free(sess_data->peer_host);
 
     ogs_thread_mutex_lock(&sess_state_mutex);
-    ogs_pool_free(&sess_state_pool, sess_data);
+    ogs_cpool_free(&sess_state_pool, sess_data);
     ogs_thread_mutex_unlock(&sess_state_mutex);
 }
 
@@ -732,7 +732,9 @@ int pcrf_rx_init(void)
 	struct disp_when data;
 
     ogs_thread_mutex_init(&sess_state_mutex);
-    ogs_pool_init(&sess_state_pool, ogs_app()->pool.sess);
+    ogs_cpool_init(&sess_state_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&sess_state_pool, true);
 
 	/* Install objects definitions for this application */
 	ret = ogs_diam_rx_init();
@@ -783,6 +785,6 @@ void pcrf_rx_final(void)
 	if (hdl_rx_str)
 		(void) fd_disp_unregister(&hdl_rx_str, NULL);
 
-    ogs_pool_final(&sess_state_pool);
+    ogs_cpool_final(&sess_state_pool);
     ogs_thread_mutex_destroy(&sess_state_mutex);
 }
@@ -25,10 +25,10 @@ static sgwc_context_t self;
 
 int __sgwc_log_domain;
 
-static OGS_POOL(sgwc_ue_pool, sgwc_ue_t);
-static OGS_POOL(sgwc_sess_pool, sgwc_sess_t);
-static OGS_POOL(sgwc_bearer_pool, sgwc_bearer_t);
-static OGS_POOL(sgwc_tunnel_pool, sgwc_tunnel_t);
+static OGS_CPOOL(sgwc_ue_pool, sgwc_ue_t);
+static OGS_CPOOL(sgwc_sess_pool, sgwc_sess_t);
+static OGS_CPOOL(sgwc_bearer_pool, sgwc_bearer_t);
+static OGS_CPOOL(sgwc_tunnel_pool, sgwc_tunnel_t);
 
 static int context_initialized = 0;
 
@@ -55,10 +55,17 @@ void sgwc_context_init(void)
     ogs_list_init(&self.enb_s1u_list);
     ogs_list_init(&self.pgw_s5u_list);
 
-    ogs_pool_init(&sgwc_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&sgwc_sess_pool, ogs_app()->pool.sess);
-    ogs_pool_init(&sgwc_bearer_pool, ogs_app()->pool.bearer);
-    ogs_pool_init(&sgwc_tunnel_pool, ogs_app()->pool.tunnel);
+    ogs_cpool_init(&sgwc_ue_pool, ogs_app()->max.ue, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&sgwc_ue_pool, true);
+    ogs_cpool_init(&sgwc_sess_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&sgwc_sess_pool, true);
+    ogs_cpool_init(&sgwc_bearer_pool,
+            ogs_app()->pool.bearer, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&sgwc_bearer_pool, true);
+    ogs_cpool_init(&sgwc_tunnel_pool,
+            ogs_app()->pool.tunnel, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&sgwc_tunnel_pool, true);
 
     self.imsi_ue_hash = ogs_hash_make();
 
@@ -76,10 +83,10 @@ void sgwc_context_final(void)
     ogs_assert(self.imsi_ue_hash);
     ogs_hash_destroy(self.imsi_ue_hash);
 
-    ogs_pool_final(&sgwc_tunnel_pool);
-    ogs_pool_final(&sgwc_bearer_pool);
-    ogs_pool_final(&sgwc_sess_pool);
-    ogs_pool_final(&sgwc_ue_pool);
+    ogs_cpool_final(&sgwc_tunnel_pool);
+    ogs_cpool_final(&sgwc_bearer_pool);
+    ogs_cpool_final(&sgwc_sess_pool);
+    ogs_cpool_final(&sgwc_ue_pool);
 
     ogs_gtp_node_remove_all(&self.mme_s11_list);
     ogs_gtp_node_remove_all(&self.pgw_s5c_list);
@@ -311,11 +318,11 @@ sgwc_ue_t *sgwc_ue_add(uint8_t *imsi, int imsi_len)
     ogs_assert(imsi);
     ogs_assert(imsi_len);
 
-    ogs_pool_alloc(&sgwc_ue_pool, &sgwc_ue);
+    ogs_cpool_alloc(&sgwc_ue_pool, &sgwc_ue);
     ogs_assert(sgwc_ue);
     memset(sgwc_ue, 0, sizeof *sgwc_ue);
 
-    sgwc_ue->sgw_s11_teid = ogs_pool_index(&sgwc_ue_pool, sgwc_ue);
+    sgwc_ue->sgw_s11_teid = ogs_cpool_index(&sgwc_ue_pool, sgwc_ue);
     ogs_assert(sgwc_ue->sgw_s11_teid > 0 &&
                 sgwc_ue->sgw_s11_teid <= ogs_app()->max.ue);
 
@@ -346,7 +353,7 @@ int sgwc_ue_remove(sgwc_ue_t *sgwc_ue)
 
     sgwc_sess_remove_all(sgwc_ue);
 
-    ogs_pool_free(&sgwc_ue_pool, sgwc_ue);
+    ogs_cpool_free(&sgwc_ue_pool, sgwc_ue);
 
     ogs_info("[Removed] Number of SGWC-UEs is now %d",
             ogs_list_count(&self.sgw_ue_list));
@@ -383,7 +390,7 @@ sgwc_ue_t *sgwc_ue_find_by_imsi(uint8_t *imsi, int imsi_len)
 
 sgwc_ue_t *sgwc_ue_find_by_teid(uint32_t teid)
 {
-    return ogs_pool_find(&sgwc_ue_pool, teid);
+    return ogs_cpool_find(&sgwc_ue_pool, teid);
 }
 
 sgwc_sess_t *sgwc_sess_add(sgwc_ue_t *sgwc_ue, char *apn)
@@ -392,7 +399,7 @@ sgwc_sess_t *sgwc_sess_add(sgwc_ue_t *sgwc_ue, char *apn)
 
     ogs_assert(sgwc_ue);
 
-    ogs_pool_alloc(&sgwc_sess_pool, &sess);
+    ogs_cpool_alloc(&sgwc_sess_pool, &sess);
     if (!sess) {
         ogs_error("Maximum number of session[%lld] reached",
                     (long long)ogs_app()->pool.sess);
@@ -402,7 +409,7 @@ sgwc_sess_t *sgwc_sess_add(sgwc_ue_t *sgwc_ue, char *apn)
 
     ogs_pfcp_pool_init(&sess->pfcp);
 
-    sess->index = ogs_pool_index(&sgwc_sess_pool, sess);
+    sess->index = ogs_cpool_index(&sgwc_sess_pool, sess);
     ogs_assert(sess->index > 0 && sess->index <= ogs_app()->pool.sess);
 
     /* Set TEID & SEID */
@@ -534,7 +541,7 @@ int sgwc_sess_remove(sgwc_sess_t *sess)
 
     ogs_pfcp_pool_final(&sess->pfcp);
 
-    ogs_pool_free(&sgwc_sess_pool, sess);
+    ogs_cpool_free(&sgwc_sess_pool, sess);
 
     stats_remove_sgwc_session();
 
@@ -553,12 +560,12 @@ void sgwc_sess_remove_all(sgwc_ue_t *sgwc_ue)
 sgwc_sess_t *sgwc_sess_find(uint32_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&sgwc_sess_pool, index);
+    return ogs_cpool_find(&sgwc_sess_pool, index);
 }
 
 sgwc_sess_t* sgwc_sess_find_by_teid(uint32_t teid)
 {
-    return ogs_pool_find(&sgwc_sess_pool, teid);
+    return ogs_cpool_find(&sgwc_sess_pool, teid);
 }
 
 sgwc_sess_t *sgwc_sess_find_by_seid(uint64_t seid)
@@ -603,7 +610,7 @@ sgwc_bearer_t *sgwc_bearer_add(sgwc_sess_t *sess)
     sgwc_ue = sess->sgwc_ue;
     ogs_assert(sgwc_ue);
 
-    ogs_pool_alloc(&sgwc_bearer_pool, &bearer);
+    ogs_cpool_alloc(&sgwc_bearer_pool, &bearer);
     ogs_assert(bearer);
     memset(bearer, 0, sizeof *bearer);
 
@@ -632,7 +639,7 @@ int sgwc_bearer_remove(sgwc_bearer_t *bearer)
 
     sgwc_tunnel_remove_all(bearer);
 
-    ogs_pool_free(&sgwc_bearer_pool, bearer);
+    ogs_cpool_free(&sgwc_bearer_pool, bearer);
 
     return OGS_OK;
 }
@@ -648,7 +655,7 @@ void sgwc_bearer_remove_all(sgwc_sess_t *sess)
 
 sgwc_bearer_t *sgwc_bearer_find_by_sgwc_s5u_teid(uint32_t sgwc_s5u_teid)
 {
-    return ogs_pool_find(&sgwc_bearer_pool, sgwc_s5u_teid);
+    return ogs_cpool_find(&sgwc_bearer_pool, sgwc_s5u_teid);
 }
 
 sgwc_bearer_t *sgwc_bearer_find_by_sess_ebi(sgwc_sess_t *sess, uint8_t ebi)
@@ -722,12 +729,12 @@ sgwc_tunnel_t *sgwc_tunnel_add(
         ogs_fatal("Invalid interface type = %d", interface_type);
     }
 
-    ogs_pool_alloc(&sgwc_tunnel_pool, &tunnel);
+    ogs_cpool_alloc(&sgwc_tunnel_pool, &tunnel);
     ogs_assert(tunnel);
     memset(tunnel, 0, sizeof *tunnel);
 
     tunnel->interface_type = interface_type;
-    tunnel->index = ogs_pool_index(&sgwc_tunnel_pool, tunnel);
+    tunnel->index = ogs_cpool_index(&sgwc_tunnel_pool, tunnel);
     ogs_assert(tunnel->index > 0 && tunnel->index <= ogs_app()->pool.tunnel);
 
     pdr = ogs_pfcp_pdr_add(&sess->pfcp);
@@ -812,7 +819,7 @@ int sgwc_tunnel_remove(sgwc_tunnel_t *tunnel)
     if (tunnel->local_addr6)
         ogs_freeaddrinfo(tunnel->local_addr6);
 
-    ogs_pool_free(&sgwc_tunnel_pool, tunnel);
+    ogs_cpool_free(&sgwc_tunnel_pool, tunnel);
 
     return OGS_OK;
 }
@@ -828,7 +835,7 @@ void sgwc_tunnel_remove_all(sgwc_bearer_t *bearer)
 
 sgwc_tunnel_t *sgwc_tunnel_find_by_teid(uint32_t teid)
 {
-    return ogs_pool_find(&sgwc_tunnel_pool, teid);
+    return ogs_cpool_find(&sgwc_tunnel_pool, teid);
 }
 
 sgwc_tunnel_t *sgwc_tunnel_find_by_interface_type(
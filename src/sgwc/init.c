@@ -99,9 +99,10 @@ static void sgwc_main(void *data)
         ogs_timer_mgr_expire(ogs_app()->timer_mgr);
 
         for ( ;; ) {
-            sgwc_event_t *e = NULL;
+            sgwc_event_t *e[OGS_QUEUE_BATCH_SIZE];
+            unsigned int i, num = OGS_QUEUE_BATCH_SIZE;
 
-            rv = ogs_queue_trypop(ogs_app()->queue, (void**)&e);
+            rv = ogs_queue_trypop_batch(ogs_app()->queue, (void**)e, &num);
             ogs_assert(rv != OGS_ERROR);
 
             if (rv == OGS_DONE)
@@ -110,9 +111,11 @@ static void sgwc_main(void *data)
             if (rv == OGS_RETRY)
                 break;
 
-            ogs_assert(e);
-            ogs_fsm_dispatch(&sgwc_sm, e);
-            sgwc_event_free(e);
+            for (i = 0; i < num; i++) {
+                ogs_assert(e[i]);
+                ogs_fsm_dispatch(&sgwc_sm, e[i]);
+                sgwc_event_free(e[i]);
+            }
         }
     }
 done:
@@ -23,7 +23,7 @@ static sgwu_context_t self;
 
 int __sgwu_log_domain;
 
-static OGS_POOL(sgwu_sess_pool, sgwu_sess_t);
+static OGS_CPOOL(sgwu_sess_pool, sgwu_sess_t);
 
 static int context_initialized = 0;
 
@@ -47,7 +47,9 @@ void sgwu_context_init(void)
     ogs_list_init(&self.gtpu_list);
     ogs_list_init(&self.peer_list);
 
-    ogs_pool_init(&sgwu_sess_pool, ogs_app()->pool.sess);
+    ogs_cpool_init(&sgwu_sess_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&sgwu_sess_pool, true);
 
     self.sess_hash = ogs_hash_make();
 
@@ -63,7 +65,7 @@ void sgwu_context_final(void)
     ogs_assert(self.sess_hash);
     ogs_hash_destroy(self.sess_hash);
 
-    ogs_pool_final(&sgwu_sess_pool);
+    ogs_cpool_final(&sgwu_sess_pool);
 
     ogs_gtp_node_remove_all(&self.peer_list);
 
@@ -370,13 +372,13 @@ sgwu_sess_t *sgwu_sess_add(
     ogs_assert(cp_f_seid);
     ogs_assert(apn);
 
-    ogs_pool_alloc(&sgwu_sess_pool, &sess);
+    ogs_cpool_alloc(&sgwu_sess_pool, &sess);
     ogs_assert(sess);
     memset(sess, 0, sizeof *sess);
 
     ogs_pfcp_pool_init(&sess->pfcp);
 
-    sess->index = ogs_pool_index(&sgwu_sess_pool, sess);
+    sess->index = ogs_cpool_index(&sgwu_sess_pool, sess);
     ogs_assert(sess->index > 0 && sess->index <= ogs_app()->pool.sess);
 
     sess->sgwu_sxa_seid = sess->index;
@@ -410,7 +412,7 @@ int sgwu_sess_remove(sgwu_sess_t *sess)
 
     ogs_pfcp_pool_final(&sess->pfcp);
 
-    ogs_pool_free(&sgwu_sess_pool, sess);
+    ogs_cpool_free(&sgwu_sess_pool, sess);
 
     ogs_info("[Removed] Number of SGWU-sessions is now %d",
             ogs_list_count(&self.sess_list));
@@ -430,7 +432,7 @@ void sgwu_sess_remove_all(void)
 sgwu_sess_t *sgwu_sess_find(uint32_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&sgwu_sess_pool, index);
+    return ogs_cpool_find(&sgwu_sess_pool, index);
 }
 
 sgwu_sess_t *sgwu_sess_find_by_cp_seid(uint64_t seid)
@@ -23,16 +23,14 @@
 #define SGWU_GTP_HANDLED     1
 
 static ogs_pkbuf_pool_t *packet_pool = NULL;
+static ogs_pkbuf_t *gtpu_recvbuf[OGS_MAX_NUM_OF_UDP_BURST];
 
-static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
+static void sgwu_gtp_handle_gtpu(
+        ogs_socket_t fd, ogs_pkbuf_t *pkbuf, ogs_sockaddr_t *from)
 {
     int len;
-    ssize_t size;
     char buf[OGS_ADDRSTRLEN];
 
-    ogs_pkbuf_t *pkbuf = NULL;
-    ogs_sockaddr_t from;
-
     ogs_gtp_header_t *gtp_h = NULL;
     struct ip *ip_h = NULL;
 
@@ -42,23 +40,14 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     ogs_pfcp_user_plane_report_t report;
 
     ogs_assert(fd != INVALID_SOCKET);
-
-    pkbuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
     ogs_assert(pkbuf);
-    ogs_pkbuf_put(pkbuf, OGS_MAX_PKT_LEN);
+    ogs_assert(from);
 
-    size = ogs_recvfrom(fd, pkbuf->data, pkbuf->len, 0, &from);
-    if (size <= 0) {
-        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
-                "ogs_recv() failed");
+    if (pkbuf->len < OGS_GTPV1U_HEADER_LEN) {
+        ogs_error("[DROP] Too short GTPU packet [%d]", pkbuf->len);
         goto cleanup;
     }
 
-    ogs_pkbuf_trim(pkbuf, size);
-
-    ogs_assert(pkbuf);
-    ogs_assert(pkbuf->len);
-
     gtp_h = (ogs_gtp_header_t *)pkbuf->data;
     if (gtp_h->version != OGS_GTP_VERSION_1) {
         ogs_error("[DROP] Invalid GTPU version [%d]", gtp_h->version);
@@ -69,15 +58,15 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     if (gtp_h->type == OGS_GTPU_MSGTYPE_ECHO_REQ) {
         ogs_pkbuf_t *echo_rsp;
 
-        ogs_debug("[RECV] Echo Request from [%s]", OGS_ADDR(&from, buf));
+        ogs_debug("[RECV] Echo Request from [%s]", OGS_ADDR(from, buf));
         echo_rsp = ogs_gtp_handle_echo_req(pkbuf);
         if (echo_rsp) {
             ssize_t sent;
 
             /* Echo reply */
-            ogs_debug("[SEND] Echo Response to [%s]", OGS_ADDR(&from, buf));
+            ogs_debug("[SEND] Echo Response to [%s]", OGS_ADDR(from, buf));
 
-            sent = ogs_sendto(fd, echo_rsp->data, echo_rsp->len, 0, &from);
+            sent = ogs_sendto(fd, echo_rsp->data, echo_rsp->len, 0, from);
             if (sent < 0 || sent != echo_rsp->len) {
                 ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
                         "ogs_sendto() failed");
@@ -91,12 +80,12 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
 
     if (gtp_h->type == OGS_GTPU_MSGTYPE_END_MARKER) {
         ogs_debug("[RECV] End Marker from [%s] : TEID[0x%x]",
-                OGS_ADDR(&from, buf), teid);
+                OGS_ADDR(from, buf), teid);
         goto cleanup;
     }
 
     if (gtp_h->type == OGS_GTPU_MSGTYPE_ERR_IND) {
-        ogs_warn("[RECV] Error Indication from [%s]", OGS_ADDR(&from, buf));
+        ogs_warn("[RECV] Error Indication from [%s]", OGS_ADDR(from, buf));
         goto cleanup;
     }
 
@@ -107,7 +96,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     }
 
     ogs_debug("[RECV] GPU-U from [%s] : TEID[0x%x]",
-            OGS_ADDR(&from, buf), teid);
+            OGS_ADDR(from, buf), teid);
 
     qfi = 0;
     if (gtp_h->flags & OGS_GTPU_FLAGS_E) {
@@ -154,6 +143,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         goto cleanup;
     }
 
+    /* pkbuf is consumed by the PDR handler */
     ogs_pfcp_up_handle_pdr(pdr, pkbuf, &report);
 
     if (report.type.downlink_data_report) {
@@ -168,11 +158,43 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
 
         sgwu_pfcp_send_session_report_request(sess, &report);
     }
+    return;
 
 cleanup:
     ogs_pkbuf_free(pkbuf);
 }
 
+static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
+{
+    ogs_sockaddr_t from[OGS_MAX_NUM_OF_UDP_BURST];
+    int i, n;
+
+    ogs_assert(fd != INVALID_SOCKET);
+
+    /* Refill the receive vector consumed by the previous burst */
+    for (i = 0; i < OGS_MAX_NUM_OF_UDP_BURST; i++) {
+        if (gtpu_recvbuf[i])
+            continue;
+
+        gtpu_recvbuf[i] = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
+        ogs_assert(gtpu_recvbuf[i]);
+        ogs_pkbuf_put(gtpu_recvbuf[i], OGS_MAX_PKT_LEN);
+    }
+
+    n = ogs_recvmmsg(fd, gtpu_recvbuf, from, OGS_MAX_NUM_OF_UDP_BURST);
+    if (n <= 0)
+        return;
+
+    ogs_gtp_burst_begin();
+
+    for (i = 0; i < n; i++) {
+        sgwu_gtp_handle_gtpu(fd, gtpu_recvbuf[i], &from[i]);
+        gtpu_recvbuf[i] = NULL;
+    }
+
+    ogs_gtp_burst_end();
+}
+
 int sgwu_gtp_init(void)
 {
     ogs_pkbuf_config_t config;
@@ -187,6 +209,15 @@ int sgwu_gtp_init(void)
 
 void sgwu_gtp_final(void)
 {
+    int i;
+
+    for (i = 0; i < OGS_MAX_NUM_OF_UDP_BURST; i++) {
+        if (gtpu_recvbuf[i]) {
+            ogs_pkbuf_free(gtpu_recvbuf[i]);
+            gtpu_recvbuf[i] = NULL;
+        }
+    }
+
     ogs_pkbuf_pool_destroy(packet_pool);
 }
 
@@ -25,11 +25,11 @@ static ogs_diam_config_t g_diam_conf;
 int __smf_log_domain;
 int __gsm_log_domain;
 
-static OGS_POOL(smf_ue_pool, smf_ue_t);
-static OGS_POOL(smf_sess_pool, smf_sess_t);
-static OGS_POOL(smf_bearer_pool, smf_bearer_t);
+static OGS_CPOOL(smf_ue_pool, smf_ue_t);
+static OGS_CPOOL(smf_sess_pool, smf_sess_t);
+static OGS_CPOOL(smf_bearer_pool, smf_bearer_t);
 
-static OGS_POOL(smf_pf_pool, smf_pf_t);
+static OGS_CPOOL(smf_pf_pool, smf_pf_t);
 
 static int context_initialized = 0;
 
@@ -65,11 +65,19 @@ void smf_context_init(void)
 
     ogs_list_init(&self.sgw_s5c_list);
 
-    ogs_pool_init(&smf_ue_pool, ogs_app()->max.ue);
-    ogs_pool_init(&smf_sess_pool, ogs_app()->pool.sess);
-    ogs_pool_init(&smf_bearer_pool, ogs_app()->pool.bearer);
+    ogs_cpool_init(&smf_ue_pool, ogs_app()->max.ue, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&smf_ue_pool, true);
+    ogs_cpool_init(&smf_sess_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&smf_sess_pool, true);
+    ogs_cpool_init(&smf_bearer_pool,
+            ogs_app()->pool.bearer, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&smf_bearer_pool, true);
 
-    ogs_pool_init(&smf_pf_pool, ogs_app()->pool.bearer * OGS_MAX_NUM_OF_PF);
+    ogs_cpool_init(&smf_pf_pool,
+            ogs_app()->pool.bearer * OGS_MAX_NUM_OF_PF,
+            OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&smf_pf_pool, true);
 
     self.supi_hash = ogs_hash_make();
     self.imsi_hash = ogs_hash_make();
@@ -94,11 +102,11 @@ void smf_context_final(void)
     ogs_assert(self.ipv6_hash);
     ogs_hash_destroy(self.ipv6_hash);
 
-    ogs_pool_final(&smf_ue_pool);
-    ogs_pool_final(&smf_bearer_pool);
-    ogs_pool_final(&smf_sess_pool);
+    ogs_cpool_final(&smf_ue_pool);
+    ogs_cpool_final(&smf_bearer_pool);
+    ogs_cpool_final(&smf_sess_pool);
 
-    ogs_pool_final(&smf_pf_pool);
+    ogs_cpool_final(&smf_pf_pool);
 
     ogs_gtp_node_remove_all(&self.sgw_s5c_list);
 
@@ -516,7 +524,7 @@ smf_ue_t *smf_ue_add_by_supi(char *supi)
 
     ogs_assert(supi);
 
-    ogs_pool_alloc(&smf_ue_pool, &smf_ue);
+    ogs_cpool_alloc(&smf_ue_pool, &smf_ue);
     ogs_assert(smf_ue);
     memset(smf_ue, 0, sizeof *smf_ue);
 
@@ -541,7 +549,7 @@ smf_ue_t *smf_ue_add_by_imsi(uint8_t *imsi, int imsi_len)
     ogs_assert(imsi);
     ogs_assert(imsi_len);
 
-    ogs_pool_alloc(&smf_ue_pool, &smf_ue);
+    ogs_cpool_alloc(&smf_ue_pool, &smf_ue);
     ogs_assert(smf_ue);
     memset(smf_ue, 0, sizeof *smf_ue);
 
@@ -577,7 +585,7 @@ void smf_ue_remove(smf_ue_t *smf_ue)
 
     smf_sess_remove_all(smf_ue);
 
-    ogs_pool_free(&smf_ue_pool, smf_ue);
+    ogs_cpool_free(&smf_ue_pool, smf_ue);
 
     ogs_info("[Removed] Number of SMF-UEs is now %d",
             ogs_list_count(&self.smf_ue_list));
@@ -713,7 +721,7 @@ smf_sess_t *smf_sess_add_by_apn(smf_ue_t *smf_ue, char *apn)
     ogs_assert(smf_ue);
     ogs_assert(apn);
 
-    ogs_pool_alloc(&smf_sess_pool, &sess);
+    ogs_cpool_alloc(&smf_sess_pool, &sess);
     if (!sess) {
         ogs_error("Maximum number of session[%lld] reached",
                     (long long)ogs_app()->pool.sess);
@@ -724,7 +732,7 @@ smf_sess_t *smf_sess_add_by_apn(smf_ue_t *smf_ue, char *apn)
     ogs_pfcp_pool_init(&sess->pfcp);
     smf_qfi_pool_init(sess);
 
-    sess->index = ogs_pool_index(&smf_sess_pool, sess);
+    sess->index = ogs_cpool_index(&smf_sess_pool, sess);
     ogs_assert(sess->index > 0 && sess->index <= ogs_app()->pool.sess);
 
     /* Set TEID & SEID */
@@ -819,7 +827,7 @@ smf_sess_t *smf_sess_add_by_psi(smf_ue_t *smf_ue, uint8_t psi)
     ogs_assert(smf_ue);
     ogs_assert(psi != OGS_NAS_PDU_SESSION_IDENTITY_UNASSIGNED);
 
-    ogs_pool_alloc(&smf_sess_pool, &sess);
+    ogs_cpool_alloc(&smf_sess_pool, &sess);
     if (!sess) {
         ogs_error("Maximum number of session[%lld] reached",
             (long long)ogs_app()->pool.sess);
@@ -830,11 +838,11 @@ smf_sess_t *smf_sess_add_by_psi(smf_ue_t *smf_ue, uint8_t psi)
     ogs_pfcp_pool_init(&sess->pfcp);
     smf_qfi_pool_init(sess);
 
-    sess->index = ogs_pool_index(&smf_sess_pool, sess);
+    sess->index = ogs_cpool_index(&smf_sess_pool, sess);
     ogs_assert(sess->index > 0 && sess->index <= ogs_app()->pool.sess);
 
     sess->sm_context_ref = ogs_msprintf("%d",
-            (int)ogs_pool_index(&smf_sess_pool, sess));
+            (int)ogs_cpool_index(&smf_sess_pool, sess));
     ogs_assert(sess->sm_context_ref);
 
     /* Set PSI */
@@ -1062,7 +1070,7 @@ void smf_sess_remove(smf_sess_t *sess)
     ogs_pfcp_pool_final(&sess->pfcp);
     smf_qfi_pool_final(sess);
 
-    ogs_pool_free(&smf_sess_pool, sess);
+    ogs_cpool_free(&smf_sess_pool, sess);
 
     stats_remove_smf_session();
 }
@@ -1080,7 +1088,7 @@ void smf_sess_remove_all(smf_ue_t *smf_ue)
 smf_sess_t *smf_sess_find(uint32_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&smf_sess_pool, index);
+    return ogs_cpool_find(&smf_sess_pool, index);
 }
 
 smf_sess_t *smf_sess_find_by_teid(uint32_t teid)
@@ -1144,12 +1152,12 @@ smf_sess_t *smf_sess_find_by_ipv6(uint32_t *addr6)
 
 smf_ue_t *smf_ue_cycle(smf_ue_t *smf_ue)
 {
-    return ogs_pool_cycle(&smf_ue_pool, smf_ue);
+    return ogs_cpool_cycle(&smf_ue_pool, smf_ue);
 }
 
 smf_sess_t *smf_sess_cycle(smf_sess_t *sess)
 {
-    return ogs_pool_cycle(&smf_sess_pool, sess);
+    return ogs_cpool_cycle(&smf_sess_pool, sess);
 }
 
 smf_bearer_t *smf_qos_flow_add(smf_sess_t *sess)
@@ -1164,11 +1172,11 @@ smf_bearer_t *smf_qos_flow_add(smf_sess_t *sess)
 
     ogs_assert(sess);
 
-    ogs_pool_alloc(&smf_bearer_pool, &qos_flow);
+    ogs_cpool_alloc(&smf_bearer_pool, &qos_flow);
     ogs_assert(qos_flow);
     memset(qos_flow, 0, sizeof *qos_flow);
 
-    qos_flow->index = ogs_pool_index(&smf_bearer_pool, qos_flow);
+    qos_flow->index = ogs_cpool_index(&smf_bearer_pool, qos_flow);
     ogs_assert(qos_flow->index > 0 && qos_flow->index <=
             ogs_app()->pool.bearer);
 
@@ -1269,13 +1277,13 @@ smf_bearer_t *smf_bearer_add(smf_sess_t *sess)
 
     ogs_assert(sess);
 
-    ogs_pool_alloc(&smf_bearer_pool, &bearer);
+    ogs_cpool_alloc(&smf_bearer_pool, &bearer);
     ogs_assert(bearer);
     memset(bearer, 0, sizeof *bearer);
 
     smf_pf_identifier_pool_init(bearer);
 
-    bearer->index = ogs_pool_index(&smf_bearer_pool, bearer);
+    bearer->index = ogs_cpool_index(&smf_bearer_pool, bearer);
     ogs_assert(bearer->index > 0 && bearer->index <=
             ogs_app()->pool.bearer);
 
@@ -1395,7 +1403,7 @@ int smf_bearer_remove(smf_bearer_t *bearer)
     if (bearer->qfi_node)
         ogs_pool_free(&bearer->sess->qfi_pool, bearer->qfi_node);
 
-    ogs_pool_free(&smf_bearer_pool, bearer);
+    ogs_cpool_free(&smf_bearer_pool, bearer);
 
     return OGS_OK;
 }
@@ -1412,7 +1420,7 @@ void smf_bearer_remove_all(smf_sess_t *sess)
 smf_bearer_t *smf_bearer_find(uint32_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&smf_bearer_pool, index);
+    return ogs_cpool_find(&smf_bearer_pool, index);
 }
 
 smf_bearer_t *smf_bearer_find_by_pgw_s5u_teid(uint32_t pgw_s5u_teid)
@@ -1529,7 +1537,7 @@ smf_pf_t *smf_pf_add(smf_bearer_t *bearer, uint32_t precedence)
 
     ogs_assert(bearer);
 
-    ogs_pool_alloc(&smf_pf_pool, &pf);
+    ogs_cpool_alloc(&smf_pf_pool, &pf);
     ogs_assert(pf);
     memset(pf, 0, sizeof *pf);
 
@@ -1559,7 +1567,7 @@ int smf_pf_remove(smf_pf_t *pf)
     if (pf->identifier_node)
         ogs_pool_free(&pf->bearer->pf_identifier_pool, pf->identifier_node);
 
-    ogs_pool_free(&smf_pf_pool, pf);
+    ogs_cpool_free(&smf_pf_pool, pf);
 
     return OGS_OK;
 }
@@ -37,7 +37,7 @@ struct sess_state {
     struct timespec ts; /* Time of sending the message */
 };
 
-static OGS_POOL(sess_state_pool, struct sess_state);
+static OGS_CPOOL(sess_state_pool, struct sess_state);
 static ogs_thread_mutex_t sess_state_mutex;
 
 static int decode_pcc_rule_definition(
@@ -49,7 +49,7 @@ static __inline__ struct sess_state *new_state(os0_t sid)
     struct sess_state *new = NULL;
 
     ogs_thread_mutex_lock(&sess_state_mutex);
-    ogs_pool_alloc(&sess_state_pool, &new);
+    ogs_cpool_alloc(&sess_state_pool, &new);
     ogs_assert(new);
     ogs_thread_mutex_unlock(&sess_state_mutex);
 
@@ -65,7 +65,7 @@ static void state_cleanup(struct sess_state *sess_data, os0_t sid, void *opaque)
         ogs_free(sess_data->gx_sid);
 
     ogs_thread_mutex_lock(&sess_state_mutex);
-    ogs_pool_free(&sess_state_pool, sess_data);
+    ogs_cpool_free(&sess_state_pool, sess_data);
     ogs_thread_mutex_unlock(&sess_state_mutex);
 }
 
@@ -1056,7 +1056,9 @@ int smf_fd_init(void)
     }
 
     ogs_thread_mutex_init(&sess_state_mutex);
-    ogs_pool_init(&sess_state_pool, ogs_app()->pool.sess);
+    ogs_cpool_init(&sess_state_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&sess_state_pool, true);
 
     ret = ogs_diam_init(FD_MODE_CLIENT|FD_MODE_SERVER,
                 smf_self()->diam_conf_path, smf_self()->diam_config);
@@ -1126,7 +1128,7 @@ void smf_fd_final(void)
 
     ogs_diam_final();
 
-    ogs_pool_final(&sess_state_pool);
+    ogs_cpool_final(&sess_state_pool);
     ogs_thread_mutex_destroy(&sess_state_mutex);
 }
 
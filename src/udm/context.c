@@ -23,7 +23,7 @@ static udm_context_t self;
 
 int __udm_log_domain;
 
-static OGS_POOL(udm_ue_pool, udm_ue_t);
+static OGS_CPOOL(udm_ue_pool, udm_ue_t);
 
 static int context_initialized = 0;
 
@@ -37,7 +37,8 @@ void udm_context_init(void)
     ogs_log_install_domain(&__udm_log_domain, "udm", ogs_core()->log.level);
 
     /* Allocate TWICE the pool to check if maximum number of gNBs is reached */
-    ogs_pool_init(&udm_ue_pool, ogs_app()->max.ue);
+    ogs_cpool_init(&udm_ue_pool, ogs_app()->max.ue, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&udm_ue_pool, true);
 
     ogs_list_init(&self.udm_ue_list);
     self.suci_hash = ogs_hash_make();
@@ -57,7 +58,7 @@ void udm_context_final(void)
     ogs_assert(self.supi_hash);
     ogs_hash_destroy(self.supi_hash);
 
-    ogs_pool_final(&udm_ue_pool);
+    ogs_cpool_final(&udm_ue_pool);
 
     context_initialized = 0;
 }
@@ -122,12 +123,12 @@ udm_ue_t *udm_ue_add(char *suci)
 
     ogs_assert(suci);
 
-    ogs_pool_alloc(&udm_ue_pool, &udm_ue);
+    ogs_cpool_alloc(&udm_ue_pool, &udm_ue);
     ogs_assert(udm_ue);
     memset(udm_ue, 0, sizeof *udm_ue);
 
     udm_ue->ctx_id = ogs_msprintf("%d",
-            (int)ogs_pool_index(&udm_ue_pool, udm_ue));
+            (int)ogs_cpool_index(&udm_ue_pool, udm_ue));
     ogs_assert(udm_ue->ctx_id);
 
     udm_ue->suci = ogs_strdup(suci);
@@ -188,7 +189,7 @@ void udm_ue_remove(udm_ue_t *udm_ue)
     if (udm_ue->dereg_callback_uri)
         ogs_free(udm_ue->dereg_callback_uri);
 
-    ogs_pool_free(&udm_ue_pool, udm_ue);
+    ogs_cpool_free(&udm_ue_pool, udm_ue);
 }
 
 void udm_ue_remove_all()
@@ -222,11 +223,18 @@ udm_ue_t *udm_ue_find_by_suci_or_supi(char *suci_or_supi)
 
 udm_ue_t *udm_ue_find_by_ctx_id(char *ctx_id)
 {
+    long long index;
+
     ogs_assert(ctx_id);
-    return ogs_pool_find(&udm_ue_pool, atoll(ctx_id));
+
+    index = atoll(ctx_id);
+    if (index <= 0 || index > ogs_cpool_size(&udm_ue_pool))
+        return NULL;
+
+    return ogs_cpool_find(&udm_ue_pool, index);
 }
 
 udm_ue_t *udm_ue_cycle(udm_ue_t *udm_ue)
 {
-    return ogs_pool_cycle(&udm_ue_pool, udm_ue);
+    return ogs_cpool_cycle(&udm_ue_pool, udm_ue);
 }
@@ -40,14 +40,8 @@ bool udm_nudr_dr_handle_subscription_authentication(
     static int step = 0;
 #endif
 
-    uint8_t autn[OGS_AUTN_LEN];
-    uint8_t ik[OGS_KEY_LEN];
-    uint8_t ck[OGS_KEY_LEN];
-    uint8_t ak[OGS_AK_LEN];
-    uint8_t xres[OGS_MAX_RES_LEN];
-    size_t xres_len = 8;
-    uint8_t xres_star[OGS_MAX_RES_LEN];
-    uint8_t kausf[OGS_SHA256_DIGEST_SIZE];
+    ogs_auc_input_t input;
+    ogs_auc_vector_t vector;
 
     char rand_string[OGS_KEYSTRLEN(OGS_RAND_LEN)];
     char autn_string[OGS_KEYSTRLEN(OGS_AUTN_LEN)];
@@ -162,22 +156,18 @@ bool udm_nudr_dr_handle_subscription_authentication(
             else step = 0;
 #endif
 
-            milenage_generate(udm_ue->opc, udm_ue->amf, udm_ue->k, udm_ue->sqn,
-                    udm_ue->rand, autn, ik, ck, ak, xres, &xres_len);
-
             ogs_assert(udm_ue->serving_network_name);
 
-            /* TS33.501 Annex A.2 : Kausf derviation function */
-            ogs_kdf_kausf(
-                    ck, ik,
-                    udm_ue->serving_network_name, autn,
-                    kausf);
+            memset(&input, 0, sizeof(input));
+            input.k = udm_ue->k;
+            input.opc = udm_ue->opc;
+            input.amf = udm_ue->amf;
+            input.sqn = udm_ue->sqn;
+            input.rand = udm_ue->rand;
 
-            /* TS33.501 Annex A.4 : RES* and XRES* derivation function */
-            ogs_kdf_xres_star(
-                    ck, ik,
-                    udm_ue->serving_network_name, udm_ue->rand, xres, xres_len,
-                    xres_star);
+            /* Milenage, then TS33.501 Annex A.2 (KAUSF) and A.4 (XRES*) */
+            ogs_auc_5g_vectors(udm_ue->serving_network_name,
+                    &input, &vector, 1);
 
             memset(&AuthenticationVector, 0, sizeof(AuthenticationVector));
             AuthenticationVector.av_type = OpenAPI_av_type_5G_HE_AKA;
@@ -185,13 +175,13 @@ bool udm_nudr_dr_handle_subscription_authentication(
             ogs_hex_to_ascii(udm_ue->rand, sizeof(udm_ue->rand),
                     rand_string, sizeof(rand_string));
             AuthenticationVector.rand = rand_string;
-            ogs_hex_to_ascii(xres_star, sizeof(xres_star),
+            ogs_hex_to_ascii(vector.xres_star, sizeof(vector.xres_star),
                     xres_star_string, sizeof(xres_star_string));
             AuthenticationVector.xres_star = xres_star_string;
-            ogs_hex_to_ascii(autn, sizeof(autn),
+            ogs_hex_to_ascii(vector.autn, sizeof(vector.autn),
                     autn_string, sizeof(autn_string));
             AuthenticationVector.autn = autn_string;
-            ogs_hex_to_ascii(kausf, sizeof(kausf),
+            ogs_hex_to_ascii(vector.kausf, sizeof(vector.kausf),
                     kausf_string, sizeof(kausf_string));
             AuthenticationVector.kausf = kausf_string;
 
@@ -54,11 +54,20 @@ static int udr_context_prepare(void)
 {
     self.nf_type = OpenAPI_nf_type_UDR;
 
+#define DEFAULT_NUM_OF_DB_WORKER    4
+    self.db_worker = DEFAULT_NUM_OF_DB_WORKER;
+
     return OGS_OK;
 }
 
 static int udr_context_validation(void)
 {
+    if (self.db_worker <= 0) {
+        ogs_error("Invalid db_worker [%d] in `%s`",
+                self.db_worker, ogs_app()->file);
+        return OGS_ERROR;
+    }
+
     return OGS_OK;
 }
 
@@ -86,6 +95,9 @@ int udr_context_parse_config(void)
                 ogs_assert(udr_key);
                 if (!strcmp(udr_key, "sbi")) {
                     /* handle config in sbi library */
+                } else if (!strcmp(udr_key, "db_worker")) {
+                    const char *v = ogs_yaml_iter_value(&udr_iter);
+                    if (v) self.db_worker = atoi(v);
                 } else
                     ogs_warn("unknown key `%s`", udr_key);
             }
@@ -41,6 +41,8 @@ extern int __udr_log_domain;
 typedef struct udr_context_s {
     OpenAPI_nf_type_e   nf_type;
 
+    int                 db_worker;  /* Num of DB worker threads */
+
 } udr_context_t;
 
 #define UDR_NF_INSTANCE_CLEAR(_cAUSE, _nFInstance) \
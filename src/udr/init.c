@@ -44,6 +44,14 @@ int udr_initialize()
     rv = ogs_dbi_init(ogs_app()->db_uri);
     if (rv != OGS_OK) return rv;
 
+    rv = ogs_dbi_cache_init(ogs_app()->db_cache);
+    if (rv != OGS_OK) return rv;
+
+    /* Every DB job holds an SBI session, so bound them the same way */
+    rv = ogs_dbi_worker_init(udr_self()->db_worker,
+            ogs_app()->pool.nf, ogs_app()->pollset);
+    if (rv != OGS_OK) return rv;
+
     thread = ogs_thread_create(udr_main, NULL);
     if (!thread) return OGS_ERROR;
 
@@ -82,6 +90,8 @@ void udr_terminate(void)
     ogs_thread_destroy(thread);
     ogs_timer_delete(t_termination_holding);
 
+    ogs_dbi_worker_final();
+    ogs_dbi_cache_final();
     ogs_dbi_final();
 
     udr_context_final();
@@ -115,10 +125,14 @@ static void udr_main(void *data)
          */
         ogs_timer_mgr_expire(ogs_app()->timer_mgr);
 
+        /* Send the responses for the DB jobs that have finished */
+        ogs_dbi_worker_complete();
+
         for ( ;; ) {
-            udr_event_t *e = NULL;
+            udr_event_t *e[OGS_QUEUE_BATCH_SIZE];
+            unsigned int i, num = OGS_QUEUE_BATCH_SIZE;
 
-            rv = ogs_queue_trypop(ogs_app()->queue, (void**)&e);
+            rv = ogs_queue_trypop_batch(ogs_app()->queue, (void**)e, &num);
             ogs_assert(rv != OGS_ERROR);
 
             if (rv == OGS_DONE)
@@ -127,9 +141,11 @@ static void udr_main(void *data)
             if (rv == OGS_RETRY)
                 break;
 
-            ogs_assert(e);
-            ogs_fsm_dispatch(&udr_sm, e);
-            udr_event_free(e);
+            for (i = 0; i < num; i++) {
+                ogs_assert(e[i]);
+                ogs_fsm_dispatch(&udr_sm, e[i]);
+                udr_event_free(e[i]);
+            }
         }
     }
 done:
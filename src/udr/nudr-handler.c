@@ -21,14 +21,187 @@
 #include "nnrf-handler.h"
 #include "nudr-handler.h"
 
-bool udr_nudr_dr_handle_subscription_authentication(
-        ogs_sbi_session_t *session, ogs_sbi_message_t *recvmsg)
+/*
+ * A request waiting on the DB worker pool. It owns the parsed message
+ * until the response is sent from the event loop.
+ */
+typedef struct udr_dbi_s {
+    ogs_dbi_job_t job;
+
+    ogs_sbi_session_t *session;
+    ogs_sbi_message_t message;
+    char *supi;
+
+    uint64_t sqn;
+
+    /* Filled in on the worker thread */
+    int status;
+    const char *title;
+
+    ogs_dbi_auth_info_t auth_info;
+    ogs_subscription_data_t subscription_data;
+} udr_dbi_t;
+
+static udr_dbi_t *udr_dbi_new(ogs_sbi_session_t *session, char *supi)
+{
+    udr_dbi_t *dbi = NULL;
+
+    ogs_assert(session);
+    ogs_assert(supi);
+
+    dbi = ogs_calloc(1, sizeof(*dbi));
+    ogs_assert(dbi);
+
+    dbi->session = session;
+
+    /* The request buffer may go away with the server before the job */
+    dbi->supi = ogs_strdup(supi);
+    ogs_assert(dbi->supi);
+
+    dbi->job.data = dbi;
+
+    return dbi;
+}
+
+static void udr_dbi_free(udr_dbi_t *dbi)
+{
+    ogs_assert(dbi);
+
+    ogs_sbi_message_free(&dbi->message);
+    ogs_free(dbi->supi);
+    ogs_free(dbi);
+}
+
+static bool udr_dbi_submit(udr_dbi_t *dbi, ogs_sbi_message_t *recvmsg,
+        ogs_dbi_job_f run, ogs_dbi_job_f done)
 {
     int rv;
 
+    ogs_assert(dbi);
+    ogs_assert(recvmsg);
+    ogs_assert(run);
+    ogs_assert(done);
+
+    dbi->job.run = run;
+    dbi->job.done = done;
+
+    memcpy(&dbi->message, recvmsg, sizeof(*recvmsg));
+
+    rv = ogs_dbi_worker_submit(&dbi->job, dbi->supi);
+    if (rv != OGS_OK) {
+        ogs_sbi_server_send_error(dbi->session,
+                OGS_SBI_HTTP_STATUS_SERVICE_UNAVAILABLE,
+                recvmsg, "DB busy", dbi->supi);
+
+        /* The message still belongs to the caller */
+        ogs_free(dbi->supi);
+        ogs_free(dbi);
+        return false;
+    }
+
+    /* The job owns the message now; ogs_sbi_message_free() skips it */
+    memset(recvmsg, 0, sizeof(*recvmsg));
+
+    return true;
+}
+
+static void udr_dbi_send_no_content(ogs_dbi_job_t *job)
+{
+    udr_dbi_t *dbi = NULL;
+    ogs_sbi_message_t sendmsg;
+    ogs_sbi_response_t *response = NULL;
+
+    ogs_assert(job);
+    dbi = job->data;
+    ogs_assert(dbi);
+
+    if (job->cancelled)
+        goto out;
+
+    if (dbi->status) {
+        ogs_sbi_server_send_error(dbi->session, dbi->status,
+                &dbi->message, dbi->title, dbi->supi);
+        goto out;
+    }
+
+    memset(&sendmsg, 0, sizeof(sendmsg));
+
+    response = ogs_sbi_build_response(
+            &sendmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
+    ogs_assert(response);
+    ogs_sbi_server_send_response(dbi->session, response);
+
+out:
+    udr_dbi_free(dbi);
+}
+
+static void auth_info_run(ogs_dbi_job_t *job)
+{
+    udr_dbi_t *dbi = NULL;
+
+    ogs_assert(job);
+    dbi = job->data;
+    ogs_assert(dbi);
+
+    if (ogs_dbi_auth_info(dbi->supi, &dbi->auth_info) != OGS_OK) {
+        ogs_warn("[%s] Cannot find SUPI in DB", dbi->supi);
+        dbi->status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        dbi->title = "Cannot find SUPI Type";
+    }
+}
+
+/* SQN is set and moved on for the next vector in a single DB operation */
+static void update_sqn_run(ogs_dbi_job_t *job)
+{
+    int rv;
+    udr_dbi_t *dbi = NULL;
+
+    ogs_assert(job);
+    dbi = job->data;
+    ogs_assert(dbi);
+
+    rv = ogs_dbi_auth_info_and_update_sqn(dbi->supi,
+            (dbi->sqn + 32) & OGS_MAX_SQN, &dbi->auth_info);
+    if (rv == OGS_NOTFOUND) {
+        ogs_warn("[%s] Cannot find SUPI in DB", dbi->supi);
+        dbi->status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        dbi->title = "Cannot find SUPI Type";
+    } else if (rv != OGS_OK) {
+        ogs_error("[%s] Cannot update SQN", dbi->supi);
+        dbi->status = OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR;
+        dbi->title = "Cannot update SQN";
+    }
+}
+
+static void increment_sqn_run(ogs_dbi_job_t *job)
+{
+    int rv;
+    udr_dbi_t *dbi = NULL;
+
+    ogs_assert(job);
+    dbi = job->data;
+    ogs_assert(dbi);
+
+    rv = ogs_dbi_auth_info_and_increment_sqn(
+            dbi->supi, 1, &dbi->auth_info);
+    if (rv == OGS_NOTFOUND) {
+        ogs_warn("[%s] Cannot find SUPI in DB", dbi->supi);
+        dbi->status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        dbi->title = "Cannot find SUPI Type";
+    } else if (rv != OGS_OK) {
+        ogs_error("[%s] Cannot increment SQN", dbi->supi);
+        dbi->status = OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR;
+        dbi->title = "Cannot increment SQN";
+    }
+}
+
+static void authentication_subscription_done(ogs_dbi_job_t *job)
+{
+    udr_dbi_t *dbi = NULL;
+    ogs_dbi_auth_info_t *auth_info = NULL;
+
     ogs_sbi_message_t sendmsg;
     ogs_sbi_response_t *response = NULL;
-    ogs_dbi_auth_info_t auth_info;
 
     char k_string[OGS_KEYSTRLEN(OGS_KEY_LEN)];
     char opc_string[OGS_KEYSTRLEN(OGS_KEY_LEN)];
@@ -36,10 +209,73 @@ bool udr_nudr_dr_handle_subscription_authentication(
     char sqn_string[OGS_KEYSTRLEN(OGS_SQN_LEN)];
 
     char sqn[OGS_SQN_LEN];
-    char *supi = NULL;
 
     OpenAPI_authentication_subscription_t AuthenticationSubscription;
     OpenAPI_sequence_number_t SequenceNumber;
+
+    ogs_assert(job);
+    dbi = job->data;
+    ogs_assert(dbi);
+
+    if (job->cancelled)
+        goto out;
+
+    if (dbi->status) {
+        ogs_sbi_server_send_error(dbi->session, dbi->status,
+                &dbi->message, dbi->title, dbi->supi);
+        goto out;
+    }
+
+    auth_info = &dbi->auth_info;
+
+    memset(&AuthenticationSubscription, 0,
+            sizeof(AuthenticationSubscription));
+
+    AuthenticationSubscription.authentication_method =
+        OpenAPI_auth_method_5G_AKA;
+
+    ogs_hex_to_ascii(auth_info->k, sizeof(auth_info->k),
+            k_string, sizeof(k_string));
+    AuthenticationSubscription.enc_permanent_key = k_string;
+
+    ogs_hex_to_ascii(auth_info->amf, sizeof(auth_info->amf),
+            amf_string, sizeof(amf_string));
+    AuthenticationSubscription.authentication_management_field =
+            amf_string;
+
+    if (!auth_info->use_opc)
+        ogs_auc_opc(auth_info->k, auth_info->op, auth_info->opc);
+
+    ogs_hex_to_ascii(auth_info->opc, sizeof(auth_info->opc),
+            opc_string, sizeof(opc_string));
+    AuthenticationSubscription.enc_opc_key = opc_string;
+
+    ogs_uint64_to_buffer(auth_info->sqn, OGS_SQN_LEN, sqn);
+    ogs_hex_to_ascii(sqn, sizeof(sqn), sqn_string, sizeof(sqn_string));
+
+    memset(&SequenceNumber, 0, sizeof(SequenceNumber));
+    SequenceNumber.sqn = sqn_string;
+    AuthenticationSubscription.sequence_number = &SequenceNumber;
+
+    memset(&sendmsg, 0, sizeof(sendmsg));
+
+    ogs_assert(AuthenticationSubscription.authentication_method);
+    sendmsg.AuthenticationSubscription = &AuthenticationSubscription;
+
+    response = ogs_sbi_build_response(&sendmsg, OGS_SBI_HTTP_STATUS_OK);
+    ogs_assert(response);
+    ogs_sbi_server_send_response(dbi->session, response);
+
+out:
+    udr_dbi_free(dbi);
+}
+
+bool udr_nudr_dr_handle_subscription_authentication(
+        ogs_sbi_session_t *session, ogs_sbi_message_t *recvmsg)
+{
+    udr_dbi_t *dbi = NULL;
+    char *supi = NULL;
+
     OpenAPI_auth_event_t *AuthEvent = NULL;
     OpenAPI_list_t *PatchItemList = NULL;
     OpenAPI_lnode_t *node = NULL;
@@ -63,64 +299,19 @@ bool udr_nudr_dr_handle_subscription_authentication(
         return false;
     }
 
-    rv = ogs_dbi_auth_info(supi, &auth_info);
-    if (rv != OGS_OK) {
-        ogs_warn("[%s] Cannot find SUPI in DB", supi);
-        ogs_sbi_server_send_error(session, OGS_SBI_HTTP_STATUS_NOT_FOUND,
-                recvmsg, "Cannot find SUPI Type", supi);
-        return false;
-    }
-
     SWITCH(recvmsg->h.resource.component[3])
     CASE(OGS_SBI_RESOURCE_NAME_AUTHENTICATION_SUBSCRIPTION)
         SWITCH(recvmsg->h.method)
         CASE(OGS_SBI_HTTP_METHOD_GET)
-            memset(&AuthenticationSubscription, 0,
-                    sizeof(AuthenticationSubscription));
-
-            AuthenticationSubscription.authentication_method =
-                OpenAPI_auth_method_5G_AKA;
-
-            ogs_hex_to_ascii(auth_info.k, sizeof(auth_info.k),
-                    k_string, sizeof(k_string));
-            AuthenticationSubscription.enc_permanent_key = k_string;
+            dbi = udr_dbi_new(session, supi);
+            ogs_assert(dbi);
 
-            ogs_hex_to_ascii(auth_info.amf, sizeof(auth_info.amf),
-                    amf_string, sizeof(amf_string));
-            AuthenticationSubscription.authentication_management_field =
-                    amf_string;
-
-            if (!auth_info.use_opc)
-                milenage_opc(auth_info.k, auth_info.op, auth_info.opc);
-
-            ogs_hex_to_ascii(auth_info.opc, sizeof(auth_info.opc),
-                    opc_string, sizeof(opc_string));
-            AuthenticationSubscription.enc_opc_key = opc_string;
-
-            ogs_uint64_to_buffer(auth_info.sqn, OGS_SQN_LEN, sqn);
-            ogs_hex_to_ascii(sqn, sizeof(sqn), sqn_string, sizeof(sqn_string));
-
-            memset(&SequenceNumber, 0, sizeof(SequenceNumber));
-            SequenceNumber.sqn = sqn_string;
-            AuthenticationSubscription.sequence_number = &SequenceNumber;
-
-            memset(&sendmsg, 0, sizeof(sendmsg));
-
-            ogs_assert(AuthenticationSubscription.authentication_method);
-            sendmsg.AuthenticationSubscription =
-                &AuthenticationSubscription;
-
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_OK);
-            ogs_assert(response);
-            ogs_sbi_server_send_response(session, response);
-
-            return true;
+            return udr_dbi_submit(dbi, recvmsg,
+                    auth_info_run, authentication_subscription_done);
 
         CASE(OGS_SBI_HTTP_METHOD_PATCH)
             char *sqn_string = NULL;
             uint8_t sqn_ms[OGS_SQN_LEN];
-            uint64_t sqn = 0;
 
             PatchItemList = recvmsg->PatchItemList;
             if (!PatchItemList) {
@@ -144,36 +335,15 @@ bool udr_nudr_dr_handle_subscription_authentication(
                 return false;
             }
 
+            dbi = udr_dbi_new(session, supi);
+            ogs_assert(dbi);
+
             ogs_ascii_to_hex(sqn_string, strlen(sqn_string),
                     sqn_ms, sizeof(sqn_ms));
-            sqn = ogs_buffer_to_uint64(sqn_ms, OGS_SQN_LEN);
-
-            rv = ogs_dbi_update_sqn(supi, sqn);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot update SQN", supi);
-                ogs_sbi_server_send_error(session,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot update SQN", supi);
-                return false;
-            }
-
-            rv = ogs_dbi_increment_sqn(supi);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot increment SQN", supi);
-                ogs_sbi_server_send_error(session,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot increment SQN", supi);
-                return false;
-            }
-
-            memset(&sendmsg, 0, sizeof(sendmsg));
-
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
-            ogs_assert(response);
-            ogs_sbi_server_send_response(session, response);
+            dbi->sqn = ogs_buffer_to_uint64(sqn_ms, OGS_SQN_LEN);
 
-            return true;
+            return udr_dbi_submit(dbi, recvmsg,
+                    update_sqn_run, udr_dbi_send_no_content);
 
         DEFAULT
             ogs_error("Invalid HTTP method [%s]", recvmsg->h.method);
@@ -195,22 +365,11 @@ bool udr_nudr_dr_handle_subscription_authentication(
                 return false;
             }
 
-            memset(&sendmsg, 0, sizeof(sendmsg));
-            rv = ogs_dbi_increment_sqn(supi);
-            if (rv != OGS_OK) {
-                ogs_fatal("[%s] Cannot increment SQN", supi);
-                ogs_sbi_server_send_error(session,
-                        OGS_SBI_HTTP_STATUS_INTERNAL_SERVER_ERROR,
-                        recvmsg, "Cannot increment SQN", supi);
-                return false;
-            }
+            dbi = udr_dbi_new(session, supi);
+            ogs_assert(dbi);
 
-            response = ogs_sbi_build_response(
-                    &sendmsg, OGS_SBI_HTTP_STATUS_NO_CONTENT);
-            ogs_assert(response);
-            ogs_sbi_server_send_response(session, response);
-
-            return true;
+            return udr_dbi_submit(dbi, recvmsg,
+                    increment_sqn_run, udr_dbi_send_no_content);
 
         DEFAULT
             ogs_error("Invalid HTTP method [%s]", recvmsg->h.method);
@@ -306,50 +465,60 @@ static OpenAPI_pdu_session_type_e pdu_session_type_from_dbi(uint8_t pdn_type)
     }
 }
 
-bool udr_nudr_dr_handle_subscription_provisioned(
-        ogs_sbi_session_t *session, ogs_sbi_message_t *recvmsg)
+static void subscription_data_run(ogs_dbi_job_t *job)
+{
+    udr_dbi_t *dbi = NULL;
+
+    ogs_assert(job);
+    dbi = job->data;
+    ogs_assert(dbi);
+
+    if (ogs_dbi_subscription_data(
+                dbi->supi, &dbi->subscription_data) != OGS_OK) {
+        ogs_error("[%s] Cannot find SUPI in DB", dbi->supi);
+        dbi->status = OGS_SBI_HTTP_STATUS_NOT_FOUND;
+        dbi->title = "Cannot find SUPI Type";
+    }
+}
+
+static void subscription_provisioned_done(ogs_dbi_job_t *job)
 {
-    int rv, i;
+    int i;
+
+    udr_dbi_t *dbi = NULL;
+    ogs_sbi_session_t *session = NULL;
+    ogs_sbi_message_t *recvmsg = NULL;
 
     ogs_sbi_message_t sendmsg;
     ogs_sbi_response_t *response = NULL;
-    ogs_subscription_data_t subscription_data;
+    ogs_subscription_data_t *subscription_data = NULL;
 
     char *supi = NULL;
 
-    ogs_assert(session);
-    ogs_assert(recvmsg);
+    ogs_assert(job);
+    dbi = job->data;
+    ogs_assert(dbi);
 
-    supi = recvmsg->h.resource.component[1];
-    if (!supi) {
-        ogs_error("No SUPI");
-        ogs_sbi_server_send_error(session, OGS_SBI_HTTP_STATUS_BAD_REQUEST,
-                recvmsg, "No SUPI", NULL);
-        return false;
-    }
+    if (job->cancelled)
+        goto out;
 
-    if (strncmp(supi,
-            OGS_ID_SUPI_TYPE_IMSI, strlen(OGS_ID_SUPI_TYPE_IMSI)) != 0) {
-        ogs_error("[%s] Unknown SUPI Type", supi);
-        ogs_sbi_server_send_error(session, OGS_SBI_HTTP_STATUS_FORBIDDEN,
-                recvmsg, "Unknwon SUPI Type", supi);
-        return false;
-    }
+    session = dbi->session;
+    recvmsg = &dbi->message;
+    supi = dbi->supi;
+    subscription_data = &dbi->subscription_data;
 
-    rv = ogs_dbi_subscription_data(supi, &subscription_data);
-    if (rv != OGS_OK) {
-        ogs_error("[%s] Cannot find SUPI in DB", supi);
-        ogs_sbi_server_send_error(session, OGS_SBI_HTTP_STATUS_NOT_FOUND,
-                recvmsg, "Cannot find SUPI Type", supi);
-        return false;
+    if (dbi->status) {
+        ogs_sbi_server_send_error(session, dbi->status,
+                recvmsg, dbi->title, supi);
+        goto out;
     }
 
-    if (!subscription_data.ambr.uplink && !subscription_data.ambr.downlink) {
+    if (!subscription_data->ambr.uplink &&
+            !subscription_data->ambr.downlink) {
         ogs_error("[%s] No UE-AMBR", supi);
         ogs_sbi_server_send_error(session, OGS_SBI_HTTP_STATUS_NOT_FOUND,
                 recvmsg, "No UE-AMBR", supi);
-
-        return false;
+        goto out;
     }
 
     SWITCH(recvmsg->h.resource.component[4])
@@ -361,15 +530,15 @@ bool udr_nudr_dr_handle_subscription_provisioned(
         OpenAPI_lnode_t *node = NULL;
 
         subscribed_ue_ambr.uplink = ogs_sbi_bitrate_to_string(
-                subscription_data.ambr.uplink, OGS_SBI_BITRATE_KBPS);
+                subscription_data->ambr.uplink, OGS_SBI_BITRATE_KBPS);
         subscribed_ue_ambr.downlink = ogs_sbi_bitrate_to_string(
-                subscription_data.ambr.downlink, OGS_SBI_BITRATE_KBPS);
+                subscription_data->ambr.downlink, OGS_SBI_BITRATE_KBPS);
 
         gpsiList = OpenAPI_list_create();
 
-        for (i = 0; i < subscription_data.num_of_msisdn; i++) {
+        for (i = 0; i < subscription_data->num_of_msisdn; i++) {
             char *gpsi = ogs_msprintf("%s-%s",
-                    OGS_ID_GPSI_TYPE_MSISDN, subscription_data.msisdn[i].bcd);
+                    OGS_ID_GPSI_TYPE_MSISDN, subscription_data->msisdn[i].bcd);
             ogs_assert(gpsi);
             OpenAPI_list_add(gpsiList, gpsi);
         }
@@ -428,7 +597,7 @@ bool udr_nudr_dr_handle_subscription_provisioned(
             ogs_sbi_server_send_error(session,
                     OGS_SBI_HTTP_STATUS_NOT_FOUND,
                     recvmsg, "Cannot find S_NSSAI", supi);
-            return false;
+            goto out;
         }
 
         singleNSSAI.sst = recvmsg->param.s_nssai.sst;
@@ -436,8 +605,8 @@ bool udr_nudr_dr_handle_subscription_provisioned(
 
         dnnConfigurationList = OpenAPI_list_create();
 
-        for (i = 0; i < subscription_data.num_of_pdn; i++) {
-            ogs_pdn_t *pdn = &subscription_data.pdn[i];
+        for (i = 0; i < subscription_data->num_of_pdn; i++) {
+            ogs_pdn_t *pdn = &subscription_data->pdn[i];
             ogs_assert(pdn);
 
             if (recvmsg->param.dnn &&
@@ -453,15 +622,15 @@ bool udr_nudr_dr_handle_subscription_provisioned(
             }
 
             if (!pdn->ambr.uplink && !pdn->ambr.downlink) {
-                if (!subscription_data.ambr.uplink &&
-                        !subscription_data.ambr.downlink) {
+                if (!subscription_data->ambr.uplink &&
+                        !subscription_data->ambr.downlink) {
                     ogs_error("No Session-AMBR");
                     ogs_error("No UE-AMBR");
                     continue;
                 }
 
-                pdn->ambr.uplink = subscription_data.ambr.uplink;
-                pdn->ambr.downlink = subscription_data.ambr.downlink;
+                pdn->ambr.uplink = subscription_data->ambr.uplink;
+                pdn->ambr.downlink = subscription_data->ambr.downlink;
                 ogs_warn("No Session-AMBR : Set UE-AMBR to Session-AMBR "
                         "[DL-%lld:UL-%lld]",
                         (long long)pdn->ambr.downlink,
@@ -666,8 +835,41 @@ bool udr_nudr_dr_handle_subscription_provisioned(
                 OGS_SBI_HTTP_STATUS_MEHTOD_NOT_ALLOWED,
                 recvmsg, "Unknown resource name",
                 recvmsg->h.resource.component[3]);
-        return false;
+        goto out;
     END
 
-    return true;
+out:
+    udr_dbi_free(dbi);
+}
+
+bool udr_nudr_dr_handle_subscription_provisioned(
+        ogs_sbi_session_t *session, ogs_sbi_message_t *recvmsg)
+{
+    udr_dbi_t *dbi = NULL;
+    char *supi = NULL;
+
+    ogs_assert(session);
+    ogs_assert(recvmsg);
+
+    supi = recvmsg->h.resource.component[1];
+    if (!supi) {
+        ogs_error("No SUPI");
+        ogs_sbi_server_send_error(session, OGS_SBI_HTTP_STATUS_BAD_REQUEST,
+                recvmsg, "No SUPI", NULL);
+        return false;
+    }
+
+    if (strncmp(supi,
+            OGS_ID_SUPI_TYPE_IMSI, strlen(OGS_ID_SUPI_TYPE_IMSI)) != 0) {
+        ogs_error("[%s] Unknown SUPI Type", supi);
+        ogs_sbi_server_send_error(session, OGS_SBI_HTTP_STATUS_FORBIDDEN,
+                recvmsg, "Unknwon SUPI Type", supi);
+        return false;
+    }
+
+    dbi = udr_dbi_new(session, supi);
+    ogs_assert(dbi);
+
+    return udr_dbi_submit(dbi, recvmsg,
+            subscription_data_run, subscription_provisioned_done);
 }
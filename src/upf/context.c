@@ -18,12 +18,13 @@
  */
 
 #include "context.h"
+#include "rule-match.h"
 
 static upf_context_t self;
 
 int __upf_log_domain;
 
-static OGS_POOL(upf_sess_pool, upf_sess_t);
+static OGS_CPOOL(upf_sess_pool, upf_sess_t);
 
 static int context_initialized = 0;
 
@@ -47,7 +48,9 @@ void upf_context_init(void)
     ogs_list_init(&self.gtpu_list);
     ogs_list_init(&self.peer_list);
 
-    ogs_pool_init(&upf_sess_pool, ogs_app()->pool.sess);
+    ogs_cpool_init(&upf_sess_pool,
+            ogs_app()->pool.sess, OGS_CPOOL_DEFAULT_CHUNK);
+    ogs_cpool_set_release(&upf_sess_pool, true);
 
     self.sess_hash = ogs_hash_make();
     self.ipv4_hash = ogs_hash_make();
@@ -69,7 +72,7 @@ void upf_context_final(void)
     ogs_assert(self.ipv6_hash);
     ogs_hash_destroy(self.ipv6_hash);
 
-    ogs_pool_final(&upf_sess_pool);
+    ogs_cpool_final(&upf_sess_pool);
 
     ogs_gtp_node_remove_all(&self.peer_list);
 
@@ -359,6 +362,13 @@ int upf_context_parse_config(void)
                         ogs_list_for_each_safe(&list6, next_iter, iter)
                             ogs_list_add(&self.gtpu_list, iter);
                     }
+                } else if (!strcmp(upf_key, "worker")) {
+                    const char *v = ogs_yaml_iter_value(&upf_iter);
+                    if (v) self.num_of_worker = atoi(v);
+                    if (self.num_of_worker < 0) {
+                        ogs_warn("Ignore worker(%d)", self.num_of_worker);
+                        self.num_of_worker = 0;
+                    }
                 } else if (!strcmp(upf_key, "pdn")) {
                     /* handle config in pfcp library */
                 }
@@ -383,13 +393,13 @@ upf_sess_t *upf_sess_add(ogs_pfcp_f_seid_t *cp_f_seid,
     ogs_assert(apn);
     ogs_assert(ue_ip);
 
-    ogs_pool_alloc(&upf_sess_pool, &sess);
+    ogs_cpool_alloc(&upf_sess_pool, &sess);
     ogs_assert(sess);
     memset(sess, 0, sizeof *sess);
 
     ogs_pfcp_pool_init(&sess->pfcp);
 
-    sess->index = ogs_pool_index(&upf_sess_pool, sess);
+    sess->index = ogs_cpool_index(&upf_sess_pool, sess);
     ogs_assert(sess->index > 0 && sess->index <= ogs_app()->pool.sess);
 
     sess->upf_n4_seid = sess->index;
@@ -456,7 +466,7 @@ upf_sess_t *upf_sess_add(ogs_pfcp_f_seid_t *cp_f_seid,
     return sess;
 
 cleanup:
-    ogs_pool_free(&upf_sess_pool, sess);
+    ogs_cpool_free(&upf_sess_pool, sess);
     return NULL;
 }
 
@@ -466,6 +476,7 @@ int upf_sess_remove(upf_sess_t *sess)
 
     ogs_list_remove(&self.sess_list, sess);
     ogs_pfcp_sess_clear(&sess->pfcp);
+    upf_classifier_clear(sess);
 
     ogs_hash_set(self.sess_hash, &sess->smf_n4_seid,
             sizeof(sess->smf_n4_seid), NULL);
@@ -481,7 +492,7 @@ int upf_sess_remove(upf_sess_t *sess)
 
     ogs_pfcp_pool_final(&sess->pfcp);
 
-    ogs_pool_free(&upf_sess_pool, sess);
+    ogs_cpool_free(&upf_sess_pool, sess);
 
     ogs_info("[Removed] Number of UPF-sessions is now %d",
             ogs_list_count(&self.sess_list));
@@ -501,7 +512,7 @@ void upf_sess_remove_all(void)
 upf_sess_t *upf_sess_find(uint32_t index)
 {
     ogs_assert(index);
-    return ogs_pool_find(&upf_sess_pool, index);
+    return ogs_cpool_find(&upf_sess_pool, index);
 }
 
 upf_sess_t *upf_sess_find_by_cp_seid(uint64_t seid)
@@ -54,6 +54,8 @@ typedef struct upf_context_s {
 
     ogs_list_t      peer_list;    /* gNB N3 Node List */
 
+    int             num_of_worker;  /* Number of data-plane threads */
+
     ogs_hash_t      *sess_hash;     /* hash table (F-SEID) */
     ogs_hash_t      *ipv4_hash;     /* hash table (IPv4 Address) */
     ogs_hash_t      *ipv6_hash;     /* hash table (IPv6 Address) */
@@ -78,6 +80,9 @@ typedef struct upf_sess_s {
 
     char            *gx_sid;            /* Gx Session ID */
     ogs_pfcp_node_t *pfcp_node;
+
+    /* Compiled Downlink SDF Filters */
+    struct upf_classifier_s *classifier;
 } upf_sess_t;
 
 void upf_context_init(void);
@@ -38,60 +38,112 @@
 #include "event.h"
 #include "gtp-path.h"
 #include "rule-match.h"
+#include "worker.h"
 
 #define UPF_GTP_HANDLED     1
 
 static ogs_pkbuf_pool_t *packet_pool = NULL;
+static ogs_pkbuf_t *gtpu_recvbuf[OGS_MAX_NUM_OF_UDP_BURST];
 
-static void upf_gtp_handle_multicast(ogs_pkbuf_t *recvbuf);
+/*
+ * Serializes the PDR handling among the data-plane workers
+ * when the FAR buffers the packet or reports to the control thread
+ */
+static ogs_thread_mutex_t buffer_mutex;
+
+static bool upf_gtp_handle_multicast(ogs_pkbuf_t *recvbuf);
 static int upf_gtp_handle_slaac(upf_sess_t *sess, ogs_pkbuf_t *recvbuf);
 static int upf_gtp_send_router_advertisement(
         upf_sess_t *sess, uint8_t *ip6_dst);
 
+static void upf_gtp_handle_pdr(ogs_pfcp_pdr_t *pdr, ogs_pkbuf_t *recvbuf)
+{
+    ogs_pfcp_far_t *far = NULL;
+    ogs_pfcp_user_plane_report_t report;
+
+    ogs_assert(pdr);
+    far = pdr->far;
+
+    /* Plain forwarding only reads the FAR */
+    if (far && far->gnode &&
+        (far->apply_action & OGS_PFCP_APPLY_ACTION_FORW)) {
+        ogs_pfcp_up_handle_pdr(pdr, recvbuf, &report);
+        return;
+    }
+
+    ogs_thread_mutex_lock(&buffer_mutex);
+    ogs_pfcp_up_handle_pdr(pdr, recvbuf, &report);
+    ogs_thread_mutex_unlock(&buffer_mutex);
+}
+
 static void _gtpv1_tun_recv_cb(short when, ogs_socket_t fd, void *data)
 {
+    upf_worker_t *worker = data;
+    ogs_pkbuf_t *burst[OGS_MAX_NUM_OF_UDP_BURST];
     ogs_pkbuf_t *recvbuf = NULL;
-    int n;
+    int i, n, num;
     ogs_pfcp_pdr_t *pdr = NULL;
-    ogs_pfcp_user_plane_report_t report;
 
-    recvbuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
-    ogs_assert(recvbuf);
-    ogs_pkbuf_reserve(recvbuf, OGS_GTPV1U_5GC_HEADER_LEN);
-    ogs_pkbuf_put(recvbuf, OGS_MAX_PKT_LEN-OGS_GTPV1U_5GC_HEADER_LEN);
+    /*
+     * Drain up to OGS_MAX_NUM_OF_UDP_BURST packets per wakeup
+     * so that the G-PDUs are sent to the peers in sendmmsg() bursts
+     */
+    for (num = 0; num < OGS_MAX_NUM_OF_UDP_BURST; num++) {
+        recvbuf = ogs_pkbuf_alloc(packet_pool, OGS_MAX_PKT_LEN);
+        ogs_assert(recvbuf);
+        ogs_pkbuf_reserve(recvbuf, OGS_GTPV1U_5GC_HEADER_LEN);
+        ogs_pkbuf_put(recvbuf, OGS_MAX_PKT_LEN-OGS_GTPV1U_5GC_HEADER_LEN);
+
+        /* EAGAIN means that the TUN queue is drained */
+        n = ogs_read(fd, recvbuf->data, recvbuf->len);
+        if (n <= 0) {
+            ogs_pkbuf_free(recvbuf);
+            break;
+        }
 
-    n = ogs_read(fd, recvbuf->data, recvbuf->len);
-    if (n <= 0) {
-        ogs_log_message(OGS_LOG_WARN, ogs_socket_errno, "ogs_read() failed");
-        ogs_pkbuf_free(recvbuf);
-        return;
+        ogs_pkbuf_trim(recvbuf, n);
+        burst[num] = recvbuf;
     }
 
-    ogs_pkbuf_trim(recvbuf, n);
+    if (num == 0)
+        return;
+
+    ogs_gtp_burst_begin();
+    if (worker)
+        ogs_thread_mutex_lock(&worker->mutex);
+
+    for (i = 0; i < num; i++) {
+        recvbuf = burst[i];
+
+        /* Find the PDR by packet filter */
+        pdr = upf_pdr_find_by_packet(recvbuf);
+        if (pdr) {
+            /* Unicast : recvbuf is consumed by the PDR handler */
+            upf_gtp_handle_pdr(pdr, recvbuf);
+            continue;
+        }
 
-    /* Find the PDR by packet filter */
-    pdr = upf_pdr_find_by_packet(recvbuf);
-    if (pdr) {
-        /* Unicast */
-        ogs_pfcp_up_handle_pdr(pdr, recvbuf, &report);
-    } else {
         if (ogs_app()->parameter.multicast) {
-            upf_gtp_handle_multicast(recvbuf);
+            if (upf_gtp_handle_multicast(recvbuf) == true)
+                continue;
         }
+
+        ogs_pkbuf_free(recvbuf);
     }
 
-    ogs_pkbuf_free(recvbuf);
+    if (worker)
+        ogs_thread_mutex_unlock(&worker->mutex);
+
+    /* Send the G-PDUs after releasing the worker */
+    ogs_gtp_burst_end();
 }
 
-static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
+static void upf_gtp_handle_gtpu(upf_worker_t *worker,
+        ogs_socket_t fd, ogs_pkbuf_t *pkbuf, ogs_sockaddr_t *from)
 {
     int rv, len;
-    ssize_t size;
     char buf[OGS_ADDRSTRLEN];
 
-    ogs_pkbuf_t *pkbuf = NULL;
-    ogs_sockaddr_t from;
-
     ogs_gtp_header_t *gtp_h = NULL;
     struct ip *ip_h = NULL;
 
@@ -101,25 +153,17 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     upf_sess_t *sess = NULL;
     ogs_pfcp_subnet_t *subnet = NULL;
     ogs_pfcp_dev_t *dev = NULL;
+    ogs_socket_t tun_fd;
 
     ogs_assert(fd != INVALID_SOCKET);
-
-    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_PKT_LEN);
     ogs_assert(pkbuf);
-    ogs_pkbuf_put(pkbuf, OGS_MAX_PKT_LEN);
+    ogs_assert(from);
 
-    size = ogs_recvfrom(fd, pkbuf->data, pkbuf->len, 0, &from);
-    if (size <= 0) {
-        ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
-                "ogs_recv() failed");
+    if (pkbuf->len < OGS_GTPV1U_HEADER_LEN) {
+        ogs_error("[DROP] Too short GTPU packet [%d]", pkbuf->len);
         goto cleanup;
     }
 
-    ogs_pkbuf_trim(pkbuf, size);
-
-    ogs_assert(pkbuf);
-    ogs_assert(pkbuf->len);
-
     gtp_h = (ogs_gtp_header_t *)pkbuf->data;
     if (gtp_h->version != OGS_GTP_VERSION_1) {
         ogs_error("[DROP] Invalid GTPU version [%d]", gtp_h->version);
@@ -130,15 +174,15 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     if (gtp_h->type == OGS_GTPU_MSGTYPE_ECHO_REQ) {
         ogs_pkbuf_t *echo_rsp;
 
-        ogs_debug("[RECV] Echo Request from [%s]", OGS_ADDR(&from, buf));
+        ogs_debug("[RECV] Echo Request from [%s]", OGS_ADDR(from, buf));
         echo_rsp = ogs_gtp_handle_echo_req(pkbuf);
         if (echo_rsp) {
             ssize_t sent;
 
             /* Echo reply */
-            ogs_debug("[SEND] Echo Response to [%s]", OGS_ADDR(&from, buf));
+            ogs_debug("[SEND] Echo Response to [%s]", OGS_ADDR(from, buf));
 
-            sent = ogs_sendto(fd, echo_rsp->data, echo_rsp->len, 0, &from);
+            sent = ogs_sendto(fd, echo_rsp->data, echo_rsp->len, 0, from);
             if (sent < 0 || sent != echo_rsp->len) {
                 ogs_log_message(OGS_LOG_ERROR, ogs_socket_errno,
                         "ogs_sendto() failed");
@@ -152,12 +196,12 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
 
     if (gtp_h->type == OGS_GTPU_MSGTYPE_END_MARKER) {
         ogs_debug("[RECV] End Marker from [%s] : TEID[0x%x]",
-                OGS_ADDR(&from, buf), teid);
+                OGS_ADDR(from, buf), teid);
         goto cleanup;
     }
 
     if (gtp_h->type == OGS_GTPU_MSGTYPE_ERR_IND) {
-        ogs_warn("[RECV] Error Indication from [%s]", OGS_ADDR(&from, buf));
+        ogs_warn("[RECV] Error Indication from [%s]", OGS_ADDR(from, buf));
         goto cleanup;
     }
 
@@ -168,7 +212,7 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
     }
 
     ogs_debug("[RECV] GPU-U from [%s] : TEID[0x%x]",
-            OGS_ADDR(&from, buf), teid);
+            OGS_ADDR(from, buf), teid);
 
     qfi = 0;
     if (gtp_h->flags & OGS_GTPU_FLAGS_E) {
@@ -241,16 +285,60 @@ static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
         ogs_assert(rv == OGS_OK);
     }
 
+    /* Uplink MBR */
+    if (ogs_pfcp_up_police_pdr(pdr, pkbuf->len) == false)
+        goto cleanup;
+
+    /* Each worker writes to its own queue of the TUN device */
     dev = subnet->dev;
     ogs_assert(dev);
-    if (ogs_write(dev->fd, pkbuf->data, pkbuf->len) <= 0)
+    tun_fd = upf_worker_tun_fd(worker, dev);
+    ogs_assert(tun_fd != INVALID_SOCKET);
+    if (ogs_write(tun_fd, pkbuf->data, pkbuf->len) <= 0)
         ogs_error("ogs_write() failed");
+    else
+        ogs_pfcp_up_measure_pdr(pdr, pkbuf->len);
 
 cleanup:
     ogs_pkbuf_free(pkbuf);
 }
 
 
+static void _gtpv1_u_recv_cb(short when, ogs_socket_t fd, void *data)
+{
+    upf_worker_t *worker = data;
+    ogs_pkbuf_t **recvbuf = worker ? worker->recvbuf : gtpu_recvbuf;
+    ogs_sockaddr_t from[OGS_MAX_NUM_OF_UDP_BURST];
+    int i, n;
+
+    ogs_assert(fd != INVALID_SOCKET);
+
+    /* Refill the receive vector consumed by the previous burst */
+    for (i = 0; i < OGS_MAX_NUM_OF_UDP_BURST; i++) {
+        if (recvbuf[i])
+            continue;
+
+        recvbuf[i] = ogs_pkbuf_alloc(NULL, OGS_MAX_PKT_LEN);
+        ogs_assert(recvbuf[i]);
+        ogs_pkbuf_put(recvbuf[i], OGS_MAX_PKT_LEN);
+    }
+
+    n = ogs_recvmmsg(fd, recvbuf, from, OGS_MAX_NUM_OF_UDP_BURST);
+    if (n <= 0)
+        return;
+
+    if (worker)
+        ogs_thread_mutex_lock(&worker->mutex);
+
+    for (i = 0; i < n; i++) {
+        upf_gtp_handle_gtpu(worker, fd, recvbuf[i], &from[i]);
+        recvbuf[i] = NULL;
+    }
+
+    if (worker)
+        ogs_thread_mutex_unlock(&worker->mutex);
+}
+
 int upf_gtp_init(void)
 {
     ogs_pkbuf_config_t config;
@@ -260,11 +348,24 @@ int upf_gtp_init(void)
 
     packet_pool = ogs_pkbuf_pool_create(&config);
 
+    ogs_thread_mutex_init(&buffer_mutex);
+
     return OGS_OK;
 }
 
 void upf_gtp_final(void)
 {
+    int i;
+
+    for (i = 0; i < OGS_MAX_NUM_OF_UDP_BURST; i++) {
+        if (gtpu_recvbuf[i]) {
+            ogs_pkbuf_free(gtpu_recvbuf[i]);
+            gtpu_recvbuf[i] = NULL;
+        }
+    }
+
+    ogs_thread_mutex_destroy(&buffer_mutex);
+
     ogs_pkbuf_pool_destroy(packet_pool);
 }
 
@@ -277,6 +378,10 @@ int upf_gtp_open(void)
     int rc;
 
     ogs_list_for_each(&upf_self()->gtpu_list, node) {
+        /* Share the GTP-U port with the data-plane workers */
+        if (upf_self()->num_of_worker)
+            ogs_socknode_reuseport(node, 1);
+
         sock = ogs_gtp_server(node);
         ogs_assert(sock);
 
@@ -285,8 +390,9 @@ int upf_gtp_open(void)
         else if (sock->family == AF_INET6)
             upf_self()->gtpu_sock6 = sock;
 
-        node->poll = ogs_pollset_add(ogs_app()->pollset,
-                OGS_POLLIN, sock->fd, _gtpv1_u_recv_cb, sock);
+        if (upf_self()->num_of_worker == 0)
+            node->poll = ogs_pollset_add(ogs_app()->pollset,
+                    OGS_POLLIN, sock->fd, _gtpv1_u_recv_cb, NULL);
     }
 
     ogs_assert(upf_self()->gtpu_sock || upf_self()->gtpu_sock6);
@@ -304,15 +410,21 @@ int upf_gtp_open(void)
 
     /* Open Tun interface */
     ogs_list_for_each(&ogs_pfcp_self()->dev_list, dev) {
-        dev->fd = ogs_tun_open(dev->ifname, OGS_MAX_IFNAME_LEN, 0);
+        if (upf_self()->num_of_worker)
+            dev->fd = ogs_tun_open_multi_queue(
+                    dev->ifname, OGS_MAX_IFNAME_LEN, 0);
+        else
+            dev->fd = ogs_tun_open(dev->ifname, OGS_MAX_IFNAME_LEN, 0);
         if (dev->fd == INVALID_SOCKET) {
             ogs_error("tun_open(dev:%s) failed", dev->ifname);
             return OGS_ERROR;
         }
 
-        dev->poll = ogs_pollset_add(ogs_app()->pollset,
-                OGS_POLLIN, dev->fd, _gtpv1_tun_recv_cb, NULL);
-        ogs_assert(dev->poll);
+        if (upf_self()->num_of_worker == 0) {
+            dev->poll = ogs_pollset_add(ogs_app()->pollset,
+                    OGS_POLLIN, dev->fd, _gtpv1_tun_recv_cb, NULL);
+            ogs_assert(dev->poll);
+        }
     }
 
     /* 
@@ -339,6 +451,15 @@ int upf_gtp_open(void)
     ogs_list_for_each(&ogs_pfcp_self()->dev_list, dev)
         dev->link_local_addr = ogs_link_local_addr_by_dev(dev->ifname);
 
+    /* The workers take over the GTP-U sockets and the TUN queues */
+    if (upf_self()->num_of_worker) {
+        rc = upf_worker_open(_gtpv1_u_recv_cb, _gtpv1_tun_recv_cb);
+        if (rc != OGS_OK) {
+            ogs_error("upf_worker_open() failed");
+            return OGS_ERROR;
+        }
+    }
+
     return OGS_OK;
 }
 
@@ -346,6 +467,8 @@ void upf_gtp_close(void)
 {
     ogs_pfcp_dev_t *dev = NULL;
 
+    upf_worker_close();
+
     ogs_socknode_remove_all(&upf_self()->gtpu_list);
 
     ogs_list_for_each(&ogs_pfcp_self()->dev_list, dev) {
@@ -355,11 +478,10 @@ void upf_gtp_close(void)
     }
 }
 
-static void upf_gtp_handle_multicast(ogs_pkbuf_t *recvbuf)
+static bool upf_gtp_handle_multicast(ogs_pkbuf_t *recvbuf)
 {
     struct ip *ip_h =  NULL;
     struct ip6_hdr *ip6_h =  NULL;
-    ogs_pfcp_user_plane_report_t report;
 
     ip_h = (struct ip *)recvbuf->data;
     if (ip_h->ip_v == 6) {
@@ -384,12 +506,14 @@ static void upf_gtp_handle_multicast(ogs_pkbuf_t *recvbuf)
                     pdr = OGS_DEFAULT_DL_PDR(&sess->pfcp);
                     ogs_assert(pdr);
 
-                    ogs_pfcp_up_handle_pdr(pdr, recvbuf, &report);
-                    return;
+                    upf_gtp_handle_pdr(pdr, recvbuf);
+                    return true;
                 }
             }
         }
     }
+
+    return false;
 }
 
 static int upf_gtp_handle_slaac(upf_sess_t *sess, ogs_pkbuf_t *recvbuf)
@@ -426,7 +550,6 @@ static int upf_gtp_send_router_advertisement(
 {
     int rv;
     ogs_pkbuf_t *pkbuf = NULL;
-    ogs_pfcp_user_plane_report_t report;
 
     ogs_pfcp_pdr_t *pdr = NULL;
     ogs_pfcp_far_t *far = NULL;
@@ -510,10 +633,9 @@ static int upf_gtp_send_router_advertisement(
     memcpy(ip6_h->ip6_src.s6_addr, src_ipsub.sub, sizeof src_ipsub.sub);
     memcpy(ip6_h->ip6_dst.s6_addr, ip6_dst, OGS_IPV6_LEN);
     
-    ogs_pfcp_up_handle_pdr(pdr, pkbuf, &report);
+    upf_gtp_handle_pdr(pdr, pkbuf);
 
     ogs_debug("      Router Advertisement");
 
-    ogs_pkbuf_free(pkbuf);
     return rv;
 }
@@ -19,6 +19,7 @@
 
 #include "context.h"
 #include "gtp-path.h"
+#include "worker.h"
 
 static ogs_thread_t *thread;
 static void upf_main(void *data);
@@ -98,24 +99,38 @@ static void upf_main(void *data)
          * because 'if rv == OGS_DONE' statement is exiting and
          * not calling ogs_timer_mgr_expire().
          */
+
+        /*
+         * The data-plane workers must be stopped
+         * while the contexts are being updated.
+         */
+        upf_worker_lock_all();
+
         ogs_timer_mgr_expire(ogs_app()->timer_mgr);
 
         for ( ;; ) {
-            upf_event_t *e = NULL;
+            upf_event_t *e[OGS_QUEUE_BATCH_SIZE];
+            unsigned int i, num = OGS_QUEUE_BATCH_SIZE;
 
-            rv = ogs_queue_trypop(ogs_app()->queue, (void**)&e);
+            rv = ogs_queue_trypop_batch(ogs_app()->queue, (void**)e, &num);
             ogs_assert(rv != OGS_ERROR);
 
-            if (rv == OGS_DONE)
+            if (rv == OGS_DONE) {
+                upf_worker_unlock_all();
                 goto done;
+            }
 
             if (rv == OGS_RETRY)
                 break;
 
-            ogs_assert(e);
-            ogs_fsm_dispatch(&upf_sm, e);
-            upf_event_free(e);
+            for (i = 0; i < num; i++) {
+                ogs_assert(e[i]);
+                ogs_fsm_dispatch(&upf_sm, e[i]);
+                upf_event_free(e[i]);
+            }
         }
+
+        upf_worker_unlock_all();
     }
 done:
 
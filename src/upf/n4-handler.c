@@ -21,6 +21,7 @@
 #include "pfcp-path.h"
 #include "gtp-path.h"
 #include "n4-handler.h"
+#include "rule-match.h"
 
 static void setup_gtp_node(ogs_pfcp_far_t *far)
 {
@@ -104,6 +105,14 @@ void upf_n4_handle_session_establishment_request(
     if (cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED)
         goto cleanup;
 
+    for (i = 0; i < OGS_ARRAY_SIZE(req->create_urr); i++) {
+        if (ogs_pfcp_handle_create_urr(&sess->pfcp, &req->create_urr[i],
+                    &cause_value, &offending_ie_value) == NULL)
+            break;
+    }
+    if (cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED)
+        goto cleanup;
+
     /* Setup GTP Node */
     ogs_list_for_each(&sess->pfcp.far_list, far)
         setup_gtp_node(far);
@@ -119,6 +128,9 @@ void upf_n4_handle_session_establishment_request(
         }
     }
 
+    /* Compile Downlink SDF Filters */
+    upf_classifier_build(sess);
+
     /* Send Buffered Packet to gNB/SGW */
     ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
         if (pdr->src_if == OGS_PFCP_INTERFACE_CORE) { /* Downlink */
@@ -132,6 +144,7 @@ void upf_n4_handle_session_establishment_request(
 
 cleanup:
     ogs_pfcp_sess_clear(&sess->pfcp);
+    upf_classifier_build(sess);
     ogs_pfcp_send_error_message(xact, sess ? sess->smf_n4_seid : 0,
             OGS_PFCP_SESSION_ESTABLISHMENT_RESPONSE_TYPE,
             cause_value, offending_ie_value);
@@ -256,6 +269,30 @@ void upf_n4_handle_session_modification_request(
     if (cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED)
         goto cleanup;
 
+    for (i = 0; i < OGS_ARRAY_SIZE(req->create_urr); i++) {
+        if (ogs_pfcp_handle_create_urr(&sess->pfcp, &req->create_urr[i],
+                    &cause_value, &offending_ie_value) == NULL)
+            break;
+    }
+    if (cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED)
+        goto cleanup;
+
+    for (i = 0; i < OGS_ARRAY_SIZE(req->update_urr); i++) {
+        if (ogs_pfcp_handle_update_urr(&sess->pfcp, &req->update_urr[i],
+                    &cause_value, &offending_ie_value) == NULL)
+            break;
+    }
+    if (cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED)
+        goto cleanup;
+
+    for (i = 0; i < OGS_ARRAY_SIZE(req->remove_urr); i++) {
+        if (ogs_pfcp_handle_remove_urr(&sess->pfcp, &req->remove_urr[i],
+                &cause_value, &offending_ie_value) == false)
+            break;
+    }
+    if (cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED)
+        goto cleanup;
+
     /* Setup GTP Node */
     ogs_list_for_each(&sess->pfcp.far_list, far)
         setup_gtp_node(far);
@@ -271,6 +308,9 @@ void upf_n4_handle_session_modification_request(
         }
     }
 
+    /* Compile Downlink SDF Filters */
+    upf_classifier_build(sess);
+
     /* Send Buffered Packet to gNB/SGW */
     ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
         if (pdr->src_if == OGS_PFCP_INTERFACE_CORE) { /* Downlink */
@@ -284,6 +324,7 @@ void upf_n4_handle_session_modification_request(
 
 cleanup:
     ogs_pfcp_sess_clear(&sess->pfcp);
+    upf_classifier_build(sess);
     ogs_pfcp_send_error_message(xact, sess ? sess->smf_n4_seid : 0,
             OGS_PFCP_SESSION_MODIFICATION_RESPONSE_TYPE,
             cause_value, offending_ie_value);
@@ -312,3 +353,39 @@ void upf_n4_handle_session_deletion_request(
 
     upf_sess_remove(sess);
 }
+
+void upf_n4_handle_session_report_response(
+        upf_sess_t *sess, ogs_pfcp_xact_t *xact,
+        ogs_pfcp_session_report_response_t *rsp)
+{
+    uint8_t cause_value = 0;
+
+    ogs_assert(xact);
+    ogs_assert(rsp);
+
+    ogs_pfcp_xact_commit(xact);
+
+    ogs_debug("Session report response");
+
+    cause_value = OGS_PFCP_CAUSE_REQUEST_ACCEPTED;
+
+    if (!sess) {
+        ogs_warn("No Context");
+        cause_value = OGS_PFCP_CAUSE_SESSION_CONTEXT_NOT_FOUND;
+    }
+
+    if (rsp->cause.presence) {
+        if (rsp->cause.u8 != OGS_PFCP_CAUSE_REQUEST_ACCEPTED) {
+            ogs_error("PFCP Cause[%d] : Not Accepted", rsp->cause.u8);
+            cause_value = rsp->cause.u8;
+        }
+    } else {
+        ogs_error("No Cause");
+        cause_value = OGS_PFCP_CAUSE_MANDATORY_IE_MISSING;
+    }
+
+    if (cause_value != OGS_PFCP_CAUSE_REQUEST_ACCEPTED) {
+        ogs_error("Cause request not accepted[%d]", cause_value);
+        return;
+    }
+}
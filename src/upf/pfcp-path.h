@@ -38,6 +38,10 @@ void upf_pfcp_send_session_modification_response(
 void upf_pfcp_send_session_deletion_response(ogs_pfcp_xact_t *xact,
         upf_sess_t *sess);
 
+void upf_pfcp_send_session_report_request(
+        upf_sess_t *sess, ogs_pfcp_user_plane_report_t *report);
+void upf_pfcp_send_usage_report(ogs_pfcp_node_t *node);
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,6 +47,9 @@ void upf_pfcp_state_initial(ogs_fsm_t *s, upf_event_t *e)
     node->t_no_heartbeat = ogs_timer_add(ogs_app()->timer_mgr,
             upf_timer_no_heartbeat, node);
     ogs_assert(node->t_no_heartbeat);
+    node->t_usage_report = ogs_timer_add(ogs_app()->timer_mgr,
+            upf_timer_usage_report, node);
+    ogs_assert(node->t_usage_report);
 
     OGS_FSM_TRAN(s, &upf_pfcp_state_will_associate);
 }
@@ -63,6 +66,7 @@ void upf_pfcp_state_final(ogs_fsm_t *s, upf_event_t *e)
     ogs_assert(node);
 
     ogs_timer_delete(node->t_no_heartbeat);
+    ogs_timer_delete(node->t_usage_report);
 }
 
 void upf_pfcp_state_will_associate(ogs_fsm_t *s, upf_event_t *e)
@@ -173,10 +177,12 @@ void upf_pfcp_state_associated(ogs_fsm_t *s, upf_event_t *e)
         ogs_info("PFCP associated");
         ogs_timer_start(node->t_no_heartbeat,
                 ogs_app()->time.message.pfcp.no_heartbeat_duration);
+        ogs_timer_start(node->t_usage_report, UPF_USAGE_REPORT_INTERVAL);
         break;
     case OGS_FSM_EXIT_SIG:
         ogs_info("PFCP de-associated");
         ogs_timer_stop(node->t_no_heartbeat);
+        ogs_timer_stop(node->t_usage_report);
         break;
     case UPF_EVT_N4_MESSAGE:
         message = e->pfcp_message;
@@ -224,6 +230,10 @@ void upf_pfcp_state_associated(ogs_fsm_t *s, upf_event_t *e)
             upf_n4_handle_session_deletion_request(
                 sess, xact, &message->pfcp_session_deletion_request);
             break;
+        case OGS_PFCP_SESSION_REPORT_RESPONSE_TYPE:
+            upf_n4_handle_session_report_response(
+                sess, xact, &message->pfcp_session_report_response);
+            break;
         default:
             ogs_error("Not implemented PFCP message type[%d]",
                     message->h.type);
@@ -239,6 +249,13 @@ void upf_pfcp_state_associated(ogs_fsm_t *s, upf_event_t *e)
 
             ogs_pfcp_send_heartbeat_request(node, node_timeout);
             break;
+        case UPF_TIMER_USAGE_REPORT:
+            node = e->pfcp_node;
+            ogs_assert(node);
+
+            upf_pfcp_send_usage_report(node);
+            ogs_timer_start(node->t_usage_report, UPF_USAGE_REPORT_INTERVAL);
+            break;
         default:
             ogs_error("Unknown timer[%s:%d]",
                     upf_timer_get_name(e->timer_id), e->timer_id);
@@ -102,6 +102,179 @@ static int decode_ipv6_header(
     return OGS_OK;
 }
 
+static void classifier_add(upf_classifier_t *classifier,
+        ogs_pfcp_pdr_t *pdr, ogs_ipfw_rule_t *ipfw, int addr_len, int order)
+{
+    int i, k;
+    uint32_t src_mask[4];
+    uint32_t dst_mask[4];
+    bool any_proto;
+    upf_classifier_tuple_t *tuple = NULL;
+    upf_classifier_entry_t *entry = NULL, *last = NULL;
+
+    ogs_assert(classifier);
+    ogs_assert(pdr);
+    ogs_assert(ipfw);
+
+    memset(src_mask, 0, sizeof(src_mask));
+    memset(dst_mask, 0, sizeof(dst_mask));
+    for (k = 0; k < addr_len / 4; k++) {
+        src_mask[k] = ipfw->ip.src.mask[k];
+        dst_mask[k] = ipfw->ip.dst.mask[k];
+    }
+    any_proto = (ipfw->proto == 0);
+
+    for (i = 0; i < classifier->num_of_tuple; i++) {
+        tuple = &classifier->tuple[i];
+        if (tuple->addr_len == addr_len && tuple->any_proto == any_proto &&
+            memcmp(tuple->src_mask, src_mask, sizeof(src_mask)) == 0 &&
+            memcmp(tuple->dst_mask, dst_mask, sizeof(dst_mask)) == 0)
+            break;
+    }
+    if (i == classifier->num_of_tuple) {
+        /* Tuples are created in ascending order of the first rule */
+        tuple = &classifier->tuple[classifier->num_of_tuple++];
+        tuple->addr_len = addr_len;
+        memcpy(tuple->src_mask, src_mask, sizeof(src_mask));
+        memcpy(tuple->dst_mask, dst_mask, sizeof(dst_mask));
+        tuple->any_proto = any_proto;
+        tuple->min_order = order;
+    }
+    ogs_assert(i <= UINT16_MAX);
+
+    entry = &classifier->entry[classifier->num_of_entry++];
+    entry->key.tuple = i;
+    entry->key.proto = any_proto ? 0 : ipfw->proto;
+    for (k = 0; k < addr_len / 4; k++) {
+        entry->key.src[k] = ipfw->ip.src.addr[k] & src_mask[k];
+        entry->key.dst[k] = ipfw->ip.dst.addr[k] & dst_mask[k];
+    }
+    entry->pdr = pdr;
+    entry->ipfw = ipfw;
+    entry->order = order;
+
+    /* Rules with the same key differ only in ports : keep them in order */
+    last = ogs_hash_get(classifier->hash, &entry->key, sizeof(entry->key));
+    if (last) {
+        while (last->next)
+            last = last->next;
+        last->next = entry;
+    } else {
+        ogs_hash_set(classifier->hash,
+                &entry->key, sizeof(entry->key), entry);
+    }
+}
+
+void upf_classifier_build(upf_sess_t *sess)
+{
+    upf_classifier_t *classifier = NULL;
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_far_t *far = NULL;
+    ogs_pfcp_rule_t *rule = NULL;
+    int num_of_rule = 0;
+    int order = 0;
+
+    ogs_assert(sess);
+
+    upf_classifier_clear(sess);
+
+    ogs_list_for_each(&sess->pfcp.pdr_list, pdr)
+        num_of_rule += ogs_list_count(&pdr->rule_list);
+
+    classifier = ogs_calloc(1, sizeof(*classifier));
+    ogs_assert(classifier);
+    classifier->hash = ogs_hash_make();
+    ogs_assert(classifier->hash);
+
+    /* A rule without address is compiled for both IPv4 and IPv6 */
+    if (num_of_rule) {
+        classifier->tuple = ogs_calloc(
+                num_of_rule * 2, sizeof(upf_classifier_tuple_t));
+        ogs_assert(classifier->tuple);
+        classifier->entry = ogs_calloc(
+                num_of_rule * 2, sizeof(upf_classifier_entry_t));
+        ogs_assert(classifier->entry);
+    }
+
+    /* Same walk as the PDR precedence order */
+    ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
+        far = pdr->far;
+        ogs_assert(far);
+
+        /* Check if PDR is Downlink */
+        if (pdr->src_if != OGS_PFCP_INTERFACE_CORE)
+            continue;
+
+        /* Check if FAR is Downlink */
+        if (far->dst_if != OGS_PFCP_INTERFACE_ACCESS)
+            continue;
+
+        /* Save the Fallback PDR : Lowest precedence downlink PDR */
+        classifier->fallback_pdr = pdr;
+
+        /* Check if Outer header creation */
+        if (far->outer_header_creation.teid == 0)
+            continue;
+
+        ogs_list_for_each(&pdr->rule_list, rule) {
+            ogs_ipfw_rule_t *ipfw = &rule->ipfw;
+
+            if (!ipfw->ipv6_src && !ipfw->ipv6_dst)
+                classifier_add(classifier, pdr, ipfw, OGS_IPV4_LEN, order);
+            if (!ipfw->ipv4_src && !ipfw->ipv4_dst)
+                classifier_add(classifier, pdr, ipfw, OGS_IPV6_LEN, order);
+
+            order++;
+        }
+    }
+
+    sess->classifier = classifier;
+}
+
+void upf_classifier_clear(upf_sess_t *sess)
+{
+    upf_classifier_t *classifier = NULL;
+
+    ogs_assert(sess);
+
+    classifier = sess->classifier;
+    if (!classifier)
+        return;
+
+    ogs_hash_destroy(classifier->hash);
+    if (classifier->tuple)
+        ogs_free(classifier->tuple);
+    if (classifier->entry)
+        ogs_free(classifier->entry);
+    ogs_free(classifier);
+
+    sess->classifier = NULL;
+}
+
+static bool classifier_match_port(ogs_ipfw_rule_t *ipfw,
+        uint8_t proto, uint16_t sport, uint16_t dport)
+{
+    ogs_assert(ipfw);
+
+    /* No need to match port */
+    if (proto != IPPROTO_TCP && proto != IPPROTO_UDP)
+        return true;
+
+    /* Source port */
+    if (ipfw->port.src.low && sport < ipfw->port.src.low)
+        return false;
+    if (ipfw->port.src.high && sport > ipfw->port.src.high)
+        return false;
+
+    /* Dst Port*/
+    if (ipfw->port.dst.low && dport < ipfw->port.dst.low)
+        return false;
+    if (ipfw->port.dst.high && dport > ipfw->port.dst.high)
+        return false;
+
+    return true;
+}
+
 ogs_pfcp_pdr_t *upf_pdr_find_by_packet(ogs_pkbuf_t *pkt)
 {
     struct ip *ip_h =  NULL;
@@ -111,6 +284,7 @@ ogs_pfcp_pdr_t *upf_pdr_find_by_packet(ogs_pkbuf_t *pkt)
     int addr_len = 0;
     uint8_t proto = 0;
     uint16_t ip_hlen = 0;
+    uint16_t sport = 0, dport = 0;
     char buf[OGS_ADDRSTRLEN];
     upf_sess_t *sess = NULL;
 
@@ -153,166 +327,72 @@ ogs_pfcp_pdr_t *upf_pdr_find_by_packet(ogs_pkbuf_t *pkt)
 
 
     if (sess) {
-        ogs_pfcp_pdr_t *fallback_pdr = NULL;
-        ogs_pfcp_pdr_t *pdr = NULL;
-        ogs_pfcp_far_t *far = NULL;
-        ogs_pfcp_rule_t *rule = NULL;
+        upf_classifier_t *classifier = sess->classifier;
+        upf_classifier_entry_t *found = NULL;
+        int i, k;
 
         if (ip_h && sess->ipv4)
             ogs_debug("PAA IPv4:%s", OGS_INET_NTOP(&sess->ipv4->addr, buf));
         if (ip6_h && sess->ipv6)
             ogs_debug("PAA IPv6:%s", OGS_INET6_NTOP(&sess->ipv6->addr, buf));
 
-        /* Found */
-        ogs_list_for_each(&sess->pfcp.pdr_list, pdr) {
-            far = pdr->far;
-            ogs_assert(far);
-
-            /* Check if PDR is Downlink */
-            if (pdr->src_if != OGS_PFCP_INTERFACE_CORE)
-                continue;
+        ogs_assert(classifier);
+
+        if (proto == IPPROTO_TCP) {
+            struct tcphdr *tcph =
+                (struct tcphdr *)((char *)pkt->data + ip_hlen);
+            sport = be16toh(tcph->th_sport);
+            dport = be16toh(tcph->th_dport);
+        } else if (proto == IPPROTO_UDP) {
+            struct udphdr *udph =
+                (struct udphdr *)((char *)pkt->data + ip_hlen);
+            sport = be16toh(udph->uh_sport);
+            dport = be16toh(udph->uh_dport);
+        }
 
-            /* Check if FAR is Downlink */
-            if (far->dst_if != OGS_PFCP_INTERFACE_ACCESS)
-                continue;
+        /* One hash probe per tuple */
+        for (i = 0; i < classifier->num_of_tuple; i++) {
+            upf_classifier_tuple_t *tuple = &classifier->tuple[i];
+            upf_classifier_entry_t *entry = NULL;
+            upf_classifier_key_t key;
 
-            /* Save the Fallback PDR : Lowest precedence downlink PDR */
-            fallback_pdr = pdr;
+            /* No rule in the remaining tuples precedes the found one */
+            if (found && found->order < tuple->min_order)
+                break;
 
-            /* Check if Outer header creation */
-            if (far->outer_header_creation.teid == 0)
+            if (tuple->addr_len != addr_len)
                 continue;
 
-            ogs_list_for_each(&pdr->rule_list, rule) {
-                int k;
-                uint32_t src_mask[4];
-                uint32_t dst_mask[4];
-                ogs_ipfw_rule_t *ipfw = NULL;
-
-                ipfw = &rule->ipfw;
-                ogs_assert(ipfw);
-
-                ogs_debug("PROTO:%d SRC:%d-%d DST:%d-%d",
-                        ipfw->proto,
-                        ipfw->port.src.low,
-                        ipfw->port.src.high,
-                        ipfw->port.dst.low,
-                        ipfw->port.dst.high);
-                ogs_debug("SRC:%08x %08x %08x %08x/%08x %08x %08x %08x",
-                        be32toh(ipfw->ip.src.addr[0]),
-                        be32toh(ipfw->ip.src.addr[1]),
-                        be32toh(ipfw->ip.src.addr[2]),
-                        be32toh(ipfw->ip.src.addr[3]),
-                        be32toh(ipfw->ip.src.mask[0]),
-                        be32toh(ipfw->ip.src.mask[1]),
-                        be32toh(ipfw->ip.src.mask[2]),
-                        be32toh(ipfw->ip.src.mask[3]));
-                ogs_debug("DST:%08x %08x %08x %08x/%08x %08x %08x %08x",
-                        be32toh(ipfw->ip.dst.addr[0]),
-                        be32toh(ipfw->ip.dst.addr[1]),
-                        be32toh(ipfw->ip.dst.addr[2]),
-                        be32toh(ipfw->ip.dst.addr[3]),
-                        be32toh(ipfw->ip.dst.mask[0]),
-                        be32toh(ipfw->ip.dst.mask[1]),
-                        be32toh(ipfw->ip.dst.mask[2]),
-                        be32toh(ipfw->ip.dst.mask[3]));
-
-                for (k = 0; k < 4; k++) {
-                    src_mask[k] = src_addr[k] & ipfw->ip.src.mask[k];
-                    dst_mask[k] = dst_addr[k] & ipfw->ip.dst.mask[k];
-                }
+            memset(&key, 0, sizeof(key));
+            key.tuple = i;
+            key.proto = tuple->any_proto ? 0 : proto;
+            for (k = 0; k < addr_len / 4; k++) {
+                key.src[k] = src_addr[k] & tuple->src_mask[k];
+                key.dst[k] = dst_addr[k] & tuple->dst_mask[k];
+            }
+
+            for (entry = ogs_hash_get(classifier->hash, &key, sizeof(key));
+                    entry; entry = entry->next) {
+                if (found && found->order < entry->order)
+                    break;
 
-                if (memcmp(src_mask, ipfw->ip.src.addr, addr_len) == 0 &&
-                    memcmp(dst_mask, ipfw->ip.dst.addr, addr_len) == 0) {
-                    /* Protocol match */
-                    if (ipfw->proto == 0) { /* IP */
-                        /* No need to match port */
-                        goto found;
-                    }
-
-                    if (ipfw->proto == proto) {
-                        if (ipfw->proto == IPPROTO_TCP) {
-                            struct tcphdr *tcph =
-                                (struct tcphdr *)((char *)pkt->data + ip_hlen);
-
-                            /* Source port */
-                            if (ipfw->port.src.low &&
-                                  be16toh(tcph->th_sport) <
-                                      ipfw->port.src.low) {
-                                continue;
-                            }
-
-                            if (ipfw->port.src.high &&
-                                  be16toh(tcph->th_sport) >
-                                      ipfw->port.src.high) {
-                                continue;
-                            }
-
-                            /* Dst Port*/
-                            if (ipfw->port.dst.low &&
-                                  be16toh(tcph->th_dport) <
-                                      ipfw->port.dst.low) {
-                                continue;
-                            }
-
-                            if (ipfw->port.dst.high &&
-                                  be16toh(tcph->th_dport) >
-                                          ipfw->port.dst.high) {
-                                continue;
-                            }
-
-                            /* Matched */
-                            goto found;
-                        } else if (ipfw->proto == IPPROTO_UDP) {
-                            struct udphdr *udph =
-                                (struct udphdr *)((char *)pkt->data + ip_hlen);
-
-                            /* Source port */
-                            if (ipfw->port.src.low &&
-                                  be16toh(udph->uh_sport) <
-                                      ipfw->port.src.low) {
-                                continue;
-                            }
-
-                            if (ipfw->port.src.high &&
-                                  be16toh(udph->uh_sport) >
-                                      ipfw->port.src.high) {
-                                continue;
-                            }
-
-                            /* Dst Port*/
-                            if (ipfw->port.dst.low &&
-                                  be16toh(udph->uh_dport) <
-                                      ipfw->port.dst.low) {
-                                continue;
-                            }
-
-                            if (ipfw->port.dst.high &&
-                                  be16toh(udph->uh_dport) >
-                                      ipfw->port.dst.high) {
-                                continue;
-                            }
-
-                            /* Matched */
-                            goto found;
-                        } else {
-                            /* No need to match port */
-                            goto found;
-                        }
-                    }
+                if (tuple->any_proto ||
+                    classifier_match_port(entry->ipfw, proto, sport, dport)) {
+                    found = entry;
+                    break;
                 }
             }
         }
 
-found:
-        if (rule) {
-            ogs_debug("Found Dedicated PDR : PDR ID[%d]", pdr->id);
-            return pdr;
+        if (found) {
+            ogs_debug("Found Dedicated PDR : PDR ID[%d]", found->pdr->id);
+            return found->pdr;
         }
 
-        ogs_assert(fallback_pdr);
-        ogs_debug("Found Session : Fallback PDR-ID[%d]", fallback_pdr->id);
-        return fallback_pdr;
+        ogs_assert(classifier->fallback_pdr);
+        ogs_debug("Found Session : Fallback PDR-ID[%d]",
+                classifier->fallback_pdr->id);
+        return classifier->fallback_pdr;
 
     } else {
         ogs_debug("No Session");
@@ -26,6 +26,55 @@
 extern "C" {
 #endif
 
+/*
+ * Compiled downlink classifier (Tuple Space Search)
+ *
+ * The SDF filters of the session are grouped by their
+ * (address family, source/destination mask, protocol wildcard) tuple.
+ * Each tuple is looked up with one hash probe on the masked addresses,
+ * so the cost depends on the number of tuples, not of filters.
+ */
+typedef struct upf_classifier_key_s {
+    uint32_t        src[4];
+    uint32_t        dst[4];
+    uint16_t        tuple;
+    uint8_t         proto;
+    uint8_t         reserved;
+} upf_classifier_key_t;
+
+typedef struct upf_classifier_entry_s {
+    upf_classifier_key_t key;
+
+    ogs_pfcp_pdr_t  *pdr;
+    ogs_ipfw_rule_t *ipfw;
+    int             order;      /* Position in the PDR/Rule walk */
+
+    struct upf_classifier_entry_s *next;
+} upf_classifier_entry_t;
+
+typedef struct upf_classifier_tuple_s {
+    int             addr_len;   /* OGS_IPV4_LEN or OGS_IPV6_LEN */
+    uint32_t        src_mask[4];
+    uint32_t        dst_mask[4];
+    bool            any_proto;
+    int             min_order;
+} upf_classifier_tuple_t;
+
+typedef struct upf_classifier_s {
+    ogs_hash_t      *hash;
+
+    int             num_of_tuple;
+    upf_classifier_tuple_t *tuple;
+
+    int             num_of_entry;
+    upf_classifier_entry_t *entry;
+
+    ogs_pfcp_pdr_t  *fallback_pdr;
+} upf_classifier_t;
+
+void upf_classifier_build(upf_sess_t *sess);
+void upf_classifier_clear(upf_sess_t *sess);
+
 ogs_pfcp_pdr_t *upf_pdr_find_by_packet(ogs_pkbuf_t *pkt);
 
 #ifdef __cplusplus
@@ -32,15 +32,20 @@ typedef enum {
 
     UPF_TIMER_ASSOCIATION,
     UPF_TIMER_NO_HEARTBEAT,
+    UPF_TIMER_USAGE_REPORT,
 
     MAX_NUM_OF_UPF_TIMER,
 
 } upf_timer_e;
 
+/* Interval to check the volume/time thresholds of the URRs */
+#define UPF_USAGE_REPORT_INTERVAL ogs_time_from_sec(1)
+
 const char *upf_timer_get_name(upf_timer_e id);
 
 void upf_timer_association(void *data);
 void upf_timer_no_heartbeat(void *data);
+void upf_timer_usage_report(void *data);
 
 #ifdef __cplusplus
 }
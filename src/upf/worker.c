@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "context.h"
+#include "worker.h"
+
+typedef struct upf_worker_tun_s {
+    ogs_lnode_t     lnode;
+
+    ogs_pfcp_dev_t  *dev;
+    ogs_socket_t    fd;
+    ogs_poll_t      *poll;
+} upf_worker_tun_t;
+
+static upf_worker_t *worker_array = NULL;
+static int num_of_worker = 0;
+
+static void worker_main(void *data);
+
+int upf_worker_open(
+        ogs_poll_handler_f gtpu_handler, ogs_poll_handler_f tun_handler)
+{
+    int i;
+    ogs_socknode_t *node = NULL, *new = NULL;
+    ogs_pfcp_dev_t *dev = NULL;
+
+    ogs_assert(gtpu_handler);
+    ogs_assert(tun_handler);
+
+    num_of_worker = upf_self()->num_of_worker;
+    ogs_assert(num_of_worker > 0);
+
+    worker_array = ogs_calloc(num_of_worker, sizeof(upf_worker_t));
+    ogs_assert(worker_array);
+
+    for (i = 0; i < num_of_worker; i++) {
+        upf_worker_t *worker = &worker_array[i];
+        ogs_list_t *gtpu_list = NULL;
+
+        worker->index = i;
+        ogs_thread_mutex_init(&worker->mutex);
+        ogs_list_init(&worker->gtpu_list);
+        ogs_list_init(&worker->tun_list);
+
+        worker->pollset = ogs_pollset_create(ogs_app()->pool.socket);
+        ogs_assert(worker->pollset);
+
+        /*
+         * The first worker polls the sockets and the TUN queues
+         * opened by upf_gtp_open(). The others open their own ones.
+         */
+        if (i == 0) {
+            gtpu_list = &upf_self()->gtpu_list;
+        } else {
+            gtpu_list = &worker->gtpu_list;
+
+            ogs_list_for_each(&upf_self()->gtpu_list, node) {
+                new = ogs_socknode_add(gtpu_list,
+                        node->addr->ogs_sa_family, node->addr);
+                ogs_assert(new);
+                ogs_socknode_reuseport(new, 1);
+
+                if (ogs_gtp_server(new) == NULL) {
+                    ogs_error("gtp_server(worker:%d) failed", i);
+                    goto cleanup;
+                }
+            }
+        }
+
+        ogs_list_for_each(gtpu_list, node) {
+            ogs_assert(node->sock);
+            node->poll = ogs_pollset_add(worker->pollset,
+                    OGS_POLLIN, node->sock->fd, gtpu_handler, worker);
+            ogs_assert(node->poll);
+        }
+
+        ogs_list_for_each(&ogs_pfcp_self()->dev_list, dev) {
+            upf_worker_tun_t *tun = ogs_calloc(1, sizeof *tun);
+            ogs_assert(tun);
+
+            tun->dev = dev;
+            if (i == 0) {
+                tun->fd = dev->fd;
+            } else {
+                tun->fd = ogs_tun_open_multi_queue(
+                        dev->ifname, OGS_MAX_IFNAME_LEN, 0);
+                if (tun->fd == INVALID_SOCKET) {
+                    ogs_error("tun_open(dev:%s, worker:%d) failed",
+                            dev->ifname, i);
+                    ogs_free(tun);
+                    goto cleanup;
+                }
+            }
+            ogs_list_add(&worker->tun_list, tun);
+
+            tun->poll = ogs_pollset_add(worker->pollset,
+                    OGS_POLLIN, tun->fd, tun_handler, worker);
+            ogs_assert(tun->poll);
+        }
+    }
+
+    for (i = 0; i < num_of_worker; i++) {
+        upf_worker_t *worker = &worker_array[i];
+
+        ogs_atomic_store(&worker->running, true);
+        worker->thread = ogs_thread_create(worker_main, worker);
+        if (!worker->thread) {
+            ogs_error("thread_create(worker:%d) failed", i);
+            goto cleanup;
+        }
+    }
+
+    ogs_info("%d data-plane workers started", num_of_worker);
+
+    return OGS_OK;
+
+cleanup:
+    /* Stop the threads and release whatever the workers have opened */
+    upf_worker_close();
+    return OGS_ERROR;
+}
+
+void upf_worker_close(void)
+{
+    int i;
+    ogs_socknode_t *node = NULL;
+    upf_worker_tun_t *tun = NULL, *next_tun = NULL;
+
+    if (!worker_array)
+        return;
+
+    for (i = 0; i < num_of_worker; i++) {
+        upf_worker_t *worker = &worker_array[i];
+
+        if (!worker->thread)
+            continue;
+
+        ogs_atomic_store(&worker->running, false);
+        ogs_pollset_notify(worker->pollset);
+        ogs_thread_destroy(worker->thread);
+    }
+
+    for (i = 0; i < num_of_worker; i++) {
+        upf_worker_t *worker = &worker_array[i];
+        int j;
+
+        if (!worker->pollset)
+            break;
+
+        if (i == 0) {
+            ogs_list_for_each(&upf_self()->gtpu_list, node) {
+                if (node->poll) {
+                    ogs_pollset_remove(node->poll);
+                    node->poll = NULL;
+                }
+            }
+        } else {
+            ogs_socknode_remove_all(&worker->gtpu_list);
+        }
+
+        ogs_list_for_each_safe(&worker->tun_list, next_tun, tun) {
+            ogs_list_remove(&worker->tun_list, tun);
+
+            ogs_pollset_remove(tun->poll);
+            if (i != 0)
+                ogs_closesocket(tun->fd);
+            ogs_free(tun);
+        }
+
+        for (j = 0; j < OGS_MAX_NUM_OF_UDP_BURST; j++) {
+            if (worker->recvbuf[j])
+                ogs_pkbuf_free(worker->recvbuf[j]);
+        }
+
+        ogs_pollset_destroy(worker->pollset);
+        ogs_thread_mutex_destroy(&worker->mutex);
+    }
+
+    ogs_free(worker_array);
+    worker_array = NULL;
+    num_of_worker = 0;
+}
+
+ogs_socket_t upf_worker_tun_fd(upf_worker_t *worker, ogs_pfcp_dev_t *dev)
+{
+    upf_worker_tun_t *tun = NULL;
+
+    ogs_assert(dev);
+
+    if (!worker)
+        return dev->fd;
+
+    ogs_list_for_each(&worker->tun_list, tun) {
+        if (tun->dev == dev)
+            return tun->fd;
+    }
+
+    return INVALID_SOCKET;
+}
+
+void upf_worker_lock_all(void)
+{
+    int i;
+
+    for (i = 0; i < num_of_worker; i++)
+        ogs_thread_mutex_lock(&worker_array[i].mutex);
+}
+
+void upf_worker_unlock_all(void)
+{
+    int i;
+
+    for (i = num_of_worker - 1; i >= 0; i--)
+        ogs_thread_mutex_unlock(&worker_array[i].mutex);
+}
+
+static void worker_main(void *data)
+{
+    upf_worker_t *worker = data;
+    ogs_assert(worker);
+
+    while (ogs_atomic_load(&worker->running))
+        ogs_pollset_poll(worker->pollset, OGS_INFINITE_TIME);
+}
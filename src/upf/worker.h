@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef UPF_WORKER_H
+#define UPF_WORKER_H
+
+#include "ogs-pfcp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Data-plane worker
+ *
+ * Each worker polls its own GTP-U sockets (SO_REUSEPORT)
+ * and its own queue of every multi-queue TUN device.
+ *
+ * The data path of a worker runs with worker->mutex held.
+ * The PFCP control thread takes every worker mutex
+ * before it touches the session/PDR/FAR/QER contexts.
+ */
+typedef struct upf_worker_s {
+    int             index;
+
+    ogs_thread_t    *thread;
+    ogs_pollset_t   *pollset;
+    bool            running;
+
+    ogs_thread_mutex_t mutex;
+
+    ogs_list_t      gtpu_list;  /* GTP-U Server List owned by the worker */
+    ogs_list_t      tun_list;   /* TUN Queue List */
+
+    ogs_pkbuf_t     *recvbuf[OGS_MAX_NUM_OF_UDP_BURST];
+} upf_worker_t;
+
+int upf_worker_open(
+        ogs_poll_handler_f gtpu_handler, ogs_poll_handler_f tun_handler);
+void upf_worker_close(void);
+
+/* The TUN queue of 'dev' owned by the worker, or dev->fd without workers */
+ogs_socket_t upf_worker_tun_fd(upf_worker_t *worker, ogs_pfcp_dev_t *dev);
+
+void upf_worker_lock_all(void);
+void upf_worker_unlock_all(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UPF_WORKER_H */
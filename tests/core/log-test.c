@@ -20,6 +20,10 @@
 #include "ogs-core.h"
 #include "core/abts.h"
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#endif
+
 static void test_basic(abts_case *tc, void *data)
 {
     int domain_id = -1;
@@ -103,11 +107,214 @@ static void test_basic(abts_case *tc, void *data)
 #endif
 }
 
+static int evaluated;
+
+static int lazy_arg(void)
+{
+    return ++evaluated;
+}
+
+static void test_lazy(abts_case *tc, void *data)
+{
+    int domain_id = ogs_log_get_domain_id("core");
+    int core_level = ogs_log_get_domain_level(domain_id);
+
+    evaluated = 0;
+    ogs_log_set_domain_level(domain_id, OGS_LOG_INFO);
+    ogs_debug("lazy %d", lazy_arg());
+    ogs_trace("lazy %d", lazy_arg());
+    ABTS_INT_EQUAL(tc, 0, evaluated);
+    ABTS_TRUE(tc, ogs_log_enabled(OGS_LOG_INFO, domain_id));
+    ABTS_TRUE(tc, !ogs_log_enabled(OGS_LOG_DEBUG, domain_id));
+
+    ogs_log_set_mask_level("core", OGS_LOG_DEBUG);
+    ABTS_TRUE(tc, ogs_log_enabled(OGS_LOG_DEBUG, domain_id));
+    ABTS_TRUE(tc, !ogs_log_enabled(OGS_LOG_TRACE, domain_id));
+
+    ogs_log_set_domain_level(domain_id, core_level);
+}
+
+#define ASYNC_THREADS 4
+
+static void async_thread(void *data)
+{
+    int i;
+
+    for (i = 0; i < 1000; i++)
+        ogs_log_print(OGS_LOG_INFO, "%s", "");
+}
+
+static void test_async(abts_case *tc, void *data)
+{
+    int i;
+    ogs_thread_t *thread[ASYNC_THREADS];
+
+    ABTS_INT_EQUAL(tc, OGS_OK, ogs_log_async_start());
+
+    for (i = 0; i < ASYNC_THREADS; i++)
+        thread[i] = ogs_thread_create(async_thread, NULL);
+    for (i = 0; i < ASYNC_THREADS; i++)
+        ogs_thread_destroy(thread[i]);
+
+    ogs_log_async_flush();
+    ogs_log_cycle();
+    ABTS_INT_EQUAL(tc, 0, ogs_log_async_dropped());
+    ogs_log_async_stop();
+}
+
+#if !defined(_WIN32)
+#define ASYNC_FILE_LINES 200
+
+static void async_file_thread(void *data)
+{
+    int i, id = *(int *)data;
+
+    for (i = 0; i < ASYNC_FILE_LINES; i++)
+        ogs_log_print(OGS_LOG_ERROR, "async %d %d\n", id, i);
+}
+
+static int count_lines(abts_case *tc, const char *name, int *next)
+{
+    FILE *fp = NULL;
+    char line[OGS_HUGE_LEN];
+    int count = 0, id, seq;
+
+    fp = fopen(name, "r");
+    ABTS_PTR_NOTNULL(tc, fp);
+    if (!fp)
+        return -1;
+
+    while (fgets(line, sizeof(line), fp)) {
+        count++;
+        if (!next)
+            continue;
+
+        /* Each thread's lines come out complete and in order */
+        ABTS_INT_EQUAL(tc, 2, sscanf(line, "async %d %d", &id, &seq));
+        ABTS_TRUE(tc, id >= 0 && id < ASYNC_THREADS);
+        ABTS_INT_EQUAL(tc, next[id], seq);
+        next[id] = seq + 1;
+    }
+    fclose(fp);
+
+    return count;
+}
+
+static void test_async_file(abts_case *tc, void *data)
+{
+    int i, saved_stderr, null_fd;
+    int id[ASYNC_THREADS], next[ASYNC_THREADS];
+    ogs_thread_t *thread[ASYNC_THREADS];
+    char name[64], rotated[80];
+    ogs_log_t *log = NULL;
+
+    ogs_snprintf(name, sizeof(name), "/tmp/ogs-log-test.%d", (int)getpid());
+    ogs_snprintf(rotated, sizeof(rotated), "%s.1", name);
+    unlink(name);
+    unlink(rotated);
+
+    log = ogs_log_add_file(name);
+    ABTS_PTR_NOTNULL(tc, log);
+
+    /* Keep the test output clean : the stderr target gets these too */
+    fflush(stderr);
+    saved_stderr = dup(STDERR_FILENO);
+    null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDERR_FILENO);
+
+    ABTS_INT_EQUAL(tc, OGS_OK, ogs_log_async_start());
+
+    for (i = 0; i < ASYNC_THREADS; i++) {
+        id[i] = i;
+        next[i] = 0;
+        thread[i] = ogs_thread_create(async_file_thread, &id[i]);
+    }
+    for (i = 0; i < ASYNC_THREADS; i++)
+        ogs_thread_destroy(thread[i]);
+
+    ogs_log_async_flush();
+    ABTS_INT_EQUAL(tc, ASYNC_THREADS * ASYNC_FILE_LINES,
+            count_lines(tc, name, next));
+    for (i = 0; i < ASYNC_THREADS; i++)
+        ABTS_INT_EQUAL(tc, ASYNC_FILE_LINES, next[i]);
+
+    /* Rotation : lines after SIGHUP go to the reopened file only */
+    ABTS_INT_EQUAL(tc, 0, rename(name, rotated));
+    ogs_log_cycle();
+    ogs_log_print(OGS_LOG_ERROR, "async 0 0\n");
+    ogs_log_async_flush();
+
+    ABTS_INT_EQUAL(tc, 1, count_lines(tc, name, NULL));
+    ABTS_INT_EQUAL(tc, ASYNC_THREADS * ASYNC_FILE_LINES,
+            count_lines(tc, rotated, NULL));
+
+    ABTS_INT_EQUAL(tc, 0, ogs_log_async_dropped());
+    ogs_log_async_stop();
+
+    fflush(stderr);
+    dup2(saved_stderr, STDERR_FILENO);
+    close(saved_stderr);
+    close(null_fd);
+
+    ogs_log_remove(log);
+    unlink(name);
+    unlink(rotated);
+}
+
+/* Stopping while threads still log loses nothing and frees no live ring */
+static void test_async_stop(abts_case *tc, void *data)
+{
+    int i, saved_stderr, null_fd;
+    int id[ASYNC_THREADS];
+    ogs_thread_t *thread[ASYNC_THREADS];
+    char name[64];
+    ogs_log_t *log = NULL;
+
+    ogs_snprintf(name, sizeof(name), "/tmp/ogs-log-stop.%d", (int)getpid());
+    unlink(name);
+
+    log = ogs_log_add_file(name);
+    ABTS_PTR_NOTNULL(tc, log);
+
+    fflush(stderr);
+    saved_stderr = dup(STDERR_FILENO);
+    null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDERR_FILENO);
+
+    ABTS_INT_EQUAL(tc, OGS_OK, ogs_log_async_start());
+
+    for (i = 0; i < ASYNC_THREADS; i++) {
+        id[i] = i;
+        thread[i] = ogs_thread_create(async_file_thread, &id[i]);
+    }
+    ogs_log_async_stop();
+    for (i = 0; i < ASYNC_THREADS; i++)
+        ogs_thread_destroy(thread[i]);
+
+    ABTS_INT_EQUAL(tc, ASYNC_THREADS * ASYNC_FILE_LINES,
+            count_lines(tc, name, NULL));
+
+    fflush(stderr);
+    dup2(saved_stderr, STDERR_FILENO);
+    close(saved_stderr);
+    close(null_fd);
+
+    ogs_log_remove(log);
+    unlink(name);
+}
+#endif
+
 abts_suite *test_log(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test_basic, NULL);
+    abts_run_test(suite, test_lazy, NULL);
+    abts_run_test(suite, test_async, NULL);
+#if !defined(_WIN32)
+    abts_run_test(suite, test_async_file, NULL);
+    abts_run_test(suite, test_async_stop, NULL);
+#endif
 
     return suite;
 }
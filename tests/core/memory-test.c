@@ -53,21 +53,99 @@ static void test3_func(abts_case *tc, void *data)
 static void test4_func(abts_case *tc, void *data)
 {
     char *p, *q;
+    char expected[10];
+
+    memset(expected, 1, 10);
 
     p = ogs_malloc(10);
     ABTS_PTR_NOTNULL(tc, p);
     memset(p, 1, 10);
 
-    q = ogs_realloc(p, 128 - sizeof(ogs_pkbuf_t *) - 1);
+    q = ogs_realloc(p, 16 - 1);
     ABTS_TRUE(tc, p == q);
 
-    p = ogs_realloc(q, 128 - sizeof(ogs_pkbuf_t *));
+    p = ogs_realloc(q, 16);
     ABTS_TRUE(tc, p == q);
 
-    q = ogs_realloc(p, 128 - sizeof(ogs_pkbuf_t *) + 1);
+    q = ogs_realloc(p, 16 + 1);
     ABTS_TRUE(tc, p != q);
-    ABTS_TRUE(tc, memcmp(p, q, 10) == 0);
+    ABTS_TRUE(tc, memcmp(expected, q, 10) == 0);
+    ogs_free(q);
+}
+
+static void test5_func(abts_case *tc, void *data)
+{
+    ogs_mem_stat_t before[OGS_MEM_NUM_OF_CLASS+1];
+    ogs_mem_stat_t after[OGS_MEM_NUM_OF_CLASS+1];
+    char *p, *q, *r;
+
+    ogs_mem_stat(before);
+
+    p = ogs_malloc(24);
+    ABTS_PTR_NOTNULL(tc, p);
+    ABTS_INT_EQUAL(tc, 0, (intptr_t)p % 16);
+
+    q = ogs_malloc(9000);
+    ABTS_PTR_NOTNULL(tc, q);
+    memset(q, 2, 9000);
+
+    r = ogs_malloc(2*1024*1024);
+    ABTS_PTR_NOTNULL(tc, r);
+    memset(r, 3, 2*1024*1024);
+
+    ogs_mem_stat(after);
+    ABTS_INT_EQUAL(tc, 32, after[1].size);
+    ABTS_INT_EQUAL(tc, before[1].in_use + 1, after[1].in_use);
+    ABTS_INT_EQUAL(tc, 10240, after[32].size);
+    ABTS_INT_EQUAL(tc, before[32].in_use + 1, after[32].in_use);
+    ABTS_INT_EQUAL(tc, 0, after[OGS_MEM_NUM_OF_CLASS].size);
+    ABTS_INT_EQUAL(tc, before[OGS_MEM_NUM_OF_CLASS].in_use + 1,
+            after[OGS_MEM_NUM_OF_CLASS].in_use);
+
+    r = ogs_realloc(r, 4*1024*1024);
+    ABTS_PTR_NOTNULL(tc, r);
+    ABTS_INT_EQUAL(tc, 3, r[2*1024*1024-1]);
+
+    ogs_free(p);
     ogs_free(q);
+    ogs_free(r);
+
+    ogs_mem_stat(after);
+    ABTS_INT_EQUAL(tc, before[1].in_use, after[1].in_use);
+    ABTS_INT_EQUAL(tc, before[32].in_use, after[32].in_use);
+    ABTS_INT_EQUAL(tc, before[OGS_MEM_NUM_OF_CLASS].in_use,
+            after[OGS_MEM_NUM_OF_CLASS].in_use);
+}
+
+#define TEST6_THREAD_NUM 32
+
+static void test6_main(void *data)
+{
+    char *ptr = ogs_malloc(16000);
+    ogs_assert(ptr);
+    ogs_free(ptr);
+}
+
+/* the objects cached by an exiting thread go back to the class */
+static void test6_func(abts_case *tc, void *data)
+{
+    ogs_mem_stat_t before[OGS_MEM_NUM_OF_CLASS+1];
+    ogs_mem_stat_t after[OGS_MEM_NUM_OF_CLASS+1];
+    ogs_thread_t *thread = NULL;
+    int i;
+
+    ogs_mem_stat(before);
+
+    for (i = 0; i < TEST6_THREAD_NUM; i++) {
+        thread = ogs_thread_create(test6_main, NULL);
+        ABTS_PTR_NOTNULL(tc, thread);
+        ogs_thread_destroy(thread);
+    }
+
+    ogs_mem_stat(after);
+    ABTS_INT_EQUAL(tc, 16384, after[35].size);
+    ABTS_INT_EQUAL(tc, before[35].in_use, after[35].in_use);
+    ABTS_TRUE(tc, after[35].num_of_slab <= before[35].num_of_slab + 1);
 }
 
 abts_suite *test_memory(abts_suite *suite)
@@ -78,6 +156,8 @@ abts_suite *test_memory(abts_suite *suite)
     abts_run_test(suite, test2_func, NULL);
     abts_run_test(suite, test3_func, NULL);
     abts_run_test(suite, test4_func, NULL);
+    abts_run_test(suite, test5_func, NULL);
+    abts_run_test(suite, test6_func, NULL);
 
     return suite;
 }
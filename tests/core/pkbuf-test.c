@@ -70,12 +70,124 @@ static void test2_func(abts_case *tc, void *data)
     ogs_pkbuf_free(p3);
 }
 
+#define TEST3_THREAD_NUM 4
+#define TEST3_PKBUF_NUM 256
+
+static ogs_pkbuf_pool_t *test3_pool;
+static ogs_pkbuf_t *test3_pkbuf[TEST3_THREAD_NUM][TEST3_PKBUF_NUM];
+
+static void test3_alloc(void *data)
+{
+    ogs_pkbuf_t **pkbuf = data;
+    int i;
+
+    for (i = 0; i < TEST3_PKBUF_NUM; i++) {
+        pkbuf[i] = ogs_pkbuf_alloc(test3_pool, 100 + i * 8);
+        ogs_assert(pkbuf[i]);
+        memset(ogs_pkbuf_put(pkbuf[i], 100), i, 100);
+    }
+}
+
+static void test3_free(void *data)
+{
+    ogs_pkbuf_t **pkbuf = data;
+    ogs_pkbuf_t *copy = NULL;
+    int i;
+
+    for (i = 0; i < TEST3_PKBUF_NUM; i++) {
+        copy = ogs_pkbuf_copy(pkbuf[i]);
+        ogs_assert(copy);
+        ogs_pkbuf_free(pkbuf[i]);
+        ogs_assert(copy->data[99] == (uint8_t)i);
+        ogs_pkbuf_free(copy);
+    }
+}
+
+static void test3_func(abts_case *tc, void *data)
+{
+    ogs_pkbuf_config_t config;
+    ogs_thread_t *thread[TEST3_THREAD_NUM];
+    int i, j;
+
+    ogs_pkbuf_default_init(&config);
+    test3_pool = ogs_pkbuf_pool_create(&config);
+    ABTS_PTR_NOTNULL(tc, test3_pool);
+
+    for (i = 0; i < TEST3_THREAD_NUM; i++)
+        thread[i] = ogs_thread_create(test3_alloc, test3_pkbuf[i]);
+    for (i = 0; i < TEST3_THREAD_NUM; i++)
+        ogs_thread_destroy(thread[i]);
+
+    for (i = 0; i < TEST3_THREAD_NUM; i++)
+        for (j = 0; j < TEST3_PKBUF_NUM; j++)
+            ABTS_INT_EQUAL(tc, 100, test3_pkbuf[i][j]->len);
+
+    /* Free the packets in another thread than the one allocating them */
+    for (i = 0; i < TEST3_THREAD_NUM; i++)
+        thread[i] = ogs_thread_create(test3_free,
+                test3_pkbuf[(i + 1) % TEST3_THREAD_NUM]);
+    for (i = 0; i < TEST3_THREAD_NUM; i++)
+        ogs_thread_destroy(thread[i]);
+
+    ogs_pkbuf_pool_destroy(test3_pool);
+}
+
+#define TEST4_THREAD_NUM 64
+#define TEST4_CLUSTER_NUM 64
+
+static ogs_pkbuf_pool_t *test4_pool;
+static int test4_failed;
+
+static void test4_main(void *data)
+{
+    ogs_pkbuf_t *pkbuf = ogs_pkbuf_alloc(test4_pool, 100);
+
+    if (!pkbuf) {
+        ogs_atomic_inc(&test4_failed);
+        return;
+    }
+    ogs_pkbuf_free(pkbuf);
+}
+
+/* the clusters cached by an exiting thread go back to the pool */
+static void test4_func(abts_case *tc, void *data)
+{
+    ogs_pkbuf_config_t config;
+    ogs_thread_t *thread = NULL;
+    ogs_pkbuf_t *pkbuf[TEST4_CLUSTER_NUM];
+    int i;
+
+    ogs_pkbuf_default_init(&config);
+    config.cluster_128_pool = TEST4_CLUSTER_NUM;
+    test4_pool = ogs_pkbuf_pool_create(&config);
+    ABTS_PTR_NOTNULL(tc, test4_pool);
+
+    test4_failed = 0;
+    for (i = 0; i < TEST4_THREAD_NUM; i++) {
+        thread = ogs_thread_create(test4_main, NULL);
+        ABTS_PTR_NOTNULL(tc, thread);
+        ogs_thread_destroy(thread);
+    }
+    ABTS_INT_EQUAL(tc, 0, test4_failed);
+
+    for (i = 0; i < TEST4_CLUSTER_NUM; i++) {
+        pkbuf[i] = ogs_pkbuf_alloc(test4_pool, 100);
+        ABTS_PTR_NOTNULL(tc, pkbuf[i]);
+    }
+    for (i = 0; i < TEST4_CLUSTER_NUM; i++)
+        ogs_pkbuf_free(pkbuf[i]);
+
+    ogs_pkbuf_pool_destroy(test4_pool);
+}
+
 abts_suite *test_pkbuf(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test1_func, NULL);
     abts_run_test(suite, test2_func, NULL);
+    abts_run_test(suite, test3_func, NULL);
+    abts_run_test(suite, test4_func, NULL);
 
     return suite;
 }
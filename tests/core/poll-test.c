@@ -435,6 +435,62 @@ static void test7_func(abts_case *tc, void *data)
     */
 }
 
+#define TEST8_PRODUCERS 4
+#define TEST8_EVENTS 20000
+
+static ogs_pollset_t *test8_pollset;
+static ogs_queue_t *test8_queue;
+
+static void test8_main(void *data)
+{
+    int i, rv;
+
+    for (i = 0; i < TEST8_EVENTS; i++) {
+        do {
+            rv = ogs_queue_push(test8_queue, &test8_queue);
+        } while (rv == OGS_ERROR);
+        ogs_assert(rv == OGS_OK);
+        ogs_assert(ogs_pollset_notify(test8_pollset) == OGS_OK);
+    }
+}
+
+static void test8_func(abts_case *tc, void *data)
+{
+    int i, rv, received = 0, timeup = 0;
+    ogs_thread_t *thread[TEST8_PRODUCERS];
+
+    test8_pollset = ogs_pollset_create(512);
+    ABTS_PTR_NOTNULL(tc, test8_pollset);
+    test8_queue = ogs_queue_create(64);
+    ABTS_PTR_NOTNULL(tc, test8_queue);
+
+    for (i = 0; i < TEST8_PRODUCERS; i++)
+        thread[i] = ogs_thread_create(test8_main, NULL);
+
+    /* Every event must be followed by a wakeup, however many coalesce */
+    while (received < TEST8_PRODUCERS * TEST8_EVENTS) {
+        void *e;
+
+        rv = ogs_pollset_poll(test8_pollset, ogs_time_from_sec(1));
+        if (rv == OGS_TIMEUP) {
+            timeup++;
+            break;
+        }
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+        while (ogs_queue_trypop(test8_queue, &e) == OGS_OK)
+            received++;
+    }
+    ABTS_INT_EQUAL(tc, 0, timeup);
+    ABTS_INT_EQUAL(tc, TEST8_PRODUCERS * TEST8_EVENTS, received);
+
+    for (i = 0; i < TEST8_PRODUCERS; i++)
+        ogs_thread_destroy(thread[i]);
+
+    ogs_queue_destroy(test8_queue);
+    ogs_pollset_destroy(test8_pollset);
+}
+
 abts_suite *test_poll(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -449,6 +505,7 @@ abts_suite *test_poll(abts_suite *suite)
     abts_run_test(suite, test5_func, NULL);
     abts_run_test(suite, test6_func, NULL);
     abts_run_test(suite, test7_func, NULL);
+    abts_run_test(suite, test8_func, NULL);
 
     return suite;
 }
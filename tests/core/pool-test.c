@@ -228,6 +228,77 @@ static void test3_func(abts_case *tc, void *data)
     ogs_pool_final(&testpool);
 }
 
+#define SIZE_OF_TPOOL4  1000
+#define CHUNK_OF_TPOOL4 64
+
+static OGS_CPOOL(tpool4, type_of_tpool2);
+
+static void test4_func(abts_case *tc, void *data)
+{
+    int i;
+    ogs_index_t index;
+    type_of_tpool2 *node[SIZE_OF_TPOOL4+1];
+
+    ogs_cpool_init(&tpool4, SIZE_OF_TPOOL4, CHUNK_OF_TPOOL4);
+    ogs_cpool_set_release(&tpool4, true);
+
+    /* Nothing is allocated up front */
+    ABTS_INT_EQUAL(tc, SIZE_OF_TPOOL4, ogs_cpool_size(&tpool4));
+    ABTS_INT_EQUAL(tc, SIZE_OF_TPOOL4, ogs_cpool_avail(&tpool4));
+    ABTS_INT_EQUAL(tc, 0, ogs_cpool_backed(&tpool4));
+
+    for (i = 0; i < SIZE_OF_TPOOL4; i++) {
+        ogs_cpool_alloc(&tpool4, &node[i]);
+        ABTS_PTR_NOTNULL(tc, node[i]);
+        node[i]->m2 = i;
+    }
+    ogs_cpool_alloc(&tpool4, &node[i]);
+    ABTS_PTR_EQUAL(tc, NULL, node[i]);
+
+    ABTS_INT_EQUAL(tc, 0, ogs_cpool_avail(&tpool4));
+    ABTS_INT_EQUAL(tc, SIZE_OF_TPOOL4, ogs_cpool_backed(&tpool4));
+    ABTS_INT_EQUAL(tc, SIZE_OF_TPOOL4, ogs_cpool_hwm(&tpool4));
+
+    for (i = 0; i < SIZE_OF_TPOOL4; i++) {
+        index = ogs_cpool_index(&tpool4, node[i]);
+        ABTS_INT_EQUAL(tc, i + 1, index);
+        ABTS_PTR_EQUAL(tc, node[i], ogs_cpool_find(&tpool4, index));
+        ABTS_PTR_EQUAL(tc, node[i], ogs_cpool_cycle(&tpool4, node[i]));
+        ABTS_INT_EQUAL(tc, i, node[i]->m2);
+    }
+    ABTS_PTR_EQUAL(tc, NULL,
+            ogs_cpool_cycle(&tpool4, (uint8_t *)node[0] + 1));
+    ABTS_PTR_EQUAL(tc, NULL, ogs_cpool_cycle(&tpool4, &index));
+
+    /* Emptied chunks are returned, keeping one chunk of spare objects */
+    for (i = 0; i < SIZE_OF_TPOOL4 - 1; i++)
+        ogs_cpool_free(&tpool4, node[i]);
+    ABTS_INT_EQUAL(tc, 1, SIZE_OF_TPOOL4 - ogs_cpool_avail(&tpool4));
+    ABTS_TRUE(tc, ogs_cpool_backed(&tpool4) <= 3 * CHUNK_OF_TPOOL4);
+    ABTS_PTR_EQUAL(tc, NULL, ogs_cpool_find(&tpool4, 1));
+
+    /* Stale pointers, including into released chunks, are rejected */
+    for (i = 0; i < SIZE_OF_TPOOL4 - 1; i++)
+        ABTS_PTR_EQUAL(tc, NULL, ogs_cpool_cycle(&tpool4, node[i]));
+    ABTS_PTR_EQUAL(tc, node[SIZE_OF_TPOOL4-1],
+            ogs_cpool_cycle(&tpool4, node[SIZE_OF_TPOOL4-1]));
+
+    /* Surviving objects keep their index */
+    index = ogs_cpool_index(&tpool4, node[SIZE_OF_TPOOL4-1]);
+    ABTS_INT_EQUAL(tc, SIZE_OF_TPOOL4, index);
+    ABTS_PTR_EQUAL(tc, node[SIZE_OF_TPOOL4-1], ogs_cpool_find(&tpool4, index));
+
+    for (i = 0; i < SIZE_OF_TPOOL4 - 1; i++) {
+        ogs_cpool_alloc(&tpool4, &node[i]);
+        ABTS_PTR_NOTNULL(tc, node[i]);
+    }
+    for (i = 0; i < SIZE_OF_TPOOL4; i++)
+        ogs_cpool_free(&tpool4, node[i]);
+    ABTS_INT_EQUAL(tc, SIZE_OF_TPOOL4, ogs_cpool_hwm(&tpool4));
+
+    ogs_cpool_final(&tpool4);
+}
+
 abts_suite *test_pool(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -235,6 +306,7 @@ abts_suite *test_pool(abts_suite *suite)
     abts_run_test(suite, test1_func, NULL);
     abts_run_test(suite, test2_func, NULL);
     abts_run_test(suite, test3_func, NULL);
+    abts_run_test(suite, test4_func, NULL);
 
     return suite;
 }
@@ -166,12 +166,89 @@ static void test_queue_timeout(abts_case *tc, void *data)
     ogs_queue_destroy(q);
 }
 
+#define BATCH_PRODUCERS     4
+#define BATCH_ELEMENTS      100000
+
+static void batch_producer(void *data)
+{
+    uintptr_t id = (uintptr_t)data;
+    uintptr_t i;
+    int rv;
+
+    for (i = 0; i < BATCH_ELEMENTS; i++) {
+        do {
+            rv = ogs_queue_push(queue, (void *)((id << 24) | (i + 1)));
+        } while (rv == OGS_ERROR);
+        ogs_assert(rv == OGS_OK);
+    }
+}
+
+static void test_queue_batch(abts_case *tc, void *data)
+{
+    uintptr_t i;
+    int rv;
+    unsigned int j, num, total = 0;
+    uintptr_t last[BATCH_PRODUCERS];
+    void *value[OGS_QUEUE_BATCH_SIZE];
+    ogs_thread_t *producer_thread[BATCH_PRODUCERS];
+    int in_order = 1;
+
+    queue = ogs_queue_create(QUEUE_SIZE);
+    ABTS_PTR_NOTNULL(tc, queue);
+
+    num = OGS_QUEUE_BATCH_SIZE;
+    rv = ogs_queue_trypop_batch(queue, value, &num);
+    ABTS_INT_EQUAL(tc, OGS_RETRY, rv);
+
+    for (i = 0; i < BATCH_PRODUCERS; i++) {
+        last[i] = 0;
+        producer_thread[i] = ogs_thread_create(batch_producer, (void *)i);
+        ABTS_PTR_NOTNULL(tc, producer_thread[i]);
+    }
+
+    while (total < BATCH_PRODUCERS * BATCH_ELEMENTS) {
+        num = OGS_QUEUE_BATCH_SIZE;
+        rv = ogs_queue_trypop_batch(queue, value, &num);
+        if (rv == OGS_RETRY)
+            continue;
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+        ABTS_TRUE(tc, num > 0 && num <= OGS_QUEUE_BATCH_SIZE);
+
+        for (j = 0; j < num; j++) {
+            uintptr_t v = (uintptr_t)value[j];
+            uintptr_t id = v >> 24;
+
+            /* Elements of one producer come out in the order pushed */
+            if (id >= BATCH_PRODUCERS || (v & 0xffffff) != last[id] + 1)
+                in_order = 0;
+            else
+                last[id]++;
+        }
+        total += num;
+    }
+    ABTS_TRUE(tc, in_order);
+    ABTS_INT_EQUAL(tc, 0, ogs_queue_size(queue));
+
+    for (i = 0; i < BATCH_PRODUCERS; i++)
+        ogs_thread_destroy(producer_thread[i]);
+
+    rv = ogs_queue_term(queue);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    num = OGS_QUEUE_BATCH_SIZE;
+    rv = ogs_queue_trypop_batch(queue, value, &num);
+    ABTS_INT_EQUAL(tc, OGS_DONE, rv);
+
+    ogs_queue_destroy(queue);
+}
+
 abts_suite *test_queue(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test_queue_producer_consumer, NULL);
     abts_run_test(suite, test_queue_timeout, NULL);
+    abts_run_test(suite, test_queue_batch, NULL);
 
     return suite;
 }
@@ -27,11 +27,21 @@ static int x = 0;
 #define THREAD_NUM 100
 
 static ogs_thread_t *thread[THREAD_NUM];
+static int exited = 0;
+
+static void exit_func(void)
+{
+    ogs_thread_mutex_lock(&lock);
+    exited++;
+    ogs_thread_mutex_unlock(&lock);
+}
 
 static void thread_func(void *data)
 {
     int i;
 
+    ogs_thread_at_exit(exit_func);
+
     for (i = 0; i < LOCK_LOOP; i++) {
         ogs_thread_mutex_lock(&lock);
         x++;
@@ -67,6 +77,17 @@ static void check_locks(abts_case *tc, void *data)
     ABTS_INT_EQUAL(tc, THREAD_NUM * LOCK_LOOP, x);
 }
 
+static void check_at_exit(abts_case *tc, void *data)
+{
+    ABTS_INT_EQUAL(tc, THREAD_NUM, exited);
+
+    /* Run early for the calling thread, and only once */
+    ogs_thread_at_exit(exit_func);
+    ogs_thread_run_at_exit();
+    ogs_thread_run_at_exit();
+    ABTS_INT_EQUAL(tc, THREAD_NUM + 1, exited);
+}
+
 static void final_thread(abts_case *tc, void *data)
 {
     ogs_thread_mutex_destroy(&lock);
@@ -80,6 +101,7 @@ abts_suite *test_thread(abts_suite *suite)
     abts_run_test(suite, create_threads, NULL);
     abts_run_test(suite, delete_threads, NULL);
     abts_run_test(suite, check_locks, NULL);
+    abts_run_test(suite, check_at_exit, NULL);
     abts_run_test(suite, final_thread, NULL);
 
     return suite;
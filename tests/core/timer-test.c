@@ -51,7 +51,7 @@ static void test1_func(abts_case *tc, void *data)
 
     memset(expire_check, 0, TEST_DURATION/TEST_TIMER_PRECISION);
 
-    timer = ogs_timer_mgr_create(512);
+    timer = ogs_timer_mgr_create(512, OGS_TIMER_MGR_RBTREE);
     pollset = ogs_pollset_create(512);
     ogs_assert(timer);
     for(n = 0; n < sizeof(timer_duration)/sizeof(ogs_time_t); n++) {
@@ -126,7 +126,7 @@ static void test2_func(abts_case *tc, void *data)
     memset(expire_check, 0, TEST_DURATION/TEST_TIMER_PRECISION);
     memset(tm_num, 0, sizeof(int)*(TEST_DURATION/TEST_TIMER_PRECISION));
 
-    timer = ogs_timer_mgr_create(512);
+    timer = ogs_timer_mgr_create(512, (uintptr_t)data);
     ogs_assert(timer);
 
     for(n = 0; n < TEST_TIMER_NUM; n++) {
@@ -168,7 +168,7 @@ static void test3_func(abts_case *tc, void *data)
     memset(expire_check, 0, TEST_DURATION/TEST_TIMER_PRECISION);
     memset(tm_num, 0, sizeof(int)*(TEST_DURATION/TEST_TIMER_PRECISION));
 
-    timer = ogs_timer_mgr_create(512);
+    timer = ogs_timer_mgr_create(512, (uintptr_t)data);
     ogs_assert(timer);
 
     for(n = 0; n < TEST_TIMER_NUM; n++) {
@@ -208,13 +208,138 @@ static void test3_func(abts_case *tc, void *data)
     ogs_timer_mgr_destroy(timer);
 }
 
+static int expire_order[5];
+static int expire_count;
+
+void test_expire_func_4(void *data)
+{
+    expire_order[expire_count++] = (uintptr_t)data;
+}
+
+/* timing wheel may wake up early when the timer is in an upper level */
+static void test4_func(abts_case *tc, void *data)
+{
+    int n = 0;
+    ogs_pollset_t *pollset = NULL;
+    ogs_timer_mgr_t *timer = NULL;
+    ogs_timer_t *timer_array[TEST_TIMER_NUM];
+    ogs_timer_t *long_timer = NULL;
+    ogs_time_t started;
+
+    expire_count = 0;
+
+    timer = ogs_timer_mgr_create(512, OGS_TIMER_MGR_WHEEL);
+    pollset = ogs_pollset_create(512);
+    ogs_assert(timer);
+    ABTS_INT_EQUAL(tc, OGS_INFINITE_TIME, ogs_timer_mgr_next(timer));
+
+    started = ogs_get_monotonic_time();
+    for(n = 0; n < sizeof(timer_duration)/sizeof(ogs_time_t); n++) {
+        timer_array[n] = ogs_timer_add(
+                timer, test_expire_func_4, (void*)(uintptr_t)n);
+        ogs_assert(timer_array[n]);
+        ogs_timer_start(timer_array[n], 1000000);
+        ogs_timer_start(timer_array[n], timer_duration[n]);
+    }
+
+    long_timer = ogs_timer_add(timer, test_expire_func_4, NULL);
+    ogs_assert(long_timer);
+    ogs_timer_start(long_timer, ogs_time_from_sec(3600));
+
+    while (expire_count < 5) {
+        ogs_pollset_poll(pollset, ogs_timer_mgr_next(timer));
+        ogs_timer_mgr_expire(timer);
+    }
+
+    ABTS_INT_EQUAL(tc, 1, expire_order[0]);
+    ABTS_INT_EQUAL(tc, 3, expire_order[1]);
+    ABTS_INT_EQUAL(tc, 2, expire_order[2]);
+    ABTS_INT_EQUAL(tc, 0, expire_order[3]);
+    ABTS_INT_EQUAL(tc, 4, expire_order[4]);
+    ABTS_TRUE(tc, ogs_get_monotonic_time() - started >= timer_duration[4]);
+
+    ABTS_TRUE(tc, ogs_timer_mgr_next(timer) > ogs_time_from_sec(1));
+    ogs_timer_stop(long_timer);
+    ABTS_INT_EQUAL(tc, OGS_INFINITE_TIME, ogs_timer_mgr_next(timer));
+
+    for(n = 0; n < sizeof(timer_duration)/sizeof(ogs_time_t); n++)
+        ogs_timer_delete(timer_array[n]);
+    ogs_timer_delete(long_timer);
+
+    ogs_timer_mgr_destroy(timer);
+    ogs_pollset_destroy(pollset);
+}
+
+#define TEST5_TIMER_NUM          65
+
+static ogs_timer_t *restart_timer[TEST5_TIMER_NUM];
+static int restart_count[TEST5_TIMER_NUM];
+static int restart_early;
+
+void test_expire_func_5(void *data)
+{
+    int index = (uintptr_t)data;
+
+    if (ogs_get_monotonic_time() < restart_timer[index]->timeout)
+        restart_early++;
+
+    /* Restart once with a timeout of zero or one tick, and beyond */
+    if (restart_count[index]++ == 0)
+        ogs_timer_start(restart_timer[index],
+                index ? ogs_time_from_msec(index) : 1);
+}
+
+/* timer restarted from its own callback */
+static void test5_func(abts_case *tc, void *data)
+{
+    int n = 0;
+    ogs_timer_mgr_t *timer = NULL;
+    ogs_time_t started;
+
+    restart_early = 0;
+
+    timer = ogs_timer_mgr_create(TEST5_TIMER_NUM, OGS_TIMER_MGR_WHEEL);
+    ogs_assert(timer);
+
+    for (n = 0; n < TEST5_TIMER_NUM; n++) {
+        restart_count[n] = 0;
+        restart_timer[n] = ogs_timer_add(
+                timer, test_expire_func_5, (void*)(uintptr_t)n);
+        ogs_assert(restart_timer[n]);
+        ogs_timer_start(restart_timer[n], ogs_time_from_msec(1));
+    }
+
+    ogs_msleep(30);
+    ogs_timer_mgr_expire(timer);
+
+    started = ogs_get_monotonic_time();
+    while (ogs_get_monotonic_time() - started < ogs_time_from_msec(200)) {
+        ogs_timer_mgr_expire(timer);
+        ogs_msleep(1);
+    }
+
+    ABTS_INT_EQUAL(tc, 0, restart_early);
+    for (n = 0; n < TEST5_TIMER_NUM; n++)
+        ABTS_INT_EQUAL(tc, 2, restart_count[n]);
+    ABTS_INT_EQUAL(tc, OGS_INFINITE_TIME, ogs_timer_mgr_next(timer));
+
+    for (n = 0; n < TEST5_TIMER_NUM; n++)
+        ogs_timer_delete(restart_timer[n]);
+
+    ogs_timer_mgr_destroy(timer);
+}
+
 abts_suite *test_timer(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
 
     abts_run_test(suite, test1_func, NULL);
-    abts_run_test(suite, test2_func, NULL);
-    abts_run_test(suite, test3_func, NULL);
+    abts_run_test(suite, test2_func, (void *)OGS_TIMER_MGR_RBTREE);
+    abts_run_test(suite, test3_func, (void *)OGS_TIMER_MGR_RBTREE);
+    abts_run_test(suite, test2_func, (void *)OGS_TIMER_MGR_WHEEL);
+    abts_run_test(suite, test3_func, (void *)OGS_TIMER_MGR_WHEEL);
+    abts_run_test(suite, test4_func, NULL);
+    abts_run_test(suite, test5_func, NULL);
 
     return suite;
 }
@@ -24,6 +24,7 @@
 abts_suite *test_aes(abts_suite *suite);
 abts_suite *test_sha(abts_suite *suite);
 abts_suite *test_base64(abts_suite *suite);
+abts_suite *test_auc(abts_suite *suite);
 
 const struct testlist {
     abts_suite *(*func)(abts_suite *suite);
@@ -31,6 +32,7 @@ const struct testlist {
     {test_aes},
     {test_sha},
     {test_base64},
+    {test_auc},
     {NULL},
 };
 
@@ -397,6 +397,48 @@ static void cmac_test(abts_case *tc, void *data)
     }
 }
 
+static void aes_test4(abts_case *tc, void *data)
+{
+    int key_bits[3] = { 128, 192, 256 };
+    uint8_t key[32], pt[16], ct1[16], ct2[16];
+    unsigned int rk[OGS_AES_RKLENGTH(256)];
+    ogs_aes_key_t aes;
+    const ogs_aes_key_t *cached = NULL;
+    int i, j, nrounds;
+
+    for (i = 0; i < 3; i++) {
+        for (j = 0; j < 100; j++) {
+            ogs_random(key, sizeof key);
+            ogs_random(pt, sizeof pt);
+
+            nrounds = ogs_aes_setup_enc(rk, key, key_bits[i]);
+            ogs_aes_encrypt(rk, nrounds, pt, ct1);
+
+            ABTS_INT_EQUAL(tc, nrounds,
+                    ogs_aes_setup_key(&aes, key, key_bits[i]));
+            ogs_aes_encrypt_block(&aes, pt, ct2);
+            ABTS_TRUE(tc, memcmp(ct1, ct2, 16) == 0);
+
+            cached = ogs_aes_key_lookup(key, key_bits[i]);
+            ABTS_PTR_NOTNULL(tc, cached);
+            ABTS_PTR_EQUAL(tc, cached, ogs_aes_key_lookup(key, key_bits[i]));
+            memset(ct2, 0, sizeof ct2);
+            ogs_aes_encrypt_block(cached, pt, ct2);
+            ABTS_TRUE(tc, memcmp(ct1, ct2, 16) == 0);
+        }
+    }
+
+    /* Clearing wipes the key and the schedule out of the slot */
+    ogs_aes_key_cache_clear();
+    memset(&aes, 0, sizeof aes);
+    ABTS_TRUE(tc, memcmp(cached, &aes, sizeof aes) == 0);
+
+    cached = ogs_aes_key_lookup(key, 256);
+    memset(ct2, 0, sizeof ct2);
+    ogs_aes_encrypt_block(cached, pt, ct2);
+    ABTS_TRUE(tc, memcmp(ct1, ct2, 16) == 0);
+}
+
 abts_suite *test_aes(abts_suite *suite)
 {
     suite = ADD_SUITE(suite)
@@ -404,6 +446,7 @@ abts_suite *test_aes(abts_suite *suite)
     abts_run_test(suite, aes_test1, NULL);
     abts_run_test(suite, aes_test2, NULL);
     abts_run_test(suite, aes_test3, NULL);
+    abts_run_test(suite, aes_test4, NULL);
     abts_run_test(suite, cmac_test, NULL);
 
     return suite;
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ogs-crypt.h"
+#include "core/abts.h"
+
+/* TS 35.208 Test Set 1 */
+static void auc_test1(abts_case *tc, void *data)
+{
+    const char *_k = "465b5ce8 b199b49f aa5f0a2e e238a6bc";
+    const char *_rand = "23553cbe 9637a89d 218ae64d ae47bf35";
+    const char *_sqn = "ff9bb4d0 b607";
+    const char *_amf = "b9b9";
+    const char *_op = "cdc202d5 123e20f6 2b6d676a c72cb318";
+    const char *_opc = "cd63cb71 954a9f4e 48a5994e 37a02baf";
+    const char *_mac_a = "4a9ffac3 54dfafb3";
+    const char *_res = "a54211d5 e3ba50bf";
+    const char *_ck = "b40ba9a3 c58b2a05 bbf0d987 b21bf8cb";
+    const char *_ik = "f769bcd7 51044604 12767271 1c6d3441";
+    const char *_ak = "aa689c64 8370";
+
+    uint8_t k[16], rand[16], sqn[6], amf[2], op[16], opc[16];
+    uint8_t tmp[16], out[16];
+    ogs_auc_input_t in;
+    ogs_auc_vector_t v;
+    int i;
+
+    OGS_HEX(_k, strlen(_k), k);
+    OGS_HEX(_rand, strlen(_rand), rand);
+    OGS_HEX(_sqn, strlen(_sqn), sqn);
+    OGS_HEX(_amf, strlen(_amf), amf);
+    OGS_HEX(_op, strlen(_op), op);
+
+    for (i = 0; i < 2; i++) {
+        ogs_auc_opc(k, op, opc);
+        ABTS_TRUE(tc, memcmp(opc, OGS_HEX(_opc, strlen(_opc), tmp), 16) == 0);
+    }
+
+    /* Derived again once the cache is wiped */
+    ogs_auc_opc_cache_clear();
+    memset(opc, 0, sizeof(opc));
+    ogs_auc_opc(k, op, opc);
+    ABTS_TRUE(tc, memcmp(opc, OGS_HEX(_opc, strlen(_opc), tmp), 16) == 0);
+
+    memset(&in, 0, sizeof(in));
+    in.k = k;
+    in.opc = opc;
+    in.amf = amf;
+    in.sqn = sqn;
+    in.rand = rand;
+
+    ogs_auc_milenage(&in, &v, 1);
+
+    ABTS_INT_EQUAL(tc, 8, v.xres_len);
+    ABTS_TRUE(tc, memcmp(v.xres, OGS_HEX(_res, strlen(_res), tmp), 8) == 0);
+    ABTS_TRUE(tc, memcmp(v.ck, OGS_HEX(_ck, strlen(_ck), tmp), 16) == 0);
+    ABTS_TRUE(tc, memcmp(v.ik, OGS_HEX(_ik, strlen(_ik), tmp), 16) == 0);
+    ABTS_TRUE(tc, memcmp(v.ak, OGS_HEX(_ak, strlen(_ak), tmp), 6) == 0);
+    ABTS_TRUE(tc,
+        memcmp(v.autn + 8, OGS_HEX(_mac_a, strlen(_mac_a), tmp), 8) == 0);
+    for (i = 0; i < 6; i++)
+        out[i] = sqn[i] ^ v.ak[i];
+    ABTS_TRUE(tc, memcmp(v.autn, out, 6) == 0);
+    ABTS_TRUE(tc, memcmp(v.autn + 6, amf, 2) == 0);
+}
+
+/* Batches must match one milenage_generate() and KDF call per vector */
+#define AUC_TEST2_NUM 21
+
+static void auc_test2(abts_case *tc, void *data)
+{
+    uint8_t plmn_id[3] = { 0x00, 0xf1, 0x10 };
+    char serving_network_name[] = "5G:mnc001.mcc001.3gppnetwork.org";
+    uint8_t k[AUC_TEST2_NUM][16], opc[AUC_TEST2_NUM][16];
+    uint8_t sqn[AUC_TEST2_NUM][6], rand[AUC_TEST2_NUM][16], amf[2];
+    ogs_auc_input_t in[AUC_TEST2_NUM];
+    ogs_auc_vector_t eps[AUC_TEST2_NUM], nr[AUC_TEST2_NUM];
+    uint8_t autn[16], ik[16], ck[16], ak[6], xres[16];
+    uint8_t kasme[32], kausf[32], xres_star[16];
+    size_t xres_len;
+    int i;
+
+    ogs_random(amf, sizeof amf);
+    for (i = 0; i < AUC_TEST2_NUM; i++) {
+        /* every third input repeats the subscriber of the previous one */
+        if (i % 3 == 2) {
+            memcpy(k[i], k[i-1], 16);
+            memcpy(opc[i], opc[i-1], 16);
+        } else {
+            ogs_random(k[i], 16);
+            ogs_random(opc[i], 16);
+        }
+        ogs_random(sqn[i], 6);
+        ogs_random(rand[i], 16);
+
+        in[i].k = k[i];
+        in[i].opc = opc[i];
+        in[i].amf = amf;
+        in[i].sqn = sqn[i];
+        in[i].rand = rand[i];
+    }
+
+    ogs_auc_eps_vectors(plmn_id, in, eps, AUC_TEST2_NUM);
+    ogs_auc_5g_vectors(serving_network_name, in, nr, AUC_TEST2_NUM);
+
+    for (i = 0; i < AUC_TEST2_NUM; i++) {
+        xres_len = sizeof xres;
+        milenage_generate(opc[i], amf, k[i], sqn[i], rand[i],
+                autn, ik, ck, ak, xres, &xres_len);
+        ogs_auc_kasme(ck, ik, plmn_id, sqn[i], ak, kasme);
+        ogs_kdf_kausf(ck, ik, serving_network_name, autn, kausf);
+        ogs_kdf_xres_star(ck, ik, serving_network_name, rand[i],
+                xres, xres_len, xres_star);
+
+        ABTS_INT_EQUAL(tc, xres_len, eps[i].xres_len);
+        ABTS_TRUE(tc, memcmp(eps[i].xres, xres, xres_len) == 0);
+        ABTS_TRUE(tc, memcmp(eps[i].autn, autn, 16) == 0);
+        ABTS_TRUE(tc, memcmp(eps[i].ck, ck, 16) == 0);
+        ABTS_TRUE(tc, memcmp(eps[i].ik, ik, 16) == 0);
+        ABTS_TRUE(tc, memcmp(eps[i].ak, ak, 6) == 0);
+        ABTS_TRUE(tc, memcmp(eps[i].kasme, kasme, 32) == 0);
+
+        ABTS_TRUE(tc, memcmp(nr[i].autn, autn, 16) == 0);
+        ABTS_TRUE(tc, memcmp(nr[i].kausf, kausf, 32) == 0);
+        ABTS_TRUE(tc, memcmp(nr[i].xres_star, xres_star, 16) == 0);
+    }
+}
+
+abts_suite *test_auc(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, auc_test1, NULL);
+    abts_run_test(suite, auc_test2, NULL);
+
+    return suite;
+}
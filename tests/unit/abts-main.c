@@ -23,7 +23,10 @@
 abts_suite *test_s1ap_message(abts_suite *suite);
 abts_suite *test_nas_message(abts_suite *suite);
 abts_suite *test_gtp_message(abts_suite *suite);
+abts_suite *test_pfcp_message(abts_suite *suite);
 abts_suite *test_sbi_message(abts_suite *suite);
+abts_suite *test_sbi_http2(abts_suite *suite);
+abts_suite *test_dbi_cache(abts_suite *suite);
 abts_suite *test_security(abts_suite *suite);
 abts_suite *test_crash(abts_suite *suite);
 
@@ -33,7 +36,10 @@ const struct testlist {
     {test_s1ap_message},
     {test_nas_message},
     {test_gtp_message},
+    {test_pfcp_message},
     {test_sbi_message},
+    {test_sbi_http2},
+    {test_dbi_cache},
     {test_security},
     {test_crash},
     {NULL},
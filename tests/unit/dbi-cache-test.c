@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2019,2020 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test-common.h"
+
+#define SUPI1 "imsi-001010000000001"
+#define SUPI2 "imsi-001010000000002"
+#define SUPI3 "imsi-001010000000003"
+
+#define OID1 "5f3a5c1e9d1e4a6b7c8d9e01"
+#define OID2 "5f3a5c1e9d1e4a6b7c8d9e02"
+#define OID3 "5f3a5c1e9d1e4a6b7c8d9e03"
+#define OID4 "5f3a5c1e9d1e4a6b7c8d9e04"
+
+static void put_auth_info(const char *supi, const char *oid_string,
+        uint8_t k0, uint64_t sqn)
+{
+    bson_oid_t oid;
+    ogs_dbi_auth_info_t auth_info;
+
+    bson_oid_init_from_string(&oid, oid_string);
+
+    memset(&auth_info, 0, sizeof(auth_info));
+    auth_info.k[0] = k0;
+    auth_info.sqn = sqn;
+
+    ogs_dbi_cache_put_auth_info(
+            supi, &oid, ogs_dbi_cache_generation(), &auth_info);
+}
+
+static bool handle_update(const char *oid_string, const char *field)
+{
+    bool rv;
+    bson_oid_t oid;
+    bson_t *event = NULL;
+
+    bson_oid_init_from_string(&oid, oid_string);
+
+    event = BCON_NEW(
+            "operationType", BCON_UTF8("update"),
+            "documentKey", "{", "_id", BCON_OID(&oid), "}",
+            "updateDescription", "{",
+                "updatedFields", "{", field, BCON_INT64(64), "}",
+                "removedFields", "[", "]",
+            "}");
+    ogs_assert(event);
+
+    rv = ogs_dbi_cache_handle_event(event);
+    bson_destroy(event);
+
+    return rv;
+}
+
+/* The least recently used entry goes first */
+static void dbi_cache_test1(abts_case *tc, void *data)
+{
+    ogs_dbi_auth_info_t auth_info;
+
+    ABTS_INT_EQUAL(tc, OGS_OK, ogs_dbi_cache_init_unwatched(2));
+
+    put_auth_info(SUPI1, OID1, 1, 0);
+    put_auth_info(SUPI2, OID2, 2, 0);
+
+    /* SUPI1 is now the most recently used */
+    ABTS_TRUE(tc, ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+    ABTS_INT_EQUAL(tc, 1, auth_info.k[0]);
+
+    put_auth_info(SUPI3, OID3, 3, 0);
+
+    ABTS_TRUE(tc, !ogs_dbi_cache_get_auth_info(SUPI2, &auth_info));
+    ABTS_TRUE(tc, ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+    ABTS_INT_EQUAL(tc, 1, auth_info.k[0]);
+    ABTS_TRUE(tc, ogs_dbi_cache_get_auth_info(SUPI3, &auth_info));
+    ABTS_INT_EQUAL(tc, 3, auth_info.k[0]);
+
+    ogs_dbi_cache_final();
+}
+
+/* A new '_id' for the same SUPI drops what was cached for the old one */
+static void dbi_cache_test2(abts_case *tc, void *data)
+{
+    bson_oid_t oid;
+    ogs_dbi_auth_info_t auth_info;
+    ogs_subscription_data_t subscription_data;
+
+    ABTS_INT_EQUAL(tc, OGS_OK, ogs_dbi_cache_init_unwatched(4));
+
+    bson_oid_init_from_string(&oid, OID1);
+    memset(&subscription_data, 0, sizeof(subscription_data));
+    subscription_data.access_restriction_data = 0x20;
+    ogs_dbi_cache_put_subscription_data(
+            SUPI1, &oid, ogs_dbi_cache_generation(), &subscription_data);
+    put_auth_info(SUPI1, OID1, 1, 0);
+
+    memset(&subscription_data, 0, sizeof(subscription_data));
+    ABTS_TRUE(tc, ogs_dbi_cache_get_subscription_data(
+                SUPI1, &subscription_data));
+    ABTS_INT_EQUAL(tc, 0x20, subscription_data.access_restriction_data);
+
+    /* The subscriber was deleted and added again */
+    put_auth_info(SUPI1, OID4, 4, 0);
+
+    ABTS_TRUE(tc, !ogs_dbi_cache_get_subscription_data(
+                SUPI1, &subscription_data));
+    ABTS_TRUE(tc, ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+    ABTS_INT_EQUAL(tc, 4, auth_info.k[0]);
+
+    /* Events for the old document no longer match anything */
+    ABTS_TRUE(tc, handle_update(OID1, "security.k"));
+    ABTS_TRUE(tc, ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+
+    ABTS_TRUE(tc, handle_update(OID4, "security.k"));
+    ABTS_TRUE(tc, !ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+
+    ogs_dbi_cache_final();
+}
+
+/* Our own SQN updates keep the entry, and SQN is never served */
+static void dbi_cache_test3(abts_case *tc, void *data)
+{
+    ogs_dbi_auth_info_t auth_info;
+
+    ABTS_INT_EQUAL(tc, OGS_OK, ogs_dbi_cache_init_unwatched(4));
+
+    put_auth_info(SUPI1, OID1, 1, 0x1234);
+    ABTS_TRUE(tc, ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+    ABTS_TRUE(tc, auth_info.sqn == 0);
+
+    ABTS_TRUE(tc, handle_update(OID1, "security.sqn"));
+    ABTS_TRUE(tc, ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+    ABTS_INT_EQUAL(tc, 1, auth_info.k[0]);
+
+    ABTS_TRUE(tc, handle_update(OID1, "ambr.uplink"));
+    ABTS_TRUE(tc, !ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+
+    ogs_dbi_cache_final();
+}
+
+/* A document read before a change is not stored after it */
+static void dbi_cache_test4(abts_case *tc, void *data)
+{
+    bson_oid_t oid;
+    bson_t *event = NULL;
+    uint64_t generation;
+    ogs_dbi_auth_info_t auth_info;
+
+    ABTS_INT_EQUAL(tc, OGS_OK, ogs_dbi_cache_init_unwatched(4));
+
+    bson_oid_init_from_string(&oid, OID1);
+    memset(&auth_info, 0, sizeof(auth_info));
+    auth_info.k[0] = 1;
+
+    /* The change lands between the DB read and the put */
+    generation = ogs_dbi_cache_generation();
+    ABTS_TRUE(tc, handle_update(OID1, "security.k"));
+    ABTS_TRUE(tc, generation != ogs_dbi_cache_generation());
+
+    ogs_dbi_cache_put_auth_info(SUPI1, &oid, generation, &auth_info);
+    ABTS_TRUE(tc, !ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+
+    ogs_dbi_cache_put_auth_info(
+            SUPI1, &oid, ogs_dbi_cache_generation(), &auth_info);
+    ABTS_TRUE(tc, ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+
+    /* Inserts and SQN-only updates leave the generation alone */
+    generation = ogs_dbi_cache_generation();
+    event = BCON_NEW(
+            "operationType", BCON_UTF8("insert"),
+            "documentKey", "{", "_id", BCON_OID(&oid), "}");
+    ABTS_TRUE(tc, ogs_dbi_cache_handle_event(event));
+    bson_destroy(event);
+    ABTS_TRUE(tc, handle_update(OID1, "security.sqn"));
+    ABTS_TRUE(tc, generation == ogs_dbi_cache_generation());
+
+    /* An invalidate drops everything and asks for a new stream */
+    event = BCON_NEW("operationType", BCON_UTF8("invalidate"));
+    ABTS_TRUE(tc, !ogs_dbi_cache_handle_event(event));
+    bson_destroy(event);
+    ABTS_TRUE(tc, !ogs_dbi_cache_get_auth_info(SUPI1, &auth_info));
+    ABTS_TRUE(tc, generation != ogs_dbi_cache_generation());
+
+    ogs_dbi_cache_final();
+}
+
+abts_suite *test_dbi_cache(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, dbi_cache_test1, NULL);
+    abts_run_test(suite, dbi_cache_test2, NULL);
+    abts_run_test(suite, dbi_cache_test3, NULL);
+    abts_run_test(suite, dbi_cache_test4, NULL);
+
+    return suite;
+}
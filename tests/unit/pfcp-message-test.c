@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "test-common.h"
+#include "ogs-pfcp.h"
+
+static ogs_pkbuf_t *pfcp_header_push(
+        ogs_pkbuf_t *pkbuf, uint8_t type, uint64_t seid)
+{
+    ogs_pfcp_header_t *h = NULL;
+
+    ogs_assert(ogs_pkbuf_push(pkbuf, OGS_PFCP_HEADER_LEN));
+    h = (ogs_pfcp_header_t *)pkbuf->data;
+    memset(h, 0, OGS_PFCP_HEADER_LEN);
+
+    h->version = OGS_PFCP_VERSION;
+    h->seid_presence = 1;
+    h->type = type;
+    h->length = htobe16(pkbuf->len - 4);
+    h->seid = htobe64(seid);
+    h->sqn = OGS_PFCP_XID_TO_SQN(1);
+
+    return pkbuf;
+}
+
+static void pfcp_message_test1(abts_case *tc, void *data)
+{
+    ogs_pfcp_message_t message;
+    ogs_pfcp_session_establishment_request_t *req = NULL;
+    ogs_pfcp_tlv_create_urr_t *create_urr = NULL;
+    ogs_pfcp_urr_t urr;
+    ogs_pfcp_measurement_method_t meas_method;
+    ogs_pfcp_reporting_triggers_t rep_triggers;
+    ogs_pfcp_volume_threshold_t vol_threshold;
+    uint8_t vol_threshold_buf[1 + 8 * 3];
+    uint64_t be64;
+    uint32_t time_threshold, be32;
+    ogs_pkbuf_t *pkbuf = NULL;
+    int rv;
+
+    /* Create URR : volume and duration measurement */
+    memset(&message, 0, sizeof(message));
+    message.h.type = OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE;
+    req = &message.pfcp_session_establishment_request;
+
+    memset(&urr, 0, sizeof(urr));
+    urr.id = 3;
+    ogs_pfcp_build_create_urr(&req->create_urr[0], 0, &urr);
+    create_urr = &req->create_urr[0];
+
+    meas_method.value = 0;
+    meas_method.volume = 1;
+    meas_method.duration = 1;
+    create_urr->measurement_method.presence = 1;
+    create_urr->measurement_method.u8 = meas_method.value;
+
+    rep_triggers.value = 0;
+    rep_triggers.volume_threshold = 1;
+    rep_triggers.time_threshold = 1;
+    create_urr->reporting_triggers.presence = 1;
+    create_urr->reporting_triggers.u8 = rep_triggers.value;
+
+    vol_threshold.flags = 0;
+    vol_threshold.tovol = 1;
+    vol_threshold.ulvol = 1;
+    vol_threshold.dlvol = 1;
+    vol_threshold_buf[0] = vol_threshold.flags;
+    be64 = htobe64(3000000);
+    memcpy(vol_threshold_buf + 1, &be64, sizeof(be64));
+    be64 = htobe64(1000000);
+    memcpy(vol_threshold_buf + 9, &be64, sizeof(be64));
+    be64 = htobe64(2000000);
+    memcpy(vol_threshold_buf + 17, &be64, sizeof(be64));
+    create_urr->volume_threshold.presence = 1;
+    create_urr->volume_threshold.data = vol_threshold_buf;
+    create_urr->volume_threshold.len = sizeof(vol_threshold_buf);
+
+    time_threshold = htobe32(60);
+    create_urr->time_threshold.presence = 1;
+    create_urr->time_threshold.data = &time_threshold;
+    create_urr->time_threshold.len = sizeof(time_threshold);
+
+    pkbuf = ogs_pfcp_build_msg(&message);
+    ABTS_PTR_NOTNULL(tc, pkbuf);
+    pfcp_header_push(pkbuf, OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE, 1);
+
+    rv = ogs_pfcp_parse_msg(&message, pkbuf);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ogs_pkbuf_free(pkbuf);
+
+    ABTS_INT_EQUAL(tc, OGS_PFCP_SESSION_ESTABLISHMENT_REQUEST_TYPE,
+            message.h.type);
+    create_urr = &message.pfcp_session_establishment_request.create_urr[0];
+    ABTS_INT_EQUAL(tc, 1, create_urr->presence);
+    ABTS_INT_EQUAL(tc, 1, create_urr->urr_id.presence);
+    ABTS_INT_EQUAL(tc, 3, create_urr->urr_id.u32);
+    ABTS_INT_EQUAL(tc, 1, create_urr->measurement_method.presence);
+    meas_method.value = create_urr->measurement_method.u8;
+    ABTS_INT_EQUAL(tc, 1, meas_method.volume);
+    ABTS_INT_EQUAL(tc, 1, meas_method.duration);
+    ABTS_INT_EQUAL(tc, 0, meas_method.event);
+    ABTS_INT_EQUAL(tc, 1, create_urr->reporting_triggers.presence);
+    rep_triggers.value = create_urr->reporting_triggers.u8;
+    ABTS_INT_EQUAL(tc, 1, rep_triggers.volume_threshold);
+    ABTS_INT_EQUAL(tc, 1, rep_triggers.time_threshold);
+    ABTS_INT_EQUAL(tc, 0, rep_triggers.periodic_reporting);
+
+    ABTS_INT_EQUAL(tc, 1, create_urr->volume_threshold.presence);
+    rv = ogs_pfcp_parse_volume(&vol_threshold, &create_urr->volume_threshold);
+    ABTS_INT_EQUAL(tc, sizeof(vol_threshold_buf), rv);
+    ABTS_TRUE(tc, vol_threshold.total_volume == 3000000);
+    ABTS_TRUE(tc, vol_threshold.uplink_volume == 1000000);
+    ABTS_TRUE(tc, vol_threshold.downlink_volume == 2000000);
+
+    ABTS_INT_EQUAL(tc, 1, create_urr->time_threshold.presence);
+    ABTS_INT_EQUAL(tc, 4, create_urr->time_threshold.len);
+    memcpy(&be32, create_urr->time_threshold.data, sizeof(be32));
+    ABTS_INT_EQUAL(tc, 60, be32toh(be32));
+
+    ABTS_INT_EQUAL(tc, 0,
+            message.pfcp_session_establishment_request.create_urr[1].presence);
+}
+
+static void pfcp_message_test2(abts_case *tc, void *data)
+{
+    ogs_pfcp_message_t message;
+    ogs_pfcp_user_plane_report_t report;
+    ogs_pfcp_tlv_usage_report_session_report_request_t *usage_report = NULL;
+    ogs_pfcp_report_type_t report_type;
+    ogs_pfcp_usage_report_trigger_t rep_trigger;
+    ogs_pfcp_volume_measurement_t volume;
+    uint8_t *p = NULL;
+    uint64_t be64;
+    uint32_t be32;
+    ogs_pkbuf_t *pkbuf = NULL;
+    int rv;
+
+    /* Usage Report : volume and duration measurement */
+    memset(&report, 0, sizeof(report));
+    report.type.usage_report = 1;
+    report.usage_report.id = 3;
+    report.usage_report.seqn = 7;
+    report.usage_report.rep_trigger.volume_threshold = 1;
+    report.usage_report.start_time = 3900000000U;
+    report.usage_report.end_time = 3900000090U;
+    report.usage_report.vol_measurement.tovol = 1;
+    report.usage_report.vol_measurement.ulvol = 1;
+    report.usage_report.vol_measurement.dlvol = 1;
+    report.usage_report.vol_measurement.tonop = 1;
+    report.usage_report.vol_measurement.total_volume = 3000123;
+    report.usage_report.vol_measurement.uplink_volume = 1000041;
+    report.usage_report.vol_measurement.downlink_volume = 2000082;
+    report.usage_report.vol_measurement.total_n_packets = 2345;
+    report.usage_report.dur_measurement_presence = true;
+    report.usage_report.dur_measurement = 90;
+
+    pkbuf = ogs_pfcp_build_session_report_request(
+            OGS_PFCP_SESSION_REPORT_REQUEST_TYPE, &report);
+    ABTS_PTR_NOTNULL(tc, pkbuf);
+    pfcp_header_push(pkbuf, OGS_PFCP_SESSION_REPORT_REQUEST_TYPE, 1);
+
+    rv = ogs_pfcp_parse_msg(&message, pkbuf);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    ogs_pkbuf_free(pkbuf);
+
+    ABTS_INT_EQUAL(tc, OGS_PFCP_SESSION_REPORT_REQUEST_TYPE, message.h.type);
+    ABTS_INT_EQUAL(tc, 1,
+            message.pfcp_session_report_request.report_type.presence);
+    report_type.value = message.pfcp_session_report_request.report_type.u8;
+    ABTS_INT_EQUAL(tc, 1, report_type.usage_report);
+    ABTS_INT_EQUAL(tc, 0, report_type.downlink_data_report);
+
+    usage_report = &message.pfcp_session_report_request.usage_report;
+    ABTS_INT_EQUAL(tc, 1, usage_report->presence);
+    ABTS_INT_EQUAL(tc, 3, usage_report->urr_id.u32);
+
+    ABTS_INT_EQUAL(tc, 4, usage_report->ur_seqn.len);
+    memcpy(&be32, usage_report->ur_seqn.data, sizeof(be32));
+    ABTS_INT_EQUAL(tc, 7, be32toh(be32));
+
+    ABTS_INT_EQUAL(tc, OGS_PFCP_USAGE_REPORT_TRIGGER_LEN,
+            usage_report->usage_report_trigger.len);
+    memcpy(&rep_trigger, usage_report->usage_report_trigger.data,
+            OGS_PFCP_USAGE_REPORT_TRIGGER_LEN);
+    ABTS_INT_EQUAL(tc, 1, rep_trigger.volume_threshold);
+    ABTS_INT_EQUAL(tc, 0, rep_trigger.time_threshold);
+
+    memcpy(&be32, usage_report->start_time.data, sizeof(be32));
+    ABTS_TRUE(tc, be32toh(be32) == 3900000000U);
+    memcpy(&be32, usage_report->end_time.data, sizeof(be32));
+    ABTS_TRUE(tc, be32toh(be32) == 3900000090U);
+
+    /* Only the flagged fields follow the flags, in order */
+    ABTS_INT_EQUAL(tc, 1, usage_report->volume_measurement.presence);
+    ABTS_INT_EQUAL(tc, 1 + 8 * 4, usage_report->volume_measurement.len);
+    p = usage_report->volume_measurement.data;
+    volume.flags = p[0];
+    ABTS_INT_EQUAL(tc, 1, volume.tovol);
+    ABTS_INT_EQUAL(tc, 1, volume.ulvol);
+    ABTS_INT_EQUAL(tc, 1, volume.dlvol);
+    ABTS_INT_EQUAL(tc, 1, volume.tonop);
+    ABTS_INT_EQUAL(tc, 0, volume.ulnop);
+    ABTS_INT_EQUAL(tc, 0, volume.dlnop);
+    memcpy(&be64, p + 1, sizeof(be64));
+    ABTS_TRUE(tc, be64toh(be64) == 3000123);
+    memcpy(&be64, p + 9, sizeof(be64));
+    ABTS_TRUE(tc, be64toh(be64) == 1000041);
+    memcpy(&be64, p + 17, sizeof(be64));
+    ABTS_TRUE(tc, be64toh(be64) == 2000082);
+    memcpy(&be64, p + 25, sizeof(be64));
+    ABTS_TRUE(tc, be64toh(be64) == 2345);
+
+    ABTS_INT_EQUAL(tc, 1, usage_report->duration_measurement.presence);
+    ABTS_INT_EQUAL(tc, 4, usage_report->duration_measurement.len);
+    memcpy(&be32, usage_report->duration_measurement.data, sizeof(be32));
+    ABTS_INT_EQUAL(tc, 90, be32toh(be32));
+}
+
+abts_suite *test_pfcp_message(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, pfcp_message_test1, NULL);
+    abts_run_test(suite, pfcp_message_test2, NULL);
+
+    return suite;
+}
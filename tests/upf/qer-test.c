@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "upf/context.h"
+#include "core/abts.h"
+
+#define TEST_PKT_LEN 1000
+#define TEST_PKT_NUM 200
+
+static ogs_pfcp_qer_t *test_qer_create(ogs_pfcp_sess_t *sess,
+        uint8_t gate, uint64_t mbr_uplink, uint64_t mbr_downlink)
+{
+    ogs_pfcp_tlv_create_qer_t message;
+    ogs_pfcp_qer_t qer;
+    uint8_t cause_value = 0, offending_ie_value = 0;
+
+    memset(&qer, 0, sizeof(qer));
+    qer.id = 1;
+    qer.gate_status.uplink = gate;
+    qer.gate_status.downlink = gate;
+    qer.mbr.uplink = mbr_uplink;
+    qer.mbr.downlink = mbr_downlink;
+
+    memset(&message, 0, sizeof(message));
+    ogs_pfcp_build_create_qer(&message, 0, &qer);
+
+    return ogs_pfcp_handle_create_qer(
+            sess, &message, &cause_value, &offending_ie_value);
+}
+
+/* MBR : packets beyond the bucket are dropped */
+static void test1_func(abts_case *tc, void *data)
+{
+    ogs_pfcp_sess_t sess;
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_qer_t *qer = NULL;
+    int i, passed;
+
+    memset(&sess, 0, sizeof(sess));
+    ogs_pfcp_pool_init(&sess);
+
+    qer = ogs_pfcp_qer_add(&sess);
+    ABTS_PTR_NOTNULL(tc, qer);
+    qer->id = 1;
+
+    /* 1MB/s downlink holds 100KB in the bucket, uplink is unlimited */
+    ABTS_PTR_EQUAL(tc, qer,
+            test_qer_create(&sess, OGS_PFCP_GATE_OPEN, 0, 8000000));
+    ABTS_TRUE(tc, qer->policer.downlink.rate == 1000000);
+    ABTS_TRUE(tc, qer->policer.downlink.bucket_size == 100000);
+    ABTS_TRUE(tc, qer->policer.uplink.rate == 0);
+
+    pdr = ogs_pfcp_pdr_add(&sess);
+    ABTS_PTR_NOTNULL(tc, pdr);
+    ogs_pfcp_pdr_associate_qer(pdr, qer);
+
+    pdr->src_if = OGS_PFCP_INTERFACE_CORE;
+    passed = 0;
+    for (i = 0; i < TEST_PKT_NUM; i++)
+        if (ogs_pfcp_up_police_pdr(pdr, TEST_PKT_LEN) == true)
+            passed++;
+
+    ABTS_TRUE(tc, passed >= 100);
+    ABTS_TRUE(tc, passed < TEST_PKT_NUM);
+    ABTS_TRUE(tc,
+            qer->policer.downlink.dropped_packets == TEST_PKT_NUM - passed);
+    ABTS_TRUE(tc, qer->policer.downlink.dropped_bytes ==
+            (uint64_t)(TEST_PKT_NUM - passed) * TEST_PKT_LEN);
+
+    pdr->src_if = OGS_PFCP_INTERFACE_ACCESS;
+    passed = 0;
+    for (i = 0; i < TEST_PKT_NUM; i++)
+        if (ogs_pfcp_up_police_pdr(pdr, TEST_PKT_LEN) == true)
+            passed++;
+
+    ABTS_INT_EQUAL(tc, TEST_PKT_NUM, passed);
+    ABTS_TRUE(tc, qer->policer.uplink.dropped_packets == 0);
+
+    ogs_pfcp_pdr_remove_all(&sess);
+    ogs_pfcp_qer_remove_all(&sess);
+    ogs_pfcp_pool_final(&sess);
+}
+
+/* Gate : a closed gate drops, an open gate lets the FAR buffer */
+static void test2_func(abts_case *tc, void *data)
+{
+    ogs_pfcp_sess_t sess;
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_far_t *far = NULL;
+    ogs_pfcp_qer_t *qer = NULL;
+    ogs_pfcp_user_plane_report_t report;
+    ogs_pkbuf_t *pkbuf = NULL;
+
+    memset(&sess, 0, sizeof(sess));
+    ogs_pfcp_pool_init(&sess);
+
+    qer = ogs_pfcp_qer_add(&sess);
+    ABTS_PTR_NOTNULL(tc, qer);
+    qer->id = 1;
+    ABTS_PTR_EQUAL(tc, qer,
+            test_qer_create(&sess, OGS_PFCP_GATE_CLOSE, 0, 0));
+
+    /* No GTP-U node yet : the FAR buffers what gets through */
+    far = ogs_pfcp_far_add(&sess);
+    ABTS_PTR_NOTNULL(tc, far);
+
+    pdr = ogs_pfcp_pdr_add(&sess);
+    ABTS_PTR_NOTNULL(tc, pdr);
+    pdr->src_if = OGS_PFCP_INTERFACE_CORE;
+    ogs_pfcp_pdr_associate_far(pdr, far);
+    ogs_pfcp_pdr_associate_qer(pdr, qer);
+
+    pkbuf = ogs_pkbuf_alloc(NULL, TEST_PKT_LEN);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put(pkbuf, TEST_PKT_LEN);
+    ogs_pfcp_up_handle_pdr(pdr, pkbuf, &report);
+
+    ABTS_INT_EQUAL(tc, 0, far->num_of_buffered_packet);
+    ABTS_INT_EQUAL(tc, 0, report.type.downlink_data_report);
+    ABTS_TRUE(tc, qer->policer.downlink.dropped_packets == 1);
+    ABTS_TRUE(tc, qer->policer.downlink.dropped_bytes == TEST_PKT_LEN);
+
+    ABTS_PTR_EQUAL(tc, qer,
+            test_qer_create(&sess, OGS_PFCP_GATE_OPEN, 0, 0));
+
+    pkbuf = ogs_pkbuf_alloc(NULL, TEST_PKT_LEN);
+    ogs_assert(pkbuf);
+    ogs_pkbuf_put(pkbuf, TEST_PKT_LEN);
+    ogs_pfcp_up_handle_pdr(pdr, pkbuf, &report);
+
+    ABTS_INT_EQUAL(tc, 1, far->num_of_buffered_packet);
+    ABTS_INT_EQUAL(tc, 1, report.type.downlink_data_report);
+    ABTS_TRUE(tc, qer->policer.downlink.dropped_packets == 1);
+
+    ogs_pfcp_pdr_remove_all(&sess);
+    ogs_pfcp_far_remove_all(&sess);
+    ogs_pfcp_qer_remove_all(&sess);
+    ogs_pfcp_pool_final(&sess);
+}
+
+abts_suite *test_qer(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, test1_func, NULL);
+    abts_run_test(suite, test2_func, NULL);
+
+    return suite;
+}
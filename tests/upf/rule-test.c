@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "upf/context.h"
+#include "upf/rule-match.h"
+#include "core/abts.h"
+
+#define TEST_UE_IPV4 "10.45.0.2"
+#define TEST_UE_IPV6 "cafe::2"
+
+static ogs_pfcp_pdr_t *test_pdr_add(upf_sess_t *sess,
+        ogs_pfcp_precedence_t precedence, const char *flow_description)
+{
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pfcp_far_t *far = NULL;
+    ogs_pfcp_rule_t *rule = NULL;
+    char buf[OGS_HUGE_LEN];
+    int rv;
+
+    far = ogs_pfcp_far_add(&sess->pfcp);
+    ogs_assert(far);
+    far->dst_if = OGS_PFCP_INTERFACE_ACCESS;
+    far->outer_header_creation.teid = precedence;
+
+    pdr = ogs_pfcp_pdr_add(&sess->pfcp);
+    ogs_assert(pdr);
+    pdr->id = precedence;
+    pdr->src_if = OGS_PFCP_INTERFACE_CORE;
+    ogs_pfcp_pdr_associate_far(pdr, far);
+    ogs_pfcp_pdr_reorder_by_precedence(pdr, precedence);
+
+    if (flow_description) {
+        rule = ogs_pfcp_rule_add(pdr);
+        ogs_assert(rule);
+        ogs_cpystrn(buf, flow_description, sizeof(buf));
+        rv = ogs_ipfw_compile_rule(&rule->ipfw, buf);
+        ogs_assert(rv == OGS_OK);
+    }
+
+    return pdr;
+}
+
+static ogs_pfcp_pdr_t *test_find(int family, uint8_t proto,
+        const char *src, uint16_t sport, const char *dst, uint16_t dport)
+{
+    ogs_pfcp_pdr_t *pdr = NULL;
+    ogs_pkbuf_t *pkbuf = NULL;
+    uint8_t *p = NULL;
+    uint16_t be16;
+    int hlen;
+
+    pkbuf = ogs_pkbuf_alloc(NULL, OGS_MAX_PKT_LEN);
+    ogs_assert(pkbuf);
+    p = pkbuf->data;
+    memset(p, 0, 64);
+
+    if (family == AF_INET) {
+        hlen = 20;
+        p[0] = 0x45;
+        p[9] = proto;
+        ogs_assert(inet_pton(AF_INET, src, p + 12) == 1);
+        ogs_assert(inet_pton(AF_INET, dst, p + 16) == 1);
+    } else {
+        hlen = 40;
+        p[0] = 0x60;
+        be16 = htobe16(8);
+        memcpy(p + 4, &be16, sizeof(be16));
+        p[6] = proto;
+        ogs_assert(inet_pton(AF_INET6, src, p + 8) == 1);
+        ogs_assert(inet_pton(AF_INET6, dst, p + 24) == 1);
+    }
+
+    /* TCP and UDP both start with the source and destination ports */
+    be16 = htobe16(sport);
+    memcpy(p + hlen, &be16, sizeof(be16));
+    be16 = htobe16(dport);
+    memcpy(p + hlen + 2, &be16, sizeof(be16));
+
+    ogs_pkbuf_put(pkbuf, hlen + 20);
+
+    pdr = upf_pdr_find_by_packet(pkbuf);
+    ogs_pkbuf_free(pkbuf);
+
+    return pdr;
+}
+
+static void test1_func(abts_case *tc, void *data)
+{
+    ogs_pfcp_subnet_t *subnet4 = NULL, *subnet6 = NULL;
+    ogs_pfcp_f_seid_t f_seid;
+    ogs_pfcp_ue_ip_addr_t ue_ip;
+    upf_sess_t *sess = NULL;
+    ogs_pfcp_pdr_t *pdr1, *pdr2, *pdr3, *pdr4, *fallback;
+
+    subnet4 = ogs_pfcp_subnet_add("10.45.0.1", "16", NULL, "ogstun-rule");
+    ogs_assert(subnet4);
+    subnet6 = ogs_pfcp_subnet_add("cafe::1", "64", NULL, "ogstun-rule");
+    ogs_assert(subnet6);
+
+    memset(&f_seid, 0, sizeof(f_seid));
+    f_seid.seid = 1;
+    memset(&ue_ip, 0, sizeof(ue_ip));
+    ue_ip.ipv4 = 1;
+    ue_ip.ipv6 = 1;
+    ogs_assert(inet_pton(AF_INET, TEST_UE_IPV4, &ue_ip.both.addr) == 1);
+    ogs_assert(inet_pton(AF_INET6, TEST_UE_IPV6, ue_ip.both.addr6) == 1);
+
+    sess = upf_sess_add(&f_seid, "internet", OGS_GTP_PDN_TYPE_IPV4V6, &ue_ip);
+    ABTS_PTR_NOTNULL(tc, sess);
+
+    /* Added out of order : the walk follows the precedence */
+    pdr3 = test_pdr_add(sess, 30, "permit out tcp from any to any 80");
+    pdr1 = test_pdr_add(sess, 10,
+            "permit out udp from 10.1.1.1/32 5000-5010 to 10.45.0.2/32 2000");
+    fallback = test_pdr_add(sess, 255, NULL);
+    pdr4 = test_pdr_add(sess, 40,
+            "permit out udp from 10.1.1.1/32 to 10.45.0.2/32 53");
+    pdr2 = test_pdr_add(sess, 20,
+            "permit out ip from 10.1.0.0/16 to 10.45.0.2/32");
+
+    upf_classifier_build(sess);
+    ABTS_PTR_NOTNULL(tc, sess->classifier);
+    ABTS_PTR_EQUAL(tc, fallback, sess->classifier->fallback_pdr);
+
+    /* Exact match with port ranges */
+    ABTS_PTR_EQUAL(tc, pdr1, test_find(AF_INET, IPPROTO_UDP,
+                "10.1.1.1", 5005, TEST_UE_IPV4, 2000));
+    ABTS_PTR_EQUAL(tc, pdr1, test_find(AF_INET, IPPROTO_UDP,
+                "10.1.1.1", 5010, TEST_UE_IPV4, 2000));
+
+    /* Out of the port range : the /16 rule of any protocol */
+    ABTS_PTR_EQUAL(tc, pdr2, test_find(AF_INET, IPPROTO_UDP,
+                "10.1.1.1", 5011, TEST_UE_IPV4, 2000));
+    ABTS_PTR_EQUAL(tc, pdr2, test_find(AF_INET, IPPROTO_TCP,
+                "10.1.200.7", 1234, TEST_UE_IPV4, 80));
+
+    /* A later, more specific rule does not win over the precedence */
+    ABTS_PTR_EQUAL(tc, pdr2, test_find(AF_INET, IPPROTO_UDP,
+                "10.1.1.1", 1234, TEST_UE_IPV4, 53));
+
+    /* The rule without address applies to IPv4 and IPv6 */
+    ABTS_PTR_EQUAL(tc, pdr3, test_find(AF_INET, IPPROTO_TCP,
+                "8.8.8.8", 1234, TEST_UE_IPV4, 80));
+    ABTS_PTR_EQUAL(tc, pdr3, test_find(AF_INET6, IPPROTO_TCP,
+                "2001:db8::1", 1234, TEST_UE_IPV6, 80));
+
+    /* No rule matches : the fallback PDR */
+    ABTS_PTR_EQUAL(tc, fallback, test_find(AF_INET, IPPROTO_TCP,
+                "8.8.8.8", 1234, TEST_UE_IPV4, 443));
+    ABTS_PTR_EQUAL(tc, fallback, test_find(AF_INET6, IPPROTO_UDP,
+                "2001:db8::1", 1234, TEST_UE_IPV6, 80));
+
+    /* No session */
+    ABTS_PTR_EQUAL(tc, NULL, test_find(AF_INET, IPPROTO_TCP,
+                "8.8.8.8", 1234, "10.45.0.3", 80));
+    ABTS_PTR_EQUAL(tc, NULL, test_find(AF_INET6, IPPROTO_TCP,
+                "2001:db8::1", 1234, "cafe::3", 80));
+
+    /* Rebuilt after the PDR is removed */
+    ogs_pfcp_pdr_remove(pdr2);
+    upf_classifier_build(sess);
+
+    ABTS_PTR_EQUAL(tc, pdr4, test_find(AF_INET, IPPROTO_UDP,
+                "10.1.1.1", 1234, TEST_UE_IPV4, 53));
+    ABTS_PTR_EQUAL(tc, fallback, test_find(AF_INET, IPPROTO_UDP,
+                "10.1.1.1", 5011, TEST_UE_IPV4, 2000));
+
+    upf_sess_remove(sess);
+
+    ogs_pfcp_subnet_remove(subnet6);
+    ogs_pfcp_subnet_remove(subnet4);
+    ogs_pfcp_dev_remove(ogs_pfcp_dev_find_by_ifname("ogstun-rule"));
+}
+
+abts_suite *test_rule(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, test1_func, NULL);
+
+    return suite;
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2019 by Sukchan Lee <acetcom@gmail.com>
+ *
+ * This file is part of Open5GS.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "upf/context.h"
+#include "upf/worker.h"
+#include "core/abts.h"
+
+static ogs_pfcp_dev_t *test_dev;
+
+static int dispatched;
+static int dispatch_index;
+static ogs_socket_t dispatch_fd;
+static ogs_socket_t dispatch_tun_fd;
+
+static void test_gtpu_handler(short when, ogs_socket_t fd, void *data)
+{
+}
+
+static void test_tun_handler(short when, ogs_socket_t fd, void *data)
+{
+    upf_worker_t *worker = data;
+    char buf[16];
+
+    ogs_assert(worker);
+    if (ogs_read(fd, buf, sizeof buf) <= 0)
+        return;
+
+    dispatch_index = worker->index;
+    dispatch_fd = fd;
+    dispatch_tun_fd = upf_worker_tun_fd(worker, test_dev);
+    ogs_atomic_store(&dispatched, 1);
+}
+
+/* The lowest free descriptor, to find the leaked ones */
+static int next_fd(void)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    ogs_assert(fd >= 0);
+    close(fd);
+
+    return fd;
+}
+
+/* start and stop the workers */
+static void test1_func(abts_case *tc, void *data)
+{
+    int rv, i, fd;
+
+    fd = next_fd();
+
+    for (i = 0; i < 3; i++) {
+        upf_self()->num_of_worker = 4;
+        rv = upf_worker_open(test_gtpu_handler, test_tun_handler);
+        ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+        upf_worker_lock_all();
+        upf_worker_unlock_all();
+
+        upf_worker_close();
+    }
+
+    ABTS_INT_EQUAL(tc, fd, next_fd());
+    upf_self()->num_of_worker = 0;
+}
+
+/* a TUN queue is handled by the worker which owns it */
+static void test2_func(abts_case *tc, void *data)
+{
+    int rv, i;
+    int sv[2];
+
+    rv = socketpair(AF_UNIX, SOCK_DGRAM, 0, sv);
+    ogs_assert(rv == 0);
+
+    test_dev = ogs_pfcp_dev_add("ogstun-test");
+    ogs_assert(test_dev);
+    test_dev->fd = sv[0];
+    ABTS_INT_EQUAL(tc, sv[0], upf_worker_tun_fd(NULL, test_dev));
+
+    dispatched = 0;
+    upf_self()->num_of_worker = 1;
+    rv = upf_worker_open(test_gtpu_handler, test_tun_handler);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+
+    ABTS_INT_EQUAL(tc, 1, write(sv[1], "x", 1));
+    for (i = 0; i < 100 && !ogs_atomic_load(&dispatched); i++)
+        ogs_msleep(10);
+
+    ABTS_INT_EQUAL(tc, 1, ogs_atomic_load(&dispatched));
+    ABTS_INT_EQUAL(tc, 0, dispatch_index);
+    ABTS_INT_EQUAL(tc, sv[0], dispatch_fd);
+    ABTS_INT_EQUAL(tc, sv[0], dispatch_tun_fd);
+
+    upf_worker_close();
+    upf_self()->num_of_worker = 0;
+
+    ogs_pfcp_dev_remove(test_dev);
+    test_dev = NULL;
+    close(sv[0]);
+    close(sv[1]);
+}
+
+/* a failed start releases what the workers have opened */
+static void test3_func(abts_case *tc, void *data)
+{
+    int rv, fd;
+    int sv[2];
+
+    rv = socketpair(AF_UNIX, SOCK_DGRAM, 0, sv);
+    ogs_assert(rv == 0);
+
+    /* The other workers cannot open a queue of an invalid name */
+    test_dev = ogs_pfcp_dev_add("ogstun/none");
+    ogs_assert(test_dev);
+    test_dev->fd = sv[0];
+
+    fd = next_fd();
+
+    upf_self()->num_of_worker = 3;
+    rv = upf_worker_open(test_gtpu_handler, test_tun_handler);
+    ABTS_INT_EQUAL(tc, OGS_ERROR, rv);
+    ABTS_INT_EQUAL(tc, fd, next_fd());
+
+    upf_self()->num_of_worker = 1;
+    rv = upf_worker_open(test_gtpu_handler, test_tun_handler);
+    ABTS_INT_EQUAL(tc, OGS_OK, rv);
+    upf_worker_close();
+    upf_self()->num_of_worker = 0;
+
+    ogs_pfcp_dev_remove(test_dev);
+    test_dev = NULL;
+    close(sv[0]);
+    close(sv[1]);
+}
+
+abts_suite *test_worker(abts_suite *suite)
+{
+    suite = ADD_SUITE(suite)
+
+    abts_run_test(suite, test1_func, NULL);
+    abts_run_test(suite, test2_func, NULL);
+    abts_run_test(suite, test3_func, NULL);
+
+    return suite;
+}